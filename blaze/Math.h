@@ -51,9 +51,12 @@
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/Dispatch.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicSparseMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
+#include <blaze/math/ExpressionGraph.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Functors.h>
 #include <blaze/math/IdentityMatrix.h>
@@ -66,11 +69,18 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/MappedVector.h>
+#include <blaze/math/NoAlias.h>
+#include <blaze/math/NpyMatrix.h>
+#include <blaze/math/NpyVector.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
+#include <blaze/math/SharedMatrix.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
@@ -79,6 +89,7 @@
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/math/TripletBuilder.h>
 #include <blaze/math/TypeTraits.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
@@ -106,6 +106,7 @@
 //             <ul>
 //                <li> \ref schur_product </li>
 //                <li> \ref matrix_product </li>
+//                <li> \ref kronecker_product </li>
 //             </ul>
 //          </li>
 //       </ul>
@@ -123,6 +124,7 @@
 //       <ul>
 //          <li> \ref vector_serialization </li>
 //          <li> \ref matrix_serialization </li>
+//          <li> \ref exchange_formats </li>
 //       </ul>
 //    </li>
 //    <li> \ref customization
@@ -737,6 +739,8 @@
 //  -# <b>\ref vector_types_custom_vector_copy_operations</b>
 //  -# <b>\ref vector_types_custom_vector_alignment</b>
 //  -# <b>\ref vector_types_custom_vector_padding</b>
+//  -# <b>\ref vector_types_custom_vector_mapped_files</b>
+//  -# <b>\ref vector_types_custom_vector_shared_memory</b>
 //
 // \n \subsection vector_types_custom_vector_memory_management Memory Management
 //
@@ -893,7 +897,75 @@
 // exception is thrown.
 //
 // Please also note that \b Blaze will zero initialize the padding elements in order to achieve
-// maximum performance!
+// maximum performance! In case of a const element type the padding elements cannot be modified
+// and are expected to be zero already.
+//
+// \n \subsection vector_types_custom_vector_mapped_files Memory-Mapped Files
+//
+// The blaze::MappedVector and blaze::MappedMatrix class templates are aligned and padded custom
+// vectors and matrices whose elements are stored in a memory-mapped file. They can be included
+// via the header files
+
+   \code
+   #include <blaze/math/MappedVector.h>
+   #include <blaze/math/MappedMatrix.h>
+   \endcode
+
+// A new file is created by specifying the size of the vector or matrix, an existing file is
+// mapped either for reading and writing (\c blaze::readWrite), copy-on-write (\c blaze::copyOnWrite),
+// or read-only (which requires a const element type):
+
+   \code
+   using blaze::MappedVector;
+   using blaze::MappedMatrix;
+
+   MappedMatrix<double> A( "A.bin", 1000UL, 1000UL );  // Creating a new 1000x1000 matrix
+   A = B * C;                                          // All elements are stored in the file
+   A.resize( 2000UL, 1000UL );                         // Growing the matrix and the file
+   A.sync();                                           // Waiting for the write-back to the file
+
+   const MappedMatrix<const double> D( "A.bin" );          // Read-only mapping
+   MappedVector<double> x( "x.bin", blaze::copyOnWrite );  // Private modifications only
+   \endcode
+
+// The elements are only loaded on first access. The advise() and prefetch() member functions
+// give access pattern hints to the operating system; prefetch() starts the read-ahead of all
+// elements in the blocks that are assigned to the individual threads of the SMP backend. Sparse
+// matrices can be stored in and loaded from the same file format via the saveMapped() and
+// loadMapped() functions. Note that memory-mapped files are only supported on POSIX systems.
+//
+// \n \subsection vector_types_custom_vector_shared_memory Shared Memory
+//
+// The blaze::SharedMatrix class template is an aligned and padded custom matrix whose elements
+// are stored in a POSIX shared memory segment, the blaze::SharedCompressedMatrix class template
+// is an immutable sparse matrix in a shared memory segment. Both can be included via the header
+// file
+
+   \code
+   #include <blaze/math/SharedMatrix.h>
+   \endcode
+
+// A segment is created once and can then be attached by any number of processes without copying
+// the elements. Anonymous segments (with an empty name) are attached via their file descriptor,
+// which is for instance inherited by a forked process:
+
+   \code
+   using blaze::SharedMatrix;
+   using blaze::SharedCompressedMatrix;
+
+   SharedMatrix<double> A( "/A", 1000UL, 1000UL, blaze::hugePages );  // Creating a new segment
+   A = B * C;
+
+   const SharedCompressedMatrix<double> S( "/S", D );  // Placing the sparse matrix D in a segment
+
+   // In all other processes
+   const SharedMatrix<const double> A2( "/A" );  // Read-only attachment without copy
+   const SharedCompressedMatrix<double> S2( "/S" );
+   \endcode
+
+// The segments are reference counted: a named segment is removed as soon as the last attached
+// matrix of all processes has been destroyed. Segments of processes that terminated abnormally
+// can be removed manually via the blaze::SharedMemory::remove() function.
 //
 //
 // \n \section vector_types_compressed_vector CompressedVector
@@ -2959,6 +3031,38 @@
 // \note Although \c append() does not allocate new memory, it still invalidates all iterators
 // returned by the \c end() functions!
 //
+// In case the elements are not available in row/column order, as for instance during the
+// assembly of a finite element system matrix, the \c blaze::TripletBuilder class template
+// collects (row, column, value) triplets in arbitrary order, optionally in one buffer per
+// thread, and builds the compressed matrix from all triplets at once. Triplets with the same
+// row and column index are summed up by default:
+
+   \code
+   blaze::TripletBuilder<int> builder( 3UL, 5UL );
+   builder.add( 2, 0, 3 );  // Adding the value 3 in row 2 with column index 0
+   builder.add( 0, 3, 2 );  // Adding the value 2 in row 0 with column index 3
+   builder.add( 0, 1, 1 );  // Adding the value 1 in row 0 with column index 1
+   builder.add( 0, 3, 4 );  // Adding the value 4 in row 0 with column index 3
+
+   blaze::CompressedMatrix<int> M1;
+   builder.build( M1 );  // Results in ( ( 0 1 0 6 0 ) ( 0 0 0 0 0 ) ( 3 0 0 0 0 ) )
+   \endcode
+
+// In case the sparsity pattern keeps changing over time, as for instance during an adaptive
+// mesh refinement, the \c blaze::DynamicSparseMatrix class template stores each row/column in a
+// separate array with slack. Random insertions and erasures therefore only touch a single
+// row/column. A \c DynamicSparseMatrix can be used as operand in all expressions and can be
+// converted into a compressed matrix via its \c finalize() function:
+
+   \code
+   blaze::DynamicSparseMatrix<int> D( 3UL, 5UL, 4UL );  // Slack of 4 elements per row
+   D.add( 0, 3, 2 );  // Adding the value 2 to the element (0,3)
+   D.set( 2, 0, 3 );  // Setting the element (2,0) to 3
+   D.erase( 0, 3 );   // Erasing the element (0,3)
+
+   blaze::CompressedMatrix<int> M2( D.finalize() );  // Results in ( ( 0 0 0 0 0 ) ( 0 0 0 0 0 ) ( 3 0 0 0 0 ) )
+   \endcode
+
 //
 // \n \section matrix_operations_non_modifying_operations Non-Modifying Operations
 // <hr>
@@ -4465,6 +4569,56 @@
    lq( A, L, Q );  // LQ decomposition of A
    \endcode
 
+// \n \subsection matrix_operations_decomposition_householder Native Householder Decompositions
+//
+// In addition to the LAPACK based functions, \b Blaze provides native Householder QR and LQ
+// decompositions, which don't require a LAPACK library. The \c hqr() and \c hlq() functions
+// have the same semantics as \c qr() and \c lq(). Additionally, \c hqr() can compute the
+// compact decomposition in place, in the same format as the LAPACK \c geqrf() function:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A;
+   // ... Resizing and initialization
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> Q, R, L;
+
+   hqr( A, Q, R );  // Native QR decomposition of A
+   hlq( A, L, Q );  // Native LQ decomposition of A
+
+   blaze::DynamicVector<double> tau;
+   hqr( A, tau );   // In-place compact QR decomposition of A
+   \endcode
+
+// Large matrices are decomposed blockwise and the trailing updates are evaluated by the \b Blaze
+// matrix multiplication kernels. Small matrices, as for instance \c StaticMatrix and
+// \c HybridMatrix, are decomposed by an unblocked algorithm without any dynamic memory
+// allocation.
+//
+// Based on the native QR decomposition, the \c solve_ls() functions solve linear systems in the
+// least squares sense. For overdetermined systems they compute the solution that minimizes
+// \f$ \|A x - b\|_2 \f$. For underdetermined systems they compute the minimum norm solution.
+// A batch of small problems can be solved with a single call. In that case the problems are
+// distributed among all available threads:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 10UL );
+   blaze::DynamicVector<double> b( 1000UL );
+   // ... Initialization
+
+   blaze::DynamicVector<double> x( solve_ls( A, b ) );
+
+   using M = blaze::StaticMatrix<double,8UL,3UL>;
+   using B = blaze::StaticVector<double,8UL>;
+   using X = blaze::StaticVector<double,3UL>;
+
+   std::vector< M, blaze::AlignedAllocator<M> > As;
+   std::vector< B, blaze::AlignedAllocator<B> > bs;
+   std::vector< X, blaze::AlignedAllocator<X> > xs;
+   // ... Initialization
+
+   solve_ls( As, xs, bs );  // Solving all systems in parallel
+   \endcode
+
 // \n \section matrix_operations_eigenvalues Eigenvalues/Eigenvectors
 // <hr>
 //
@@ -4570,6 +4724,54 @@
 // LAPACK kernels. Thus the functions can only be used if a fitting LAPACK library is available
 // and linked to the executable. Otherwise a linker error will be created.
 //
+// \n \subsection matrix_operations_eigenvalues_native Native Symmetric Eigensolver
+//
+// For symmetric and Hermitian matrices, \b Blaze additionally provides the native \c eigh()
+// functions, which don't require a LAPACK library:
+
+   \code
+   namespace blaze {
+
+   template< typename MT, bool SO, typename VT, bool TF >
+   void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
+
+   template< typename MT, bool SO, typename VT, bool TF >
+   void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, size_t k );
+
+   template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+   void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V );
+
+   template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+   void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V, size_t k );
+
+   } // namespace blaze
+   \endcode
+
+// The functions compute all or the \a k smallest eigenvalues of the given \a n-by-\a n matrix
+// in ascending order and optionally the corresponding eigenvectors. Only the lower part of \a A is
+// referenced. The eigenvalues are always of floating point type and the eigenvectors are stored
+// in the columns of \a V, independent of the storage order of \a V:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+
+   eigh( A, w );            // Computing all eigenvalues of A
+   eigh( A, w, V );         // Computing all eigenvalues and eigenvectors of A
+   eigh( A, w, V, 10UL );   // Computing the 10 smallest eigenpairs of A
+   \endcode
+
+// The matrix is reduced to tridiagonal form by a blocked Householder algorithm, whose updates
+// are evaluated by the \b Blaze matrix multiplication kernels. All eigenpairs of the tridiagonal
+// matrix are computed by a divide-and-conquer algorithm, which solves independent subproblems
+// in parallel. In case only few eigenpairs are requested, they are computed by bisection and
+// inverse iteration instead. The functions fail if the given matrix is not a square matrix or
+// if \a k exceeds the number of rows of \a A. In both cases a \c std::invalid_argument exception
+// is thrown.
+//
 //
 // \n \section matrix_operations_singularvalues Singular Values/Singular Vectors
 // <hr>
@@ -4675,6 +4877,129 @@
 // means of LAPACK kernels. Thus the functions can only be used if a fitting LAPACK library is
 // available and linked to the executable. Otherwise a linker error will be created.
 //
+// \n \subsection matrix_operations_decompositions_3x3 Decompositions of 3x3 Matrices
+//
+// Many applications in continuum mechanics and computer graphics (as for instance corotational
+// finite elements, shape matching, or point cloud registration) require the decomposition of
+// a very large number of tiny 3x3 matrices. For this purpose, \b Blaze provides the native
+// \c svd3x3(), \c polar3x3(), and \c eigh3x3() functions for 3x3 \c StaticMatrix instances
+// with \c float or \c double element type:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A, U, V, R, S;
+   blaze::StaticVector<double,3UL> s, w;
+   // ... Initialization
+
+   svd3x3( A, U, s, V );  // Singular value decomposition A = U * diag(s) * V
+   polar3x3( A, R, S );   // Polar decomposition A = R * S
+   eigh3x3( S, w, V );    // Eigenvalue decomposition S = V * diag(w) * trans(V)
+   \endcode
+
+// All three functions are based on a fixed number of Jacobi sweeps and don't contain any data
+// dependent branches. \a U, \a V, and \a R are always proper rotations. Thus the singular values
+// are sorted in descending order of their magnitude and the last singular value is negative in
+// case \f$ \det(A) < 0 \f$. In accordance with the \c svd() and \c eigh() functions, the right
+// singular vectors are stored in the rows of \a V, the eigenvalues are sorted in ascending order
+// and only the lower part of the symmetric matrix is referenced.
+//
+// Additionally, all three functions can be applied to a \c std::vector of matrices. In this case
+// each lane of a SIMD vector processes a separate matrix and in case parallelization is enabled,
+// the matrices are distributed among all available threads:
+
+   \code
+   using M = blaze::StaticMatrix<float,3UL,3UL>;
+
+   std::vector< M, blaze::AlignedAllocator<M> > F( 100000UL ), R, S;
+   // ... Initialization
+
+   polar3x3( F, R, S );  // Computing 100000 polar decompositions
+   \endcode
+
+// The output vectors are resized to the number of given matrices.
+//
+//
+// \n \section matrix_operations_iterative_solvers Iterative Solvers
+// <hr>
+//
+// Large sparse linear systems \f$ Ax = b \f$ can be solved by means of the iterative solvers
+// \c cg() (conjugate gradient method for symmetric positive definite matrices), \c bicgstab()
+// (BiCGSTAB method for general matrices) and \c gmres() (restarted GMRES method for general
+// matrices). All solvers work for dense and sparse matrices as well as for adaptors, use the
+// given vector \c x as initial guess, and return a \c SolverResult that contains the number
+// of iterations, the final relative residual norm, and whether the requested tolerance has
+// been reached. Optionally, a \c SolverSettings object and a preconditioner can be specified:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverSettings settings;
+   settings.tolerance     = 1E-10;  // Relative residual norm (default: 1E-8)
+   settings.maxIterations = 500UL;  // Maximum number of iterations (default: 1000)
+   settings.restart       = 50UL;   // Restart length of GMRES (default: 30)
+
+   blaze::cg( A, x, b, settings );                                          // Unpreconditioned CG
+   blaze::cg( A, x, b, blaze::JacobiPreconditioner<double>( A ), settings );  // Jacobi-preconditioned CG
+
+   const blaze::ILU0Preconditioner<double> M( A );  // Incomplete LU decomposition without fill-in
+   const blaze::SolverResult result( blaze::gmres( A, x, b, M, settings ) );
+
+   if( !result.converged ) { ... }
+   \endcode
+
+// The inner loops of the solvers are based on fused kernels, which combine the matrix/vector
+// multiplication with the subsequent dot products and several vector updates with the
+// computation of the residual norm. Thus each vector is streamed from and to main memory as
+// few times as possible. All kernels are parallelized via the active shared memory
+// parallelization (see \ref shared_memory_parallelization).
+//
+//
+// \n \section matrix_operations_sparse_triangular_solve Sparse Triangular Solve
+// <hr>
+//
+// Sparse lower and upper triangular systems \f$ Ax = b \f$ (as for instance the factors of an
+// incomplete factorization) can be solved via forward or backward substitution by means of the
+// \c solve() function. The system matrix has to be a sparse \c LowerMatrix, \c UniLowerMatrix,
+// \c UpperMatrix, or \c UniUpperMatrix. Both a single right-hand side vector and multiple
+// right-hand sides stored in the columns of a dense matrix are supported:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   blaze::DynamicMatrix<double> X, B;
+   // ... Resizing and initialization
+
+   solve( L, x, b );  // Forward substitution with a single right-hand side
+   solve( L, X, B );  // Forward substitution with multiple right-hand sides
+   \endcode
+
+// These functions perform a serial substitution. In order to enable the parallel substitution,
+// the rows of the matrix are grouped into levels of rows that don't depend on each other. This
+// analysis only depends on the sparsity pattern of the matrix and can be stored in a
+// \c LevelSchedule, which can be reused for all subsequent solves with matrices of the same
+// pattern:
+
+   \code
+   const blaze::LevelSchedule schedule( L );
+
+   for( ... ) {
+      // ... Updating the values of L and b
+      solve( L, x, b, schedule );
+   }
+   \endcode
+
+// The attempt to use a schedule with a matrix of a different size or number of non-zero elements
+// results in a \c std::invalid_argument exception. Other changes of the sparsity pattern are only
+// detected in case user assertions are activated (see the \c BLAZE_USER_ASSERTION switch).
+//
+// The levels are processed in order, whereas the rows of each sufficiently large level are
+// distributed among all available threads (see \ref shared_memory_parallelization). Column-major
+// matrices are processed row-wise by means of the positions stored in the level schedule and
+// therefore don't have to be copied. In case of multiple right-hand sides, each update of a row
+// of \a X is vectorized. In case a zero diagonal element is encountered, a \c std::runtime_error
+// exception is thrown.
+//
 //
 // \n Previous: \ref matrix_types &nbsp; &nbsp; Next: \ref adaptors
 */
@@ -7602,6 +7927,34 @@
    auto sv = submatrix<aligned>( A, 0UL, 0UL, 8UL, 8UL );
    \endcode
 
+// \n \section views_submatrices_aliasing Aliasing
+//
+// In case the right-hand side of an assignment to a dense submatrix refers to the underlying
+// matrix, the right-hand side is evaluated into a temporary matrix first. However, submatrices
+// on the same matrix are only considered in case their regions overlap with the target, i.e.
+// the following assignment between disjoint parts of a matrix is performed without temporary:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 16UL, 16UL ), X( 8UL, 8UL );
+   // ... Initialization
+
+   submatrix( A, 0UL, 0UL, 8UL, 8UL ) = submatrix( A, 8UL, 8UL, 8UL, 8UL ) * X;
+   \endcode
+
+// All other references to the underlying matrix (as for instance the matrix itself or a row of
+// the matrix) conservatively enforce a temporary. In case it is known that the right-hand side
+// does not overlap with the target, the \c noalias() function can be used to suppress the
+// temporary for any dense matrix or vector and any dense view:
+
+   \code
+   noalias( submatrix( A, 0UL, 0UL, 8UL, 8UL ) ) = X * trans( submatrix( A, 0UL, 8UL, 8UL, 8UL ) );
+   noalias( subvector( column( A, 15UL ), 0UL, 8UL ) ) = X * subvector( column( A, 0UL ), 8UL, 8UL );
+   \endcode
+
+// Note that noalias() cannot be used on restricted matrices (as for instance LowerMatrix) or
+// views on restricted matrices and that the result of an alias-free assignment to a target that
+// overlaps with the right-hand side is undefined.
+//
 // \n \section views_submatrices_on_symmetric_matrices Submatrices on Symmetric Matrices
 //
 // Submatrices can also be created on symmetric matrices (see the \c SymmetricMatrix class template):
@@ -9020,6 +9373,59 @@
 // as symmetric, Hermitian, lower triangular, upper triangular, or diagonal leads to undefined
 // behavior!
 //
+// Chains of up to six matrix products are not necessarily evaluated in the order given by the
+// expression. Instead, \b Blaze determines the order of evaluation at runtime based on the actual
+// dimensions and number of non-zero elements of the factors and picks the order that requires
+// the least number of operations:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::CompressedMatrix;
+
+   DynamicMatrix<double>    A( 1000UL, 1000UL ), B( 1000UL, 1000UL ), C( 1000UL, 2UL );
+   CompressedMatrix<double> S( 1000UL, 1000UL );
+
+   // ... Initialization of the matrices
+
+   DynamicMatrix<double> D = A * B * C;  // Evaluated as A * ( B * C )
+   DynamicMatrix<double> E = S * A * C;  // Evaluated as S * ( A * C )
+   \endcode
+
+// The reordering can be disabled via the \c BLAZE_USE_CHAIN_REORDERING switch in the
+// <tt>./blaze/config/Optimizations.h</tt> configuration file.
+//
+//
+// \n \section kronecker_product Kronecker Product
+// <hr>
+//
+// The Kronecker product of an \f$ M \times N \f$ matrix \a A and a \f$ P \times Q \f$ matrix \a B
+// can be computed via the \c kron() function. The result is an \f$ MP \times NQ \f$ matrix that
+// is dense in case both operands are dense and sparse otherwise:
+
+   \code
+   blaze::DynamicMatrix<double>    A( 4UL, 3UL ), B( 5UL, 2UL );
+   blaze::CompressedMatrix<double> S( 5UL, 2UL );
+
+   // ... Initialization of the matrices
+
+   blaze::DynamicMatrix<double>    C = kron( A, B );  // Dense 20x6 matrix
+   blaze::CompressedMatrix<double> D = kron( A, S );  // Sparse 20x6 matrix
+   \endcode
+
+// The Kronecker product is never formed explicitly in case it is multiplied with a dense vector.
+// Instead, the multiplication \f$ (A \otimes B) \vec{x} \f$ is computed as the matrix product
+// \f$ A X B^T \f$, where \a X is the vector \f$ \vec{x} \f$ interpreted as row-major
+// \f$ N \times Q \f$ matrix. This reduces both the memory requirements and the number of
+// operations by several orders of magnitude:
+
+   \code
+   blaze::DynamicVector<double> x( 6UL ), y;
+
+   // ... Initialization of the vector
+
+   y = kron( A, B ) * x;  // Computed as A * X * trans( B )
+   \endcode
+
 // \n Previous: \ref matrix_vector_multiplication &nbsp; &nbsp; Next: \ref shared_memory_parallelization
 */
 //*************************************************************************************************
@@ -9132,7 +9538,7 @@
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
 //
-// So far the \b Blaze library does not (yet) automatically initialize dynamic memory according
+// By default the \b Blaze library does not automatically initialize dynamic memory according
 // to the first touch principle. Consider for instance the following vector triad example:
 
    \code
@@ -9181,6 +9587,34 @@
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+// Alternatively, \b Blaze can perform the first touch of large dense vectors and matrices in
+// parallel. In case the \c BLAZE_USE_NUMA_FIRST_TOUCH switch in <tt><blaze/config/SMP.h></tt>
+// is set to 1, the constructors and the \c resize() functions of \c DynamicVector and
+// \c DynamicMatrix initialize the memory of all vectors and matrices that are large enough for
+// a parallel assignment in parallel, using the same partitioning of the data as the parallel
+// assignments. In case \c resize() preserves the old elements, these are copied within the
+// same parallel pass. In combination with the C++11 or Boost thread parallelization, each part
+// of a vector or matrix is even initialized by the same thread that later performs the
+// assignments to it (see also \ref cpp_threads_parallelization). Note however that the parallel
+// first touch does not affect the initialization loops of the application itself, which should
+// therefore not be executed by a single thread:
+
+   \code
+   #define BLAZE_USE_NUMA_FIRST_TOUCH 1
+   #include <blaze/Blaze.h>
+
+   // ...
+
+   // The memory of b, c, and d is initialized in parallel
+   blaze::DynamicVector<double,columnVector> a( N ), b( N, 1.0 ), c( N, 2.0 ), d( N, 3.0 );
+
+   // Performing a vector triad
+   a = b + c * d;
+   \endcode
+
+// The \c firsttouch benchmark of the \b Blaze benchmark suite (blazemark) demonstrates the effect
+// of the parallel first touch initialization for a specific system.
+//
 //
 // \n \section openmp_limitations Limitations of the OpenMP Parallelization
 // <hr>
@@ -9373,6 +9807,40 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_async Asynchronous Assignments
+// <hr>
+//
+// All assignments in \b Blaze are synchronous, i.e. the calling thread is blocked until the
+// assignment has been completed. In order to overlap an assignment with other work (as for
+// instance I/O or an independent expression), the \c asyncAssign() function schedules the
+// assignment for execution by a separate pool of asynchronous threads and returns a
+// \c std::future, which can be used to wait for the completion of the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   std::future<void> f1 = blaze::asyncAssign( C, A * B );
+   std::future<void> f2 = blaze::asyncAssign( y, A * x );
+
+   // ... Independent work
+
+   f1.get();  // Waiting for the completion of C = A * B
+   f2.get();  // Waiting for the completion of y = A * x
+   \endcode
+
+// Each asynchronous assignment is executed serially by a single thread, but independent
+// asynchronous assignments are executed concurrently. An assignment whose right-hand side can
+// alias with the left-hand side in a way that would require an intermediate temporary (as for
+// instance \c x = \c A \c * \c x) is rejected with a \c std::invalid_argument exception.
+// Exceptions thrown during the assignment are rethrown by the \c get() function of the future.
+// Please note that all operands must remain alive and that the left-hand side must not be
+// accessed until the assignment has been completed. Since the asynchronous threads are separate
+// from the threads executing the parallel assignments, a subsequent thread parallel assignment
+// of an independent expression is executed concurrently to the pending asynchronous assignments.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -9613,8 +10081,9 @@
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that the \c BLAZE_SERIAL_SECTION only affects the thread of execution it is used in. Thus
+// it is possible to use serial sections within several concurrent threads (as for instance done
+// by the asynchronous assignments, see \ref cpp_threads_async).
 //
 //
 // \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
@@ -9650,6 +10119,11 @@
 //  - \ref vector_serialization
 //  - \ref matrix_serialization
 //
+// For the exchange of data with other software, vectors and matrices can also be imported from
+// and exported to established file formats:
+//
+//  - \ref exchange_formats
+//
 // \n Previous: \ref serial_execution &nbsp; &nbsp; Next: \ref vector_serialization
 */
 //*************************************************************************************************
@@ -9832,7 +10306,110 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
-// \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref customization \n
+// By default, every non-zero element of a sparse matrix is stored with its full index. For large
+// sparse matrices (as for instance adjacency matrices of graphs) a considerably more compact
+// archive can be written by means of the \c blaze::deltaEncoding:
+
+   \code
+   blaze::CompressedMatrix<float,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "graph.blaze" );
+   serialize( archive, A, blaze::deltaEncoding );
+   \endcode
+
+// In this encoding the gaps between the indices of consecutive non-zero elements are stored as
+// variable-length integers. Additionally, matrices that contain only 1s are stored without any
+// values, 0/1 matrices are stored as bitmask, and matrices with at most 256 distinct values are
+// stored by means of a value dictionary. The encoding and decoding of large matrices is executed
+// in parallel (see \ref shared_memory_parallelization). Archives in the delta encoding are
+// deserialized exactly as all other archives, i.e. via \c operator>>() or the \c deserialize()
+// function.
+//
+// \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref exchange_formats \n
+*/
+//*************************************************************************************************
+
+
+//**Exchange Formats*******************************************************************************
+/*!\page exchange_formats Exchange Formats
+//
+// In contrast to the portable \b Blaze archives, the following functions and classes read and
+// write established exchange formats, which allows to share vectors and matrices with other
+// software, as for instance NumPy/SciPy or the SuiteSparse Matrix Collection.
+//
+// \n \section exchange_formats_numpy NumPy .npy and .npz Files
+//
+// Dense vectors and matrices can be written to and read from NumPy's .npy files via the
+// \c writeNpy() and \c readNpy() functions. One-dimensional arrays correspond to vectors,
+// two-dimensional arrays to matrices. Row-major matrices are written in C order, column-major
+// matrices in Fortran order, but both orders can be read into matrices of any storage order.
+// In case the dtype of the array differs from the element type of the target, the elements are
+// converted (including a possibly different byte order):
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100UL, 50UL );
+   // ... Initialization
+
+   blaze::writeNpy( "A.npy", A );  // Equivalent to numpy.save( "A.npy", A )
+
+   blaze::DynamicMatrix<float,blaze::columnMajor> B;
+   blaze::readNpy( "A.npy", B );   // Equivalent to B = numpy.load( "A.npy" )
+   \endcode
+
+// Several arrays can be combined in a .npz archive via the NpzWriter class and can be accessed
+// by name via the NpzArchive class:
+
+   \code
+   {
+      blaze::NpzWriter writer( "data.npz" );  // Equivalent to numpy.savez( "data.npz", A=A, x=x )
+      writer.write( "A", A );
+      writer.write( "x", x );
+   }
+
+   blaze::NpzArchive archive( "data.npz" );
+   archive.read( "A", B );
+   \endcode
+
+// Since the arrays within a .npz archive are used in place, only uncompressed archives (as
+// created by \c numpy.savez()) are supported.
+//
+// In order to avoid any copy operation, the NpyVector and NpyMatrix class templates directly
+// refer to the elements of a memory-mapped .npy file or to an array of a .npz archive. Both
+// are custom vectors/matrices (see \ref vector_types_custom_vector) that can be used in all
+// operations:
+
+   \code
+   const blaze::NpyMatrix<const double,blaze::rowMajor> C( "A.npy" );       // Read-only mapping
+   blaze::NpyMatrix<double,blaze::rowMajor> D( "A.npy", blaze::readWrite );  // Persistent modifications
+   blaze::NpyMatrix<double,blaze::rowMajor> E( archive, "A" );               // Mapping of an archive entry
+
+   blaze::DynamicVector<double> y( C * x );
+   \endcode
+
+// The mapping is zero-copy in case the dtype, the order, and the alignment of the array match
+// the element type and the storage order of the vector/matrix. Otherwise the elements are
+// converted into an internal buffer (see the \c isMapped() function).
+//
+// \n \section exchange_formats_matrix_market Matrix Market Files
+//
+// Sparse matrices can be written to and read from files in the coordinate format of the Matrix
+// Market exchange format via the \c writeMatrixMarket() and \c readMatrixMarket() functions.
+// All fields (\c real, \c integer, \c complex, and \c pattern) and all symmetry structures
+// (\c general, \c symmetric, \c skew-symmetric, and \c hermitian) are supported:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "A.mtx", A );
+
+   blaze::writeMatrixMarket( "AtA.mtx", trans( A ) * A );
+   \endcode
+
+// The file is parsed in parallel by all threads of the active SMP backend and the compressed
+// matrix is built in a single pass. Therefore reading a large Matrix Market file is
+// considerably faster than inserting the elements one by one.
+//
+// \n Previous: \ref matrix_serialization &nbsp; &nbsp; Next: \ref customization \n
 */
 //*************************************************************************************************
 
@@ -9848,7 +10425,7 @@
 //  - \ref vector_and_matrix_customization
 //  - \ref error_reporting_customization
 //
-// \n Previous: \ref matrix_serialization &nbsp; &nbsp; Next: \ref configuration_files
+// \n Previous: \ref exchange_formats &nbsp; &nbsp; Next: \ref configuration_files
 */
 //*************************************************************************************************
 
@@ -10002,6 +10579,93 @@
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// By default, the instruction set used for the vectorization is fixed at compile time (for
+// instance via the \c -mavx2 compiler flag). In order to build a single executable for several
+// CPU generations, it is possible to additionally compile the most performance critical compute
+// kernels (i.e. the dense matrix multiplication, the dense vector inner product, the addition
+// and subtraction of scaled dense vectors, and the sparse matrix/dense vector multiplication)
+// for the SSE4, AVX2, and AVX-512 instruction sets and to select the best variant for the
+// executing CPU at runtime. This runtime dispatch is enabled via the \c BLAZE_USE_RUNTIME_DISPATCH
+// switch in the configuration file <tt>./blaze/config/Vectorization.h</tt>:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   \endcode
+
+// The selected instruction set can be queried via the \c getInstructionSet() function and can
+// be restricted via the \c setInstructionSet() function or the \c BLAZE_INSTRUCTION_SET
+// environment variable (\c "generic", \c "sse4", \c "avx2", or \c "avx512"):
+
+   \code
+   blaze::setInstructionSet( blaze::isaAVX2 );  // Avoid the AVX-512 kernels
+   \endcode
+
+// Note that the runtime dispatch is only available for GNU and Clang compatible compilers on
+// x86 platforms.
+//
+// The exponential, logarithm, power, sine, cosine, hyperbolic tangent, and error functions
+// (for instance in \c map( A, exp ) or \c exp( A )) are vectorized via the Intel SVML, if
+// available. Without the SVML, \b Blaze uses built-in polynomial approximations for the SSE2,
+// AVX, and AVX-512 instruction sets, which deviate from the results of the scalar functions of
+// the standard library by at most 3 ULP. This SIMD approximation can be deactivated via the
+// \c BLAZE_USE_SIMD_APPROXIMATION switch in the configuration file
+// <tt>./blaze/config/Vectorization.h</tt>:
+
+   \code
+   #define BLAZE_USE_SIMD_APPROXIMATION 0
+   \endcode
+
+// Operations that combine single and double precision operands can in general not be vectorized,
+// since the SIMD vectors of both data types contain a different number of elements. However,
+// for the most important mixed precision operations \b Blaze provides dedicated SIMD kernels
+// that convert the single precision operand on the fly and accumulate in double precision:
+// the inner product of two dense vectors, the multiplication of a dense matrix with a dense
+// vector (with a double precision target vector), and the assignment of a dense vector to a
+// \c DynamicVector with a different floating point element type:
+
+   \code
+   blaze::DynamicMatrix<float,blaze::columnMajor> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization
+
+   y = A * x;                                     // Vectorized, accumulation in double precision
+   const double d = dot( x, column( A, 0UL ) );  // Vectorized, accumulation in double precision
+   blaze::DynamicVector<float> z( x );            // Vectorized conversion to single precision
+   \endcode
+
+// Additionally, \b Blaze provides the two 16-bit floating point storage types \c blaze::bfloat16
+// (with the exponent range of \c float) and \c blaze::float16 (IEEE 754 half precision). Both
+// types can be stored in all dense vectors and matrices and are converted to and from \c float
+// via SIMD operations (for \c float16 this requires the F16C or AVX-512 instruction set). The
+// inner product, the dense matrix/dense vector multiplication, and the dense matrix/dense matrix
+// multiplication with 16-bit operands and a single precision target are vectorized, whereas all
+// computations are performed in single precision:
+
+   \code
+   blaze::DynamicMatrix<blaze::bfloat16> A( 1000UL, 1000UL ), B( 1000UL, 1000UL );
+   blaze::DynamicVector<blaze::float16> x( 1000UL );
+   // ... Initialization
+
+   blaze::DynamicMatrix<float> C( A * B );  // Vectorized, accumulation in single precision
+   blaze::DynamicVector<float> y( A * x );  // Vectorized, accumulation in single precision
+   \endcode
+
+// The multiplication of two dense matrices with 8-bit or 16-bit integral elements (\c int8_t,
+// \c uint8_t, or \c int16_t) into a dense matrix with 32-bit integral elements accumulates all
+// products in 32-bit integral values (instead of the 8-bit or 16-bit element type of the
+// operands). For quantized computations the \c qmmm() function additionally provides the
+// scaling of the integral products by per-row and per-column scaling factors:
+
+   \code
+   blaze::DynamicMatrix<int8_t> A( 1000UL, 1000UL ), B( 1000UL, 1000UL );
+   blaze::DynamicVector<float> rs( 1000UL ), cs( 1000UL );
+   // ... Initialization
+
+   blaze::DynamicMatrix<int32_t> C( A * B );  // Vectorized, accumulation in 32-bit integers
+   blaze::DynamicMatrix<float> D;
+   blaze::qmmm( D, A, B, rs, cs );            // D(i,j) = rs[i] * cs[j] * C(i,j)
+   \endcode
+
 //
 // \n \section thresholds Thresholds
 // <hr>
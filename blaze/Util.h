@@ -46,6 +46,7 @@
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AsConst.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/CheckedDelete.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
@@ -55,12 +56,14 @@
 #include <blaze/util/EmptyType.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Indices.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InputString.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
+#include <blaze/util/MappedFile.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
@@ -72,6 +75,7 @@
 #include <blaze/util/Policies.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/Serialization.h>
+#include <blaze/util/SharedMemory.h>
 #include <blaze/util/Singleton.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
@@ -120,3 +120,32 @@
 #define BLAZE_USE_OPTIMIZED_KERNELS 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the runtime reordering of matrix product chains.
+// \ingroup config
+//
+// This configuration switch enables/disables the runtime reordering of chained matrix/matrix
+// multiplications (as for instance \f$ A*B*C*D \f$). In case the switch is set to \a true the
+// order of evaluation of a chain of up to six matrix factors is chosen at runtime by means of
+// a matrix-chain dynamic program based on the actual dimensions and number of non-zero elements
+// of the factors. In case the switch is set to \a false all chains are evaluated in the order
+// given by the expression.
+//
+// Possible settings for the chain reordering:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the chain reordering via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_CHAIN_REORDERING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_CHAIN_REORDERING
+#define BLAZE_USE_CHAIN_REORDERING 1
+#endif
+//*************************************************************************************************
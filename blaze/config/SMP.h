@@ -58,3 +58,36 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first touch initialization of large dense containers.
+// \ingroup config
+//
+// This compilation switch enables/disables the parallel first touch initialization of large
+// dense vectors and matrices. On NUMA systems the operating system usually places a memory page
+// on the NUMA node of the thread that first writes to the page. By default, the dense vectors
+// and matrices of the Blaze library are initialized by the thread that creates or resizes them,
+// which places all memory pages of a vector or matrix on a single NUMA node. In case the switch
+// is set to 1, the memory of large dense vectors and matrices (i.e. vectors and matrices that
+// are large enough for an SMP assignment) is initialized in parallel, using the same partitioning
+// and the same threads as the SMP assignments. Thus subsequent parallel operations primarily
+// access memory on their local NUMA node. Note that the switch only has an effect in case the
+// shared-memory parallelization is enabled.
+//
+// Possible settings for the first touch initialization switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the parallel first touch initialization via command line
+// or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_NUMA_FIRST_TOUCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_NUMA_FIRST_TOUCH
+#define BLAZE_USE_NUMA_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
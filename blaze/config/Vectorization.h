@@ -62,3 +62,66 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of the performance critical compute kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime selection of the instruction set for
+// the performance critical compute kernels of the Blaze library. In case the switch is set to
+// 1, the dense matrix multiplication kernel, the dense vector inner product, the addition and
+// subtraction assignment of scaled dense vectors, and the sparse matrix/dense vector product
+// are compiled for the SSE4, AVX2, and AVX-512 instruction sets in addition to the instruction
+// set selected at compile time. The best variant supported by the executing CPU is selected
+// once at startup. This allows to build a single executable for a baseline instruction set
+// (for instance SSE4) that nonetheless exploits the wider SIMD registers of newer CPUs. In case
+// the switch is set to 0, only the instruction set selected at compile time is used.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note The runtime dispatch is only available for GNU and Clang compatible compilers on x86
+// platforms and is ignored in case vectorization is disabled. It is possible to (de-)activate
+// the runtime dispatch via command line or by defining this symbol manually before including
+// any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the built-in SIMD approximation of transcendental functions.
+// \ingroup config
+//
+// This compilation switch enables/disables the built-in SIMD approximation of the exp(), log(),
+// pow(), sin(), cos(), tanh(), and erf() functions. In case the switch is set to 1 and the Intel
+// SVML is not available, these functions are vectorized for SSE2, AVX, and AVX-512 by means of
+// polynomial approximations with a maximum error of a few ULP (see the \c SIMDApproximation
+// class template). In case the switch is set to 0, these functions are only vectorized via the
+// SVML; otherwise the Blaze library chooses default, non-vectorized functionality.
+//
+// Possible settings for the SIMD approximation switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the SIMD approximation via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_SIMD_APPROXIMATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_SIMD_APPROXIMATION
+#define BLAZE_USE_SIMD_APPROXIMATION 1
+#endif
+//*************************************************************************************************
@@ -47,7 +47,11 @@
 #include <blaze/math/adaptors/UpperMatrix.h>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/Eigh.h>
+#include <blaze/math/dense/Householder.h>
+#include <blaze/math/dense/IntegerMMM.h>
 #include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/Jacobi3x3.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/LQ.h>
 #include <blaze/math/dense/LU.h>
@@ -63,6 +67,7 @@
 #include <blaze/math/expressions/DMatDeclUppExpr.h>
 #include <blaze/math/expressions/DMatDetExpr.h>
 #include <blaze/math/expressions/DMatDMatAddExpr.h>
+#include <blaze/math/expressions/DMatDMatKronExpr.h>
 #include <blaze/math/expressions/DMatDMatMapExpr.h>
 #include <blaze/math/expressions/DMatDMatMultExpr.h>
 #include <blaze/math/expressions/DMatDMatSchurExpr.h>
@@ -89,6 +94,7 @@
 #include <blaze/math/expressions/DMatTSMatMultExpr.h>
 #include <blaze/math/expressions/DMatTSMatSubExpr.h>
 #include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/KronDVecMultExpr.h>
 #include <blaze/math/expressions/SMatDMatMultExpr.h>
 #include <blaze/math/expressions/SMatDMatSubExpr.h>
 #include <blaze/math/expressions/SMatTDMatMultExpr.h>
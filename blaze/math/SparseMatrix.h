@@ -46,6 +46,7 @@
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatSMatKronExpr.h>
 #include <blaze/math/expressions/DMatSMatSchurExpr.h>
 #include <blaze/math/expressions/DMatTSMatSchurExpr.h>
 #include <blaze/math/expressions/DVecSVecOuterExpr.h>
@@ -54,6 +55,7 @@
 #include <blaze/math/expressions/SMatDeclLowExpr.h>
 #include <blaze/math/expressions/SMatDeclSymExpr.h>
 #include <blaze/math/expressions/SMatDeclUppExpr.h>
+#include <blaze/math/expressions/SMatDMatKronExpr.h>
 #include <blaze/math/expressions/SMatDMatSchurExpr.h>
 #include <blaze/math/expressions/SMatDVecMultExpr.h>
 #include <blaze/math/expressions/SMatEvalExpr.h>
@@ -62,6 +64,7 @@
 #include <blaze/math/expressions/SMatScalarMultExpr.h>
 #include <blaze/math/expressions/SMatSerialExpr.h>
 #include <blaze/math/expressions/SMatSMatAddExpr.h>
+#include <blaze/math/expressions/SMatSMatKronExpr.h>
 #include <blaze/math/expressions/SMatSMatMultExpr.h>
 #include <blaze/math/expressions/SMatSMatSchurExpr.h>
 #include <blaze/math/expressions/SMatSMatSubExpr.h>
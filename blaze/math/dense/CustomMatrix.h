@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Padding.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -833,10 +834,8 @@ inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n,
    }
 
    if( PF && IsVectorizable<Type>::value ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
+      for( size_t i=0UL; i<m_; ++i )
+         clearPadding( v_+i*nn_+n_, v_+(i+1UL)*nn_ );
    }
 }
 //*************************************************************************************************
@@ -3673,9 +3672,7 @@ inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t
 
    if( PF && IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
-         for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
-      }
+         clearPadding( v_+j*mm_+m_, v_+(j+1UL)*mm_ );
    }
 }
 /*! \endcond */
@@ -6521,13 +6518,13 @@ struct BinaryMapTrait< CustomMatrix<T1,AF1,PF1,SO1>, CustomMatrix<T2,AF2,PF2,SO2
 template< typename T, bool AF, bool PF, bool SO, size_t I, size_t J, size_t M, size_t N >
 struct SubmatrixTrait< CustomMatrix<T,AF,PF,SO>, I, J, M, N >
 {
-   using Type = StaticMatrix<T,M,N,SO>;
+   using Type = StaticMatrix<RemoveConst_<T>,M,N,SO>;
 };
 
 template< typename T, bool AF, bool PF, bool SO >
 struct SubmatrixTrait< CustomMatrix<T,AF,PF,SO> >
 {
-   using Type = DynamicMatrix<T,SO>;
+   using Type = DynamicMatrix<RemoveConst_<T>,SO>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6546,7 +6543,7 @@ struct SubmatrixTrait< CustomMatrix<T,AF,PF,SO> >
 template< typename T, bool AF, bool PF, bool SO, size_t... CRAs >
 struct RowTrait< CustomMatrix<T,AF,PF,SO>, CRAs... >
 {
-   using Type = DynamicVector<T,true>;
+   using Type = DynamicVector<RemoveConst_<T>,true>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6565,7 +6562,7 @@ struct RowTrait< CustomMatrix<T,AF,PF,SO>, CRAs... >
 template< typename T, bool AF, bool PF, bool SO, size_t... CRAs >
 struct RowsTrait< CustomMatrix<T,AF,PF,SO>, CRAs... >
 {
-   using Type = DynamicMatrix<T,false>;
+   using Type = DynamicMatrix<RemoveConst_<T>,false>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6584,7 +6581,7 @@ struct RowsTrait< CustomMatrix<T,AF,PF,SO>, CRAs... >
 template< typename T, bool AF, bool PF, bool SO, size_t... CCAs >
 struct ColumnTrait< CustomMatrix<T,AF,PF,SO>, CCAs... >
 {
-   using Type = DynamicVector<T,false>;
+   using Type = DynamicVector<RemoveConst_<T>,false>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6603,7 +6600,7 @@ struct ColumnTrait< CustomMatrix<T,AF,PF,SO>, CCAs... >
 template< typename T, bool AF, bool PF, bool SO, size_t... CCAs >
 struct ColumnsTrait< CustomMatrix<T,AF,PF,SO>, CCAs... >
 {
-   using Type = DynamicMatrix<T,true>;
+   using Type = DynamicMatrix<RemoveConst_<T>,true>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6622,7 +6619,7 @@ struct ColumnsTrait< CustomMatrix<T,AF,PF,SO>, CCAs... >
 template< typename T, bool AF, bool PF, bool SO, ptrdiff_t... CBAs >
 struct BandTrait< CustomMatrix<T,AF,PF,SO>, CBAs... >
 {
-   using Type = DynamicVector<T,defaultTransposeFlag>;
+   using Type = DynamicVector<RemoveConst_<T>,defaultTransposeFlag>;
 };
 /*! \endcond */
 //*************************************************************************************************
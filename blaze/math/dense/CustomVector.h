@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Padding.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -3019,8 +3020,7 @@ inline CustomVector<Type,AF,padded,TF>::CustomVector( Type* ptr, size_t n, size_
    }
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
+      clearPadding( v_+size_, v_+capacity_ );
    }
 }
 /*! \endcond */
@@ -5259,13 +5259,13 @@ struct BinaryMapTrait< CustomVector<T1,AF1,PF1,TF>, CustomVector<T2,AF2,PF2,TF>,
 template< typename T, bool AF, bool PF, bool TF, size_t I, size_t N >
 struct SubvectorTrait< CustomVector<T,AF,PF,TF>, I, N >
 {
-   using Type = StaticVector<T,N,TF>;
+   using Type = StaticVector<RemoveConst_<T>,N,TF>;
 };
 
 template< typename T, bool AF, bool PF, bool TF >
 struct SubvectorTrait< CustomVector<T,AF,PF,TF> >
 {
-   using Type = DynamicVector<T,TF>;
+   using Type = DynamicVector<RemoveConst_<T>,TF>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5284,13 +5284,13 @@ struct SubvectorTrait< CustomVector<T,AF,PF,TF> >
 template< typename T, bool AF, bool PF, bool TF, size_t... CEAs >
 struct ElementsTrait< CustomVector<T,AF,PF,TF>, CEAs... >
 {
-   using Type = StaticVector<T,sizeof...(CEAs),TF>;
+   using Type = StaticVector<RemoveConst_<T>,sizeof...(CEAs),TF>;
 };
 
 template< typename T, bool AF, bool PF, bool TF >
 struct ElementsTrait< CustomVector<T,AF,PF,TF> >
 {
-   using Type = DynamicVector<T,TF>;
+   using Type = DynamicVector<RemoveConst_<T>,TF>;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -47,6 +47,8 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MixedPrecision.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -77,8 +79,10 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConversion.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
 #include <blaze/math/typetraits/HighType.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -98,6 +102,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -115,9 +120,11 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -387,6 +394,30 @@ class DynamicMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct ConversionAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            HasSIMDConversion< ElementType_<MT>, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            HasSIMDTranspose< ElementType_<MT>, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -460,12 +491,21 @@ class DynamicMatrix
    BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
 
    template< typename MT >
-   inline DisableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,SO>& rhs );
+   inline DisableIf_< Or< VectorizedAssign<MT>, ConversionAssign<MT> > >
+      assign( const DenseMatrix<MT,SO>& rhs );
 
    template< typename MT >
    inline EnableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,SO>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline EnableIf_<ConversionAssign<MT> > assign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline DisableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline EnableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -571,7 +611,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the parallel first touch initialization
+// is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large matrices
+// of built-in data type are default initialized in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -582,6 +624,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, Type() );
+   }
+
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
@@ -602,7 +648,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first
+// touch initialization is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements
+// of large matrices of built-in data type are initialized in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -613,14 +661,19 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[i*nn_+j] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i )
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
-      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -1752,6 +1805,11 @@ inline void DynamicMatrix<Type,SO>::clear()
 // ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+// Note that in case the parallel first touch initialization is activated (see the
+// \c BLAZE_USE_NUMA_FIRST_TOUCH switch), newly allocated memory of large matrices of built-in
+// data type is initialized in parallel. In this case the preserved elements are copied within
+// the same parallel pass, i.e. every element of the new array is written exactly once by the
+// thread that later works on it.
 //
 // The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ matrix to a
 // \f$ 4 \times 2 \f$ matrix. The new, uninitialized elements are marked with \a x:
@@ -1782,6 +1840,39 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    const size_t nn( addPadding( n ) );
 
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value && preserve )
+   {
+      // Allocating a new array
+      DynamicMatrix tmp;
+      tmp.capacity_ = m*nn;
+      tmp.v_        = allocate<Type>( tmp.capacity_ );
+      tmp.m_        = m;
+      tmp.n_        = n;
+      tmp.nn_       = nn;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=n; j<nn; ++j ) {
+               tmp.v_[i*nn+j] = Type();
+            }
+         }
+      }
+
+      // Initializing the new array in parallel, writing each element exactly once
+      smpInitialize( tmp, *this, Type() );
+
+      swap( tmp );
+      return;
+   }
+
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value && m*nn > capacity_ )
+   {
+      // Allocating and initializing a new array in parallel
+      DynamicMatrix tmp( m, n );
+      swap( tmp );
+      return;
+   }
+
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
@@ -1946,6 +2037,16 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by swapping blocks of elements. Rectangular matrices are
+// transposed within the existing allocation, which requires an auxiliary buffer of only
+// \f$ \max(M,N) \f$ elements instead of a full temporary matrix. In case the capacity of the
+// matrix does not suffice for the padded transposed matrix (as for instance for a row-major
+// \f$ 1000001 \times 32 \f$ matrix of double precision values without spare capacity), the
+// capacity is increased accordingly first (see the reserve() function). Since the capacity is
+// never reduced, the matrix can afterwards be transposed back and forth without reallocation.\n
+// Both the additional capacity and the auxiliary buffer are allocated before any element is
+// moved. Therefore the matrix remains unchanged in case an allocation fails.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -1971,8 +2072,31 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
-      this->swap( tmp );
+      const size_t nn( addPadding( m_ ) );
+
+      reserve( n_*nn );
+
+      transposeInPlace( v_, m_, n_, [this]() {
+         if( nn_ != n_ ) {
+            for( size_t i=1UL; i<m_; ++i ) {
+               std::move( v_+i*nn_, v_+i*nn_+n_, v_+i*n_ );
+            }
+         }
+      } );
+      swap( m_, n_ );
+
+      if( nn != n_ ) {
+         for( size_t i=m_; i-->1UL; ) {
+            std::move_backward( v_+i*n_, v_+i*n_+n_, v_+i*nn+n_ );
+         }
+         for( size_t i=0UL; i<m_; ++i ) {
+            for( size_t j=n_; j<nn; ++j ) {
+               v_[i*nn+j] = Type();
+            }
+         }
+      }
+
+      nn_ = nn;
    }
 
    return *this;
@@ -2013,8 +2137,13 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            conjugate( v_[i*nn_+j] );
+         }
+      }
    }
 
    return *this;
@@ -2422,7 +2551,8 @@ BLAZE_ALWAYS_INLINE void
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+inline DisableIf_< Or< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT>
+                     , typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE ConversionAssign<MT> > >
    DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2514,6 +2644,34 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix with a
+//        different floating point precision.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE ConversionAssign<MT> >
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      mixedConvert( v_+i*nn_, (~rhs).data(i), n_ );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
 //
@@ -2528,7 +2686,8 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2552,6 +2711,33 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), v_, nn_, n_, m_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3432,6 +3618,26 @@ class DynamicMatrix<Type,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct ConversionAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            HasSIMDConversion< ElementType_<MT>, Type >::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<MT>::value &&
+                            HasSIMDTranspose< ElementType_<MT>, Type >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    template< typename MT >
@@ -3499,12 +3705,21 @@ class DynamicMatrix<Type,true>
    BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
 
    template< typename MT >
-   inline DisableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,true>& rhs );
+   inline DisableIf_< Or< VectorizedAssign<MT>, ConversionAssign<MT> > >
+      assign( const DenseMatrix<MT,true>& rhs );
 
    template< typename MT >
    inline EnableIf_<VectorizedAssign<MT> > assign( const DenseMatrix<MT,true>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline EnableIf_<ConversionAssign<MT> > assign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT >
+   inline DisableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline EnableIf_<TransposeAssign<MT> > assign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -3614,6 +3829,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, Type() );
+   }
+
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
@@ -3636,7 +3855,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first
+// touch initialization is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements
+// of large matrices of built-in data type are initialized in parallel.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -3646,14 +3867,19 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, init );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[i+j*mm_] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i )
             v_[i+j*mm_] = Type();
-      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -4807,6 +5033,11 @@ inline void DynamicMatrix<Type,true>::clear()
 // ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true. However, new matrix elements are not initialized!
+// Note that in case the parallel first touch initialization is activated (see the
+// \c BLAZE_USE_NUMA_FIRST_TOUCH switch), newly allocated memory of large matrices of built-in
+// data type is initialized in parallel. In this case the preserved elements are copied within
+// the same parallel pass, i.e. every element of the new array is written exactly once by the
+// thread that later works on it.
 //
 // The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ matrix to a
 // \f$ 4 \times 2 \f$ matrix. The new, uninitialized elements are marked with \a x:
@@ -4836,6 +5067,39 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    const size_t mm( addPadding( m ) );
 
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value && preserve )
+   {
+      // Allocating a new array
+      DynamicMatrix tmp;
+      tmp.capacity_ = mm*n;
+      tmp.v_        = allocate<Type>( tmp.capacity_ );
+      tmp.m_        = m;
+      tmp.mm_       = mm;
+      tmp.n_        = n;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            for( size_t i=m; i<mm; ++i ) {
+               tmp.v_[i+j*mm] = Type();
+            }
+         }
+      }
+
+      // Initializing the new array in parallel, writing each element exactly once
+      smpInitialize( tmp, *this, Type() );
+
+      swap( tmp );
+      return;
+   }
+
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value && mm*n > capacity_ )
+   {
+      // Allocating and initializing a new array in parallel
+      DynamicMatrix tmp( m, n );
+      swap( tmp );
+      return;
+   }
+
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
@@ -5007,6 +5271,16 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by swapping blocks of elements. Rectangular matrices are
+// transposed within the existing allocation, which requires an auxiliary buffer of only
+// \f$ \max(M,N) \f$ elements instead of a full temporary matrix. In case the capacity of the
+// matrix does not suffice for the padded transposed matrix (as for instance for a column-major
+// \f$ 32 \times 1000001 \f$ matrix of double precision values without spare capacity), the
+// capacity is increased accordingly first (see the reserve() function). Since the capacity is
+// never reduced, the matrix can afterwards be transposed back and forth without reallocation.\n
+// Both the additional capacity and the auxiliary buffer are allocated before any element is
+// moved. Therefore the matrix remains unchanged in case an allocation fails.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
@@ -5031,8 +5305,31 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
-      this->swap( tmp );
+      const size_t mm( addPadding( n_ ) );
+
+      reserve( mm*m_ );
+
+      transposeInPlace( v_, n_, m_, [this]() {
+         if( mm_ != m_ ) {
+            for( size_t j=1UL; j<n_; ++j ) {
+               std::move( v_+j*mm_, v_+j*mm_+m_, v_+j*m_ );
+            }
+         }
+      } );
+      swap( m_, n_ );
+
+      if( mm != m_ ) {
+         for( size_t j=n_; j-->1UL; ) {
+            std::move_backward( v_+j*m_, v_+j*m_+m_, v_+j*mm+m_ );
+         }
+         for( size_t j=0UL; j<n_; ++j ) {
+            for( size_t i=m_; i<mm; ++i ) {
+               v_[i+j*mm] = Type();
+            }
+         }
+      }
+
+      mm_ = mm;
    }
 
    return *this;
@@ -5074,8 +5371,13 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      this->swap( tmp );
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            conjugate( v_[i+j*mm_] );
+         }
+      }
    }
 
    return *this;
@@ -5490,7 +5792,8 @@ BLAZE_ALWAYS_INLINE void
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+inline DisableIf_< Or< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT>
+                     , typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE ConversionAssign<MT> > >
    DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -5583,6 +5886,34 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
 /*! \endcond */
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix with a
+//        different floating point precision.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE ConversionAssign<MT> >
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      mixedConvert( v_+j*mm_, (~rhs).data(j), m_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -5598,7 +5929,8 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5623,6 +5955,34 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE TransposeAssign<MT> >
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), v_, mm_, m_, n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
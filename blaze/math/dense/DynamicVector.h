@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MixedPrecision.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -70,6 +71,7 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConversion.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
@@ -86,6 +88,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Transfer.h>
@@ -100,9 +103,11 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 
@@ -346,6 +351,18 @@ class DynamicVector
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct ConversionAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasConstDataAccess<VT>::value &&
+                            HasSIMDConversion< ElementType_<VT>, Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -430,11 +447,15 @@ class DynamicVector
    BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
 
    template< typename VT >
-   inline DisableIf_<VectorizedAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
+   inline DisableIf_< Or< VectorizedAssign<VT>, ConversionAssign<VT> > >
+      assign( const DenseVector<VT,TF>& rhs );
 
    template< typename VT >
    inline EnableIf_<VectorizedAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
 
+   template< typename VT >
+   inline EnableIf_<ConversionAssign<VT> > assign( const DenseVector<VT,TF>& rhs );
+
    template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
 
    template< typename VT >
@@ -530,7 +551,9 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 // \param n The size of the vector.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the parallel first touch initialization
+// is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements of large vectors
+// of built-in data type are default initialized in parallel.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -539,6 +562,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, Type() );
+   }
+
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
@@ -555,7 +582,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In case the parallel first
+// touch initialization is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), the elements
+// of large vectors of built-in data type are initialized in parallel.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -564,8 +593,13 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value ) {
+      smpInitialize( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -1501,7 +1535,11 @@ inline void DynamicVector<Type,TF>::clear()
 // this function may invalidate all existing views (subvectors, ...) on the vector if it is
 // used to shrink the vector. Additionally, the resize operation potentially changes all vector
 // elements. In order to preserve the old vector values, the \a preserve flag can be set to
-// \a true. However, new vector elements are not initialized!
+// \a true. However, new vector elements are not initialized! Note that in case the parallel
+// first touch initialization is activated (see the \c BLAZE_USE_NUMA_FIRST_TOUCH switch), newly
+// allocated memory of large vectors of built-in data type is initialized in parallel. In this
+// case the preserved elements are copied within the same parallel pass, i.e. every element of
+// the new array is written exactly once by the thread that later works on it.
 //
 // The following example illustrates the resize operation of a vector of size 2 to a vector of
 // size 4. The new, uninitialized elements are marked with \a x:
@@ -1522,7 +1560,31 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 {
-   if( n > capacity_ )
+   if( BLAZE_NUMA_FIRST_TOUCH_MODE && IsBuiltin<Type>::value && n > capacity_ )
+   {
+      // Allocating a new array
+      DynamicVector tmp;
+      tmp.capacity_ = addPadding( n );
+      tmp.v_        = allocate<Type>( tmp.capacity_ );
+      tmp.size_     = n;
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=n; i<tmp.capacity_; ++i )
+            tmp.v_[i] = Type();
+      }
+
+      // Initializing the new array in parallel, writing each element exactly once
+      if( preserve ) {
+         smpInitialize( tmp, *this, Type() );
+      }
+      else {
+         smpInitialize( tmp, Type() );
+      }
+
+      // Replacing the old array
+      swap( tmp );
+   }
+   else if( n > capacity_ )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
@@ -2043,7 +2105,8 @@ BLAZE_ALWAYS_INLINE void
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >
+inline DisableIf_< Or< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT>
+                     , typename DynamicVector<Type,TF>::BLAZE_TEMPLATE ConversionAssign<VT> > >
    DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
@@ -2119,6 +2182,31 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssig
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a dense vector with a different
+//        floating point precision.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE ConversionAssign<VT> >
+   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   mixedConvert( v_, (~rhs).data(), size_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a sparse vector.
 //
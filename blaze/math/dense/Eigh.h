@@ -0,0 +1,1510 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Eigh.h
+//  \brief Header file for the native symmetric/Hermitian eigensolver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_EIGH_H_
+#define _BLAZE_MATH_DENSE_EIGH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Householder.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDVecMultExpr.h>
+#include <blaze/math/expressions/DVecDVecAddExpr.h>
+#include <blaze/math/expressions/DVecDVecInnerExpr.h>
+#include <blaze/math/expressions/DVecScalarMultExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/expressions/TDMatDVecMultExpr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum size of the subproblems of the divide-and-conquer tridiagonal eigensolver.
+// \ingroup dense_matrix
+//
+// Tridiagonal matrices up to this size are diagonalized directly by the implicit QL algorithm.
+// Larger matrices are recursively split in halves until all subproblems fit this limit.
+*/
+constexpr size_t EIGH_LEAF_SIZE = 32UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum number of secular equations per merge for a parallel solution.
+// \ingroup dense_matrix
+//
+// Merges of the divide-and-conquer tridiagonal eigensolver with less non-deflated eigenvalues
+// solve their secular equations serially since the work per equation is proportional to the
+// number of equations. Hermitian matrix/vector products of the tridiagonalization are executed
+// in parallel for matrices with at least four times as many rows.
+*/
+constexpr size_t EIGH_SMP_THRESHOLD = 128UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of the given operation for all indices of a range.
+// \ingroup dense_matrix
+//
+// \param N The number of indices.
+// \param threshold The minimum number of indices for a parallel execution.
+// \param op The operation to be executed for every index in the range \f$ [0..N) \f$.
+// \return void
+//
+// The indices are distributed among all available threads via smpForRange(), each thread
+// executing its share serially.
+*/
+template< typename OP >  // Type of the operation
+void eighParallelFor( size_t N, size_t threshold, OP op )
+{
+   smpForRange( N, threshold, [&op]( size_t begin, size_t end ) {
+      for( size_t i=begin; i<end; ++i ) {
+         op( i );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIDIAGONALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a dense Hermitian matrix with a dense vector (\f$ y=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param A The column-major Hermitian matrix (only the lower part is referenced).
+// \param x The right-hand side dense vector.
+// \param y The resulting dense vector.
+// \param Y The work matrix for the partial results of the individual threads.
+// \return void
+//
+// This function computes the matrix/vector product by traversing the lower part of \a A in
+// panels of columns. Each panel is used twice while it resides in cache, which halves the memory
+// traffic compared to a general matrix/vector multiplication. The panels are distributed among
+// all available threads, each thread accumulating its share in a separate column of \a Y.
+*/
+template< typename MT     // Type of the Hermitian matrix
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2    // Type of the result vector
+        , typename MT2 >  // Type of the work matrix
+void eighHermitianMatVec( const MT& A, const VT1& x, VT2& y, MT2& Y )
+{
+   const size_t m ( A.rows() );
+   const size_t bs( 16UL );
+   const size_t panels( ( m + bs - 1UL ) / bs );
+
+   const bool parallel( m >= 4UL*EIGH_SMP_THRESHOLD && !isSerialSectionActive() && !isParallelSectionActive() );
+   const size_t P( parallel ? min( getNumThreads(), panels ) : 1UL );
+
+   Y.resize( m, P, false );
+   reset( Y );
+
+   eighParallelFor( P, 2UL, [&]( size_t t )
+   {
+      auto yt( column( Y, t, unchecked ) );
+
+      for( size_t p=t; p<panels; p+=P )
+      {
+         const size_t j0( p*bs );
+         const size_t jb( min( bs, m-j0 ) );
+         const size_t mb( m-j0-jb );
+
+         subvector( yt, j0, m-j0, unchecked ) +=
+            submatrix( A, j0, j0, m-j0, jb, unchecked ) * subvector( x, j0, jb, unchecked );
+
+         if( mb > 0UL ) {
+            subvector( yt, j0, jb, unchecked ) +=
+               ctrans( submatrix( A, j0+jb, j0, mb, jb, unchecked ) ) * subvector( x, j0+jb, mb, unchecked );
+         }
+      }
+   } );
+
+   y = column( Y, 0UL, unchecked );
+   for( size_t t=1UL; t<P; ++t ) {
+      y += column( Y, t, unchecked );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Householder tridiagonalization of a dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The \a n-by-\a n column-major matrix to be reduced (both triangles must be set).
+// \param d The resulting \a n diagonal elements of the tridiagonal matrix.
+// \param e The resulting \a n-1 off-diagonal elements of the tridiagonal matrix.
+// \param tau The resulting scalar factors of the \a n-1 elementary reflectors.
+// \return void
+//
+// This function computes the reduction \f$ A = Q T Q^H \f$ to a real symmetric tridiagonal
+// matrix \a T (compatible to the LAPACK \c xSYTRD/xHETRD functions with \c uplo='L'). The
+// matrix \f$ Q = H_0 H_1 \ldots H_{n-2} \f$ is represented by the elementary reflectors below
+// the subdiagonal of \a A (with explicit unit elements on the subdiagonal) and by \a tau.
+//
+// The matrix is processed in panels of \c HQR_BLOCK_SIZE columns. Within a panel, the reflectors
+// are computed from the lazily updated columns while the matrix \a W is accumulated (compatible
+// to the LAPACK \c xLATRD function). The trailing matrix is then updated by the symmetric rank-2k
+// update \f$ A -= V W^H + W V^H \f$, which is evaluated block column by block column on the lower
+// triangle by the optimized (and possibly parallel) matrix multiplication kernels of Blaze and
+// mirrored to the upper triangle afterwards.
+*/
+template< typename MT     // Type of the dense matrix
+        , typename VT1    // Type of the diagonal vector
+        , typename VT2    // Type of the off-diagonal vector
+        , typename VT3 >  // Type of the vector of scalar factors
+void eighTridiagonalize( MT& A, VT1& d, VT2& e, VT3& tau )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t n ( A.rows() );
+   const size_t bs( 4UL*HQR_BLOCK_SIZE );
+
+   DynamicMatrix<ET,columnMajor> W( n, HQR_BLOCK_SIZE ), S, R, Y;
+   DynamicVector<ET> wc, vc, t1, t2;
+
+   for( size_t k=0UL; k+1UL<n; k+=HQR_BLOCK_SIZE )
+   {
+      const size_t nb( min( HQR_BLOCK_SIZE, n-k-1UL ) );
+
+      for( size_t i=0UL; i<nb; ++i )
+      {
+         const size_t c( k+i );
+         const size_t m( n-c-1UL );
+
+         if( i > 0UL ) {
+            wc.resize( i, false );
+            vc.resize( i, false );
+            for( size_t l=0UL; l<i; ++l ) {
+               wc[l] = conj( W(c,l) );
+               vc[l] = conj( A(c,k+l) );
+            }
+            auto a( subvector( column( A, c, unchecked ), c, m+1UL, unchecked ) );
+            a -= submatrix( A, c, k, m+1UL, i, unchecked ) * wc +
+                 submatrix( W, c, 0UL, m+1UL, i, unchecked ) * vc;
+         }
+
+         d[c] = real( A(c,c) );
+
+         auto x( submatrix( A, c+1UL, c, m, 1UL, unchecked ) );
+         tau[c] = hqrReflector( x, 0UL );
+         e[c] = real( A(c+1UL,c) );
+         A(c+1UL,c) = ET(1);
+
+         const auto v( subvector( column( A, c, unchecked ), c+1UL, m, unchecked ) );
+         auto y( subvector( column( W, i, unchecked ), c+1UL, m, unchecked ) );
+
+         eighHermitianMatVec( submatrix( A, c+1UL, c+1UL, m, m, unchecked ), v, y, Y );
+
+         if( i > 0UL ) {
+            const auto Vp( submatrix( A, c+1UL, k, m, i, unchecked ) );
+            const auto Wp( submatrix( W, c+1UL, 0UL, m, i, unchecked ) );
+            t1 = ctrans( Wp ) * v;
+            t2 = ctrans( Vp ) * v;
+            y -= Vp * t1 + Wp * t2;
+         }
+
+         y *= tau[c];
+
+         const ET alpha( ET(-0.5) * tau[c] * ( ctrans( y ) * v ) );
+         y += alpha * v;
+      }
+
+      const size_t r ( k+nb );
+      const size_t mr( n-r );
+
+      S.resize( mr, 2UL*nb, false );
+      R.resize( mr, 2UL*nb, false );
+
+      submatrix( S, 0UL, 0UL, mr, nb, unchecked ) = submatrix( A, r, k, mr, nb, unchecked );
+      submatrix( S, 0UL, nb , mr, nb, unchecked ) = submatrix( W, r, 0UL, mr, nb, unchecked );
+      submatrix( R, 0UL, 0UL, mr, nb, unchecked ) = submatrix( W, r, 0UL, mr, nb, unchecked );
+      submatrix( R, 0UL, nb , mr, nb, unchecked ) = submatrix( A, r, k, mr, nb, unchecked );
+
+      for( size_t j=0UL; j<mr; j+=bs )
+      {
+         const size_t jb( min( bs, mr-j ) );
+
+         submatrix( A, r+j, r+j, mr-j, jb, unchecked ) -=
+            submatrix( S, j, 0UL, mr-j, 2UL*nb, unchecked ) *
+            ctrans( submatrix( R, j, 0UL, jb, 2UL*nb, unchecked ) );
+
+         if( j+jb < mr ) {
+            submatrix( A, r+j, r+j+jb, jb, mr-j-jb, unchecked ) =
+               ctrans( submatrix( A, r+j+jb, r+j, mr-j-jb, jb, unchecked ) );
+         }
+      }
+   }
+
+   d[n-1UL] = real( A(n-1UL,n-1UL) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Back-transformation of the eigenvectors of a tridiagonal matrix.
+// \ingroup dense_matrix
+//
+// \param A The tridiagonalized matrix containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \param C The eigenvectors of the tridiagonal matrix, overwritten by \f$ Q C \f$.
+// \return void
+//
+// This function applies the orthogonal/unitary matrix \a Q of the tridiagonalization to the
+// columns of the given matrix (compatible to the LAPACK \c xORMTR/xUNMTR functions). Large
+// transformations are performed blockwise by means of compact WY block reflectors.
+*/
+template< typename MT1    // Type of the tridiagonalized matrix
+        , typename VT     // Type of the vector of scalar factors
+        , typename MT2 >  // Type of the target matrix
+void eighBackTransform( const MT1& A, const VT& tau, MT2& C )
+{
+   using ET = ElementType_<MT1>;
+
+   const size_t n( A.rows()    );
+   const size_t k( C.columns() );
+
+   if( n < 2UL || k == 0UL ) return;
+
+   const size_t r( n-1UL );
+   const auto Vr( submatrix( A, 1UL, 0UL, r, r, unchecked ) );
+   auto Cr( submatrix( C, 1UL, 0UL, r, k, unchecked ) );
+
+   if( r < HQR_BLOCK_THRESHOLD ) {
+      for( size_t j=r; j-- > 0UL; ) {
+         hqrApplyReflector( Vr, j, tau[j], Cr, 0UL );
+      }
+      return;
+   }
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t k0=( ( r - 1UL ) / HQR_BLOCK_SIZE ) * HQR_BLOCK_SIZE; ; k0-=HQR_BLOCK_SIZE )
+   {
+      const size_t kb( min( HQR_BLOCK_SIZE, r - k0 ) );
+
+      V = submatrix( Vr, k0, k0, r-k0, kb, unchecked );
+      for( size_t j=0UL; j<kb; ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            V(i,j) = ET();
+         }
+         V(j,j) = ET(1);
+      }
+
+      const auto tk( subvector( tau, k0, kb, unchecked ) );
+      hqrTriangularFactor( V, tk, T );
+
+      auto Cb( submatrix( Cr, k0, 0UL, r-k0, k, unchecked ) );
+      hqrApplyBlock( Cb, V, T, false );
+
+      if( k0 == 0UL ) break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIDIAGONAL EIGENSOLVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implicit QL algorithm for a real symmetric tridiagonal matrix.
+// \ingroup dense_matrix
+//
+// \param d The \a n diagonal elements, overwritten by the (unordered) eigenvalues.
+// \param e The \a n-1 off-diagonal elements plus one trailing element (destroyed on exit).
+// \param Z The \a m-by-\a n matrix to be multiplied by the eigenvectors (only for \a Vectors).
+// \return void
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the eigenvalues of a symmetric tridiagonal matrix by the implicit QL
+// algorithm with Wilkinson shifts (compatible to the EISPACK \c tql1/tql2 functions). In case
+// \a Vectors is \a true, all Givens rotations are accumulated in the columns of \a Z.
+*/
+template< bool Vectors    // Flag for the computation of the eigenvectors
+        , typename VT1    // Type of the diagonal vector
+        , typename VT2    // Type of the off-diagonal vector
+        , typename MT >   // Type of the eigenvector matrix
+void eighTridiagonalQL( VT1& d, VT2& e, MT& Z )
+{
+   using BT = ElementType_<VT1>;
+
+   const size_t n( d.size() );
+   const BT eps( std::numeric_limits<BT>::epsilon() );
+
+   size_t iter( 0UL );
+
+   for( size_t l=0UL; l<n; ++l )
+   {
+      while( true )
+      {
+         size_t m( l );
+         for( ; m+1UL<n; ++m ) {
+            if( std::abs( e[m] ) <= eps * ( std::abs( d[m] ) + std::abs( d[m+1UL] ) ) )
+               break;
+         }
+
+         if( m == l ) break;
+
+         if( ++iter > 30UL*n ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Eigenvalue computation failed" );
+         }
+
+         BT g( ( d[l+1UL] - d[l] ) / ( BT(2) * e[l] ) );
+         BT r( std::hypot( g, BT(1) ) );
+         g = d[m] - d[l] + e[l] / ( g + ( g >= BT() ? r : -r ) );
+
+         BT s( 1 ), c( 1 ), p( 0 );
+         bool underflow( false );
+
+         for( size_t i=m; i-- > l; )
+         {
+            const BT f( s*e[i] );
+            const BT b( c*e[i] );
+
+            r = std::hypot( f, g );
+            e[i+1UL] = r;
+
+            if( r == BT() ) {
+               d[i+1UL] -= p;
+               e[m] = BT();
+               underflow = true;
+               break;
+            }
+
+            s = f / r;
+            c = g / r;
+            g = d[i+1UL] - p;
+            r = ( d[i] - g ) * s + BT(2) * c * b;
+            p = s * r;
+            d[i+1UL] = g + p;
+            g = c * r - b;
+
+            if( Vectors ) {
+               for( size_t j=0UL; j<Z.rows(); ++j ) {
+                  const BT t( Z(j,i+1UL) );
+                  Z(j,i+1UL) = s * Z(j,i) + c * t;
+                  Z(j,i    ) = c * Z(j,i) - s * t;
+               }
+            }
+         }
+
+         if( underflow ) continue;
+
+         d[l] -= p;
+         e[l] = g;
+         e[m] = BT();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a single secular equation of the divide-and-conquer eigensolver.
+// \ingroup dense_matrix
+//
+// \param d The \a K strictly ascending poles of the secular equation.
+// \param z The \a K weights of the secular equation (normalized to unit length).
+// \param rho The positive scalar factor of the rank-one modification.
+// \param i The index of the requested root.
+// \param origin The resulting index of the pole closest to the root.
+// \return The distance of the root from the pole \a d[origin].
+//
+// This function computes the \a i-th root \f$ \lambda_i \f$ of the secular equation
+// \f$ 1 + \rho \sum_j z_j^2 / (d_j - \lambda) = 0 \f$, which lies in the interval
+// \f$ (d_i,d_{i+1}) \f$ (or \f$ (d_{K-1},d_{K-1}+\rho) \f$ for the last root). The root is
+// returned relative to the closest pole, which allows to compute all differences
+// \f$ d_j - \lambda_i \f$ to full relative accuracy. The iteration combines Newton steps
+// with bisection in order to stay within the bracketing interval.
+*/
+template< typename VT >  // Type of the dense vectors
+ElementType_<VT> eighSecularRoot( const VT& d, const VT& z, ElementType_<VT> rho, size_t i, size_t& origin )
+{
+   using BT = ElementType_<VT>;
+
+   const size_t K( d.size() );
+   const BT eps( std::numeric_limits<BT>::epsilon() );
+
+   BT f{}, fp{}, bound{};
+
+   const auto evaluate = [&]( BT tau )
+   {
+      f     = BT(1);
+      fp    = BT();
+      bound = BT(1);
+      for( size_t j=0UL; j<K; ++j ) {
+         const BT delta( ( d[j] - d[origin] ) - tau );
+         const BT term ( rho * z[j] * z[j] / delta );
+         f     += term;
+         fp    += term / delta;
+         bound += std::abs( term );
+      }
+   };
+
+   BT lo{}, hi{};
+
+   if( i+1UL < K ) {
+      const BT mid( ( d[i+1UL] - d[i] ) / BT(2) );
+      origin = i;
+      evaluate( mid );
+      if( f >= BT() ) {
+         lo = BT();
+         hi = mid;
+      }
+      else {
+         origin = i+1UL;
+         lo = mid - ( d[i+1UL] - d[i] );
+         hi = BT();
+      }
+   }
+   else {
+      origin = i;
+      lo = BT();
+      for( size_t j=0UL; j<K; ++j ) {
+         hi += rho * z[j] * z[j];
+      }
+   }
+
+   BT tau( ( lo + hi ) / BT(2) );
+
+   for( size_t iter=0UL; iter<200UL; ++iter )
+   {
+      evaluate( tau );
+
+      if( std::abs( f ) <= eps * BT(K) * bound )
+         break;
+
+      if( f > BT() ) hi = tau;
+      else           lo = tau;
+
+      BT next( tau - f / fp );
+      if( !( next > lo && next < hi ) )
+         next = ( lo + hi ) / BT(2);
+
+      if( next == tau || hi - lo <= BT(2) * eps * max( std::abs( lo ), std::abs( hi ) ) )
+         break;
+
+      tau = next;
+   }
+
+   return tau;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merge of two tridiagonal subproblems of the divide-and-conquer eigensolver.
+// \ingroup dense_matrix
+//
+// \param d The eigenvalues of both subproblems, overwritten by the ascending merged eigenvalues.
+// \param Z The eigenvectors of both subproblems, overwritten by the merged eigenvectors.
+// \param n1 The size of the first subproblem.
+// \param rho The off-diagonal element coupling the two subproblems.
+// \return void
+//
+// This function computes the eigendecomposition of the rank-one modification
+// \f$ diag(Q_1,Q_2) (D + \rho z z^T) diag(Q_1,Q_2)^T \f$ (compatible to the LAPACK \c xLAED1
+// function): Negligible components of \a z and close pairs of eigenvalues are deflated, the
+// remaining eigenvalues are the roots of the secular equation. The eigenvectors of the
+// non-deflated eigenvalues are computed according to Gu and Eisenstat, which guarantees their
+// numerical orthogonality, and multiplied by \f$ diag(Q_1,Q_2) \f$. This multiplication exploits
+// the block structure and is evaluated by the optimized matrix multiplication kernels of Blaze.
+*/
+template< typename VT    // Type of the eigenvalue vector
+        , typename MT >  // Type of the eigenvector matrix
+void eighMerge( VT& d, MT& Z, size_t n1, ElementType_<VT> rho )
+{
+   using BT = ElementType_<VT>;
+
+   const size_t N( d.size() );
+   const size_t n2( N - n1 );
+   const BT eps( std::numeric_limits<BT>::epsilon() );
+   const BT r( BT(2) * std::abs( rho ) );
+   const BT scale( BT(1) / std::sqrt( BT(2) ) );
+
+   DynamicVector<BT> z( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      z[j] = ( j < n1 ) ? ( Z(n1-1UL,j) * scale )
+                        : ( rho < BT() ? -Z(n1,j) * scale : Z(n1,j) * scale );
+   }
+
+   std::vector<size_t> perm( N );
+   std::iota( perm.begin(), perm.end(), 0UL );
+   std::stable_sort( perm.begin(), perm.end(), [&d]( size_t a, size_t b ) { return d[a] < d[b]; } );
+
+   BT dmax{}, zmax{};
+   for( size_t j=0UL; j<N; ++j ) {
+      dmax = max( dmax, std::abs( d[j] ) );
+      zmax = max( zmax, std::abs( z[j] ) );
+   }
+   const BT tol( BT(8) * eps * max( dmax, zmax ) );
+
+   // Deflation of negligible weights and of close pairs of eigenvalues. The columns of the
+   // eigenvector matrix are classified as upper (1), dense (2), or lower (3) columns.
+   std::vector<size_t> ndef, defl;
+   std::vector<int> type( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      type[j] = ( j < n1 ) ? 1 : 3;
+   }
+
+   size_t pj( N );
+
+   for( size_t j : perm )
+   {
+      if( r * std::abs( z[j] ) <= tol ) {
+         defl.push_back( j );
+         continue;
+      }
+
+      if( pj == N ) {
+         pj = j;
+         continue;
+      }
+
+      const BT tau( std::hypot( z[j], z[pj] ) );
+      const BT c( z[j] / tau );
+      const BT s( -z[pj] / tau );
+
+      if( std::abs( ( d[j] - d[pj] ) * c * s ) <= tol )
+      {
+         z[j ] = tau;
+         z[pj] = BT();
+
+         for( size_t i=0UL; i<N; ++i ) {
+            const BT x( Z(i,pj) );
+            const BT y( Z(i,j ) );
+            Z(i,pj) = c*x + s*y;
+            Z(i,j ) = c*y - s*x;
+         }
+
+         if( type[pj] != type[j] ) {
+            type[pj] = type[j] = 2;
+         }
+
+         const BT t( d[pj]*c*c + d[j]*s*s );
+         d[j ] = d[pj]*s*s + d[j]*c*c;
+         d[pj] = t;
+
+         defl.push_back( pj );
+      }
+      else {
+         ndef.push_back( pj );
+      }
+
+      pj = j;
+   }
+
+   if( pj != N ) {
+      ndef.push_back( pj );
+   }
+
+   const size_t K( ndef.size() );
+
+   DynamicVector<BT> lambda( K );
+   DynamicMatrix<BT,columnMajor> Qn( N, K );
+
+   if( K > 0UL )
+   {
+      DynamicVector<BT> dk( K ), zk( K ), zh( K );
+      BT znorm{};
+      for( size_t p=0UL; p<K; ++p ) {
+         dk[p] = d[ndef[p]];
+         zk[p] = z[ndef[p]];
+         znorm += zk[p] * zk[p];
+      }
+      zk *= BT(1) / std::sqrt( znorm );
+      const BT rk( r * znorm );
+
+      // Ordering of the rows of the secular eigenvectors by column type
+      std::vector<size_t> rows;
+      size_t nt[3] = { 0UL, 0UL, 0UL };
+      for( int t=1; t<=3; ++t ) {
+         for( size_t p=0UL; p<K; ++p ) {
+            if( type[ndef[p]] == t ) {
+               rows.push_back( p );
+               ++nt[t-1];
+            }
+         }
+      }
+
+      std::vector<size_t> rowOf( K );
+      for( size_t q=0UL; q<K; ++q ) {
+         rowOf[rows[q]] = q;
+      }
+
+      // Roots of the secular equation and differences d_j - lambda_i
+      DynamicMatrix<BT,columnMajor> U( K, K );
+      eighParallelFor( K, EIGH_SMP_THRESHOLD, [&]( size_t i )
+      {
+         size_t o( 0UL );
+         const BT tau( eighSecularRoot( dk, zk, rk, i, o ) );
+         lambda[i] = dk[o] + tau;
+         for( size_t q=0UL; q<K; ++q ) {
+            U(q,i) = ( dk[rows[q]] - dk[o] ) - tau;
+         }
+      } );
+
+      // Recomputation of the weights according to Gu and Eisenstat
+      eighParallelFor( K, EIGH_SMP_THRESHOLD, [&]( size_t p )
+      {
+         const size_t q( rowOf[p] );
+         BT prod( -U(q,p) / rk );
+         for( size_t i=0UL; i<K; ++i ) {
+            if( i != p ) prod *= U(q,i) / ( dk[p] - dk[i] );
+         }
+         const BT zabs( std::sqrt( max( prod, BT() ) ) );
+         zh[p] = ( zk[p] < BT() ) ? -zabs : zabs;
+      } );
+
+      // Eigenvectors of the rank-one modification
+      eighParallelFor( K, EIGH_SMP_THRESHOLD, [&]( size_t i )
+      {
+         BT norm{};
+         for( size_t q=0UL; q<K; ++q ) {
+            U(q,i) = zh[rows[q]] / U(q,i);
+            norm += U(q,i) * U(q,i);
+         }
+         norm = BT(1) / std::sqrt( norm );
+         for( size_t q=0UL; q<K; ++q ) {
+            U(q,i) *= norm;
+         }
+      } );
+
+      DynamicMatrix<BT,columnMajor> Qc( N, K );
+      for( size_t q=0UL; q<K; ++q ) {
+         column( Qc, q, unchecked ) = column( Z, ndef[rows[q]], unchecked );
+      }
+
+      const size_t nu( nt[0] + nt[1] );
+      const size_t nl( nt[1] + nt[2] );
+
+      if( nu > 0UL )
+         submatrix( Qn, 0UL, 0UL, n1, K, unchecked ) =
+            submatrix( Qc, 0UL, 0UL, n1, nu, unchecked ) * submatrix( U, 0UL, 0UL, nu, K, unchecked );
+      else
+         reset( submatrix( Qn, 0UL, 0UL, n1, K, unchecked ) );
+
+      if( nl > 0UL )
+         submatrix( Qn, n1, 0UL, n2, K, unchecked ) =
+            submatrix( Qc, n1, nt[0], n2, nl, unchecked ) * submatrix( U, nt[0], 0UL, nl, K, unchecked );
+      else
+         reset( submatrix( Qn, n1, 0UL, n2, K, unchecked ) );
+   }
+
+   // Ascending arrangement of the non-deflated and deflated eigenpairs
+   const size_t nd( defl.size() );
+
+   DynamicMatrix<BT,columnMajor> Qd( N, nd );
+   std::vector< std::pair<BT,size_t> > order;
+   order.reserve( N );
+
+   for( size_t i=0UL; i<K; ++i ) {
+      order.emplace_back( lambda[i], i );
+   }
+   for( size_t j=0UL; j<nd; ++j ) {
+      column( Qd, j, unchecked ) = column( Z, defl[j], unchecked );
+      order.emplace_back( d[defl[j]], K+j );
+   }
+
+   std::stable_sort( order.begin(), order.end(),
+                     []( const std::pair<BT,size_t>& a, const std::pair<BT,size_t>& b ) {
+                        return a.first < b.first;
+                     } );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      const size_t src( order[j].second );
+      d[j] = order[j].first;
+      if( src < K )
+         column( Z, j, unchecked ) = column( Qn, src, unchecked );
+      else
+         column( Z, j, unchecked ) = column( Qd, src-K, unchecked );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Divide-and-conquer eigensolver for a real symmetric tridiagonal matrix.
+// \ingroup dense_matrix
+//
+// \param d The \a n diagonal elements, overwritten by the ascending eigenvalues.
+// \param e The \a n-1 off-diagonal elements.
+// \param Z The resulting \a n-by-\a n matrix of eigenvectors.
+// \return void
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and eigenvectors of a symmetric tridiagonal matrix by
+// Cuppen's divide-and-conquer method (compatible to the LAPACK \c xSTEDC function). The matrix
+// is recursively torn into subproblems of at most \c EIGH_LEAF_SIZE rows by rank-one
+// modifications. The subproblems are diagonalized by the implicit QL algorithm and merged
+// pairwise bottom-up (see eighMerge()). All subproblems of one level are independent: the
+// leaves and the merges of the lower levels are distributed among all available threads, the
+// few large merges of the upper levels are parallelized internally.
+*/
+template< typename VT1    // Type of the diagonal vector
+        , typename VT2    // Type of the off-diagonal vector
+        , typename MT >   // Type of the eigenvector matrix
+void eighDivideConquer( VT1& d, const VT2& e, MT& Z )
+{
+   using BT = ElementType_<VT1>;
+
+   const size_t n( d.size() );
+
+   reset( Z );
+
+   if( n == 0UL ) return;
+
+   // Recursive bisection of the matrix into subproblems
+   std::vector< std::vector<size_t> > levels( 1UL, std::vector<size_t>{ 0UL, n } );
+
+   while( true ) {
+      const std::vector<size_t>& bounds( levels.back() );
+      size_t maxSize( 0UL );
+      for( size_t p=0UL; p+1UL<bounds.size(); ++p ) {
+         maxSize = max( maxSize, bounds[p+1UL] - bounds[p] );
+      }
+      if( maxSize <= EIGH_LEAF_SIZE ) break;
+
+      std::vector<size_t> split;
+      for( size_t p=0UL; p+1UL<bounds.size(); ++p ) {
+         split.push_back( bounds[p] );
+         split.push_back( bounds[p] + ( bounds[p+1UL] - bounds[p] ) / 2UL );
+      }
+      split.push_back( n );
+      levels.push_back( std::move( split ) );
+   }
+
+   const std::vector<size_t>& leaves( levels.back() );
+   const size_t P( leaves.size() - 1UL );
+
+   // Rank-one tearing of the subproblems
+   for( size_t p=1UL; p<P; ++p ) {
+      const BT rho( std::abs( e[leaves[p]-1UL] ) );
+      d[leaves[p]-1UL] -= rho;
+      d[leaves[p]    ] -= rho;
+   }
+
+   // Diagonalization of the leaves
+   eighParallelFor( P, 2UL, [&]( size_t p )
+   {
+      const size_t first( leaves[p] );
+      const size_t size ( leaves[p+1UL] - first );
+
+      DynamicVector<BT> el( size );
+      for( size_t i=0UL; i+1UL<size; ++i ) {
+         el[i] = e[first+i];
+      }
+      el[size-1UL] = BT();
+
+      auto dl( subvector( d, first, size, unchecked ) );
+      auto Zl( submatrix( Z, first, first, size, size, unchecked ) );
+      for( size_t i=0UL; i<size; ++i ) {
+         Zl(i,i) = BT(1);
+      }
+
+      eighTridiagonalQL<true>( dl, el, Zl );
+   } );
+
+   if( P == 1UL )
+   {
+      for( size_t i=0UL; i<n; ++i ) {
+         size_t jmin( i );
+         for( size_t j=i+1UL; j<n; ++j ) {
+            if( d[j] < d[jmin] ) jmin = j;
+         }
+         if( jmin != i ) {
+            std::swap( d[i], d[jmin] );
+            for( size_t j=0UL; j<n; ++j ) {
+               std::swap( Z(j,i), Z(j,jmin) );
+            }
+         }
+      }
+      return;
+   }
+
+   // Bottom-up merges of the subproblems
+   for( size_t level=levels.size()-1UL; level-- > 0UL; )
+   {
+      const std::vector<size_t>& bounds( levels[level] );
+      const size_t M( bounds.size() - 1UL );
+
+      eighParallelFor( M, getNumThreads(), [&]( size_t p )
+      {
+         const size_t first( bounds[p] );
+         const size_t size ( bounds[p+1UL] - first );
+         const size_t n1   ( size / 2UL );
+
+         auto dm( subvector( d, first, size, unchecked ) );
+         auto Zm( submatrix( Z, first, first, size, size, unchecked ) );
+
+         eighMerge( dm, Zm, n1, e[first+n1-1UL] );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bisection for the lowest eigenvalues of a real symmetric tridiagonal matrix.
+// \ingroup dense_matrix
+//
+// \param d The \a n diagonal elements.
+// \param e The \a n-1 off-diagonal elements.
+// \param w The resulting \a k lowest eigenvalues in ascending order.
+// \return void
+//
+// This function computes the requested eigenvalues by bisection based on Sturm sequence counts
+// (compatible to the LAPACK \c xSTEBZ function). All eigenvalues are computed independently of
+// each other and are therefore distributed among all available threads.
+*/
+template< typename VT1    // Type of the diagonal vector
+        , typename VT2    // Type of the off-diagonal vector
+        , typename VT3 >  // Type of the eigenvalue vector
+void eighBisection( const VT1& d, const VT2& e, VT3& w )
+{
+   using BT = ElementType_<VT1>;
+
+   const size_t n( d.size() );
+   const size_t k( w.size() );
+   const BT eps( std::numeric_limits<BT>::epsilon() );
+
+   DynamicVector<BT> e2( n );
+   BT gl( d[0] ), gu( d[0] ), e2max{};
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const BT ei( ( i+1UL < n ) ? e[i] : BT() );
+      const BT ep( ( i > 0UL ) ? e[i-1UL] : BT() );
+      e2[i] = ei * ei;
+      e2max = max( e2max, e2[i] );
+      gl = min( gl, d[i] - std::abs( ei ) - std::abs( ep ) );
+      gu = max( gu, d[i] + std::abs( ei ) + std::abs( ep ) );
+   }
+
+   const BT pivmin( std::numeric_limits<BT>::min() * max( BT(1), e2max ) );
+   const BT bnorm ( max( std::abs( gl ), std::abs( gu ) ) );
+   gl -= BT(2) * BT(n) * eps * bnorm + BT(4) * pivmin;
+   gu += BT(2) * BT(n) * eps * bnorm + BT(4) * pivmin;
+
+   const auto count = [&]( BT x )
+   {
+      size_t negatives( 0UL );
+      BT q( d[0] - x );
+      for( size_t i=0UL; ; ++i ) {
+         if( std::abs( q ) < pivmin ) q = -pivmin;
+         if( q < BT() ) ++negatives;
+         if( i+1UL == n ) break;
+         q = ( d[i+1UL] - x ) - e2[i] / q;
+      }
+      return negatives;
+   };
+
+   eighParallelFor( k, 2UL, [&]( size_t i )
+   {
+      BT lo( gl ), hi( gu );
+
+      for( size_t iter=0UL; iter<200UL; ++iter )
+      {
+         if( hi - lo <= BT(2) * eps * max( std::abs( lo ), std::abs( hi ) ) + pivmin )
+            break;
+
+         const BT mid( lo + ( hi - lo ) / BT(2) );
+         if( mid <= lo || mid >= hi ) break;
+
+         if( count( mid ) > i ) hi = mid;
+         else                   lo = mid;
+      }
+
+      w[i] = lo + ( hi - lo ) / BT(2);
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inverse iteration for eigenvectors of a real symmetric tridiagonal matrix.
+// \ingroup dense_matrix
+//
+// \param d The \a n diagonal elements.
+// \param e The \a n-1 off-diagonal elements.
+// \param w The \a k ascending eigenvalues.
+// \param Z The resulting \a n-by-\a k matrix of eigenvectors.
+// \return void
+//
+// This function computes the eigenvectors of the given eigenvalues by inverse iteration with
+// a tridiagonal LU decomposition with partial pivoting (compatible to the LAPACK \c xSTEIN
+// function). Eigenvectors of eigenvalues closer than \f$ 10^{-3} \|T\| \f$ form a cluster and
+// are reorthogonalized against each other. Different clusters are independent of each other
+// and are therefore distributed among all available threads.
+*/
+template< typename VT1    // Type of the diagonal vector
+        , typename VT2    // Type of the off-diagonal vector
+        , typename VT3    // Type of the eigenvalue vector
+        , typename MT >   // Type of the eigenvector matrix
+void eighInverseIteration( const VT1& d, const VT2& e, const VT3& w, MT& Z )
+{
+   using BT = ElementType_<VT1>;
+
+   const size_t n( d.size() );
+   const size_t k( w.size() );
+   const BT eps( std::numeric_limits<BT>::epsilon() );
+
+   BT tnorm( std::numeric_limits<BT>::min() );
+   for( size_t i=0UL; i<n; ++i ) {
+      tnorm = max( tnorm, std::abs( d[i] ) + ( i > 0UL ? std::abs( e[i-1UL] ) : BT() )
+                                          + ( i+1UL < n ? std::abs( e[i] ) : BT() ) );
+   }
+
+   const BT ortol ( BT(1E-3) * tnorm );
+   const BT pertol( BT(10) * eps * tnorm );
+   const BT growth( BT(0.1) / ( std::sqrt( BT(n) ) * eps * tnorm ) );
+
+   std::vector<size_t> clusters( 1UL, 0UL );
+   for( size_t i=1UL; i<k; ++i ) {
+      if( w[i] - w[i-1UL] > ortol ) clusters.push_back( i );
+   }
+   clusters.push_back( k );
+
+   eighParallelFor( clusters.size()-1UL, 2UL, [&]( size_t cl )
+   {
+      DynamicVector<BT> dd( n ), du( n ), du2( n ), dl( n ), x( n ), b( n );
+      std::vector<bool> pivot( n );
+
+      BT shift{};
+
+      for( size_t j=clusters[cl]; j<clusters[cl+1UL]; ++j )
+      {
+         shift = ( j > clusters[cl] && w[j] - shift < pertol ) ? shift + pertol : w[j];
+
+         // LU decomposition of T - shift*I with partial pivoting
+         for( size_t i=0UL; i<n; ++i ) {
+            dd[i] = d[i] - shift;
+            du[i] = ( i+1UL < n ) ? e[i] : BT();
+            dl[i] = du[i];
+            du2[i] = BT();
+         }
+
+         for( size_t i=0UL; i+1UL<n; ++i )
+         {
+            if( std::abs( dd[i] ) >= std::abs( dl[i] ) ) {
+               pivot[i] = false;
+               if( dd[i] != BT() ) {
+                  dl[i] /= dd[i];
+                  dd[i+1UL] -= dl[i] * du[i];
+               }
+            }
+            else {
+               pivot[i] = true;
+               const BT fact( dd[i] / dl[i] );
+               dd[i] = dl[i];
+               dl[i] = fact;
+               const BT tmp( du[i] );
+               du[i] = dd[i+1UL];
+               dd[i+1UL] = tmp - fact * dd[i+1UL];
+               if( i+2UL < n ) {
+                  du2[i] = du[i+1UL];
+                  du[i+1UL] = -fact * du[i+1UL];
+               }
+            }
+         }
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( std::abs( dd[i] ) < pertol ) dd[i] = ( dd[i] < BT() ) ? -pertol : pertol;
+         }
+
+         // Deterministic pseudo-random start vector
+         size_t seed( 2UL*j + 1UL );
+         for( size_t i=0UL; i<n; ++i ) {
+            seed = ( seed * 6364136223846793005UL + 1442695040888963407UL );
+            b[i] = BT( ( seed >> 33 ) % 2001UL ) / BT(1000) - BT(1);
+         }
+         b *= BT(1) / std::sqrt( BT( ctrans( b ) * b ) );
+
+         const auto Zc( submatrix( Z, 0UL, clusters[cl], n, j-clusters[cl], unchecked ) );
+
+         for( size_t iter=0UL; iter<5UL; ++iter )
+         {
+            x = b;
+
+            for( size_t i=0UL; i+1UL<n; ++i ) {
+               if( !pivot[i] ) {
+                  x[i+1UL] -= dl[i] * x[i];
+               }
+               else {
+                  const BT tmp( x[i] );
+                  x[i] = x[i+1UL];
+                  x[i+1UL] = tmp - dl[i] * x[i];
+               }
+            }
+
+            for( size_t i=n; i-- > 0UL; ) {
+               BT s( x[i] );
+               if( i+1UL < n ) s -= du [i] * x[i+1UL];
+               if( i+2UL < n ) s -= du2[i] * x[i+2UL];
+               x[i] = s / dd[i];
+            }
+
+            if( Zc.columns() > 0UL ) {
+               x -= Zc * ( trans( Zc ) * x );
+            }
+
+            const BT norm( std::sqrt( BT( ctrans( x ) * x ) ) );
+            b = x * ( BT(1) / norm );
+
+            if( iter > 0UL && norm >= growth ) break;
+         }
+
+         column( Z, j, unchecked ) = b;
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC/HERMITIAN EIGENSOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Symmetric/Hermitian eigensolver functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, size_t k );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V, size_t k );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tridiagonalization of the lower part of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a n-by-\a n symmetric or Hermitian matrix.
+// \param QT The resulting tridiagonalized matrix containing the elementary reflectors.
+// \param d The resulting \a n diagonal elements of the tridiagonal matrix.
+// \param e The resulting \a n-1 off-diagonal elements of the tridiagonal matrix.
+// \param tau The resulting scalar factors of the elementary reflectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO       // Storage order of the matrix A
+        , typename MT2  // Type of the tridiagonalized matrix
+        , typename VT1  // Type of the diagonal vector
+        , typename VT2  // Type of the off-diagonal vector
+        , typename VT3 > // Type of the vector of scalar factors
+void eighReduce( const DenseMatrix<MT1,SO>& A, MT2& QT, VT1& d, VT2& e, VT3& tau )
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   QT = ~A;
+
+   for( size_t j=1UL; j<n; ++j ) {
+      for( size_t i=0UL; i<j; ++i ) {
+         QT(i,j) = conj( QT(j,i) );
+      }
+   }
+
+   d.resize( n, false );
+   e.resize( n, false );
+   tau.resize( n, false );
+
+   if( n > 0UL ) {
+      eighTridiagonalize( QT, d, e, tau );
+      e[n-1UL] = UnderlyingBuiltin_< ElementType_<MT2> >();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native eigenvalue computation of the given dense symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a n-by-\a n symmetric or Hermitian matrix.
+// \param w The resulting vector of the \a n eigenvalues in ascending order.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues of the given symmetric or Hermitian matrix without any
+// LAPACK call. Only the lower part of \a A is referenced, i.e. the upper part is assumed to be
+// the (conjugate) transpose of the lower part. The matrix is reduced to a real symmetric
+// tridiagonal matrix by the blocked Householder tridiagonalization, whose eigenvalues are
+// computed by the implicit QL algorithm. The eigenvalues are of the underlying builtin type of
+// the elements of \a A, i.e. they are expected to be of floating point type.
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > A( 500UL );
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   // ... Initialization
+
+   eigh( A, w );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+{
+   eigh( ~A, ~w, (~A).rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native computation of the lowest eigenvalues of the given dense symmetric or Hermitian
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a n-by-\a n symmetric or Hermitian matrix.
+// \param w The resulting vector of the \a k lowest eigenvalues in ascending order.
+// \param k The number of requested eigenvalues.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the \a k lowest eigenvalues of the given symmetric or Hermitian matrix
+// (see the two-argument eigh() function for details). The function fails if \a k is larger than
+// the number of rows of \a A.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+void eigh( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, size_t k )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+
+   using ET = ElementType_<MT>;
+   using BT = UnderlyingBuiltin_<ET>;
+
+   DynamicMatrix<ET,columnMajor> QT;
+   DynamicVector<BT> d, e;
+   DynamicVector<ET> tau;
+
+   eighReduce( ~A, QT, d, e, tau );
+
+   if( k > d.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   resize( ~w, k, false );
+
+   DynamicMatrix<BT,columnMajor> Z;
+   eighTridiagonalQL<false>( d, e, Z );
+   std::sort( d.begin(), d.end() );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      (~w)[i] = d[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native eigenvalue and eigenvector computation of the given dense symmetric or Hermitian
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a n-by-\a n symmetric or Hermitian matrix.
+// \param w The resulting vector of the \a n eigenvalues in ascending order.
+// \param V The resulting \a n-by-\a n matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes all eigenvalues and eigenvectors of the given symmetric or Hermitian
+// matrix without any LAPACK call, such that \f$ A = V \cdot diag(w) \cdot V^H \f$. Independent
+// of the storage order of \a V, the eigenvectors are stored in the columns of \a V. Only the lower
+// part of \a A is referenced. The computation proceeds in three steps:
+//
+//  -# The matrix is reduced to a real symmetric tridiagonal matrix by the blocked Householder
+//     tridiagonalization, whose trailing updates are evaluated by the optimized matrix
+//     multiplication kernels of Blaze.
+//  -# The tridiagonal eigenproblem is solved by the divide-and-conquer method. Independent
+//     subproblems are distributed among all available threads, the large merges are evaluated
+//     by parallel matrix multiplications.
+//  -# The eigenvectors are transformed back by means of compact WY block reflectors.
+//
+// All parallel steps are executed via the selected Blaze SMP backend, i.e. the computation
+// is serial inside a serial section.
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 500UL, 500UL );  // Symmetric matrix
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   // ... Initialization
+
+   eigh( A, w, V );  // A == V * diagonal( w ) * trans( V )
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+{
+   eigh( ~A, ~w, ~V, (~A).rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native computation of the lowest eigenpairs of the given dense symmetric or Hermitian
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a n-by-\a n symmetric or Hermitian matrix.
+// \param w The resulting vector of the \a k lowest eigenvalues in ascending order.
+// \param V The resulting \a n-by-\a k matrix of the according eigenvectors.
+// \param k The number of requested eigenpairs.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the \a k lowest eigenvalues and the according eigenvectors of the
+// given symmetric or Hermitian matrix (see the three-argument eigh() function for details).
+// In case \a k is small compared to the size of the matrix, the eigenvalues of the tridiagonal
+// matrix are computed by bisection and the eigenvectors by inverse iteration, which reduces the
+// cost of the tridiagonal eigenproblem and of the back-transformation to \f$ O(n^2 k) \f$.
+// Otherwise all eigenpairs are computed by the divide-and-conquer method. The function fails
+// if \a k is larger than the number of rows of \a A.
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > C( 5000UL );  // Covariance matrix
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   // ... Initialization
+
+   eigh( C, w, V, 10UL );  // The ten lowest eigenpairs
+   \endcode
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+void eigh( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V, size_t k )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT2> );
+
+   using ET = ElementType_<MT1>;
+   using BT = UnderlyingBuiltin_<ET>;
+
+   DynamicMatrix<ET,columnMajor> QT;
+   DynamicVector<BT> d, e;
+   DynamicVector<ET> tau;
+
+   eighReduce( ~A, QT, d, e, tau );
+
+   const size_t n( d.size() );
+
+   if( k > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   resize( ~w, k, false );
+   resize( ~V, n, k, false );
+
+   DynamicMatrix<BT,columnMajor> Z;
+
+   if( 4UL*k < n )
+   {
+      DynamicVector<BT> lambda( k );
+      eighBisection( d, e, lambda );
+
+      Z.resize( n, k, false );
+      eighInverseIteration( d, e, lambda, Z );
+
+      d = lambda;
+   }
+   else
+   {
+      Z.resize( n, n, false );
+      eighDivideConquer( d, e, Z );
+   }
+
+   DynamicMatrix<ET,columnMajor> Vw( submatrix( Z, 0UL, 0UL, n, k, unchecked ) );
+   eighBackTransform( QT, tau, Vw );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      (~w)[i] = d[i];
+   }
+
+   ~V = Vw;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,892 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ExpressionGraph.h
+//  \brief Header file for the deferred evaluation of dense vector assignments
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_EXPRESSIONGRAPH_H_
+#define _BLAZE_MATH_DENSE_EXPRESSIONGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <ostream>
+#include <vector>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/constraints/View.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS GRAPHNODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for the nodes of an expression graph.
+// \ingroup dense_vector
+//
+// The GraphNode class represents a single recorded statement of an ExpressionGraph. It provides
+// the type-erased interface to query the aliasing of the statement with the targets of other
+// statements and to evaluate the statement either as a whole or block by block.
+*/
+class GraphNode
+{
+ public:
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor of the GraphNode class.
+   */
+   virtual ~GraphNode() = default;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   //! Returns the name of the statement.
+   virtual const char* name() const = 0;
+
+   //! Returns the size of the iteration space of the statement.
+   virtual size_t size() const = 0;
+
+   //! Returns the number of bytes accessed per element of the iteration space.
+   virtual size_t bytes() const = 0;
+
+   //! Returns the address of the target vector (\a nullptr for reductions).
+   virtual const void* target() const = 0;
+
+   //! Returns whether the statement reads the given vector.
+   virtual bool reads( const void* alias ) const = 0;
+
+   //! Returns whether the statement reads the given vector other than element-wise.
+   virtual bool conflicts( const void* alias ) const = 0;
+
+   //! Prepares the statement for a block-wise evaluation with the given number of partitions.
+   virtual void prepare( size_t partitions ) = 0;
+
+   //! Evaluates the given block of the statement as part of the given partition.
+   virtual void execute( size_t partition, size_t index, size_t size ) = 0;
+
+   //! Completes a block-wise evaluation of the statement.
+   virtual void finalize() = 0;
+
+   //! Evaluates the complete statement at once.
+   virtual void evaluate() = 0;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASSIGNGRAPHNODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expression graph node for the assignment of a dense vector expression.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the source dense vector expression
+class AssignGraphNode
+   : public GraphNode
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the source operand.
+   using Operand = If_< IsExpression<VT2>, const VT2, const VT2& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AssignGraphNode class template.
+   //
+   // \param lhs The target dense vector.
+   // \param rhs The source dense vector expression.
+   */
+   explicit inline AssignGraphNode( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target dense vector
+      , rhs_( rhs )  // The source dense vector expression
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   const char* name() const override {
+      return "assign";
+   }
+
+   size_t size() const override {
+      return lhs_.size();
+   }
+
+   size_t bytes() const override {
+      return sizeof( ElementType_<VT1> ) + sizeof( ElementType_<VT2> );
+   }
+
+   const void* target() const override {
+      return &lhs_;
+   }
+
+   bool reads( const void* alias ) const override {
+      return rhs_.isAliased( alias );
+   }
+
+   bool conflicts( const void* alias ) const override {
+      return ( IsExpression<VT2>::value && rhs_.canAlias( alias ) ) ||
+             ( alias == &lhs_ && lhs_.size() != rhs_.size() );
+   }
+
+   void prepare( size_t /*partitions*/ ) override {}
+
+   void execute( size_t /*partition*/, size_t index, size_t size ) override {
+      auto target( subvector<unaligned>( lhs_, index, size, unchecked ) );
+      assign( target, subvector<unaligned>( rhs_, index, size, unchecked ) );
+   }
+
+   void finalize() override {}
+
+   void evaluate() override {
+      lhs_ = rhs_;
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&    lhs_;  //!< The target dense vector.
+   Operand rhs_;  //!< The source dense vector expression.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VIEW_TYPE( VT1 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DOTGRAPHNODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expression graph node for the scalar product of two dense vector expressions.
+// \ingroup dense_vector
+*/
+template< typename T      // Type of the result
+        , typename VT1    // Type of the left-hand side dense vector expression
+        , typename VT2 >  // Type of the right-hand side dense vector expression
+class DotGraphNode
+   : public GraphNode
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side operand.
+   using LeftOperand = If_< IsExpression<VT1>, const VT1, const VT1& >;
+
+   //! Composite type of the right-hand side operand.
+   using RightOperand = If_< IsExpression<VT2>, const VT2, const VT2& >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DotGraphNode class template.
+   //
+   // \param result The target of the scalar product.
+   // \param lhs The left-hand side dense vector expression.
+   // \param rhs The right-hand side dense vector expression.
+   */
+   explicit inline DotGraphNode( T& result, const VT1& lhs, const VT2& rhs )
+      : result_  ( result )  // The target of the scalar product
+      , lhs_     ( lhs    )  // The left-hand side dense vector expression
+      , rhs_     ( rhs    )  // The right-hand side dense vector expression
+      , partials_()          // The partial results of the partitions
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   const char* name() const override {
+      return "dot";
+   }
+
+   size_t size() const override {
+      return lhs_.size();
+   }
+
+   size_t bytes() const override {
+      return sizeof( ElementType_<VT1> ) + sizeof( ElementType_<VT2> );
+   }
+
+   const void* target() const override {
+      return nullptr;
+   }
+
+   bool reads( const void* alias ) const override {
+      return lhs_.isAliased( alias ) || rhs_.isAliased( alias );
+   }
+
+   bool conflicts( const void* alias ) const override {
+      return ( IsExpression<VT1>::value && lhs_.canAlias( alias ) ) ||
+             ( IsExpression<VT2>::value && rhs_.canAlias( alias ) );
+   }
+
+   void prepare( size_t partitions ) override {
+      partials_.assign( partitions, T() );
+   }
+
+   void execute( size_t partition, size_t index, size_t size ) override {
+      partials_[partition] += dot( subvector<unaligned>( lhs_, index, size, unchecked ),
+                                   subvector<unaligned>( rhs_, index, size, unchecked ) );
+   }
+
+   void finalize() override {
+      T sum = T();
+      for( const T& partial : partials_ ) {
+         sum += partial;
+      }
+      result_ = sum;
+   }
+
+   void evaluate() override {
+      result_ = dot( lhs_, rhs_ );
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&             result_;    //!< The target of the scalar product.
+   LeftOperand    lhs_;       //!< The left-hand side dense vector expression.
+   RightOperand   rhs_;       //!< The right-hand side dense vector expression.
+   std::vector<T> partials_;  //!< The partial results of the partitions.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred evaluation of a sequence of dense vector statements.
+// \ingroup dense_vector
+//
+// The ExpressionGraph class records a sequence of dense vector assignments and scalar products
+// instead of evaluating them immediately. Each statement is evaluated by a separate loop over
+// the involved vectors. For bandwidth-bound sequences of statements, as they are for instance
+// typical for iterative solvers, this means that the same vectors are streamed from and to the
+// main memory several times:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, b, w, y, z;
+   double s;
+   // ... Resizing and initialization
+
+   y = A * x;      // First pass: streams A, x, and y
+   z = y + b;      // Second pass: streams y, b, and z
+   s = dot(z,w);   // Third pass: streams z and w
+   \endcode
+
+// In contrast, the ExpressionGraph records the statements as nodes of a directed acyclic graph
+// and determines the dependencies between the statements via the aliasing functionality of the
+// recorded expressions (i.e. the \c isAliased() and \c canAlias() functions). Consecutive
+// statements of the same size that access each other's targets only element-wise are fused
+// into a single pass, which evaluates all statements block by block such that the data of
+// each block is still cached when the next statement accesses it:
+
+   \code
+   blaze::ExpressionGraph graph;
+
+   graph.assign( y, A * x );
+   graph.assign( z, y + b );
+   graph.dot( s, z, w );
+
+   std::cout << graph;  // Printing the recorded graph (one fused pass)
+
+   graph.evaluate();    // Evaluating all three statements in a single pass
+   \endcode
+
+// The fused passes are distributed among the threads of the active shared memory
+// parallelization. Statements that cannot be fused with the preceding statements start a new
+// pass. Statements whose source aliases their own target in a way that would require an
+// intermediate temporary (as for instance \c x \c = \c A \c * \c x) are evaluated on their own
+// via a regular assignment. The recorded graph can be inspected via the size(), passes(),
+// pass(), and dependencies() functions and printed via the output operator.
+//
+// Please note that the targets and all operands of the recorded statements must remain alive
+// until evaluate() has been called. Since the statements are only evaluated by evaluate(),
+// scalar values used in the recorded expressions (including the results of recorded scalar
+// products) are captured at the time the statement is recorded. Also note that the targets of
+// the statements must be dense vectors, not views, and that a target that differs in size
+// from the source expression is resized when the statement is recorded. Therefore a target
+// cannot be resized in case it is read or assigned by a previously recorded statement.
+*/
+class ExpressionGraph
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExpressionGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   void assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename T, typename VT1, bool TF1, typename VT2, bool TF2 >
+   void dot( T& result, const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Inspection functions************************************************************************
+   /*!\name Inspection functions */
+   //@{
+   inline size_t                     size        () const noexcept;
+   inline size_t                     passes      () const noexcept;
+   inline size_t                     pass        ( size_t node ) const;
+   inline bool                       isFused     ( size_t node ) const;
+   inline const std::vector<size_t>& dependencies( size_t node ) const;
+          void                       print       ( std::ostream& os ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Evaluation functions************************************************************************
+   /*!\name Evaluation functions */
+   //@{
+          void evaluate();
+   inline void clear() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void record( std::unique_ptr<GraphNode> node );
+   void evaluatePass( size_t first, size_t last );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector< std::unique_ptr<GraphNode> > nodes_;  //!< The recorded statements.
+   std::vector< std::vector<size_t> > dependencies_;  //!< The dependencies of each statement.
+   std::vector<size_t> passes_;                       //!< The index of the first statement of each pass.
+   std::vector<bool>   fused_;                        //!< The fusion flag of each pass.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ExpressionGraph.
+*/
+inline ExpressionGraph::ExpressionGraph()
+   : nodes_       ()  // The recorded statements
+   , dependencies_()  // The dependencies of each statement
+   , passes_      ()  // The index of the first statement of each pass
+   , fused_       ()  // The fusion flag of each pass
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a dense vector expression to a dense vector.
+//
+// \param lhs The target dense vector.
+// \param rhs The dense vector expression to be assigned.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function records the assignment \f$ lhs = rhs \f$ for a deferred evaluation. In case
+// the size of the target vector differs from the size of the given expression, the target
+// vector is resized immediately. Since this would invalidate the previously recorded statements
+// that read or assign the target vector, a \a std::invalid_argument exception is thrown in
+// this case. Note that the target vector must not be a view.
+*/
+template< typename VT1    // Type of the target dense vector
+        , bool TF         // Transpose flag of the vectors
+        , typename VT2 >  // Type of the source dense vector expression
+void ExpressionGraph::assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VIEW_TYPE( VT1 );
+
+   if( (~lhs).size() != (~rhs).size() )
+   {
+      for( const auto& node : nodes_ ) {
+         if( node->target() == &~lhs || node->reads( &~lhs ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Vector is accessed by a recorded statement" );
+         }
+      }
+
+      if( !(~rhs).isAliased( &~lhs ) ) {
+         resize( ~lhs, (~rhs).size(), false );
+      }
+   }
+
+   record( std::unique_ptr<GraphNode>( new AssignGraphNode<VT1,VT2>( ~lhs, ~rhs ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the scalar product of two dense vector expressions.
+//
+// \param result The target of the scalar product.
+// \param lhs The left-hand side dense vector expression.
+// \param rhs The right-hand side dense vector expression.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the scalar product \f$ result = dot( lhs, rhs ) \f$ for a deferred
+// evaluation. In case the sizes of the two given vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename T      // Type of the result
+        , typename VT1    // Type of the left-hand side dense vector expression
+        , bool TF1        // Transpose flag of the left-hand side dense vector expression
+        , typename VT2    // Type of the right-hand side dense vector expression
+        , bool TF2 >      // Transpose flag of the right-hand side dense vector expression
+void ExpressionGraph::dot( T& result, const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   record( std::unique_ptr<GraphNode>( new DotGraphNode<T,VT1,VT2>( result, ~lhs, ~rhs ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSPECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded statements.
+//
+// \return The number of recorded statements.
+*/
+inline size_t ExpressionGraph::size() const noexcept
+{
+   return nodes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of passes required to evaluate the recorded statements.
+//
+// \return The number of passes.
+*/
+inline size_t ExpressionGraph::passes() const noexcept
+{
+   return passes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the pass that evaluates the given statement.
+//
+// \param node The index of the statement \f$[0..size()-1]\f$.
+// \return The index of the pass \f$[0..passes()-1]\f$.
+*/
+inline size_t ExpressionGraph::pass( size_t node ) const
+{
+   BLAZE_USER_ASSERT( node < nodes_.size(), "Invalid statement access index" );
+
+   size_t index( passes_.size() - 1UL );
+   while( passes_[index] > node ) {
+      --index;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given statement is evaluated block-wise as part of a fused pass.
+//
+// \param node The index of the statement \f$[0..size()-1]\f$.
+// \return \a true in case the statement is evaluated block-wise, \a false if not.
+//
+// This function returns \a false for all statements that are evaluated on their own via a
+// regular assignment (as for instance \c x \c = \c A \c * \c x).
+*/
+inline bool ExpressionGraph::isFused( size_t node ) const
+{
+   return fused_[pass( node )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the preceding statements the given statement depends on.
+//
+// \param node The index of the statement \f$[0..size()-1]\f$.
+// \return The sorted indices of the statements the given statement depends on.
+//
+// A statement depends on a preceding statement in case it reads the target of the preceding
+// statement, in case the preceding statement reads the target of the statement, or in case
+// both statements assign to the same target.
+*/
+inline const std::vector<size_t>& ExpressionGraph::dependencies( size_t node ) const
+{
+   BLAZE_USER_ASSERT( node < nodes_.size(), "Invalid statement access index" );
+
+   return dependencies_[node];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the recorded graph to the given output stream.
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function prints all recorded statements, including their size, the pass they are
+// evaluated in, and their dependencies:
+
+   \code
+   Expression graph (3 statements, 1 pass)
+      [0] assign  size=10000  pass=0 (fused)  dependencies: -
+      [1] assign  size=10000  pass=0 (fused)  dependencies: 0
+      [2] dot     size=10000  pass=0 (fused)  dependencies: 1
+   \endcode
+*/
+inline void ExpressionGraph::print( std::ostream& os ) const
+{
+   os << "Expression graph (" << nodes_.size() << ( nodes_.size() == 1UL ? " statement, " : " statements, " )
+      << passes_.size() << ( passes_.size() == 1UL ? " pass)\n" : " passes)\n" );
+
+   for( size_t k=0UL; k<nodes_.size(); ++k )
+   {
+      os << "   [" << k << "] " << nodes_[k]->name()
+         << ( nodes_[k]->target() ? "  " : "     " )
+         << "size=" << nodes_[k]->size()
+         << "  pass=" << pass( k ) << ( isFused( k ) ? " (fused)" : " (single)" )
+         << "  dependencies:";
+
+      if( dependencies_[k].empty() ) {
+         os << " -";
+      }
+      for( size_t j : dependencies_[k] ) {
+         os << " " << j;
+      }
+
+      os << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates all recorded statements.
+//
+// \return void
+//
+// This function evaluates all recorded statements pass by pass. Afterwards the graph is empty
+// and can be used to record further statements.
+*/
+inline void ExpressionGraph::evaluate()
+{
+   for( size_t p=0UL; p<passes_.size(); ++p )
+   {
+      const size_t first( passes_[p] );
+      const size_t last ( p+1UL < passes_.size() ? passes_[p+1UL] : nodes_.size() );
+
+      if( fused_[p] ) {
+         evaluatePass( first, last );
+      }
+      else {
+         BLAZE_INTERNAL_ASSERT( last == first+1UL, "Invalid unfused pass detected" );
+         nodes_[first]->evaluate();
+      }
+   }
+
+   clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded statements.
+//
+// \return void
+*/
+inline void ExpressionGraph::clear() noexcept
+{
+   nodes_.clear();
+   dependencies_.clear();
+   passes_.clear();
+   fused_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the given statement and assigns it to a pass.
+//
+// \param node The statement to be recorded.
+// \return void
+//
+// This function determines the dependencies of the given statement and either appends it to
+// the current pass or starts a new pass. The statement is appended in case the current pass
+// is fused, both have the same size, and the statement and all statements of the current pass
+// access each other's targets only element-wise. A statement that reads its own target other
+// than element-wise forms an unfused pass on its own.
+*/
+inline void ExpressionGraph::record( std::unique_ptr<GraphNode> node )
+{
+   const size_t k( nodes_.size() );
+   const void* target( node->target() );
+
+   std::vector<size_t> dependencies;
+   for( size_t j=0UL; j<k; ++j ) {
+      const void* other( nodes_[j]->target() );
+      if( ( other  && node->reads( other ) ) ||
+          ( target && nodes_[j]->reads( target ) ) ||
+          ( target && target == other ) ) {
+         dependencies.push_back( j );
+      }
+   }
+
+   const bool blockable( !target || !node->conflicts( target ) );
+
+   bool fusible( blockable && !passes_.empty() && fused_.back() &&
+                 nodes_[passes_.back()]->size() == node->size() );
+
+   for( size_t j=( passes_.empty() ? k : passes_.back() ); fusible && j<k; ++j ) {
+      const void* other( nodes_[j]->target() );
+      if( ( other  && node->conflicts( other ) ) ||
+          ( target && nodes_[j]->conflicts( target ) ) ) {
+         fusible = false;
+      }
+   }
+
+   if( !fusible ) {
+      passes_.push_back( k );
+      fused_.push_back( blockable );
+   }
+
+   nodes_.push_back( std::move( node ) );
+   dependencies_.push_back( std::move( dependencies ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Block-wise evaluation of a fused pass.
+//
+// \param first The index of the first statement of the pass.
+// \param last The index one past the last statement of the pass.
+// \return void
+//
+// This function evaluates the statements \f$[first..last)\f$ block by block. The iteration
+// space is split into one partition per thread (in case it exceeds the SMP threshold for
+// dense vector assignments) and every partition is processed in blocks that fit into the
+// cache. For every block, all statements are evaluated in the order of their recording.
+*/
+inline void ExpressionGraph::evaluatePass( size_t first, size_t last )
+{
+   const size_t n( nodes_[first]->size() );
+
+   size_t bytes( 0UL );
+   for( size_t k=first; k<last; ++k ) {
+      bytes += nodes_[k]->bytes();
+   }
+
+   const bool parallel( n >= SMP_DVECASSIGN_THRESHOLD && !isSerialSectionActive() &&
+                        !isParallelSectionActive() );
+
+   const size_t partitions( parallel ? getNumThreads() : 1UL );
+   const size_t blockSize ( max( 64UL, ( cacheSize / ( 4UL * bytes ) ) & ~size_t(63) ) );
+   const size_t partSize  ( nextMultiple( ( n + partitions - 1UL ) / partitions, 64UL ) );
+
+   for( size_t k=first; k<last; ++k ) {
+      nodes_[k]->prepare( partitions );
+   }
+
+   auto process = [this,first,last,n,blockSize,partSize]( size_t partition )
+   {
+      const size_t begin( partition * partSize );
+      const size_t end  ( min( begin + partSize, n ) );
+
+      for( size_t i=begin; i<end; i+=blockSize ) {
+         const size_t size( min( blockSize, end - i ) );
+         for( size_t k=first; k<last; ++k ) {
+            nodes_[k]->execute( partition, i, size );
+         }
+      }
+   };
+
+   smpForRange( partitions, 2UL, [&process]( size_t begin, size_t end ) {
+      for( size_t partition=begin; partition<end; ++partition ) {
+         process( partition );
+      }
+   } );
+
+   for( size_t k=first; k<last; ++k ) {
+      nodes_[k]->finalize();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ExpressionGraph operators */
+//@{
+inline std::ostream& operator<<( std::ostream& os, const ExpressionGraph& graph );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for expression graphs.
+// \ingroup dense_vector
+//
+// \param os Reference to the output stream.
+// \param graph Reference to a constant expression graph object.
+// \return Reference to the output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, const ExpressionGraph& graph )
+{
+   graph.print( os );
+   return os;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
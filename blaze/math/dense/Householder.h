@@ -0,0 +1,942 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Householder.h
+//  \brief Header file for the native Householder QR/LQ decompositions and least squares solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_HOUSEHOLDER_H_
+#define _BLAZE_MATH_DENSE_HOUSEHOLDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Hermitian.h>
+#include <blaze/math/constraints/Lower.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDeclLowExpr.h>
+#include <blaze/math/expressions/DMatDeclUppExpr.h>
+#include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatTDMatMultExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/TDMatDMatMultExpr.h>
+#include <blaze/math/expressions/TDMatTDMatMultExpr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Width of the panels of the blocked Householder QR decomposition.
+// \ingroup dense_matrix
+//
+// The blocked Householder QR decomposition factorizes panels of this width with the unblocked
+// algorithm and applies them to the trailing matrix as a single compact WY block reflector.
+*/
+constexpr size_t HQR_BLOCK_SIZE = 32UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum number of reflectors for the blocked Householder QR decomposition.
+// \ingroup dense_matrix
+//
+// Decompositions with less reflectors (which includes all typical StaticMatrix and HybridMatrix
+// sizes) are computed by the unblocked algorithm, which works directly on the given matrix and
+// doesn't require any dynamic memory.
+*/
+constexpr size_t HQR_BLOCK_THRESHOLD = 2UL * HQR_BLOCK_SIZE;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOUSEHOLDER KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of the elementary reflector for the given column of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix.
+// \param j The index of the column (and of the first row) of the reflector.
+// \return The scalar factor \f$ \tau \f$ of the elementary reflector.
+//
+// This function computes the elementary reflector \f$ H = I - \tau v v^H \f$ with \f$ v_0 = 1 \f$
+// that annihilates the elements below the diagonal element \f$ A(j,j) \f$. On exit, the diagonal
+// element is overwritten by \f$ \beta \f$ and the elements below the diagonal by the elements
+// \f$ v_1 \ldots v_{m-j-1} \f$ of the Householder vector (compatible to the LAPACK \c xLARFG
+// function). In case the elements below the diagonal are already zero, \f$ \tau \f$ is zero.
+*/
+template< typename MT >  // Type of the dense matrix
+ElementType_<MT> hqrReflector( MT& A, size_t j )
+{
+   using ET = ElementType_<MT>;
+   using BT = UnderlyingBuiltin_<ET>;
+
+   const size_t m( A.rows() );
+   const ET alpha( A(j,j) );
+
+   BT xnorm2{};
+   for( size_t i=j+1UL; i<m; ++i ) {
+      xnorm2 += real( conj( A(i,j) ) * A(i,j) );
+   }
+
+   if( xnorm2 == BT() && imag( alpha ) == BT() ) {
+      return ET();
+   }
+
+   const BT anorm( std::sqrt( real( conj( alpha ) * alpha ) + xnorm2 ) );
+   const BT beta ( real( alpha ) >= BT() ? -anorm : anorm );
+   const ET scale( ET(1) / ( alpha - ET(beta) ) );
+
+   for( size_t i=j+1UL; i<m; ++i ) {
+      A(i,j) *= scale;
+   }
+
+   A(j,j) = ET(beta);
+
+   return ( ET(beta) - alpha ) / ET(beta);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an elementary reflector to the columns of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param V The dense matrix containing the Householder vector in column \a j.
+// \param j The index of the column (and of the first row) of the Householder vector.
+// \param tau The scalar factor of the elementary reflector.
+// \param C The target dense matrix.
+// \param first The index of the first column of \a C to be updated.
+// \return void
+//
+// This function computes \f$ C(j:m,first:n) = (I - \tau v v^H) C(j:m,first:n) \f$, where \a v
+// is the Householder vector stored below the diagonal of column \a j of \a V with an implicit
+// unit first element. Passing \f$ \overline{\tau} \f$ applies \f$ H^H \f$ instead of \a H. \a V
+// and \a C may refer to the same matrix as long as column \a j is not part of the update.
+*/
+template< typename MT1    // Type of the matrix containing the Householder vector
+        , typename MT2 >  // Type of the target dense matrix
+void hqrApplyReflector( const MT1& V, size_t j, ElementType_<MT1> tau, MT2& C, size_t first )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t m( V.rows() );
+
+   if( tau == ElementType_<MT1>() ) return;
+
+   for( size_t c=first; c<C.columns(); ++c )
+   {
+      ET w( C(j,c) );
+      for( size_t i=j+1UL; i<m; ++i ) {
+         w += conj( V(i,j) ) * C(i,c);
+      }
+      w *= tau;
+
+      C(j,c) -= w;
+      for( size_t i=j+1UL; i<m; ++i ) {
+         C(i,c) -= V(i,j) * w;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an elementary reflector to a dense vector.
+// \ingroup dense_matrix
+//
+// \param V The dense matrix containing the Householder vector in column \a j.
+// \param j The index of the column (and of the first row) of the Householder vector.
+// \param tau The scalar factor of the elementary reflector.
+// \param y The target dense vector.
+// \return void
+//
+// This function computes \f$ y(j:m) = (I - \tau v v^H) y(j:m) \f$, where \a v is the Householder
+// vector stored below the diagonal of column \a j of \a V with an implicit unit first element.
+*/
+template< typename MT    // Type of the matrix containing the Householder vector
+        , typename VT >  // Type of the target dense vector
+void hqrApplyReflector( const MT& V, size_t j, ElementType_<MT> tau, VT& y )
+{
+   using ET = ElementType_<VT>;
+
+   const size_t m( V.rows() );
+
+   if( tau == ElementType_<MT>() ) return;
+
+   ET w( y[j] );
+   for( size_t i=j+1UL; i<m; ++i ) {
+      w += conj( V(i,j) ) * y[i];
+   }
+   w *= tau;
+
+   y[j] -= w;
+   for( size_t i=j+1UL; i<m; ++i ) {
+      y[i] -= V(i,j) * w;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Householder QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param tau The dense vector for the scalar factors of the elementary reflectors.
+// \return void
+//
+// This function computes the compact Householder QR decomposition of the given \a m-by-\a n
+// matrix column by column (compatible to the LAPACK \c xGEQR2 function). The first min(\a m,\a n)
+// elements of \a tau have to be available. The function works directly on the given matrix and
+// therefore doesn't require any dynamic memory.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT >  // Type of the dense vector
+void hqrUnblocked( MT& A, VT& tau )
+{
+   const size_t kmin( min( A.rows(), A.columns() ) );
+
+   BLAZE_INTERNAL_ASSERT( tau.size() >= kmin, "Invalid size of the tau vector detected" );
+
+   for( size_t j=0UL; j<kmin; ++j ) {
+      tau[j] = hqrReflector( A, j );
+      hqrApplyReflector( A, j, conj( tau[j] ), A, j+1UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the triangular factor of a compact WY block reflector.
+// \ingroup dense_matrix
+//
+// \param V The unit lower trapezoidal matrix of Householder vectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \param T The resulting upper triangular factor.
+// \return void
+//
+// This function computes the upper triangular matrix \a T of the compact WY representation
+// \f$ H_0 H_1 \ldots H_{k-1} = I - V T V^H \f$ (compatible to the LAPACK \c xLARFT function).
+*/
+template< typename MT1    // Type of the matrix of Householder vectors
+        , typename VT     // Type of the vector of scalar factors
+        , typename MT2 >  // Type of the triangular factor
+void hqrTriangularFactor( const MT1& V, const VT& tau, MT2& T )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t m( V.rows()    );
+   const size_t k( V.columns() );
+
+   T.resize( k, k, false );
+   reset( T );
+
+   for( size_t j=0UL; j<k; ++j )
+   {
+      T(j,j) = tau[j];
+
+      for( size_t i=0UL; i<j; ++i ) {
+         ET z{};
+         for( size_t l=j; l<m; ++l ) {
+            z += conj( V(l,i) ) * V(l,j);
+         }
+         T(i,j) = -tau[j] * z;
+      }
+
+      for( size_t i=0UL; i<j; ++i ) {
+         ET s{};
+         for( size_t l=i; l<j; ++l ) {
+            s += T(i,l) * T(l,j);
+         }
+         T(i,j) = s;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a compact WY block reflector to a dense matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param V The unit lower trapezoidal matrix of Householder vectors.
+// \param T The upper triangular factor of the block reflector.
+// \param adjoint \a true to apply \f$ (I - V T V^H)^H \f$, \a false to apply \f$ I - V T V^H \f$.
+// \return void
+//
+// This function applies the block reflector from the left (compatible to the LAPACK \c xLARFB
+// function). All three steps are formulated as dense matrix multiplications and are therefore
+// evaluated by the optimized (and possibly parallel) matrix multiplication kernels of Blaze.
+*/
+template< typename MT1    // Type of the target dense matrix
+        , typename MT2    // Type of the matrix of Householder vectors
+        , typename MT3 >  // Type of the triangular factor
+void hqrApplyBlock( MT1& C, const MT2& V, const MT3& T, bool adjoint )
+{
+   using ET = ElementType_<MT1>;
+
+   DynamicMatrix<ET,rowMajor> W( ctrans( V ) * C );
+
+   if( adjoint )
+      W = decllow( ctrans( T ) ) * W;
+   else
+      W = declupp( T ) * W;
+
+   C -= V * W;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Householder QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param tau The dense vector for the scalar factors of the elementary reflectors.
+// \return void
+//
+// This function computes the compact Householder QR decomposition of the given \a m-by-\a n
+// matrix (compatible to the LAPACK \c xGEQRF function). In case the number of reflectors is
+// small, the unblocked algorithm is used. Otherwise the matrix is processed in panels of
+// \c HQR_BLOCK_SIZE columns: each panel is copied to a column-major buffer and factorized by
+// the unblocked algorithm, the trailing matrix is updated by means of a compact WY block
+// reflector via three matrix multiplications.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT >  // Type of the dense vector
+void hqrBlocked( MT& A, VT& tau )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t m   ( A.rows()    );
+   const size_t n   ( A.columns() );
+   const size_t kmin( min( m, n ) );
+
+   if( kmin < HQR_BLOCK_THRESHOLD ) {
+      hqrUnblocked( A, tau );
+      return;
+   }
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t k=0UL; k<kmin; k+=HQR_BLOCK_SIZE )
+   {
+      const size_t kb( min( HQR_BLOCK_SIZE, kmin - k ) );
+
+      auto Ap( submatrix( A, k, k, m-k, kb, unchecked ) );
+      auto tk( subvector( tau, k, kb, unchecked ) );
+
+      V = Ap;
+      hqrUnblocked( V, tk );
+      Ap = V;
+
+      if( k+kb < n )
+      {
+         for( size_t j=0UL; j<kb; ++j ) {
+            for( size_t i=0UL; i<j; ++i ) {
+               V(i,j) = ET();
+            }
+            V(j,j) = ET(1);
+         }
+
+         hqrTriangularFactor( V, tk, T );
+
+         auto C( submatrix( A, k, k+kb, m-k, n-k-kb, unchecked ) );
+         hqrApplyBlock( C, V, T, true );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Formation of the explicit \c Q matrix of a compact Householder QR decomposition.
+// \ingroup dense_matrix
+//
+// \param QR The compact QR decomposition.
+// \param tau The scalar factors of the elementary reflectors.
+// \param Q The resulting \a m-by-\a k matrix with orthonormal columns.
+// \return void
+//
+// This function computes the first \a k columns of \f$ Q = H_0 H_1 \ldots H_{k-1} \f$ by applying
+// the reflectors in reverse order to the first \a k columns of the identity matrix (compatible to
+// the LAPACK \c xORGQR/xUNGQR functions). Large decompositions are processed blockwise.
+*/
+template< typename MT1    // Type of the compact QR decomposition
+        , typename VT     // Type of the vector of scalar factors
+        , typename MT2 >  // Type of the target matrix
+void hqrFormQ( const MT1& QR, const VT& tau, MT2& Q )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t m( Q.rows()    );
+   const size_t k( Q.columns() );
+
+   reset( Q );
+   for( size_t j=0UL; j<k; ++j ) {
+      Q(j,j) = ET(1);
+   }
+
+   if( k < HQR_BLOCK_THRESHOLD ) {
+      for( size_t j=k; j-- > 0UL; ) {
+         hqrApplyReflector( QR, j, tau[j], Q, j );
+      }
+      return;
+   }
+
+   DynamicMatrix<ElementType_<MT1>,columnMajor> V, T;
+
+   for( size_t k0=( ( k - 1UL ) / HQR_BLOCK_SIZE ) * HQR_BLOCK_SIZE; ; k0-=HQR_BLOCK_SIZE )
+   {
+      const size_t kb( min( HQR_BLOCK_SIZE, k - k0 ) );
+
+      V = submatrix( QR, k0, k0, m-k0, kb, unchecked );
+      for( size_t j=0UL; j<kb; ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            V(i,j) = ET();
+         }
+         V(j,j) = ET(1);
+      }
+
+      const auto tk( subvector( tau, k0, kb, unchecked ) );
+      hqrTriangularFactor( V, tk, T );
+
+      auto C( submatrix( Q, k0, k0, m-k0, k-k0, unchecked ) );
+      hqrApplyBlock( C, V, T, false );
+
+      if( k0 == 0UL ) break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOUSEHOLDER QR/LQ DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Householder QR/LQ decomposition functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void hqr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& tau );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void hqr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void hlq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3,SO3>& Q );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native compact Householder QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau The resulting scalar factors of the elementary reflectors.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function computes the Householder QR decomposition of a general \a m-by-\a n matrix in
+// place and without any LAPACK call. On exit, the elements on and above the diagonal of \a A
+// contain the min(\a m,\a n)-by-\a n upper trapezoidal matrix \c R, the elements below the
+// diagonal, together with the min(\a m,\a n) elements of \a tau, represent the matrix \c Q as
+// product of elementary reflectors \f$ H_i = I - \tau_i v_i v_i^H \f$. The format is identical
+// to the format of the LAPACK \c geqrf() function.
+//
+// Small matrices (which includes all typical StaticMatrix and HybridMatrix sizes) are decomposed
+// by an unblocked algorithm that doesn't require any dynamic memory. Larger matrices are
+// decomposed blockwise; the update of the trailing matrix is formulated by means of compact WY
+// block reflectors and evaluated by the optimized matrix multiplication kernels of Blaze.
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 500UL, 200UL );
+   blaze::DynamicVector<double> tau;
+   // ... Initialization of A
+
+   hqr( A, tau );  // R is stored in the upper part of A
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO      // Storage order of the dense matrix
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void hqr( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   resize( ~tau, min( (~A).rows(), (~A).columns() ), false );
+
+   hqrBlocked( ~A, ~tau );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native Householder QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param R The resulting \c R matrix.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to m-by-n.
+//
+// This function computes the QR decomposition \f$ A = Q \cdot R \f$ of a general \a m-by-\a n
+// matrix, where \c Q is a general \a m-by-min(\a m,\a n) matrix with orthonormal columns and
+// \c R is an upper trapezoidal min(\a m,\a n)-by-\a n matrix. In contrast to the qr() function,
+// the decomposition is computed by the native Householder kernels of Blaze (see hqr()) and
+// therefore doesn't require a LAPACK library. The function fails if ...
+//
+//  - ... either \a Q or \a R are fixed size matrices and the dimensions don't match;
+//  - ... \a R is a compile time square matrix, but is required to be non-square.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix R
+        , bool SO3 >    // Storage order of matrix R
+void hqr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNITRIANGULAR_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_LOWER_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT3> );
+
+   using ET1 = ElementType_<MT1>;
+   using ET3 = ElementType_<MT3>;
+
+   const size_t m   ( (~A).rows()    );
+   const size_t n   ( (~A).columns() );
+   const size_t kmin( min( m, n ) );
+
+   RemoveAdaptor_< ResultType_<MT1> > QR( ~A );
+   DynamicVector<ET1> tau( kmin );
+
+   hqrBlocked( QR, tau );
+
+   resize( ~Q, m, kmin, false );
+   resize( ~R, kmin, n, false );
+
+   hqrFormQ( QR, tau, ~Q );
+
+   for( size_t i=0UL; i<kmin; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         reset( (~R)(i,j) );
+      }
+      for( size_t j=i; j<n; ++j ) {
+         (~R)(i,j) = ET3( QR(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native Householder LQ decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param L The resulting \c L matrix.
+// \param Q The resulting \c Q matrix.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to m-by-n.
+//
+// This function computes the LQ decomposition \f$ A = L \cdot Q \f$ of a general \a m-by-\a n
+// matrix, where \c L is a lower trapezoidal \a m-by-min(\a m,\a n) matrix and \c Q is a general
+// min(\a m,\a n)-by-\a n matrix with orthonormal rows. The decomposition is computed by means of
+// the native Householder QR decomposition of \f$ A^H \f$ (see hqr()) and therefore doesn't
+// require a LAPACK library. The function fails if ...
+//
+//  - ... either \a L or \a Q are fixed size matrices and the dimensions don't match;
+//  - ... \a L is a compile time square matrix, but is required to be non-square.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix L
+        , bool SO2      // Storage order of matrix L
+        , typename MT3  // Type of matrix Q
+        , bool SO3 >    // Storage order of matrix Q
+void hlq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3,SO3>& Q )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNITRIANGULAR_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UPPER_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT3> );
+
+   using ET1 = ElementType_<MT1>;
+
+   DynamicMatrix<ET1,!SO1> Qt, Rt;
+
+   hqr( ctrans( ~A ), Qt, Rt );
+
+   resize( ~L, Rt.columns(), Rt.rows(), false );
+   resize( ~Q, Qt.columns(), Qt.rows(), false );
+
+   ~L = ctrans( Rt );
+   ~Q = ctrans( Qt );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LEAST SQUARES SOLVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Least squares solvers */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve_ls( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b );
+
+template< typename MT, bool SO, typename VT >
+DynamicVector< ElementType_<MT> > solve_ls( const DenseMatrix<MT,SO>& A, const DenseVector<VT,false>& b );
+
+template< typename MT, typename A1, typename VT1, typename A2, typename VT2, typename A3 >
+void solve_ls( const std::vector<MT,A1>& A, std::vector<VT1,A2>& x, const std::vector<VT2,A3>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native least squares solution of the given linear system.
+// \ingroup dense_matrix
+//
+// \param A The \a m-by-\a n system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector of size \a m.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Rank-deficient matrix detected.
+//
+// This function solves the linear system \f$ A x = b \f$ in the least squares sense by means of
+// the native Householder QR decomposition. For \a m >= \a n the function computes the vector
+// \a x that minimizes \f$ \|A x - b\|_2 \f$ via the QR decomposition of \a A. For \a m < \a n the
+// function computes the minimum norm solution of the underdetermined system via the QR
+// decomposition of \f$ A^H \f$. In both cases \a A has to have full rank; otherwise a
+// \a std::runtime_error exception is thrown.
+//
+// For fixed size system matrices and right-hand side vectors (for instance \c StaticMatrix and
+// \c StaticVector) all work arrays are fixed size as well, i.e. the solution doesn't require any
+// dynamic memory.
+
+   \code
+   blaze::StaticMatrix<double,8UL,3UL> A;
+   blaze::StaticVector<double,8UL> b;
+   blaze::StaticVector<double,3UL> x;
+   // ... Initialization of A and b
+
+   solve_ls( A, x, b );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve_ls( const DenseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   using ET = ElementType_<VT1>;
+   using WT = RemoveAdaptor_< ResultType_<MT> >;
+   using VWT = ResultType_<VT2>;
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+
+   if( (~b).size() != m ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~x, n, false );
+
+   if( m == 0UL || n == 0UL ) {
+      reset( ~x );
+      return;
+   }
+
+   // Both the right-hand side vector and the scalar factors of the min(m,n) reflectors fit
+   // into a work vector of the type of the right-hand side vector
+   VWT y  ( ~b );
+   VWT tau( ~b );
+
+   if( m >= n )
+   {
+      WT QR( ~A );
+      hqrBlocked( QR, tau );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         hqrApplyReflector( QR, j, conj( tau[j] ), y );
+      }
+
+      for( size_t i=n; i-- > 0UL; ) {
+         if( !isDivisor( QR(i,i) ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Rank-deficient matrix detected" );
+         }
+         ET s( y[i] );
+         for( size_t j=i+1UL; j<n; ++j ) {
+            s -= QR(i,j) * (~x)[j];
+         }
+         (~x)[i] = s / QR(i,i);
+      }
+   }
+   else
+   {
+      TransposeType_<WT> QR( ctrans( ~A ) );
+      hqrBlocked( QR, tau );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !isDivisor( QR(i,i) ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Rank-deficient matrix detected" );
+         }
+         ET s( y[i] );
+         for( size_t j=0UL; j<i; ++j ) {
+            s -= conj( QR(j,i) ) * (~x)[j];
+         }
+         (~x)[i] = s / conj( QR(i,i) );
+      }
+
+      for( size_t i=m; i<n; ++i ) {
+         reset( (~x)[i] );
+      }
+
+      for( size_t j=m; j-- > 0UL; ) {
+         hqrApplyReflector( QR, j, tau[j], ~x );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native least squares solution of the given linear system.
+// \ingroup dense_matrix
+//
+// \param A The \a m-by-\a n system matrix.
+// \param b The right-hand side vector of size \a m.
+// \return The least squares solution of size \a n.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::runtime_error Rank-deficient matrix detected.
+//
+// This function returns the least squares solution of the linear system \f$ A x = b \f$ (see
+// the three-argument solve_ls() function for details):
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 10UL );
+   blaze::DynamicVector<double> b( 1000UL );
+   // ... Initialization of A and b
+
+   const blaze::DynamicVector<double> x( solve_ls( A, b ) );
+   \endcode
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT >  // Type of the right-hand side vector
+DynamicVector< ElementType_<MT> > solve_ls( const DenseMatrix<MT,SO>& A, const DenseVector<VT,false>& b )
+{
+   DynamicVector< ElementType_<MT> > x;
+   solve_ls( ~A, x, ~b );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native least squares solution of a batch of linear systems.
+// \ingroup dense_matrix
+//
+// \param A The system matrices.
+// \param x The resulting solution vectors.
+// \param b The right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Invalid number of right-hand side vectors.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::runtime_error Rank-deficient matrix detected.
+//
+// This function solves the linear systems \f$ A_i x_i = b_i \f$ in the least squares sense
+// (see the three-argument solve_ls() function for details). The vector \a x is resized to the
+// number of systems. In case parallelization is enabled, the systems are distributed among all
+// available threads, each thread solving its share of the systems serially. Therefore this
+// function is the preferred way to solve a large number of small problems. In case any of the
+// systems cannot be solved, the exception of the first failing thread is rethrown after all
+// threads have finished.
+
+   \code
+   using M  = blaze::StaticMatrix<double,6UL,4UL>;
+   using V1 = blaze::StaticVector<double,4UL>;
+   using V2 = blaze::StaticVector<double,6UL>;
+
+   std::vector< M , blaze::AlignedAllocator<M>  > A;
+   std::vector< V1, blaze::AlignedAllocator<V1> > x;
+   std::vector< V2, blaze::AlignedAllocator<V2> > b;
+   // ... Initialization of A and b
+
+   solve_ls( A, x, b );
+   \endcode
+*/
+template< typename MT     // Type of the system matrices
+        , typename A1     // Allocator of the system matrices
+        , typename VT1    // Type of the solution vectors
+        , typename A2     // Allocator of the solution vectors
+        , typename VT2    // Type of the right-hand side vectors
+        , typename A3 >   // Allocator of the right-hand side vectors
+void solve_ls( const std::vector<MT,A1>& A, std::vector<VT1,A2>& x, const std::vector<VT2,A3>& b )
+{
+   const size_t N( A.size() );
+
+   if( b.size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of right-hand side vectors" );
+   }
+
+   x.resize( N );
+
+   smpForRange( N, 2UL, [&]( size_t begin, size_t end ) {
+      for( size_t i=begin; i<end; ++i ) {
+         solve_ls( A[i], x[i], b[i] );
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
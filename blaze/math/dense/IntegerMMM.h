@@ -0,0 +1,585 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/IntegerMMM.h
+//  \brief Header file for the low precision integral dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_INTEGERMMM_H_
+#define _BLAZE_MATH_DENSE_INTEGERMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the low precision integral dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// This helper struct evaluates whether the given data type is a valid element type of an
+// operand of the low precision integral dense matrix multiplication, i.e. whether it is one
+// of the types \c int8_t, \c uint8_t, or \c int16_t. All values of these types can be exactly
+// represented by 16-bit signed integral values.
+*/
+template< typename T >  // Type to be checked
+struct IMMMOperandHelper
+{
+   //**********************************************************************************************
+   enum : bool { value = IsSame<T,int8_t>::value || IsSame<T,uint8_t>::value ||
+                         IsSame<T,int16_t>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update functor for the integral dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the target matrix
+        , typename ST >  // Type of the scalar values
+struct IMMMUpdate
+{
+   //**********************************************************************************************
+   using ET = ElementType_<MT>;  //!< Element type of the target matrix.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   explicit inline IMMMUpdate( MT& C, ST alpha, ST beta )
+      : C_    ( C )
+      , alpha_( alpha )
+      , beta_ ( beta )
+      , one_  ( isOne( alpha ) )
+      , mone_ ( isOne( -alpha ) )
+      , reset_( isDefault( beta ) )
+      , add_  ( isOne( beta ) )
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   BLAZE_ALWAYS_INLINE void operator()( size_t i, size_t j, int32_t acc ) const {
+      const ET value( one_ ? ET( acc ) : mone_ ? ET( -acc ) : ET( alpha_ * acc ) );
+      if( reset_ )
+         C_(i,j) = value;
+      else if( add_ )
+         C_(i,j) += value;
+      else
+         C_(i,j) = ET( beta_ * C_(i,j) ) + value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   MT& C_;            //!< The target matrix.
+   const ST alpha_;   //!< The scaling factor for the matrix product.
+   const ST beta_;    //!< The scaling factor for the target matrix.
+   const bool one_;   //!< Flag for a scaling factor \f$ \alpha=1 \f$.
+   const bool mone_;  //!< Flag for a scaling factor \f$ \alpha=-1 \f$.
+   const bool reset_; //!< Flag for a scaling factor \f$ \beta=0 \f$.
+   const bool add_;   //!< Flag for a scaling factor \f$ \beta=1 \f$.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling functor for the quantized dense matrix multiplication
+//        (\f$ C_{ij}=r_i*c_j*(A*B)_{ij} \f$).
+// \ingroup dense_matrix
+*/
+template< typename MT     // Type of the target matrix
+        , typename VT1    // Type of the row scaling factors
+        , typename VT2 >  // Type of the column scaling factors
+struct IMMMScale
+{
+   //**********************************************************************************************
+   explicit inline IMMMScale( MT& C, const VT1& r, const VT2& c )
+      : C_( C )
+      , r_( r )
+      , c_( c )
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   BLAZE_ALWAYS_INLINE void operator()( size_t i, size_t j, int32_t acc ) const {
+      C_(i,j) = r_[i] * c_[j] * acc;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   MT& C_;         //!< The target matrix.
+   const VT1& r_;  //!< The row scaling factors.
+   const VT2& c_;  //!< The column scaling factors.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of the left-hand side operand of an integral dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param Ap Pointer to the first element of the packed panels.
+// \param A The left-hand side multiplication operand.
+// \param mr The number of rows per panel.
+// \return void
+//
+// This function packs the given matrix \a A into panels of \a mr rows. Within a panel, each
+// pair of adjacent elements \f$ A_{i,2p} \f$ and \f$ A_{i,2p+1} \f$ is combined into a single
+// 32-bit value (the first element in the lower, the second element in the upper 16 bits),
+// which can be broadcast to all elements of a SIMD vector. The panels are padded with zeros.
+*/
+template< typename MT >  // Type of the left-hand side operand
+void immmPackLeft( int32_t* Ap, const MT& A, size_t mr )
+{
+   const size_t M( A.rows()    );
+   const size_t K( A.columns() );
+   const size_t P( ( K + 1UL ) / 2UL );
+
+   for( size_t ii=0UL; ii<M; ii+=mr ) {
+      for( size_t p=0UL; p<P; ++p ) {
+         for( size_t i=ii; i<ii+mr; ++i, ++Ap )
+         {
+            if( i >= M ) {
+               *Ap = 0;
+               continue;
+            }
+
+            const int16_t lo( A(i,2UL*p) );
+            const int16_t hi( ( 2UL*p+1UL < K )?( A(i,2UL*p+1UL) ):( 0 ) );
+
+            *Ap = static_cast<int32_t>( ( static_cast<uint32_t>( static_cast<uint16_t>( lo ) ) ) |
+                                        ( static_cast<uint32_t>( static_cast<uint16_t>( hi ) ) << 16 ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of the right-hand side operand of an integral dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param Bp Pointer to the first element of the packed panels.
+// \param B The right-hand side multiplication operand.
+// \param nr The number of columns per panel.
+// \return void
+//
+// This function packs the given matrix \a B into panels of \a nr columns. Within a panel, the
+// elements \f$ B_{2p,j} \f$ and \f$ B_{2p+1,j} \f$ of all columns are interleaved, such that
+// a 16-bit multiply-add with a broadcast pair of left-hand side elements directly results in
+// the contribution of two rows of \a B to \a nr consecutive 32-bit accumulators. The panels
+// are padded with zeros.
+*/
+template< typename MT >  // Type of the right-hand side operand
+void immmPackRight( int16_t* Bp, const MT& B, size_t nr )
+{
+   const size_t K( B.rows()    );
+   const size_t N( B.columns() );
+   const size_t P( ( K + 1UL ) / 2UL );
+
+   for( size_t jj=0UL; jj<N; jj+=nr ) {
+      for( size_t p=0UL; p<P; ++p ) {
+         for( size_t j=jj; j<jj+nr; ++j ) {
+            *Bp++ = ( j < N )?( int16_t( B(2UL*p,j) ) ):( 0 );
+            *Bp++ = ( j < N && 2UL*p+1UL < K )?( int16_t( B(2UL*p+1UL,j) ) ):( 0 );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTEGRAL DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a low precision integral dense matrix/dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param op The functor for the update of the target matrix.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of two dense matrices
+// with 8-bit or 16-bit integral elements. All products are accumulated in 32-bit integral
+// values, which are passed to the given functor \a op (as \c op(i,j,acc)) after the complete
+// accumulation of the element \f$ (i,j) \f$. Both operands are packed into panels of 16-bit
+// values and multiplied via 16-bit SIMD multiply-add operations (\c pmaddwd), which compute
+// the sum of two products in a single instruction. In case AVX512VNNI or AVXVNNI is available,
+// the multiply-add and the accumulation are fused into a single dot product instruction. Note
+// that the unsigned multiply-add of 8-bit values (\c pmaddubsw) is deliberately not used since
+// it saturates its 16-bit intermediate results.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2    // Type of the right-hand side matrix operand
+        , typename OP >   // Type of the update functor
+void immm( const MT1& A, const MT2& B, OP op )
+{
+   BLAZE_STATIC_ASSERT( IMMMOperandHelper< ElementType_<MT1> >::value );
+   BLAZE_STATIC_ASSERT( IMMMOperandHelper< ElementType_<MT2> >::value );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   if( M == 0UL || N == 0UL ) {
+      return;
+   }
+
+   if( K == 0UL ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            op( i, j, 0 );
+         }
+      }
+      return;
+   }
+
+#if BLAZE_AVX512BW_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE )
+
+   constexpr size_t SIMDSIZE( SIMDint32::size );
+   constexpr size_t MR( 4UL );
+   constexpr size_t NR( 2UL*SIMDSIZE );
+
+   const size_t P( ( K + 1UL ) / 2UL );
+   const size_t mpanels( ( M + MR - 1UL ) / MR );
+   const size_t npanels( ( N + NR - 1UL ) / NR );
+
+   std::unique_ptr<int32_t[],Deallocate> left ( allocate<int32_t>( mpanels*MR*P ) );
+   std::unique_ptr<int16_t[],Deallocate> right( allocate<int16_t>( npanels*NR*P*2UL ) );
+
+   immmPackLeft ( left.get() , A, MR );
+   immmPackRight( right.get(), B, NR );
+
+   int32_t tmp[MR*NR];
+
+   for( size_t jj=0UL; jj<N; jj+=NR )
+   {
+      const int16_t* const bp( right.get() + ( jj / NR )*P*NR*2UL );
+      const size_t jend( min( NR, N-jj ) );
+
+      for( size_t ii=0UL; ii<M; ii+=MR )
+      {
+         const int32_t* ap( left.get() + ( ii / MR )*P*MR );
+         const int16_t* b( bp );
+         const size_t iend( min( MR, M-ii ) );
+
+         SIMDint32 xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         for( size_t p=0UL; p<P; ++p, ap+=MR, b+=NR*2UL ) {
+            const SIMDint16 b1( loada( b ) );
+            const SIMDint16 b2( loada( b+NR ) );
+            const SIMDint16 a1( set( ap[0] ).value );
+            const SIMDint16 a2( set( ap[1] ).value );
+            const SIMDint16 a3( set( ap[2] ).value );
+            const SIMDint16 a4( set( ap[3] ).value );
+            xmm1 = madd( xmm1, a1, b1 );
+            xmm2 = madd( xmm2, a1, b2 );
+            xmm3 = madd( xmm3, a2, b1 );
+            xmm4 = madd( xmm4, a2, b2 );
+            xmm5 = madd( xmm5, a3, b1 );
+            xmm6 = madd( xmm6, a3, b2 );
+            xmm7 = madd( xmm7, a4, b1 );
+            xmm8 = madd( xmm8, a4, b2 );
+         }
+
+         storeu( tmp                , xmm1 );
+         storeu( tmp+SIMDSIZE       , xmm2 );
+         storeu( tmp+NR             , xmm3 );
+         storeu( tmp+NR+SIMDSIZE    , xmm4 );
+         storeu( tmp+NR*2UL         , xmm5 );
+         storeu( tmp+NR*2UL+SIMDSIZE, xmm6 );
+         storeu( tmp+NR*3UL         , xmm7 );
+         storeu( tmp+NR*3UL+SIMDSIZE, xmm8 );
+
+         for( size_t i=0UL; i<iend; ++i ) {
+            for( size_t j=0UL; j<jend; ++j ) {
+               op( ii+i, jj+j, tmp[i*NR+j] );
+            }
+         }
+      }
+   }
+
+#else
+
+   const std::unique_ptr<int32_t[]> tmp( new int32_t[N] );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      for( size_t j=0UL; j<N; ++j ) {
+         tmp[j] = 0;
+      }
+
+      for( size_t k=0UL; k<K; ++k ) {
+         const int32_t a( A(i,k) );
+         for( size_t j=0UL; j<N; ++j ) {
+            tmp[j] += a * int32_t( B(k,j) );
+         }
+      }
+
+      for( size_t j=0UL; j<N; ++j ) {
+         op( i, j, tmp[j] );
+      }
+   }
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  QUANTIZED DENSE MATRIX MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Quantized dense matrix multiplication functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void qmmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A, const DenseMatrix<MT3,SO3>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename VT1, bool TF1, typename VT2, bool TF2 >
+void qmmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A, const DenseMatrix<MT3,SO3>& B,
+           const DenseVector<VT1,TF1>& rowScales, const DenseVector<VT2,TF2>& colScales );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low precision integral dense matrix multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the product of the two given dense matrices with 8-bit or 16-bit
+// integral elements (i.e. \c int8_t, \c uint8_t, or \c int16_t) and stores the result in the
+// given target matrix \a C. In contrast to the default matrix multiplication, all products
+// are accumulated in 32-bit integral values, independent of the size of the matrices:
+
+   \code
+   blaze::DynamicMatrix<int8_t> A( 200UL, 300UL ), B( 300UL, 100UL );
+   blaze::DynamicMatrix<int32_t> C;
+
+   // ... Initialization of A and B
+
+   blaze::qmmm( C, A, B );
+   \endcode
+
+// In case the sizes of \a A and \a B don't match, a \a std::invalid_argument exception is
+// thrown. In case \a C is not resizable and doesn't match the size of the product, a
+// \a std::invalid_argument exception is thrown. Note that the 32-bit accumulation may overflow
+// for large inner dimensions, as for instance for more than 33025 products of two maximum
+// \c uint8_t values or for more than two products of two maximum \c int16_t values.
+*/
+template< typename MT1  // Type of the target matrix
+        , bool SO1      // Storage order of the target matrix
+        , typename MT2  // Type of the left-hand side operand
+        , bool SO2      // Storage order of the left-hand side operand
+        , typename MT3  // Type of the right-hand side operand
+        , bool SO3 >    // Storage order of the right-hand side operand
+void qmmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_STATIC_ASSERT_MSG( IMMMOperandHelper< ElementType_<MT2> >::value &&
+                            IMMMOperandHelper< ElementType_<MT3> >::value,
+                            "Invalid element types of the multiplication operands" );
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT2> a( ~A );
+   CompositeType_<MT3> b( ~B );
+
+   resize( ~C, a.rows(), b.columns(), false );
+
+   immm( a, b, IMMMUpdate<MT1,int32_t>( ~C, 1, 0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantized dense matrix multiplication with row and column scaling factors
+//        (\f$ C_{ij}=r_i*c_j*(A*B)_{ij} \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param rowScales The scaling factors for the rows of the product.
+// \param colScales The scaling factors for the columns of the product.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid number of row scaling factors.
+// \exception std::invalid_argument Invalid number of column scaling factors.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the product of the two given dense matrices with 8-bit or 16-bit
+// integral elements (i.e. \c int8_t, \c uint8_t, or \c int16_t). All products are accumulated
+// in 32-bit integral values, which are scaled by the according row and column scaling factors
+// while writing the result to the target matrix \a C. This corresponds to the dequantization
+// of a product of two matrices that have been quantized with per-row (\a A) and per-column
+// (\a B) scaling factors:
+
+   \code
+   blaze::DynamicMatrix<int8_t> A( 200UL, 300UL ), B( 300UL, 100UL );
+   blaze::DynamicVector<float> rs( 200UL ), cs( 100UL );
+   blaze::DynamicMatrix<float> C;
+
+   // ... Quantization of the original matrices into A and B with scaling factors rs and cs
+
+   blaze::qmmm( C, A, B, rs, cs );  // C(i,j) = rs[i] * cs[j] * (A*B)(i,j)
+   \endcode
+
+// In case the sizes of \a A and \a B don't match or in case the number of scaling factors
+// doesn't match the number of rows or columns of the product, a \a std::invalid_argument
+// exception is thrown. In case \a C is not resizable and doesn't match the size of the
+// product, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the target matrix
+        , bool SO1      // Storage order of the target matrix
+        , typename MT2  // Type of the left-hand side operand
+        , bool SO2      // Storage order of the left-hand side operand
+        , typename MT3  // Type of the right-hand side operand
+        , bool SO3      // Storage order of the right-hand side operand
+        , typename VT1  // Type of the row scaling factors
+        , bool TF1      // Transpose flag of the row scaling factors
+        , typename VT2  // Type of the column scaling factors
+        , bool TF2 >    // Transpose flag of the column scaling factors
+void qmmm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A, const DenseMatrix<MT3,SO3>& B,
+           const DenseVector<VT1,TF1>& rowScales, const DenseVector<VT2,TF2>& colScales )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_STATIC_ASSERT_MSG( IMMMOperandHelper< ElementType_<MT2> >::value &&
+                            IMMMOperandHelper< ElementType_<MT3> >::value,
+                            "Invalid element types of the multiplication operands" );
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rowScales).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of row scaling factors" );
+   }
+
+   if( (~colScales).size() != (~B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of column scaling factors" );
+   }
+
+   CompositeType_<MT2> a( ~A );
+   CompositeType_<MT3> b( ~B );
+   CompositeType_<VT1> r( ~rowScales );
+   CompositeType_<VT2> c( ~colScales );
+
+   resize( ~C, a.rows(), b.columns(), false );
+
+   using RT = RemoveReference_< CompositeType_<VT1> >;
+   using CT = RemoveReference_< CompositeType_<VT2> >;
+
+   immm( a, b, IMMMScale<MT1,RT,CT>( ~C, r, c ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1048 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Jacobi3x3.h
+//  \brief Header file for the branch-free Jacobi based 3x3 decompositions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_JACOBI3X3_H_
+#define _BLAZE_MATH_DENSE_JACOBI3X3_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/simd/Approximation.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of sweeps of the 3x3 Jacobi algorithms.
+// \ingroup dense_matrix
+//
+// The 3x3 Jacobi algorithms perform a fixed number of sweeps in order to avoid any data dependent
+// branches. Due to the quadratic convergence of the cyclic Jacobi method this suffices to reduce
+// the off-diagonal elements of any 3x3 matrix below double precision accuracy.
+*/
+constexpr size_t JACOBI3X3_SWEEPS = 5UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum number of matrices of a batch for a parallel 3x3 decomposition.
+// \ingroup dense_matrix
+//
+// Batches of 3x3 matrices are only distributed among the available threads in case they
+// contain at least this many matrices. Since a single decomposition takes only several hundred
+// floating point operations, smaller batches are processed by the calling thread in order to
+// avoid the synchronization overhead.
+*/
+constexpr size_t JACOBI3X3_SMP_THRESHOLD = 2048UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS JACOBI3X3SCALAR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar operations for the 3x3 Jacobi algorithms.
+// \ingroup dense_matrix
+//
+// This class provides the same interface as the SIMDApproxTraits class template for a single
+// scalar value. It enables the execution of the 3x3 Jacobi algorithms for individual matrices.
+*/
+template< typename ET >  // Type of the elements
+struct Jacobi3x3Scalar
+{
+   using Type        = ET;    //!< Type of the scalar values.
+   using ElementType = ET;    //!< Type of the elements.
+   using Mask        = bool;  //!< Type of the comparison results.
+
+   enum : size_t { size = 1UL };
+
+   static BLAZE_ALWAYS_INLINE Type set( ET v ) noexcept { return v; }
+
+   static BLAZE_ALWAYS_INLINE Type add ( Type a, Type b ) noexcept { return a + b; }
+   static BLAZE_ALWAYS_INLINE Type sub ( Type a, Type b ) noexcept { return a - b; }
+   static BLAZE_ALWAYS_INLINE Type mul ( Type a, Type b ) noexcept { return a * b; }
+   static BLAZE_ALWAYS_INLINE Type div ( Type a, Type b ) noexcept { return a / b; }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return std::sqrt( a ); }
+   static BLAZE_ALWAYS_INLINE Type max ( Type a, Type b ) noexcept { return ( a < b ? b : a ); }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return a < b; }
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept { return ( m ? a : b ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS JACOBI3X3
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Branch-free Jacobi algorithms for 3x3 matrices.
+// \ingroup dense_matrix
+//
+// This class implements the singular value decomposition and the symmetric eigenvalue
+// decomposition of 3x3 matrices based on the cyclic Jacobi method. All algorithms are free of
+// data dependent branches, i.e. they are expressed in terms of the arithmetic operations, the
+// comparisons and the blending operation of the given operations \a Ops. Therefore the same
+// implementation processes either a single matrix (see the Jacobi3x3Scalar class template) or
+// one matrix per lane of a SIMD vector (see the SIMDApproxTraits class template).
+//
+// All matrices are given as arrays of nine values in row-major order. Before the iteration the
+// matrices are scaled by the reciprocal of their largest absolute element to avoid overflow and
+// underflow of the squared elements.
+*/
+template< typename Ops >  // Type of the elementary operations
+struct Jacobi3x3
+{
+   using Type = typename Ops::Type;         //!< Type of the processed values.
+   using ET   = typename Ops::ElementType;  //!< Type of the elements.
+   using Mask = typename Ops::Mask;         //!< Type of the comparison results.
+
+   //**Absolute value******************************************************************************
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept {
+      return Ops::max( a, Ops::sub( Ops::set( ET(0) ), a ) );
+   }
+   //**********************************************************************************************
+
+   //**Scaling*************************************************************************************
+   /*!\brief Scales the given matrix by the reciprocal of its largest absolute element.
+   //
+   // \param a The matrix to be scaled.
+   // \return The largest absolute element of the original matrix.
+   */
+   static BLAZE_ALWAYS_INLINE Type normalize( Type (&a)[9] ) noexcept
+   {
+      Type m( Ops::set( std::numeric_limits<ET>::min() ) );
+      for( size_t k=0UL; k<9UL; ++k ) {
+         m = Ops::max( m, abs( a[k] ) );
+      }
+
+      const Type inv( Ops::div( Ops::set( ET(1) ), m ) );
+      for( size_t k=0UL; k<9UL; ++k ) {
+         a[k] = Ops::mul( a[k], inv );
+      }
+
+      return m;
+   }
+   //**********************************************************************************************
+
+   //**Identity************************************************************************************
+   static BLAZE_ALWAYS_INLINE void identity( Type (&a)[9] ) noexcept
+   {
+      for( size_t k=0UL; k<9UL; ++k ) {
+         a[k] = Ops::set( k % 4UL == 0UL ? ET(1) : ET(0) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Jacobi rotation*****************************************************************************
+   /*!\brief Computes the Jacobi rotation that diagonalizes a symmetric 2x2 matrix.
+   //
+   // \param alpha The first diagonal element.
+   // \param beta The second diagonal element.
+   // \param gamma The off-diagonal element.
+   // \param c The resulting cosine of the rotation.
+   // \param s The resulting sine of the rotation.
+   // \return void
+   //
+   // The rotation \f$ J = [c,s;-s,c] \f$ satisfies \f$ J^T [\alpha,\gamma;\gamma,\beta] J = D \f$
+   // for a diagonal matrix \f$ D \f$. The tangent \f$ t=s/c \f$ is the smaller root of the
+   // quadratic equation \f$ t^2 + 2 \zeta t - 1 = 0 \f$ with
+   // \f$ \zeta = (\beta-\alpha)/(2\gamma) \f$. It is evaluated in a form that is free of
+   // cancellation and that gracefully yields the identity for \f$ \gamma = 0 \f$.
+   */
+   static BLAZE_ALWAYS_INLINE void rotation( Type alpha, Type beta, Type gamma, Type& c, Type& s ) noexcept
+   {
+      const Type zero( Ops::set( ET(0) ) );
+      const Type one ( Ops::set( ET(1) ) );
+      const Type tiny( Ops::set( std::numeric_limits<ET>::min() ) );
+
+      const Type tau ( Ops::sub( beta, alpha ) );
+      const Type g2  ( Ops::add( gamma, gamma ) );
+      const Type sign( Ops::select( Ops::cmplt( tau, zero ), Ops::set( ET(-1) ), one ) );
+      const Type g2sq( Ops::mul( g2, g2 ) );
+      const Type root( Ops::sqrt( Ops::add( Ops::mul( tau, tau ), g2sq ) ) );
+      const Type den ( Ops::max( Ops::add( abs( tau ), root ), tiny ) );
+      const Type hyp ( Ops::max( Ops::sqrt( Ops::add( Ops::mul( den, den ), g2sq ) ), den ) );
+      const Type inv ( Ops::div( one, hyp ) );
+
+      c = Ops::mul( den, inv );
+      s = Ops::mul( Ops::mul( g2, sign ), inv );
+   }
+   //**********************************************************************************************
+
+   //**Rotation of two columns*********************************************************************
+   /*!\brief Applies the rotation \f$ [c,s;-s,c] \f$ from the right to the columns \a p and \a q. */
+   static BLAZE_ALWAYS_INLINE void rotateColumns( Type (&a)[9], size_t p, size_t q, Type c, Type s ) noexcept
+   {
+      for( size_t i=0UL; i<9UL; i+=3UL ) {
+         const Type ap( a[i+p] );
+         const Type aq( a[i+q] );
+         a[i+p] = Ops::sub( Ops::mul( c, ap ), Ops::mul( s, aq ) );
+         a[i+q] = Ops::add( Ops::mul( s, ap ), Ops::mul( c, aq ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Rotation of two rows************************************************************************
+   /*!\brief Applies the rotation \f$ [c,-s;s,c] \f$ from the left to the rows \a p and \a q. */
+   static BLAZE_ALWAYS_INLINE void rotateRows( Type (&a)[9], size_t p, size_t q, Type c, Type s ) noexcept
+   {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         const Type ap( a[3UL*p+j] );
+         const Type aq( a[3UL*q+j] );
+         a[3UL*p+j] = Ops::sub( Ops::mul( c, ap ), Ops::mul( s, aq ) );
+         a[3UL*q+j] = Ops::add( Ops::mul( s, ap ), Ops::mul( c, aq ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Conditional swap of two columns*************************************************************
+   /*!\brief Swaps the columns \a p and \a q in all lanes selected by \a m.
+   //
+   // The column moved to position \a q is negated in order to preserve the determinant.
+   */
+   static BLAZE_ALWAYS_INLINE void swapColumns( Mask m, Type (&a)[9], size_t p, size_t q ) noexcept
+   {
+      for( size_t i=0UL; i<9UL; i+=3UL ) {
+         const Type ap( a[i+p] );
+         const Type aq( a[i+q] );
+         a[i+p] = Ops::select( m, aq, ap );
+         a[i+q] = Ops::select( m, Ops::sub( Ops::set( ET(0) ), ap ), aq );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Conditional swap of two values**************************************************************
+   static BLAZE_ALWAYS_INLINE void swapValues( Mask m, Type& a, Type& b ) noexcept
+   {
+      const Type tmp( a );
+      a = Ops::select( m, b, a );
+      b = Ops::select( m, tmp, b );
+   }
+   //**********************************************************************************************
+
+   //**Givens rotation*****************************************************************************
+   /*!\brief Annihilates the element \f$ b_{q,col} \f$ by a Givens rotation of the rows \a p and \a q.
+   //
+   // \param b The matrix to be reduced.
+   // \param u The accumulated orthogonal matrix, i.e. \f$ u*b \f$ is invariant.
+   // \param p The index of the pivot row.
+   // \param q The index of the row to be reduced.
+   // \param col The index of the column.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void givens( Type (&b)[9], Type (&u)[9], size_t p, size_t q, size_t col ) noexcept
+   {
+      const Type zero( Ops::set( ET(0) ) );
+
+      const Type x( b[3UL*p+col] );
+      const Type y( b[3UL*q+col] );
+      const Type r( Ops::sqrt( Ops::add( Ops::mul( x, x ), Ops::mul( y, y ) ) ) );
+      const Mask nonzero( Ops::cmplt( zero, r ) );
+      const Type rinv( Ops::div( Ops::set( ET(1) ), Ops::max( r, Ops::set( std::numeric_limits<ET>::min() ) ) ) );
+      const Type c( Ops::select( nonzero, Ops::mul( x, rinv ), Ops::set( ET(1) ) ) );
+      const Type s( Ops::select( nonzero, Ops::mul( y, rinv ), zero ) );
+
+      rotateRows( b, p, q, c, Ops::sub( zero, s ) );
+      rotateColumns( u, p, q, c, Ops::sub( zero, s ) );
+   }
+   //**********************************************************************************************
+
+   //**Singular value decomposition****************************************************************
+   /*!\brief Singular value decomposition \f$ A = U \Sigma V^T \f$ of a 3x3 matrix.
+   //
+   // \param a The given matrix.
+   // \param u The resulting rotation \a U.
+   // \param sigma The resulting singular values in descending order of their magnitude.
+   // \param v The resulting rotation \a V.
+   // \return void
+   //
+   // The columns of \f$ A V \f$ are orthogonalized by one-sided Jacobi rotations, sorted by
+   // decreasing norm and finally reduced to diagonal form by Givens rotations. Both \a U and
+   // \a V are proper rotations, i.e. in case \f$ \det(A) < 0 \f$ the smallest singular value
+   // is negative.
+   */
+   static BLAZE_ALWAYS_INLINE void svd( const Type (&a)[9], Type (&u)[9], Type (&sigma)[3], Type (&v)[9] ) noexcept
+   {
+      Type b[9];
+      for( size_t k=0UL; k<9UL; ++k ) {
+         b[k] = a[k];
+      }
+
+      const Type scale( normalize( b ) );
+
+      identity( v );
+
+      for( size_t sweep=0UL; sweep<JACOBI3X3_SWEEPS; ++sweep ) {
+         for( size_t pair=0UL; pair<3UL; ++pair )
+         {
+            const size_t p( pair == 2UL ? 1UL : 0UL );
+            const size_t q( pair == 0UL ? 1UL : 2UL );
+
+            Type alpha( Ops::set( ET(0) ) ), beta( alpha ), gamma( alpha );
+            for( size_t i=0UL; i<9UL; i+=3UL ) {
+               alpha = Ops::add( alpha, Ops::mul( b[i+p], b[i+p] ) );
+               beta  = Ops::add( beta , Ops::mul( b[i+q], b[i+q] ) );
+               gamma = Ops::add( gamma, Ops::mul( b[i+p], b[i+q] ) );
+            }
+
+            Type c, s;
+            rotation( alpha, beta, gamma, c, s );
+            rotateColumns( b, p, q, c, s );
+            rotateColumns( v, p, q, c, s );
+         }
+      }
+
+      Type norm[3];
+      for( size_t j=0UL; j<3UL; ++j ) {
+         norm[j] = Ops::add( Ops::add( Ops::mul( b[j], b[j] ), Ops::mul( b[3UL+j], b[3UL+j] ) ),
+                             Ops::mul( b[6UL+j], b[6UL+j] ) );
+      }
+
+      for( size_t k=0UL; k<3UL; ++k )
+      {
+         const size_t p( k == 1UL ? 1UL : 0UL );
+         const size_t q( p + 1UL );
+         const Mask m( Ops::cmplt( norm[p], norm[q] ) );
+
+         swapColumns( m, b, p, q );
+         swapColumns( m, v, p, q );
+         swapValues( m, norm[p], norm[q] );
+      }
+
+      identity( u );
+      givens( b, u, 0UL, 1UL, 0UL );
+      givens( b, u, 0UL, 2UL, 0UL );
+      givens( b, u, 1UL, 2UL, 1UL );
+
+      for( size_t j=0UL; j<3UL; ++j ) {
+         sigma[j] = Ops::mul( b[4UL*j], scale );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Symmetric eigenvalue decomposition**********************************************************
+   /*!\brief Eigenvalue decomposition \f$ A = V \Lambda V^T \f$ of a symmetric 3x3 matrix.
+   //
+   // \param a The given symmetric matrix (only the lower part is referenced).
+   // \param w The resulting eigenvalues in ascending order.
+   // \param v The resulting rotation \a V containing the eigenvectors in its columns.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void eigh( const Type (&a)[9], Type (&w)[3], Type (&v)[9] ) noexcept
+   {
+      Type b[9] = { a[0], a[3], a[6], a[3], a[4], a[7], a[6], a[7], a[8] };
+
+      const Type scale( normalize( b ) );
+
+      identity( v );
+
+      for( size_t sweep=0UL; sweep<JACOBI3X3_SWEEPS; ++sweep ) {
+         for( size_t pair=0UL; pair<3UL; ++pair )
+         {
+            const size_t p( pair == 2UL ? 1UL : 0UL );
+            const size_t q( pair == 0UL ? 1UL : 2UL );
+
+            Type c, s;
+            rotation( b[4UL*p], b[4UL*q], b[3UL*p+q], c, s );
+            rotateColumns( b, p, q, c, s );
+            rotateRows( b, p, q, c, s );
+            rotateColumns( v, p, q, c, s );
+         }
+      }
+
+      for( size_t j=0UL; j<3UL; ++j ) {
+         w[j] = b[4UL*j];
+      }
+
+      for( size_t k=0UL; k<3UL; ++k )
+      {
+         const size_t p( k == 1UL ? 1UL : 0UL );
+         const size_t q( p + 1UL );
+         const Mask m( Ops::cmplt( w[q], w[p] ) );
+
+         swapColumns( m, v, p, q );
+         swapValues( m, w[p], w[q] );
+      }
+
+      for( size_t j=0UL; j<3UL; ++j ) {
+         w[j] = Ops::mul( w[j], scale );
+      }
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gathering of the elements of a 3x3 matrix into a strided array.
+// \ingroup dense_matrix
+//
+// \param A The given 3x3 matrix.
+// \param dst Pointer to the first element of the destination array.
+// \param stride The distance between two consecutive elements in the destination array.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+BLAZE_ALWAYS_INLINE void jacobi3x3Load( const MT& A, ElementType_<MT>* dst, size_t stride ) noexcept
+{
+   for( size_t i=0UL; i<3UL; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         dst[(3UL*i+j)*stride] = A(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scattering of the elements of a strided array into a 3x3 matrix.
+// \ingroup dense_matrix
+//
+// \param A The target 3x3 matrix.
+// \param src Pointer to the first element of the source array.
+// \param stride The distance between two consecutive elements in the source array.
+// \param transpose \a true in case the transpose of the source matrix is stored.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+BLAZE_ALWAYS_INLINE void jacobi3x3Store( MT& A, const ElementType_<MT>* src, size_t stride, bool transpose ) noexcept
+{
+   for( size_t i=0UL; i<3UL; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         A(i,j) = src[( transpose ? 3UL*j+i : 3UL*i+j )*stride];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the 3x3 singular value decomposition.
+// \ingroup dense_matrix
+*/
+struct Svd3x3Kernel
+{
+   enum : size_t { outputs = 21UL };
+
+   template< typename Ops >
+   static BLAZE_ALWAYS_INLINE void apply( const typename Ops::Type (&a)[9], typename Ops::Type (&r)[outputs] ) noexcept
+   {
+      typename Ops::Type u[9], s[3], v[9];
+      Jacobi3x3<Ops>::svd( a, u, s, v );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         r[k    ] = u[k];
+         r[k+12UL] = v[k];
+      }
+      for( size_t k=0UL; k<3UL; ++k ) {
+         r[k+9UL] = s[k];
+      }
+   }
+
+   template< typename MT1, typename VT, typename MT2 >
+   static BLAZE_ALWAYS_INLINE void store( MT1& U, VT& s, MT2& V, const ElementType_<MT1>* src, size_t stride ) noexcept
+   {
+      jacobi3x3Store( U, src, stride, false );
+      for( size_t k=0UL; k<3UL; ++k ) {
+         s[k] = src[(k+9UL)*stride];
+      }
+      jacobi3x3Store( V, src+12UL*stride, stride, true );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the 3x3 polar decomposition.
+// \ingroup dense_matrix
+*/
+struct Polar3x3Kernel
+{
+   enum : size_t { outputs = 18UL };
+
+   template< typename Ops >
+   static BLAZE_ALWAYS_INLINE void apply( const typename Ops::Type (&a)[9], typename Ops::Type (&r)[outputs] ) noexcept
+   {
+      typename Ops::Type u[9], s[3], v[9];
+      Jacobi3x3<Ops>::svd( a, u, s, v );
+
+      for( size_t i=0UL; i<3UL; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            typename Ops::Type rij( Ops::set( typename Ops::ElementType(0) ) ), sij( rij );
+            for( size_t k=0UL; k<3UL; ++k ) {
+               rij = Ops::add( rij, Ops::mul( u[3UL*i+k], v[3UL*j+k] ) );
+               sij = Ops::add( sij, Ops::mul( Ops::mul( v[3UL*i+k], s[k] ), v[3UL*j+k] ) );
+            }
+            r[3UL*i+j    ] = rij;
+            r[3UL*i+j+9UL] = sij;
+         }
+      }
+   }
+
+   template< typename MT1, typename MT2 >
+   static BLAZE_ALWAYS_INLINE void store( MT1& R, MT2& S, const ElementType_<MT1>* src, size_t stride ) noexcept
+   {
+      jacobi3x3Store( R, src, stride, false );
+      jacobi3x3Store( S, src+9UL*stride, stride, false );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the symmetric 3x3 eigenvalue decomposition.
+// \ingroup dense_matrix
+*/
+struct Eigh3x3Kernel
+{
+   enum : size_t { outputs = 12UL };
+
+   template< typename Ops >
+   static BLAZE_ALWAYS_INLINE void apply( const typename Ops::Type (&a)[9], typename Ops::Type (&r)[outputs] ) noexcept
+   {
+      typename Ops::Type w[3], v[9];
+      Jacobi3x3<Ops>::eigh( a, w, v );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         r[k] = w[k];
+      }
+      for( size_t k=0UL; k<9UL; ++k ) {
+         r[k+3UL] = v[k];
+      }
+   }
+
+   template< typename VT, typename MT >
+   static BLAZE_ALWAYS_INLINE void store( VT& w, MT& V, const ElementType_<MT>* src, size_t stride ) noexcept
+   {
+      for( size_t k=0UL; k<3UL; ++k ) {
+         w[k] = src[k*stride];
+      }
+      jacobi3x3Store( V, src+3UL*stride, stride, false );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a 3x3 kernel to a range of matrices.
+// \ingroup dense_matrix
+//
+// \param begin The index of the first matrix.
+// \param end The index one past the last matrix.
+// \param load The operation gathering the elements of a matrix into a strided array.
+// \param store The operation scattering the results of a matrix from a strided array.
+// \return void
+//
+// In case SSE2, AVX, or AVX-512 is available, the matrices are processed in groups of as many
+// matrices as a SIMD vector has lanes. The elements of each group are transposed into one SIMD
+// vector per matrix element, such that every lane processes a separate matrix. The remaining
+// matrices are processed individually.
+*/
+template< typename Kernel  // Type of the 3x3 kernel
+        , typename ET      // Type of the elements
+        , typename Load    // Type of the load operation
+        , typename Store > // Type of the store operation
+void jacobi3x3Range( size_t begin, size_t end, Load& load, Store& store )
+{
+   constexpr size_t M( Kernel::outputs );
+
+   size_t i( begin );
+
+#if BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+   {
+      using Ops  = SIMDApproxTraits<ET>;
+      using Type = typename Ops::Type;
+
+      constexpr size_t L( Ops::size );
+
+      ET in[9UL*L], out[M*L];
+      Type a[9], r[M];
+
+      for( ; i+L<=end; i+=L )
+      {
+         for( size_t l=0UL; l<L; ++l ) {
+            load( i+l, in+l, L );
+         }
+         for( size_t k=0UL; k<9UL; ++k ) {
+            a[k] = Ops::loadu( in+k*L );
+         }
+
+         Kernel::template apply<Ops>( a, r );
+
+         for( size_t k=0UL; k<M; ++k ) {
+            Ops::storeu( out+k*L, r[k] );
+         }
+         for( size_t l=0UL; l<L; ++l ) {
+            store( i+l, out+l, L );
+         }
+      }
+   }
+#endif
+
+   for( ; i<end; ++i )
+   {
+      ET a[9], r[M];
+      load( i, a, 1UL );
+      Kernel::template apply< Jacobi3x3Scalar<ET> >( a, r );
+      store( i, r, 1UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a 3x3 kernel to a batch of matrices.
+// \ingroup dense_matrix
+//
+// \param N The number of matrices.
+// \param load The operation gathering the elements of a matrix into a strided array.
+// \param store The operation scattering the results of a matrix from a strided array.
+// \return void
+//
+// In case parallelization is enabled and the batch contains at least JACOBI3X3_SMP_THRESHOLD
+// matrices, the matrices are distributed among all available threads, each thread processing
+// a contiguous range of matrices (see jacobi3x3Range()).
+*/
+template< typename Kernel  // Type of the 3x3 kernel
+        , typename ET      // Type of the elements
+        , typename Load    // Type of the load operation
+        , typename Store > // Type of the store operation
+void jacobi3x3Batch( size_t N, Load load, Store store )
+{
+   smpForRange( N, JACOBI3X3_SMP_THRESHOLD, [&load,&store]( size_t begin, size_t end ) {
+      jacobi3x3Range<Kernel,ET>( begin, end, load, store );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  3x3 DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name 3x3 decomposition functions */
+//@{
+template< typename Type, bool SO1, bool SO2, bool TF, bool SO3 >
+void svd3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticMatrix<Type,3UL,3UL,SO2>& U,
+             StaticVector<Type,3UL,TF>& s, StaticMatrix<Type,3UL,3UL,SO3>& V );
+
+template< typename Type, bool SO1, bool SO2, bool SO3 >
+void polar3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticMatrix<Type,3UL,3UL,SO2>& R,
+               StaticMatrix<Type,3UL,3UL,SO3>& S );
+
+template< typename Type, bool SO1, bool TF, bool SO2 >
+void eigh3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticVector<Type,3UL,TF>& w,
+              StaticMatrix<Type,3UL,3UL,SO2>& V );
+
+template< typename Type, bool SO1, typename A1, bool SO2, typename A2
+        , bool TF, typename A3, bool SO3, typename A4 >
+void svd3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+             std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A2 >& U,
+             std::vector< StaticVector<Type,3UL,TF>, A3 >& s,
+             std::vector< StaticMatrix<Type,3UL,3UL,SO3>, A4 >& V );
+
+template< typename Type, bool SO1, typename A1, bool SO2, typename A2, bool SO3, typename A3 >
+void polar3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+               std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A2 >& R,
+               std::vector< StaticMatrix<Type,3UL,3UL,SO3>, A3 >& S );
+
+template< typename Type, bool SO1, typename A1, bool TF, typename A2, bool SO2, typename A3 >
+void eigh3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+              std::vector< StaticVector<Type,3UL,TF>, A2 >& w,
+              std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A3 >& V );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free singular value decomposition (SVD) of a 3x3 matrix.
+// \ingroup dense_matrix
+//
+// \param A The given 3x3 matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \return void
+//
+// This function computes the singular value decomposition \f$ A = U \cdot diag(s) \cdot V \f$
+// of the given 3x3 matrix by means of the one-sided Jacobi method. In accordance with the svd()
+// function, the right singular vectors are stored in the rows of \a V. In contrast to the svd()
+// function, \a U and \a V are always proper rotations (i.e. their determinant is 1). Therefore
+// the singular values are sorted in descending order of their magnitude and the last singular
+// value is negative in case \f$ \det(A) < 0 \f$. This sign convention is common in continuum
+// mechanics and computer graphics.
+//
+// The decomposition performs a fixed number of operations without any data dependent branches
+// and without calling LAPACK. In order to decompose a large number of matrices, the batched
+// svd3x3() function should be preferred.
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A, U, V;
+   blaze::StaticVector<double,3UL> s;
+   // ... Initialization of A
+
+   svd3x3( A, U, s, V );  // A == U * D * V with the singular values s on the diagonal of D
+   \endcode
+
+// \note This function can only be used for matrices with \c float or \c double element type.
+// The attempt to call the function with any other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices and the vector
+        , bool SO1       // Storage order of matrix A
+        , bool SO2       // Storage order of matrix U
+        , bool TF        // Transpose flag of vector s
+        , bool SO3 >     // Storage order of matrix V
+void svd3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticMatrix<Type,3UL,3UL,SO2>& U,
+             StaticVector<Type,3UL,TF>& s, StaticMatrix<Type,3UL,3UL,SO3>& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   Type a[9], r[Svd3x3Kernel::outputs];
+
+   jacobi3x3Load( A, a, 1UL );
+   Svd3x3Kernel::apply< Jacobi3x3Scalar<Type> >( a, r );
+   Svd3x3Kernel::store( U, s, V, r, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free polar decomposition of a 3x3 matrix.
+// \ingroup dense_matrix
+//
+// \param A The given 3x3 matrix.
+// \param R The resulting rotation.
+// \param S The resulting symmetric matrix.
+// \return void
+//
+// This function computes the polar decomposition \f$ A = R \cdot S \f$ of the given 3x3 matrix
+// into the rotation \a R and the symmetric matrix \a S. It is based on the singular value
+// decomposition of \a A (see svd3x3()). In case \f$ \det(A) > 0 \f$, \a S is positive definite
+// and the decomposition coincides with the classical polar decomposition. In case
+// \f$ \det(A) < 0 \f$, \a R is still a proper rotation and the reflection is contained in the
+// indefinite matrix \a S.
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> F, R, U;
+   // ... Initialization of the deformation gradient F
+
+   polar3x3( F, R, U );  // F == R * U
+   \endcode
+
+// \note This function can only be used for matrices with \c float or \c double element type.
+// The attempt to call the function with any other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices
+        , bool SO1       // Storage order of matrix A
+        , bool SO2       // Storage order of matrix R
+        , bool SO3 >     // Storage order of matrix S
+void polar3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticMatrix<Type,3UL,3UL,SO2>& R,
+               StaticMatrix<Type,3UL,3UL,SO3>& S )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   Type a[9], r[Polar3x3Kernel::outputs];
+
+   jacobi3x3Load( A, a, 1UL );
+   Polar3x3Kernel::apply< Jacobi3x3Scalar<Type> >( a, r );
+   Polar3x3Kernel::store( R, S, r, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free eigenvalue decomposition of a symmetric 3x3 matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric 3x3 matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+//
+// This function computes the eigenvalues and eigenvectors of the given symmetric 3x3 matrix by
+// means of the cyclic Jacobi method. In accordance with the eigh() function, the eigenvalues are
+// sorted in ascending order, the eigenvectors are stored in the columns of \a V and only the
+// lower part of \a A is referenced. \a V is a proper rotation.
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A, V;
+   blaze::StaticVector<double,3UL> w;
+   // ... Initialization of the symmetric matrix A
+
+   eigh3x3( A, w, V );  // A == V * D * trans( V ) with the eigenvalues w on the diagonal of D
+   \endcode
+
+// \note This function can only be used for matrices with \c float or \c double element type.
+// The attempt to call the function with any other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices and the vector
+        , bool SO1       // Storage order of matrix A
+        , bool TF        // Transpose flag of vector w
+        , bool SO2 >     // Storage order of matrix V
+void eigh3x3( const StaticMatrix<Type,3UL,3UL,SO1>& A, StaticVector<Type,3UL,TF>& w,
+              StaticMatrix<Type,3UL,3UL,SO2>& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   Type a[9], r[Eigh3x3Kernel::outputs];
+
+   jacobi3x3Load( A, a, 1UL );
+   Eigh3x3Kernel::apply< Jacobi3x3Scalar<Type> >( a, r );
+   Eigh3x3Kernel::store( w, V, r, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free singular value decomposition (SVD) of a batch of 3x3 matrices.
+// \ingroup dense_matrix
+//
+// \param A The given 3x3 matrices.
+// \param U The resulting matrices of left singular vectors.
+// \param s The resulting vectors of singular values.
+// \param V The resulting matrices of right singular vectors.
+// \return void
+//
+// This function computes the singular value decompositions of all given 3x3 matrices (see the
+// svd3x3() function for a single matrix for details). The vectors \a U, \a s, and \a V are
+// resized to the number of matrices. The matrices are processed in groups of as many matrices
+// as a SIMD vector has lanes, each lane processing a separate matrix. In case parallelization
+// is enabled, the groups are distributed among all available threads.
+
+   \code
+   using M  = blaze::StaticMatrix<double,3UL,3UL>;
+   using SV = blaze::StaticVector<double,3UL>;
+
+   std::vector< M , blaze::AlignedAllocator<M>  > F, U, V;
+   std::vector< SV, blaze::AlignedAllocator<SV> > s;
+   // ... Initialization of F
+
+   svd3x3( F, U, s, V );
+   \endcode
+*/
+template< typename Type  // Element type of the matrices and vectors
+        , bool SO1       // Storage order of the matrices A
+        , typename A1    // Allocator of the matrices A
+        , bool SO2       // Storage order of the matrices U
+        , typename A2    // Allocator of the matrices U
+        , bool TF        // Transpose flag of the vectors s
+        , typename A3    // Allocator of the vectors s
+        , bool SO3       // Storage order of the matrices V
+        , typename A4 >  // Allocator of the matrices V
+void svd3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+             std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A2 >& U,
+             std::vector< StaticVector<Type,3UL,TF>, A3 >& s,
+             std::vector< StaticMatrix<Type,3UL,3UL,SO3>, A4 >& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t N( A.size() );
+
+   U.resize( N );
+   s.resize( N );
+   V.resize( N );
+
+   jacobi3x3Batch<Svd3x3Kernel,Type>( N,
+      [&A]( size_t i, Type* dst, size_t stride ) {
+         jacobi3x3Load( A[i], dst, stride );
+      },
+      [&U,&s,&V]( size_t i, const Type* src, size_t stride ) {
+         Svd3x3Kernel::store( U[i], s[i], V[i], src, stride );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free polar decomposition of a batch of 3x3 matrices.
+// \ingroup dense_matrix
+//
+// \param A The given 3x3 matrices.
+// \param R The resulting rotations.
+// \param S The resulting symmetric matrices.
+// \return void
+//
+// This function computes the polar decompositions of all given 3x3 matrices (see the polar3x3()
+// function for a single matrix for details). The vectors \a R and \a S are resized to the number
+// of matrices. The matrices are processed in groups of as many matrices as a SIMD vector has
+// lanes, each lane processing a separate matrix. In case parallelization is enabled, the groups
+// are distributed among all available threads.
+*/
+template< typename Type  // Element type of the matrices
+        , bool SO1       // Storage order of the matrices A
+        , typename A1    // Allocator of the matrices A
+        , bool SO2       // Storage order of the matrices R
+        , typename A2    // Allocator of the matrices R
+        , bool SO3       // Storage order of the matrices S
+        , typename A3 >  // Allocator of the matrices S
+void polar3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+               std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A2 >& R,
+               std::vector< StaticMatrix<Type,3UL,3UL,SO3>, A3 >& S )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t N( A.size() );
+
+   R.resize( N );
+   S.resize( N );
+
+   jacobi3x3Batch<Polar3x3Kernel,Type>( N,
+      [&A]( size_t i, Type* dst, size_t stride ) {
+         jacobi3x3Load( A[i], dst, stride );
+      },
+      [&R,&S]( size_t i, const Type* src, size_t stride ) {
+         Polar3x3Kernel::store( R[i], S[i], src, stride );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Branch-free eigenvalue decomposition of a batch of symmetric 3x3 matrices.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric 3x3 matrices.
+// \param w The resulting vectors of eigenvalues.
+// \param V The resulting matrices of eigenvectors.
+// \return void
+//
+// This function computes the eigenvalue decompositions of all given symmetric 3x3 matrices (see
+// the eigh3x3() function for a single matrix for details). The vectors \a w and \a V are resized
+// to the number of matrices. The matrices are processed in groups of as many matrices as a SIMD
+// vector has lanes, each lane processing a separate matrix. In case parallelization is enabled,
+// the groups are distributed among all available threads.
+*/
+template< typename Type  // Element type of the matrices and vectors
+        , bool SO1       // Storage order of the matrices A
+        , typename A1    // Allocator of the matrices A
+        , bool TF        // Transpose flag of the vectors w
+        , typename A2    // Allocator of the vectors w
+        , bool SO2       // Storage order of the matrices V
+        , typename A3 >  // Allocator of the matrices V
+void eigh3x3( const std::vector< StaticMatrix<Type,3UL,3UL,SO1>, A1 >& A,
+              std::vector< StaticVector<Type,3UL,TF>, A2 >& w,
+              std::vector< StaticMatrix<Type,3UL,3UL,SO2>, A3 >& V )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t N( A.size() );
+
+   w.resize( N );
+   V.resize( N );
+
+   jacobi3x3Batch<Eigh3x3Kernel,Type>( N,
+      [&A]( size_t i, Type* dst, size_t stride ) {
+         jacobi3x3Load( A[i], dst, stride );
+      },
+      [&w,&V]( size_t i, const Type* src, size_t stride ) {
+         Eigh3x3Kernel::store( w[i], V[i], src, stride );
+      } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
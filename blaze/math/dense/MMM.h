@@ -56,26 +56,143 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/IntegerMMM.h>
+#include <blaze/math/dispatch/Dispatch.h>
+#include <blaze/math/dispatch/InstructionSet.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsDispatchable.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/Blocking.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  RUNTIME DISPATCHED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched dense matrix multiplication.
+// \ingroup dense_matrix
+*/
+template< typename MT1    // Type of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+struct MMMDispatchHelper
+{
+   //**********************************************************************************************
+   enum : bool { value = HasMutableDataAccess<MT1>::value &&
+                         HasConstDataAccess<MT2>::value &&
+                         HasConstDataAccess<MT3>::value &&
+                         MT1::simdEnabled && MT2::simdEnabled && MT3::simdEnabled &&
+                         IsDispatchable< ElementType_<MT1> >::value &&
+                         IsSame< ElementType_<MT1>, ElementType_<MT2> >::value &&
+                         IsSame< ElementType_<MT1>, ElementType_<MT3> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fallback of the runtime dispatched dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a false to indicate that the multiplication has not been performed.
+//
+// This function is selected in case the runtime dispatched kernel cannot be used for the
+// given combination of matrices.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+inline DisableIf_< MMMDispatchHelper<MT1,MT2,MT3>, bool >
+   dispatchedMMM( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   UNUSED_PARAMETER( C, A, B, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the dense matrix multiplication by means of the kernel for the
+// instruction set of the executing CPU (see the \c BLAZE_USE_RUNTIME_DISPATCH switch). It
+// is selected in case all three matrices provide direct access to their \c float or \c double
+// elements. In case no explicitly vectorized kernel is selected (i.e. the instruction set is
+// \c isaGeneric), the function returns \a false in order to fall back to the compile time
+// vectorized default kernel.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+inline EnableIf_< MMMDispatchHelper<MT1,MT2,MT3>, bool >
+   dispatchedMMM( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET = ElementType_<MT1>;
+
+   if( getInstructionSet() == isaGeneric )
+      return false;
+
+   const ptrdiff_t sA( A.spacing() );
+   const ptrdiff_t sB( B.spacing() );
+   const ptrdiff_t sC( (~C).spacing() );
+
+   const bool rmA( IsRowMajorMatrix<MT2>::value );
+   const bool rmB( IsRowMajorMatrix<MT3>::value );
+
+   dispatch::gemm( A.rows(), B.columns(), A.columns(), ET( alpha ),
+                   A.data(), ( rmA ? sA : 1 ), ( rmA ? 1 : sA ),
+                   B.data(), ( rmB ? sB : 1 ), ( rmB ? 1 : sB ),
+                   ET( beta ), (~C).data(), ( SO ? 1 : sC ), ( SO ? sC : 1 ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
@@ -139,6 +256,9 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( dispatchedMMM( C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
@@ -639,6 +759,9 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( dispatchedMMM( C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
@@ -1100,6 +1223,124 @@ inline void mmm( MT1& C, const MT2& A, const MT3& B )
 
 
 
+//=================================================================================================
+//
+//  MIXED PRECISION DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a mixed precision dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side single precision dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a dense matrix/dense matrix multiplication
+// of the form \f$ C=\alpha*A*B+\beta*C \f$, where the elements of \a A and/or \a B are stored
+// in a 16-bit floating point format (bfloat16 or float16). The operands are widened panel by
+// panel into single precision matrices (via the SIMD conversion kernels) and multiplied by
+// means of the general mmm() kernel, i.e. all products are accumulated in single precision.
+// Both \a A and \a B must be non-expression dense matrix types, \a C must be a non-expression,
+// non-adaptor dense matrix type with single precision elements.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+EnableIf_< IsFloat< ElementType_<MT1> > >
+   mixedMMM( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * 4UL );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   if( K == 0UL ) {
+      if( isDefault( beta ) ) {
+         reset( ~C );
+      }
+      else if( !isOne( beta ) ) {
+         (~C) *= beta;
+      }
+      return;
+   }
+
+   DynamicMatrix<float,!IsRowMajorMatrix<MT2>::value> A2;
+   DynamicMatrix<float,!IsRowMajorMatrix<MT3>::value> B2;
+
+   for( size_t kk=0UL; kk<K; kk+=KBLOCK )
+   {
+      const size_t kblock( min( KBLOCK, K - kk ) );
+
+      A2 = serial( submatrix<unaligned>( A, 0UL, kk, M, kblock, unchecked ) );
+      B2 = serial( submatrix<unaligned>( B, kk, 0UL, kblock, N, unchecked ) );
+
+      mmm( ~C, A2, B2, float( alpha ), ( kk == 0UL )?( float( beta ) ):( 1.0F ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a low precision integral dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side 32-bit integral dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a dense matrix/dense matrix multiplication
+// of the form \f$ C=\alpha*A*B+\beta*C \f$, where the elements of \a A and \a B are 8-bit or
+// 16-bit integral values (\c int8_t, \c uint8_t, or \c int16_t). The operands are packed into
+// panels of 16-bit values and all products are accumulated in 32-bit integral values (see the
+// immm() kernel). Both \a A and \a B must be non-expression dense matrix types, \a C must be
+// a non-expression, non-adaptor dense matrix type with 32-bit integral elements.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+EnableIf_< IsSame< ElementType_<MT1>, int32_t > >
+   mixedMMM( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   immm( A, B, IMMMUpdate<MT1,ST>( ~C, alpha, beta ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  LOWER DENSE MATRIX MULTIPLICATION KERNELS
@@ -0,0 +1,196 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedHeader.h
+//  \brief Header file for the file header of memory-mapped vectors and matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDHEADER_H_
+#define _BLAZE_MATH_DENSE_MAPPEDHEADER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief File header of memory-mapped vectors and matrices.
+// \ingroup math
+//
+// The MappedHeader represents the first 64 bytes of all files and shared memory segments that
+// are used as storage of memory-mapped vectors and matrices. Since the header exactly fills one
+// cache line, the data following the header is aligned for all SIMD instruction sets. All values
+// are stored in the native byte order of the system.
+*/
+struct MappedHeader
+{
+   //**Kinds of mapped data************************************************************************
+   /*!\brief The kinds of data stored in a mapped file. */
+   enum Kind : uint32_t {
+      denseVector      = 1U,  //!< Flag for dense vectors.
+      denseMatrix      = 2U,  //!< Flag for dense matrices.
+      compressedMatrix = 3U,  //!< Flag for compressed matrices.
+      compressedPairs  = 4U   //!< Flag for compressed matrices of value/index pairs.
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   char     magic[8];     //!< The magic number of the file ("BLAZEMAP").
+   uint32_t version;      //!< The version of the file format.
+   uint32_t kind;         //!< The kind of the stored data.
+   uint32_t order;        //!< The transpose flag or storage order of the stored data.
+   uint32_t type;         //!< The category of the element type (see TypeValueMapping).
+   uint32_t elementSize;  //!< The size of a single element in bytes.
+   uint32_t reserved;     //!< Reserved for future use.
+   uint64_t rows;         //!< The number of rows (or the size in case of vectors).
+   uint64_t columns;      //!< The number of columns (1 in case of vectors).
+   uint64_t spacing;      //!< The number of elements between two rows/columns (incl. padding).
+   uint64_t nonZeros;     //!< The number of non-zero elements in case of sparse data.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_STATIC_ASSERT( sizeof( MappedHeader ) == 64UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the header of a memory-mapped vector or matrix.
+// \ingroup math
+//
+// \param storage The mapped file or shared memory segment.
+// \param kind The kind of the stored data.
+// \param order The transpose flag or storage order of the stored data.
+// \param rows The number of rows (or the size in case of vectors).
+// \param columns The number of columns (1 in case of vectors).
+// \param spacing The number of elements between two rows/columns.
+// \param nonZeros The number of non-zero elements in case of sparse data.
+// \return void
+*/
+template< typename Type       // Data type of the elements
+        , typename Storage >  // Type of the mapped storage
+void writeMappedHeader( Storage& storage, MappedHeader::Kind kind, bool order,
+                        size_t rows, size_t columns, size_t spacing, size_t nonZeros = 0UL )
+{
+   MappedHeader header;
+
+   std::memcpy( header.magic, "BLAZEMAP", 8UL );
+   header.version     = 1U;
+   header.kind        = kind;
+   header.order       = order;
+   header.type        = TypeValueMapping< RemoveConst_<Type> >::value;
+   header.elementSize = static_cast<uint32_t>( sizeof( Type ) );
+   header.reserved    = 0U;
+   header.rows        = rows;
+   header.columns     = columns;
+   header.spacing     = spacing;
+   header.nonZeros    = nonZeros;
+
+   std::memcpy( storage.data(), &header, sizeof( MappedHeader ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads and validates the header of a memory-mapped vector or matrix.
+// \ingroup math
+//
+// \param storage The mapped file or shared memory segment.
+// \param kind The expected kind of the stored data.
+// \param order The expected transpose flag or storage order of the stored data.
+// \return The header of the mapped file.
+// \exception std::invalid_argument Invalid or incompatible file header.
+*/
+template< typename Type       // Data type of the elements
+        , typename Storage >  // Type of the mapped storage
+MappedHeader readMappedHeader( const Storage& storage, MappedHeader::Kind kind, bool order )
+{
+   MappedHeader header;
+
+   if( storage.size() < sizeof( MappedHeader ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+   }
+
+   std::memcpy( &header, storage.data(), sizeof( MappedHeader ) );
+
+   if( std::memcmp( header.magic, "BLAZEMAP", 8UL ) != 0 || header.version != 1U ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+   }
+
+   if( header.kind != kind || header.order != static_cast<uint32_t>( order ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid data type of mapped file" );
+   }
+
+   if( header.type != TypeValueMapping< RemoveConst_<Type> >::value || header.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type of mapped file" );
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,538 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedMatrix.h
+//  \brief Header file for the implementation of a memory-mapped matrix
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_matrix MappedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a memory-mapped, file-backed dense matrix.
+// \ingroup mapped_matrix
+//
+// The MappedMatrix class template is a CustomMatrix whose elements are stored in a memory-mapped
+// file. The type of the elements and the storage order of the matrix can be specified via the
+// two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedMatrix can be used with any
+//          non-cv-qualified numeric element type. In order to map a file read-only, the
+//          element type has to be const-qualified (e.g. \c const \c double).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The file starts with a 64-byte header that describes the stored matrix, followed by the rows
+// (in case of a row-major matrix) or columns (in case of a column-major matrix) of the matrix.
+// Since the header fills exactly one cache line and since each row/column is padded to a
+// multiple of the SIMD width, a MappedMatrix is an aligned and padded CustomMatrix that can be
+// used in all vectorized (and parallelized) kernels:
+
+   \code
+   using blaze::MappedMatrix;
+   using blaze::DynamicMatrix;
+
+   // Creating a new file for a 1000x500 matrix (the elements are initialized to zero)
+   MappedMatrix<double> A( "A.bin", 1000UL, 500UL );
+   A = B * C;
+   A.sync();
+
+   // Growing the matrix (the existing elements are preserved)
+   A.resize( 2000UL, 500UL );
+
+   // Mapping the existing file read-only and prefetching the rows of all threads
+   const MappedMatrix<const double> D( "A.bin" );
+   D.advise( blaze::sequentialAccess );
+   D.prefetch();
+   DynamicMatrix<double> E( D * trans( D ) );
+   \endcode
+
+// A MappedMatrix is not copyable. Note that the elements of the matrix are not loaded into
+// memory during construction, but on first access. The prefetch() function can be used to
+// start the read-ahead of the elements in the blocks of rows/columns that are processed by
+// the individual threads of the active SMP backend.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class MappedMatrix
+   : public CustomMatrix<Type,aligned,padded,SO>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomMatrix<Type,aligned,padded,SO>;  //!< Type of the underlying custom matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedMatrix( const std::string& path, size_t m, size_t n );
+   explicit inline MappedMatrix( const std::string& path,
+                                 MappingMode mode = ( IsConst<Type>::value ? readOnly : readWrite ) );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using CustomType::operator=;
+
+   inline MappedMatrix& operator=( const MappedMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& path() const noexcept;
+   inline MappingMode        mode() const noexcept;
+   inline void               resize( size_t m, size_t n );
+   inline void               sync() const;
+   inline void               advise( MappingAdvice advice ) const noexcept;
+   inline void               prefetch() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait< RemoveConst_<Type> >::size };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type* elements() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;  //!< The mapped file.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( RemoveConst_<Type> );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new file for a matrix of the given size.
+//
+// \param path The path of the file to be created.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::runtime_error The file could not be created or mapped.
+//
+// This constructor creates a new file for a \f$ m \times n \f$ matrix and maps it for reading
+// and writing. In case the file already exists, it is overwritten. All elements are initialized
+// to zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& path, size_t m, size_t n )
+   : CustomType()  // Base class initialization
+   , file_( path, sizeof( MappedHeader ) + ( SO ? n : m ) *
+                  nextMultiple<size_t>( SO ? m : n, SIMDSIZE ) * sizeof( Type ) )
+{
+   BLAZE_STATIC_ASSERT_MSG( !IsConst<Type>::value, "Creation of a read-only mapped matrix" );
+
+   const size_t nn( nextMultiple<size_t>( SO ? m : n, SIMDSIZE ) );
+
+   writeMappedHeader<Type>( file_, MappedHeader::denseMatrix, SO, m, n, nn );
+
+   if( m > 0UL && n > 0UL ) {
+      CustomType::reset( elements(), m, n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the existing file at the given path.
+//
+// \param path The path of the file to be mapped.
+// \param mode The access mode of the mapping.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible mapped file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This constructor maps an existing file that has previously been created by a MappedMatrix
+// with the same element type and storage order. By default, matrices of non-const element type
+// are mapped for reading and writing, matrices of const element type are mapped read-only.
+// Non-const element types cannot be combined with the \a readOnly mode.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& path, MappingMode mode )
+   : CustomType()         // Base class initialization
+   , file_( path, mode )  // The mapped file
+{
+   if( !IsConst<Type>::value && mode == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   const MappedHeader header( readMappedHeader<Type>( file_, MappedHeader::denseMatrix, SO ) );
+
+   const size_t m ( header.rows    );
+   const size_t n ( header.columns );
+   const size_t nn( header.spacing );
+
+   const size_t capacity( ( file_.size() - sizeof( MappedHeader ) ) / sizeof( Type ) );
+
+   if( nn < ( SO ? m : n ) || nn % SIMDSIZE != 0UL ||
+       ( ( SO ? n : m ) > 0UL && nn > capacity / ( SO ? n : m ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   if( m > 0UL && n > 0UL ) {
+      CustomType::reset( elements(), m, n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MappedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>& MappedMatrix<Type,SO>::operator=( const MappedMatrix& rhs )
+{
+   CustomType::operator=( static_cast<const CustomType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the path of the mapped file.
+//
+// \return The path of the mapped file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const std::string& MappedMatrix<Type,SO>::path() const noexcept
+{
+   return file_.path();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappingMode MappedMatrix<Type,SO>::mode() const noexcept
+{
+   return file_.mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \return void
+// \exception std::logic_error Invalid resize of a read-only or copy-on-write mapping.
+// \exception std::runtime_error The file could not be resized or remapped.
+//
+// This function resizes the mapped file to the given size of the matrix. The values of the
+// existing elements are preserved, new elements are initialized to zero. In case only the
+// number of rows of a row-major matrix (or the number of columns of a column-major matrix)
+// changes, the file is only truncated or extended. Otherwise the rows/columns are moved within
+// the file. Note that the file may be mapped to a different address, i.e. all iterators,
+// pointers, and views referring to the elements of the matrix are invalidated. Only
+// \a readWrite mappings can be resized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::resize( size_t m, size_t n )
+{
+   if( file_.mode() != readWrite ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid resize of a read-only mapping" );
+   }
+
+   const MappedHeader header( readMappedHeader<Type>( file_, MappedHeader::denseMatrix, SO ) );
+
+   // Major (rows of a row-major matrix) and minor dimensions of the old and the new matrix
+   const size_t M0( SO ? header.columns : header.rows    );
+   const size_t N0( SO ? header.rows    : header.columns );
+   const size_t S0( header.spacing );
+   const size_t M1( SO ? n : m );
+   const size_t N1( SO ? m : n );
+   const size_t S1( nextMultiple<size_t>( N1, SIMDSIZE ) );
+
+   const size_t oldBytes( sizeof( MappedHeader ) + M0*S0*sizeof( Type ) );
+   const size_t newBytes( sizeof( MappedHeader ) + M1*S1*sizeof( Type ) );
+
+   const size_t K( min( M0, M1 ) );
+   const size_t L( min( N0, N1 ) );
+
+   CustomType::clear();
+
+   if( newBytes > oldBytes ) {
+      file_.resize( newBytes );
+   }
+
+   Type* v( elements() );
+
+   if( S1 > S0 ) {
+      for( size_t i=K; i-- > 0UL; ) {
+         std::memmove( v+i*S1, v+i*S0, L*sizeof( Type ) );
+         std::fill( v+i*S1+L, v+(i+1UL)*S1, Type() );
+      }
+   }
+   else {
+      for( size_t i=0UL; i<K; ++i ) {
+         if( S1 != S0 )
+            std::memmove( v+i*S1, v+i*S0, L*sizeof( Type ) );
+         std::fill( v+i*S1+L, v+(i+1UL)*S1, Type() );
+      }
+   }
+
+   if( K*S1 < min( M1*S1, M0*S0 ) ) {
+      std::fill( v+K*S1, v+min( M1*S1, M0*S0 ), Type() );
+   }
+
+   if( newBytes < oldBytes ) {
+      file_.resize( newBytes );
+   }
+
+   writeMappedHeader<Type>( file_, MappedHeader::denseMatrix, SO, m, n, S1 );
+
+   if( m > 0UL && n > 0UL ) {
+      CustomType::reset( elements(), m, n, S1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error The file could not be synchronized.
+//
+// This function blocks until all modifications of a \a readWrite mapping have been written to
+// the file. In case of a \a readOnly or \a copyOnWrite mapping, the function has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::sync() const
+{
+   file_.sync();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advises the operating system about the expected access pattern of the matrix.
+//
+// \param advice The expected access pattern.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::advise( MappingAdvice advice ) const noexcept
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Starts the read-ahead of the elements of the matrix.
+//
+// \return void
+//
+// This function advises the operating system that all elements of the matrix will be needed
+// in the near future. The advice is given block by block, where the blocks correspond to the
+// bands of rows (in case of a row-major matrix) or columns (in case of a column-major matrix)
+// that are assigned to the individual threads of the active SMP backend. Thus the read-ahead
+// of the first band of each thread starts as early as possible.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::prefetch() const noexcept
+{
+   const size_t M( SO ? CustomType::columns() : CustomType::rows() );
+
+   if( M == 0UL || CustomType::rows() == 0UL || CustomType::columns() == 0UL )
+      return;
+
+   const ThreadMapping threads( createThreadMapping( getNumThreads(), *this ) );
+   const size_t bands( SO ? threads.second : threads.first );
+
+   const size_t addon     ( ( ( M % bands ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( M / bands + addon );
+   const size_t rest      ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( IsVectorizable<Type>::value && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   const size_t nn( CustomType::spacing() );
+
+   for( size_t index=0UL; index<M; index+=sizePerThread ) {
+      file_.advise( sizeof( MappedHeader ) + index*nn*sizeof( Type ),
+                    min( sizePerThread, M - index )*nn*sizeof( Type ), willNeed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first element of the mapped matrix.
+//
+// \return Pointer to the first element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline Type* MappedMatrix<Type,SO>::elements() noexcept
+{
+   return reinterpret_cast<Type*>( file_.data() + sizeof( MappedHeader ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped matrix is in default state.
+// \ingroup mapped_matrix
+//
+// \param m The mapped matrix to be tested for its default state.
+// \return \a true in case the given matrix is in default state, \a false otherwise.
+//
+// This overload forwards to the isDefault() function of the underlying custom matrix.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const MappedMatrix<Type,SO>& m )
+{
+   return isDefault<RF>( static_cast< const CustomMatrix<Type,aligned,padded,SO>& >( m ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
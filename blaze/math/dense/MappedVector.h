@@ -0,0 +1,484 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedVector.h
+//  \brief Header file for the implementation of a memory-mapped vector
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDVECTOR_H_
+#define _BLAZE_MATH_DENSE_MAPPEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_vector MappedVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a memory-mapped, file-backed dense vector.
+// \ingroup mapped_vector
+//
+// The MappedVector class template is a CustomVector whose elements are stored in a memory-mapped
+// file. The type of the elements and the transpose flag of the vector can be specified via the
+// two template parameters:
+
+   \code
+   template< typename Type, bool TF >
+   class MappedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. MappedVector can be used with any
+//          non-cv-qualified numeric element type. In order to map a file read-only, the
+//          element type has to be const-qualified (e.g. \c const \c double).
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// The file starts with a 64-byte header that describes the stored vector, followed by the
+// elements of the vector. Since the header fills exactly one cache line and since the number
+// of stored elements is padded to a multiple of the SIMD width, a MappedVector is an aligned
+// and padded CustomVector that can be used in all vectorized (and parallelized) kernels:
+
+   \code
+   using blaze::MappedVector;
+   using blaze::MappedMatrix;
+
+   // Creating a new file of 1000 elements (the elements are initialized to zero)
+   MappedVector<double> x( "x.bin", 1000UL );
+   x = 1.0;
+
+   // Mapping the existing file for reading and writing (all modifications are persistent)
+   MappedVector<double> y( "x.bin" );
+   y *= 2.0;
+
+   // Mapping the existing file copy-on-write (all modifications are private to the mapping)
+   MappedVector<double> z( "x.bin", blaze::copyOnWrite );
+
+   // Mapping the existing file read-only
+   const MappedVector<const double> w( "x.bin" );
+   w.advise( blaze::sequentialAccess );
+   w.prefetch();
+   \endcode
+
+// A MappedVector is not copyable. Note that the elements of the vector are not loaded into
+// memory during construction, but on first access. The prefetch() function can be used to
+// start the read-ahead of the elements in the blocks that are processed by the individual
+// threads of the active SMP backend.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class MappedVector
+   : public CustomVector<Type,aligned,padded,TF>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomVector<Type,aligned,padded,TF>;  //!< Type of the underlying custom vector.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedVector( const std::string& path, size_t n );
+   explicit inline MappedVector( const std::string& path,
+                                 MappingMode mode = ( IsConst<Type>::value ? readOnly : readWrite ) );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using CustomType::operator=;
+
+   inline MappedVector& operator=( const MappedVector& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& path() const noexcept;
+   inline MappingMode        mode() const noexcept;
+   inline void               resize( size_t n );
+   inline void               sync() const;
+   inline void               advise( MappingAdvice advice ) const noexcept;
+   inline void               prefetch() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait< RemoveConst_<Type> >::size };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type* elements() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;  //!< The mapped file.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( RemoveConst_<Type> );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new file for a vector of the given size.
+//
+// \param path The path of the file to be created.
+// \param n The size of the vector.
+// \exception std::runtime_error The file could not be created or mapped.
+//
+// This constructor creates a new file for a vector of size \a n and maps it for reading and
+// writing. In case the file already exists, it is overwritten. All elements are initialized
+// to zero.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>::MappedVector( const std::string& path, size_t n )
+   : CustomType()  // Base class initialization
+   , file_( path, sizeof( MappedHeader ) + nextMultiple<size_t>( n, SIMDSIZE )*sizeof( Type ) )
+{
+   BLAZE_STATIC_ASSERT_MSG( !IsConst<Type>::value, "Creation of a read-only mapped vector" );
+
+   const size_t nn( nextMultiple<size_t>( n, SIMDSIZE ) );
+
+   writeMappedHeader<Type>( file_, MappedHeader::denseVector, TF, n, 1UL, nn );
+
+   if( n > 0UL ) {
+      CustomType::reset( elements(), n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the existing file at the given path.
+//
+// \param path The path of the file to be mapped.
+// \param mode The access mode of the mapping.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible mapped file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This constructor maps an existing file that has previously been created by a MappedVector
+// with the same element type and transpose flag. By default, vectors of non-const element type
+// are mapped for reading and writing, vectors of const element type are mapped read-only.
+// Non-const element types cannot be combined with the \a readOnly mode.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>::MappedVector( const std::string& path, MappingMode mode )
+   : CustomType()         // Base class initialization
+   , file_( path, mode )  // The mapped file
+{
+   if( !IsConst<Type>::value && mode == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   const MappedHeader header( readMappedHeader<Type>( file_, MappedHeader::denseVector, TF ) );
+
+   const size_t n ( header.rows    );
+   const size_t nn( header.spacing );
+
+   const size_t capacity( ( file_.size() - sizeof( MappedHeader ) ) / sizeof( Type ) );
+
+   if( nn < n || nn % SIMDSIZE != 0UL || nn > capacity ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   if( n > 0UL ) {
+      CustomType::reset( elements(), n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MappedVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In case the current sizes of the two
+// vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappedVector<Type,TF>& MappedVector<Type,TF>::operator=( const MappedVector& rhs )
+{
+   CustomType::operator=( static_cast<const CustomType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the path of the mapped file.
+//
+// \return The path of the mapped file.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline const std::string& MappedVector<Type,TF>::path() const noexcept
+{
+   return file_.path();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline MappingMode MappedVector<Type,TF>::mode() const noexcept
+{
+   return file_.mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector.
+//
+// \param n The new size of the vector.
+// \return void
+// \exception std::logic_error Invalid resize of a read-only or copy-on-write mapping.
+// \exception std::runtime_error The file could not be resized or remapped.
+//
+// This function resizes the mapped file to the given size of the vector. The values of the
+// existing elements are preserved, new elements are initialized to zero. Note that the file may
+// be mapped to a different address, i.e. all iterators, pointers, and views referring to the
+// elements of the vector are invalidated. Only \a readWrite mappings can be resized.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::resize( size_t n )
+{
+   if( file_.mode() != readWrite ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid resize of a read-only mapping" );
+   }
+
+   const size_t oldn( CustomType::size() );
+   const size_t nn  ( nextMultiple<size_t>( n, SIMDSIZE ) );
+
+   if( n < oldn ) {
+      Type* v( elements() );
+      std::fill( v+n, v+min( oldn, nn ), Type() );
+   }
+
+   CustomType::clear();
+   file_.resize( sizeof( MappedHeader ) + nn*sizeof( Type ) );
+   writeMappedHeader<Type>( file_, MappedHeader::denseVector, TF, n, 1UL, nn );
+
+   if( n > 0UL ) {
+      CustomType::reset( elements(), n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the vector back to the file.
+//
+// \return void
+// \exception std::runtime_error The file could not be synchronized.
+//
+// This function blocks until all modifications of a \a readWrite mapping have been written to
+// the file. In case of a \a readOnly or \a copyOnWrite mapping, the function has no effect.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::sync() const
+{
+   file_.sync();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advises the operating system about the expected access pattern of the vector.
+//
+// \param advice The expected access pattern.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::advise( MappingAdvice advice ) const noexcept
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Starts the read-ahead of the elements of the vector.
+//
+// \return void
+//
+// This function advises the operating system that all elements of the vector will be needed
+// in the near future. The advice is given block by block, where the blocks correspond to the
+// parts of the vector that are assigned to the individual threads of the active SMP backend.
+// Thus the read-ahead of the first block of each thread starts as early as possible.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void MappedVector<Type,TF>::prefetch() const noexcept
+{
+   const size_t n      ( CustomType::size() );
+   const size_t threads( getNumThreads() );
+
+   const size_t addon     ( ( ( n % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( n / threads + addon );
+   const size_t rest      ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( IsVectorizable<Type>::value && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t index=0UL; index<n; index+=sizePerThread ) {
+      file_.advise( sizeof( MappedHeader ) + index*sizeof( Type ),
+                    min( sizePerThread, n - index )*sizeof( Type ), willNeed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first element of the mapped vector.
+//
+// \return Pointer to the first element.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline Type* MappedVector<Type,TF>::elements() noexcept
+{
+   return reinterpret_cast<Type*>( file_.data() + sizeof( MappedHeader ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given mapped vector is in default state.
+// \ingroup mapped_vector
+//
+// \param v The mapped vector to be tested for its default state.
+// \return \a true in case the given vector is in default state, \a false otherwise.
+//
+// This overload forwards to the isDefault() function of the underlying custom vector.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool isDefault( const MappedVector<Type,TF>& v )
+{
+   return isDefault<RF>( static_cast< const CustomVector<Type,aligned,padded,TF>& >( v ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
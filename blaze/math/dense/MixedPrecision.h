@@ -0,0 +1,505 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MixedPrecision.h
+//  \brief Header file for the mixed precision dense kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+#define _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBFloat16.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsFloat16.h>
+
+
+namespace blaze {
+
+#if BLAZE_SSE2_MODE || BLAZE_AVX_MODE || BLAZE_AVX512F_MODE
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads two SIMD vectors of double precision values from single precision values.
+// \ingroup simd
+//
+// \param address The first of the \a 2*SIMDdouble::size single precision values to be loaded.
+// \param lo The vector for the first half of the loaded values.
+// \param hi The vector for the second half of the loaded values.
+// \return void
+*/
+template< typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE EnableIf_< IsFloat<T> >
+   loadWidened( const T* address, SIMDdouble& lo, SIMDdouble& hi ) noexcept
+{
+   const SIMDfloat a( loadu( address ) );
+   lo = widenLow ( a );
+   hi = widenHigh( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads two SIMD vectors of double precision values.
+// \ingroup simd
+//
+// \param address The first of the \a 2*SIMDdouble::size double precision values to be loaded.
+// \param lo The vector for the first half of the loaded values.
+// \param hi The vector for the second half of the loaded values.
+// \return void
+*/
+template< typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE EnableIf_< IsDouble<T> >
+   loadWidened( const T* address, SIMDdouble& lo, SIMDdouble& hi ) noexcept
+{
+   lo = loadu( address );
+   hi = loadu( address + SIMDdouble::size );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MIXED PRECISION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the scalar product of two arrays of mixed precision values.
+// \ingroup dense_vector
+//
+// \param a The first array of \a n single or double precision values.
+// \param b The second array of \a n single or double precision values.
+// \param n The number of elements of the two arrays.
+// \return The scalar product in double precision.
+//
+// This kernel computes the scalar product of a single precision and a double precision array
+// (in any order). The single precision values are converted to double precision in SIMD
+// registers, i.e. all products are accumulated in double precision.
+*/
+template< typename T1    // Type of the left-hand side values
+        , typename T2 >  // Type of the right-hand side values
+inline EnableIf_< Or< IsDouble<T1>, IsDouble<T2> >, double >
+   mixedDot( const T1* a, const T2* b, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDdouble::size );
+
+   SIMDdouble xmm1, xmm2, xmm3, xmm4;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      SIMDdouble a1, a2, a3, a4, b1, b2, b3, b4;
+      loadWidened( a+i              , a1, a2 );
+      loadWidened( a+i+SIMDSIZE*2UL, a3, a4 );
+      loadWidened( b+i              , b1, b2 );
+      loadWidened( b+i+SIMDSIZE*2UL, b3, b4 );
+      xmm1 += a1 * b1;
+      xmm2 += a2 * b2;
+      xmm3 += a3 * b3;
+      xmm4 += a4 * b4;
+   }
+
+   for( ; (i+SIMDSIZE*2UL) <= n; i+=SIMDSIZE*2UL ) {
+      SIMDdouble a1, a2, b1, b2;
+      loadWidened( a+i, a1, a2 );
+      loadWidened( b+i, b1, b2 );
+      xmm1 += a1 * b1;
+      xmm2 += a2 * b2;
+   }
+
+   double sp( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<n; ++i ) {
+      sp += double( a[i] ) * double( b[i] );
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the scalar product of two arrays of 16-bit or single precision values.
+// \ingroup dense_vector
+//
+// \param a The first array of \a n bfloat16, float16, or single precision values.
+// \param b The second array of \a n bfloat16, float16, or single precision values.
+// \param n The number of elements of the two arrays.
+// \return The scalar product in single precision.
+//
+// This kernel computes the scalar product of two arrays of which at least one contains
+// \c bfloat16 or \c float16 values. The 16-bit values are converted to single precision
+// while loading them into SIMD registers, i.e. all products are accumulated in single
+// precision.
+*/
+template< typename T1    // Type of the left-hand side values
+        , typename T2 >  // Type of the right-hand side values
+inline DisableIf_< Or< IsDouble<T1>, IsDouble<T2> >, float >
+   mixedDot( const T1* a, const T2* b, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDfloat::size );
+
+   SIMDfloat xmm1, xmm2, xmm3, xmm4;
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 += loadu( a+i             ) * loadu( b+i             );
+      xmm2 += loadu( a+i+SIMDSIZE    ) * loadu( b+i+SIMDSIZE    );
+      xmm3 += loadu( a+i+SIMDSIZE*2UL ) * loadu( b+i+SIMDSIZE*2UL );
+      xmm4 += loadu( a+i+SIMDSIZE*3UL ) * loadu( b+i+SIMDSIZE*3UL );
+   }
+
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 += loadu( a+i ) * loadu( b+i );
+   }
+
+   float sp( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<n; ++i ) {
+      sp += float( a[i] ) * float( b[i] );
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adds the scaled product of a column-major dense matrix and a dense vector to an array
+//        of double precision values (\f$ \vec{y}+=s*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array of \a A.rows() double precision values.
+// \param A The column-major dense matrix of single or double precision values.
+// \param x The dense vector of single or double precision values.
+// \param scale The scaling factor \a s.
+// \return void
+//
+// This kernel computes the product of a column-major dense matrix with direct access to its
+// columns and an arbitrary dense vector in double precision. The matrix elements are converted
+// to double precision in SIMD registers. In order to limit the memory traffic on the target
+// array, the rows are processed in blocks and four columns are handled at once.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT >  // Type of the dense vector
+void mixedTDMatDVecMult( double* y, const MT& A, const VT& x, double scale )
+{
+   constexpr size_t SIMDSIZE ( SIMDdouble::size );
+   constexpr size_t BLOCKSIZE( 2048UL );
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( x.size() == N, "Invalid vector size" );
+
+   for( size_t ii=0UL; ii<M; ii+=BLOCKSIZE )
+   {
+      const size_t iend( min( ii+BLOCKSIZE, M ) );
+      const size_t ipos( ii + ( ( iend - ii ) & size_t(-SIMDSIZE*2UL) ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL )
+      {
+         const double x1( scale * x[j    ] );
+         const double x2( scale * x[j+1UL] );
+         const double x3( scale * x[j+2UL] );
+         const double x4( scale * x[j+3UL] );
+         const SIMDdouble s1( set( x1 ) ), s2( set( x2 ) ), s3( set( x3 ) ), s4( set( x4 ) );
+
+         const auto* a1( A.data(j    ) );
+         const auto* a2( A.data(j+1UL) );
+         const auto* a3( A.data(j+2UL) );
+         const auto* a4( A.data(j+3UL) );
+
+         size_t i( ii );
+
+         for( ; i<ipos; i+=SIMDSIZE*2UL ) {
+            SIMDdouble l1, h1, l2, h2, l3, h3, l4, h4;
+            loadWidened( a1+i, l1, h1 );
+            loadWidened( a2+i, l2, h2 );
+            loadWidened( a3+i, l3, h3 );
+            loadWidened( a4+i, l4, h4 );
+            SIMDdouble ylo( loadu( y+i ) ), yhi( loadu( y+i+SIMDSIZE ) );
+            ylo += l1 * s1; yhi += h1 * s1;
+            ylo += l2 * s2; yhi += h2 * s2;
+            ylo += l3 * s3; yhi += h3 * s3;
+            ylo += l4 * s4; yhi += h4 * s4;
+            storeu( y+i, ylo );
+            storeu( y+i+SIMDSIZE, yhi );
+         }
+         for( ; i<iend; ++i ) {
+            y[i] += a1[i]*x1 + a2[i]*x2 + a3[i]*x3 + a4[i]*x4;
+         }
+      }
+
+      for( ; j<N; ++j )
+      {
+         const double x1( scale * x[j] );
+         const SIMDdouble s1( set( x1 ) );
+         const auto* a1( A.data(j) );
+
+         size_t i( ii );
+
+         for( ; i<ipos; i+=SIMDSIZE*2UL ) {
+            SIMDdouble l1, h1;
+            loadWidened( a1+i, l1, h1 );
+            storeu( y+i         , loadu( y+i          ) + l1 * s1 );
+            storeu( y+i+SIMDSIZE, loadu( y+i+SIMDSIZE ) + h1 * s1 );
+         }
+         for( ; i<iend; ++i ) {
+            y[i] += a1[i]*x1;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adds the scaled product of a column-major dense matrix and a dense vector to an array
+//        of single precision values (\f$ \vec{y}+=s*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array of \a A.rows() single precision values.
+// \param A The column-major dense matrix of bfloat16 or float16 values.
+// \param x The dense vector of bfloat16, float16, or single precision values.
+// \param scale The scaling factor \a s.
+// \return void
+//
+// This kernel computes the product of a column-major dense matrix of 16-bit floating point
+// values with direct access to its columns and an arbitrary dense vector in single precision.
+// The matrix elements are converted to single precision while loading them into SIMD registers.
+// In order to limit the memory traffic on the target array, the rows are processed in blocks
+// and four columns are handled at once.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT >  // Type of the dense vector
+void mixedTDMatDVecMult( float* y, const MT& A, const VT& x, float scale )
+{
+   constexpr size_t SIMDSIZE ( SIMDfloat::size );
+   constexpr size_t BLOCKSIZE( 4096UL );
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( x.size() == N, "Invalid vector size" );
+
+   for( size_t ii=0UL; ii<M; ii+=BLOCKSIZE )
+   {
+      const size_t iend( min( ii+BLOCKSIZE, M ) );
+      const size_t ipos( ii + ( ( iend - ii ) & size_t(-SIMDSIZE) ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL )
+      {
+         const float x1( scale * float( x[j    ] ) );
+         const float x2( scale * float( x[j+1UL] ) );
+         const float x3( scale * float( x[j+2UL] ) );
+         const float x4( scale * float( x[j+3UL] ) );
+         const SIMDfloat s1( set( x1 ) ), s2( set( x2 ) ), s3( set( x3 ) ), s4( set( x4 ) );
+
+         const auto* a1( A.data(j    ) );
+         const auto* a2( A.data(j+1UL) );
+         const auto* a3( A.data(j+2UL) );
+         const auto* a4( A.data(j+3UL) );
+
+         size_t i( ii );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            SIMDfloat xmm( loadu( y+i ) );
+            xmm += loadu( a1+i ) * s1;
+            xmm += loadu( a2+i ) * s2;
+            xmm += loadu( a3+i ) * s3;
+            xmm += loadu( a4+i ) * s4;
+            storeu( y+i, xmm );
+         }
+         for( ; i<iend; ++i ) {
+            y[i] += float( a1[i] )*x1 + float( a2[i] )*x2 + float( a3[i] )*x3 + float( a4[i] )*x4;
+         }
+      }
+
+      for( ; j<N; ++j )
+      {
+         const float x1( scale * float( x[j] ) );
+         const SIMDfloat s1( set( x1 ) );
+         const auto* a1( A.data(j) );
+
+         size_t i( ii );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            storeu( y+i, loadu( y+i ) + loadu( a1+i ) * s1 );
+         }
+         for( ; i<iend; ++i ) {
+            y[i] += float( a1[i] )*x1;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts an array of single precision values to double precision.
+// \ingroup dense_vector
+//
+// \param dst The target array of \a n double precision values.
+// \param src The source array of \a n single precision values.
+// \param n The number of elements to be converted.
+// \return void
+*/
+template< typename T1    // Type of the target values
+        , typename T2 >  // Type of the source values
+inline EnableIf_< And< IsDouble<T1>, IsFloat<T2> > >
+   mixedConvert( T1* dst, const T2* src, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDdouble::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= n; i+=SIMDSIZE*2UL ) {
+      SIMDdouble lo, hi;
+      loadWidened( src+i, lo, hi );
+      storeu( dst+i         , lo );
+      storeu( dst+i+SIMDSIZE, hi );
+   }
+   for( ; i<n; ++i ) {
+      dst[i] = src[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts an array of double precision values to single precision.
+// \ingroup dense_vector
+//
+// \param dst The target array of \a n single precision values.
+// \param src The source array of \a n double precision values.
+// \param n The number of elements to be converted.
+// \return void
+*/
+template< typename T1    // Type of the target values
+        , typename T2 >  // Type of the source values
+inline EnableIf_< And< IsFloat<T1>, IsDouble<T2> > >
+   mixedConvert( T1* dst, const T2* src, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDdouble::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*2UL) <= n; i+=SIMDSIZE*2UL ) {
+      storeu( dst+i, narrow( loadu( src+i ), loadu( src+i+SIMDSIZE ) ) );
+   }
+   for( ; i<n; ++i ) {
+      dst[i] = static_cast<T1>( src[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts an array of 16-bit floating point values to single precision or vice versa.
+// \ingroup dense_vector
+//
+// \param dst The target array of \a n single precision, bfloat16, or float16 values.
+// \param src The source array of \a n bfloat16, float16, or single precision values.
+// \param n The number of elements to be converted.
+// \return void
+//
+// This kernel converts between \c bfloat16 or \c float16 values and single precision values.
+// The conversion to 16-bit values rounds to the nearest representable value (ties to even).
+*/
+template< typename T1    // Type of the target values
+        , typename T2 >  // Type of the source values
+inline EnableIf_< Or< And< IsFloat<T1>, Or< IsBFloat16<T2>, IsFloat16<T2> > >
+                    , And< Or< IsBFloat16<T1>, IsFloat16<T1> >, IsFloat<T2> > > >
+   mixedConvert( T1* dst, const T2* src, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDfloat::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      storeu( dst+i, loadu( src+i ) );
+   }
+   for( ; i<n; ++i ) {
+      dst[i] = static_cast<T1>( src[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
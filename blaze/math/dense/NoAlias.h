@@ -0,0 +1,545 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NoAlias.h
+//  \brief Header file for the noalias() assignment proxy
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_NOALIAS_H_
+#define _BLAZE_MATH_DENSE_NOALIAS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/constraints/Restricted.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment proxy for the alias-free assignment to dense matrices and vectors.
+// \ingroup math
+//
+// The NoAlias class template represents the left-hand side of an assignment that is known to
+// be free of aliasing. All assignment operators directly evaluate the right-hand side expression
+// into the target, i.e. in contrast to the assignment operators of the target itself they never
+// create a defensive temporary in case the right-hand side might alias with the target. The
+// class is not intended to be used directly, but via the noalias() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   noalias( C ) = A * B;
+   noalias( submatrix( C, 0UL, 0UL, 8UL, 8UL ) ) += submatrix( A, 8UL, 8UL, 8UL, 8UL ) * B;
+   \endcode
+
+// The template argument \a T is either an lvalue reference to the target or, in case the target
+// is a temporary view, the type of the view itself.
+*/
+template< typename T >  // Type of the target
+class NoAlias
+{
+ private:
+   //**Type definitions****************************************************************************
+   using TT = RemoveReference_<T>;  //!< Type of the target without reference.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the NoAlias class template.
+   //
+   // \param target The target of the assignment.
+   */
+   explicit inline NoAlias( T target )
+      : target_( std::forward<T>( target ) )  // The target of the assignment
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO > inline NoAlias& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline NoAlias& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline NoAlias& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline NoAlias& operator%=( const Matrix<MT,SO>& rhs );
+
+   template< typename VT, bool TF > inline NoAlias& operator= ( const Vector<VT,TF>& rhs );
+   template< typename VT, bool TF > inline NoAlias& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT, bool TF > inline NoAlias& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT, bool TF > inline NoAlias& operator*=( const Vector<VT,TF>& rhs );
+   template< typename VT, bool TF > inline NoAlias& operator/=( const Vector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO > inline void checkSizes( const Matrix<MT,SO>& rhs ) const;
+   template< typename VT, bool TF > inline void checkSizes( const Vector<VT,TF>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T target_;  //!< The target of the assignment.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( IsDenseMatrix<TT>::value || IsDenseVector<TT>::value );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( TT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Alias-free assignment of a matrix (\f$ A=B \f$).
+//
+// \param rhs The right-hand side matrix to be assigned.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// Resizable targets are resized to the size of the right-hand side matrix. In case the target
+// cannot be resized and the sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename T >  // Type of the target
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the right-hand side matrix
+inline NoAlias<T>& NoAlias<T>::operator=( const Matrix<MT,SO>& rhs )
+{
+   if( IsResizable<TT>::value ) {
+      resize( target_, (~rhs).rows(), (~rhs).columns(), false );
+   }
+   else {
+      checkSizes( ~rhs );
+   }
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   if( IsSparseMatrix<MT>::value ) {
+      target_.reset();
+   }
+
+   smpAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free addition assignment of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the target.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the right-hand side matrix
+inline NoAlias<T>& NoAlias<T>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpAddAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free subtraction assignment of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the target.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the right-hand side matrix
+inline NoAlias<T>& NoAlias<T>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpSubAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free Schur product assignment of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the right-hand side matrix
+inline NoAlias<T>& NoAlias<T>::operator%=( const Matrix<MT,SO>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpSchurAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free assignment of a vector (\f$ \vec{a}=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be assigned.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// Resizable targets are resized to the size of the right-hand side vector. In case the target
+// cannot be resized and the sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline NoAlias<T>& NoAlias<T>::operator=( const Vector<VT,TF>& rhs )
+{
+   if( IsResizable<TT>::value ) {
+      resize( target_, (~rhs).size(), false );
+   }
+   else {
+      checkSizes( ~rhs );
+   }
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   if( IsSparseVector<VT>::value ) {
+      target_.reset();
+   }
+
+   smpAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free addition assignment of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the target.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline NoAlias<T>& NoAlias<T>::operator+=( const Vector<VT,TF>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpAddAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free subtraction assignment of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the target.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline NoAlias<T>& NoAlias<T>::operator-=( const Vector<VT,TF>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpSubAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free multiplication assignment of a vector (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the target.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline NoAlias<T>& NoAlias<T>::operator*=( const Vector<VT,TF>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpMultAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Alias-free division assignment of a vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector divisor.
+// \return Reference to the assignment proxy.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline NoAlias<T>& NoAlias<T>::operator/=( const Vector<VT,TF>& rhs )
+{
+   checkSizes( ~rhs );
+
+   BLAZE_USER_ASSERT( !(~rhs).isAliased( &target_ ), "Aliasing detected in alias-free assignment" );
+
+   smpDivAssign( target_, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks the size of the given matrix against the size of the target.
+//
+// \param rhs The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename MT   // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the right-hand side matrix
+inline void NoAlias<T>::checkSizes( const Matrix<MT,SO>& rhs ) const
+{
+   if( target_.rows() != (~rhs).rows() || target_.columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the size of the given vector against the size of the target.
+//
+// \param rhs The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename T >  // Type of the target
+template< typename VT   // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the right-hand side vector
+inline void NoAlias<T>::checkSizes( const Vector<VT,TF>& rhs ) const
+{
+   if( target_.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NoAlias functions */
+//@{
+template< typename MT, bool SO >
+inline NoAlias<MT&> noalias( DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline NoAlias<MT> noalias( DenseMatrix<MT,SO>&& dm );
+
+template< typename VT, bool TF >
+inline NoAlias<VT&> noalias( DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline NoAlias<VT> noalias( DenseVector<VT,TF>&& dv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Declares the assignment to the given dense matrix to be free of aliasing.
+// \ingroup dense_matrix
+//
+// \param dm The target dense matrix.
+// \return Assignment proxy for the alias-free assignment to the given matrix.
+//
+// By default, all assignments to a matrix or a view create a temporary in case the right-hand
+// side expression might alias with the left-hand side, i.e. in case any operand refers to the
+// same matrix. The noalias() function asserts that the right-hand side does not overlap with
+// the target and therefore evaluates the right-hand side directly into the target:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   noalias( submatrix( C, 0UL, 0UL, 8UL, 8UL ) ) = A * submatrix( C, 8UL, 8UL, 8UL, 8UL );
+   \endcode
+
+// Note that the result of an assignment to a target that in fact overlaps with the right-hand
+// side is undefined. In debug mode such an assignment is detected by a user assertion as far
+// as possible. Since restricted matrices (as for instance LowerMatrix) have to check their
+// invariants before an assignment, noalias() cannot be used on restricted matrices or views
+// on restricted matrices.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline NoAlias<MT&> noalias( DenseMatrix<MT,SO>& dm )
+{
+   return NoAlias<MT&>( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Declares the assignment to the given temporary dense matrix view to be free of aliasing.
+// \ingroup dense_matrix
+//
+// \param dm The target dense matrix view.
+// \return Assignment proxy for the alias-free assignment to the given view.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline NoAlias<MT> noalias( DenseMatrix<MT,SO>&& dm )
+{
+   return NoAlias<MT>( std::move( ~dm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Declares the assignment to the given dense vector to be free of aliasing.
+// \ingroup dense_vector
+//
+// \param dv The target dense vector.
+// \return Assignment proxy for the alias-free assignment to the given vector.
+//
+// This function is the vector counterpart of the noalias() function for dense matrices.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline NoAlias<VT&> noalias( DenseVector<VT,TF>& dv )
+{
+   return NoAlias<VT&>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Declares the assignment to the given temporary dense vector view to be free of aliasing.
+// \ingroup dense_vector
+//
+// \param dv The target dense vector view.
+// \return Assignment proxy for the alias-free assignment to the given view.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline NoAlias<VT> noalias( DenseVector<VT,TF>&& dv )
+{
+   return NoAlias<VT>( std::move( ~dv ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
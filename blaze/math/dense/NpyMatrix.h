@@ -0,0 +1,381 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NpyMatrix.h
+//  \brief Header file for the implementation of a dense matrix backed by a NumPy array
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_NPYMATRIX_H_
+#define _BLAZE_MATH_DENSE_NPYMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/math/serialization/Npz.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup npy_matrix NpyMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix backed by a NumPy .npy array.
+// \ingroup npy_matrix
+//
+// The NpyMatrix class template is a CustomMatrix that refers to the elements of a
+// two-dimensional NumPy array, which is stored either in a .npy file or as uncompressed array
+// within a .npz archive. The type of the elements and the storage order of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class NpyMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. NpyMatrix can be used with any
+//          non-cv-qualified numeric element type. In order to map a file read-only, the
+//          element type has to be const-qualified (e.g. \c const \c double).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// In case the dtype of the array exactly matches the element type (including the byte order),
+// the order of the array matches the storage order of the matrix (i.e. C order for row-major
+// and Fortran order for column-major matrices), and the elements are properly aligned, the
+// matrix directly refers to the elements within the memory-mapped file (zero-copy). Otherwise
+// the elements are converted into a buffer owned by the matrix:
+
+   \code
+   using blaze::NpyMatrix;
+
+   // Mapping the C-ordered array copy-on-write (all modifications are private to the matrix)
+   NpyMatrix<double,blaze::rowMajor> A( "A.npy" );
+
+   // Mapping the C-ordered array for reading and writing (all modifications are persistent)
+   NpyMatrix<double,blaze::rowMajor> B( "A.npy", blaze::readWrite );
+
+   // Converting the C-ordered array into a column-major matrix
+   const NpyMatrix<const double,blaze::columnMajor> C( "A.npy" );
+   const bool zeroCopy( C.isMapped() );  // false
+   \endcode
+
+// Since NumPy does not pad the arrays, an NpyMatrix is an unaligned and unpadded CustomMatrix.
+// A \a readWrite mapping requires a zero-copy mapping, since modifications of the converted
+// elements cannot be written back to the file.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class NpyMatrix
+   : public CustomMatrix<Type,unaligned,unpadded,SO>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomMatrix<Type,unaligned,unpadded,SO>;  //!< Type of the underlying custom matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyMatrix( const std::string& path,
+                              MappingMode mode = ( IsConst<Type>::value ? readOnly : copyOnWrite ) );
+   explicit inline NpyMatrix( const NpzArchive& archive, const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using CustomType::operator=;
+
+   inline NpyMatrix& operator=( const NpyMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isMapped() const noexcept;
+   inline void sync() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using ElementType = RemoveConst_<Type>;  //!< Non-const type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( const NpySource& source );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<MappedFile> file_;          //!< The mapped file (in case of a zero-copy mapping).
+   std::unique_ptr<ElementType[]> buffer_;     //!< The converted elements (in case of a conversion).
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the .npy file at the given path.
+//
+// \param path The path of the .npy file.
+// \param mode The access mode of the mapping.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible .npy file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// By default, matrices of non-const element type are mapped copy-on-write, matrices of const
+// element type are mapped read-only. Non-const element types cannot be combined with the
+// \a readOnly mode.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::NpyMatrix( const std::string& path, MappingMode mode )
+   : CustomType()  // Base class initialization
+   , file_  ()     // The mapped file
+   , buffer_()     // The converted elements
+{
+   if( !IsConst<Type>::value && mode == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   map( openNpy( path, mode ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given array of a .npz archive.
+//
+// \param archive The .npz archive.
+// \param name The name of the array.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid, compressed, or incompatible array.
+//
+// The access mode of the mapping is determined by the access mode of the archive. The matrix
+// shares the mapping with the archive, i.e. it remains valid after the destruction of the
+// archive.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::NpyMatrix( const NpzArchive& archive, const std::string& name )
+   : CustomType()  // Base class initialization
+   , file_  ()     // The mapped file
+   , buffer_()     // The converted elements
+{
+   if( !IsConst<Type>::value && archive.mode() == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   map( archive.source( name ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for NpyMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>& NpyMatrix<Type,SO>::operator=( const NpyMatrix& rhs )
+{
+   CustomType::operator=( static_cast<const CustomType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix directly refers to the elements of the mapped file.
+//
+// \return \a true in case of a zero-copy mapping, \a false in case of converted elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool NpyMatrix<Type,SO>::isMapped() const noexcept
+{
+   return file_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error The file could not be synchronized.
+//
+// This function blocks until all modifications of a \a readWrite mapping have been written to
+// the file. In all other cases the function has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void NpyMatrix<Type,SO>::sync() const
+{
+   if( file_ != nullptr ) {
+      file_->sync();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the matrix from the given .npy array.
+//
+// \param source The mapped .npy array.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void NpyMatrix<Type,SO>::map( const NpySource& source )
+{
+   byte_t* data( source.data() );
+   const NpyHeader header( parseNpyHeader( data, source.size ) );
+
+   if( header.shape.size() != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of .npy array" );
+   }
+
+   const size_t m( header.shape[0] );
+   const size_t n( header.shape[1] );
+
+   if( isNpyCompatible<ElementType>( header, data ) && header.fortran == SO ) {
+      file_ = source.file;
+      if( m > 0UL && n > 0UL ) {
+         CustomType::reset( reinterpret_cast<Type*>( data + header.offset ), m, n );
+      }
+   }
+   else if( source.file->mode() == readWrite ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid writable mapping of incompatible .npy array" );
+   }
+   else if( m > 0UL && n > 0UL ) {
+      buffer_.reset( new ElementType[m*n] );
+      convertNpy( header, data, m, n, SO, buffer_.get() );
+      CustomType::reset( buffer_.get(), m, n );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPYMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given NumPy matrix is in default state.
+// \ingroup npy_matrix
+//
+// \param m The NumPy matrix to be tested for its default state.
+// \return \a true in case the given matrix is in default state, \a false otherwise.
+//
+// This overload forwards to the isDefault() function of the underlying custom matrix.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const NpyMatrix<Type,SO>& m )
+{
+   return isDefault<RF>( static_cast< const CustomMatrix<Type,unaligned,unpadded,SO>& >( m ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,379 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NpyVector.h
+//  \brief Header file for the implementation of a dense vector backed by a NumPy array
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_NPYVECTOR_H_
+#define _BLAZE_MATH_DENSE_NPYVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/math/serialization/Npz.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup npy_vector NpyVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a dense vector backed by a NumPy .npy array.
+// \ingroup npy_vector
+//
+// The NpyVector class template is a CustomVector that refers to the elements of a
+// one-dimensional NumPy array, which is stored either in a .npy file or as uncompressed array
+// within a .npz archive. The type of the elements and the transpose flag of the vector can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool TF >
+   class NpyVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. NpyVector can be used with any
+//          non-cv-qualified numeric element type. In order to map a file read-only, the
+//          element type has to be const-qualified (e.g. \c const \c double).
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// In case the dtype of the array exactly matches the element type (including the byte order)
+// and the elements are properly aligned, the vector directly refers to the elements within the
+// memory-mapped file (zero-copy). Otherwise the elements are converted into a buffer owned by
+// the vector:
+
+   \code
+   using blaze::NpyVector;
+
+   // Mapping the array copy-on-write (all modifications are private to the vector)
+   NpyVector<double> x( "x.npy" );
+
+   // Mapping the array for reading and writing (all modifications are persistent)
+   NpyVector<double> y( "x.npy", blaze::readWrite );
+
+   // Mapping the array read-only
+   const NpyVector<const double> z( "x.npy" );
+   const bool zeroCopy( z.isMapped() );
+   \endcode
+
+// Since NumPy does not pad the arrays, an NpyVector is an unaligned and unpadded CustomVector.
+// A \a readWrite mapping requires a zero-copy mapping, since modifications of the converted
+// elements cannot be written back to the file.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class NpyVector
+   : public CustomVector<Type,unaligned,unpadded,TF>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomVector<Type,unaligned,unpadded,TF>;  //!< Type of the underlying custom vector.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyVector( const std::string& path,
+                              MappingMode mode = ( IsConst<Type>::value ? readOnly : copyOnWrite ) );
+   explicit inline NpyVector( const NpzArchive& archive, const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using CustomType::operator=;
+
+   inline NpyVector& operator=( const NpyVector& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isMapped() const noexcept;
+   inline void sync() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using ElementType = RemoveConst_<Type>;  //!< Non-const type of the vector elements.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( const NpySource& source );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<MappedFile> file_;          //!< The mapped file (in case of a zero-copy mapping).
+   std::unique_ptr<ElementType[]> buffer_;     //!< The converted elements (in case of a conversion).
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the .npy file at the given path.
+//
+// \param path The path of the .npy file.
+// \param mode The access mode of the mapping.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible .npy file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// By default, vectors of non-const element type are mapped copy-on-write, vectors of const
+// element type are mapped read-only. Non-const element types cannot be combined with the
+// \a readOnly mode.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline NpyVector<Type,TF>::NpyVector( const std::string& path, MappingMode mode )
+   : CustomType()  // Base class initialization
+   , file_  ()     // The mapped file
+   , buffer_()     // The converted elements
+{
+   if( !IsConst<Type>::value && mode == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   map( openNpy( path, mode ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the given array of a .npz archive.
+//
+// \param archive The .npz archive.
+// \param name The name of the array.
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid, compressed, or incompatible array.
+//
+// The access mode of the mapping is determined by the access mode of the archive. The vector
+// shares the mapping with the archive, i.e. it remains valid after the destruction of the
+// archive.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline NpyVector<Type,TF>::NpyVector( const NpzArchive& archive, const std::string& name )
+   : CustomType()  // Base class initialization
+   , file_  ()     // The mapped file
+   , buffer_()     // The converted elements
+{
+   if( !IsConst<Type>::value && archive.mode() == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   map( archive.source( name ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for NpyVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In case the current sizes of the two
+// vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline NpyVector<Type,TF>& NpyVector<Type,TF>::operator=( const NpyVector& rhs )
+{
+   CustomType::operator=( static_cast<const CustomType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector directly refers to the elements of the mapped file.
+//
+// \return \a true in case of a zero-copy mapping, \a false in case of converted elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool NpyVector<Type,TF>::isMapped() const noexcept
+{
+   return file_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the vector back to the file.
+//
+// \return void
+// \exception std::runtime_error The file could not be synchronized.
+//
+// This function blocks until all modifications of a \a readWrite mapping have been written to
+// the file. In all other cases the function has no effect.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void NpyVector<Type,TF>::sync() const
+{
+   if( file_ != nullptr ) {
+      file_->sync();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the vector from the given .npy array.
+//
+// \param source The mapped .npy array.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy array.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void NpyVector<Type,TF>::map( const NpySource& source )
+{
+   byte_t* data( source.data() );
+   const NpyHeader header( parseNpyHeader( data, source.size ) );
+
+   if( header.shape.size() != 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of .npy array" );
+   }
+
+   const size_t n( header.shape[0] );
+
+   if( isNpyCompatible<ElementType>( header, data ) ) {
+      file_ = source.file;
+      if( n > 0UL ) {
+         CustomType::reset( reinterpret_cast<Type*>( data + header.offset ), n );
+      }
+   }
+   else if( source.file->mode() == readWrite ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid writable mapping of incompatible .npy array" );
+   }
+   else if( n > 0UL ) {
+      buffer_.reset( new ElementType[n] );
+      convertNpy( header, data, n, 1UL, false, buffer_.get() );
+      CustomType::reset( buffer_.get(), n );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPYVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given NumPy vector is in default state.
+// \ingroup npy_vector
+//
+// \param v The NumPy vector to be tested for its default state.
+// \return \a true in case the given vector is in default state, \a false otherwise.
+//
+// This overload forwards to the isDefault() function of the underlying custom vector.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool isDefault( const NpyVector<Type,TF>& v )
+{
+   return isDefault<RF>( static_cast< const CustomVector<Type,unaligned,unpadded,TF>& >( v ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,104 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Padding.h
+//  \brief Header file for the padding functionality of dense vectors and matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PADDING_H_
+#define _BLAZE_MATH_DENSE_PADDING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PADDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resets the padding elements in the range \f$ [first..last) \f$ to their default value.
+// \ingroup dense
+//
+// \param first Pointer to the first padding element.
+// \param last Pointer one past the last padding element.
+// \return void
+//
+// Padding elements that already have their default value are not written. This avoids to dirty
+// the pages of shared or memory-mapped storage whose padding has been reset before.
+*/
+template< typename Type >  // Data type of the padding elements
+inline DisableIf_< IsConst<Type> > clearPadding( Type* first, Type* last )
+{
+   for( ; first!=last; ++first ) {
+      if( *first != Type() )
+         *first = Type();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resets the padding elements in the range \f$ [first..last) \f$ to their default value.
+// \ingroup dense
+//
+// \param first Pointer to the first padding element.
+// \param last Pointer one past the last padding element.
+// \return void
+//
+// This overload of the clearPadding() function is selected for constant element types. Since
+// constant elements cannot be modified, the padding elements are expected to be already reset
+// to their default value (as for instance in case of read-only memory-mapped files).
+*/
+template< typename Type >  // Data type of the padding elements
+inline EnableIf_< IsConst<Type> > clearPadding( Type* first, Type* last ) noexcept
+{
+   UNUSED_PARAMETER( first, last );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
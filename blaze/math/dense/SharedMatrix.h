@@ -0,0 +1,449 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SharedMatrix.h
+//  \brief Header file for the implementation of a dense matrix in shared memory
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SHAREDMATRIX_H_
+#define _BLAZE_MATH_DENSE_SHAREDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/SharedMemory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup shared_matrix SharedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix in a POSIX shared memory segment.
+// \ingroup shared_matrix
+//
+// The SharedMatrix class template is a CustomMatrix whose elements are stored in a shared memory
+// segment (see the SharedMemory class). Thus several processes can work on the same matrix
+// without copying it. The type of the elements and the storage order of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class SharedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SharedMatrix can be used with any
+//          non-cv-qualified numeric element type. In order to attach a segment read-only, the
+//          element type has to be const-qualified (e.g. \c const \c double).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The segment starts with the same 64-byte header as the files of a MappedMatrix, followed by
+// the padded rows (in case of a row-major matrix) or columns (in case of a column-major matrix)
+// of the matrix. Thus a SharedMatrix is an aligned and padded CustomMatrix that can be used in
+// all vectorized (and parallelized) kernels:
+
+   \code
+   using blaze::SharedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   // Process 1: Placing the matrix A in the shared memory segment "/weights", backed by huge pages
+   DynamicMatrix<double> A( 100000UL, 20000UL );
+   // ... Initialization
+   SharedMatrix<double> W( "/weights", A.rows(), A.columns(), blaze::hugePages );
+   W = A;
+
+   // Processes 2-16: Attaching to the segment read-only
+   const SharedMatrix<const double> V( "/weights" );
+   DynamicVector<double> y( V * x );
+   \endcode
+
+// The segment is removed from the system as soon as the last SharedMatrix instance of all
+// processes has been destroyed. A SharedMatrix is not copyable.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class SharedMatrix
+   : public CustomMatrix<Type,aligned,padded,SO>
+{
+ public:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomMatrix<Type,aligned,padded,SO>;  //!< Type of the underlying custom matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SharedMatrix( const std::string& name, size_t m, size_t n,
+                                 SharedPages pages = normalPages );
+   explicit inline SharedMatrix( const std::string& name,
+                                 MappingMode mode = ( IsConst<Type>::value ? readOnly : readWrite ) );
+   explicit inline SharedMatrix( int fd,
+                                 MappingMode mode = ( IsConst<Type>::value ? readOnly : readWrite ) );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   using CustomType::operator=;
+
+   inline SharedMatrix& operator=( const SharedMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& name() const noexcept;
+   inline int                fd() const noexcept;
+   inline MappingMode        mode() const noexcept;
+   inline size_t             references() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait< RemoveConst_<Type> >::size };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void  attach();
+   inline Type* elements() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SharedMemory segment_;  //!< The shared memory segment.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( RemoveConst_<Type> );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new shared memory segment for a matrix of the given size.
+//
+// \param name The name of the segment (e.g. "/weights") or an empty string.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pages The page size flag of the segment (\a normalPages or \a hugePages).
+// \exception std::runtime_error The segment could not be created or mapped.
+//
+// This constructor creates a new shared memory segment for a \f$ m \times n \f$ matrix. All
+// elements are initialized to zero. In case the name is empty, an anonymous segment is created,
+// which can be attached by other processes via its file descriptor (see the fd() function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedMatrix<Type,SO>::SharedMatrix( const std::string& name, size_t m, size_t n,
+                                            SharedPages pages )
+   : CustomType()  // Base class initialization
+   , segment_( name, sizeof( MappedHeader ) + ( SO ? n : m ) *
+                     nextMultiple<size_t>( SO ? m : n, SIMDSIZE ) * sizeof( Type ), pages )
+{
+   BLAZE_STATIC_ASSERT_MSG( !IsConst<Type>::value, "Creation of a read-only shared matrix" );
+
+   const size_t nn( nextMultiple<size_t>( SO ? m : n, SIMDSIZE ) );
+
+   writeMappedHeader<Type>( segment_, MappedHeader::denseMatrix, SO, m, n, nn );
+
+   if( m > 0UL && n > 0UL ) {
+      CustomType::reset( elements(), m, n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the existing shared memory segment of the given name.
+//
+// \param name The name of the segment.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+// \exception std::runtime_error The segment could not be opened or mapped.
+//
+// This constructor attaches to a segment that has previously been created by a SharedMatrix
+// with the same element type and storage order. By default, matrices of non-const element type
+// are attached for reading and writing, matrices of const element type are attached read-only.
+// Non-const element types cannot be combined with the \a readOnly mode.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedMatrix<Type,SO>::SharedMatrix( const std::string& name, MappingMode mode )
+   : CustomType()            // Base class initialization
+   , segment_( name, mode )  // The shared memory segment
+{
+   attach();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the shared memory segment of the given file descriptor.
+//
+// \param fd The file descriptor of the segment.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+// \exception std::runtime_error The segment could not be mapped.
+//
+// This constructor attaches to a (named or anonymous) segment via a file descriptor, which has
+// for instance been inherited from the parent process. The given descriptor remains open.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedMatrix<Type,SO>::SharedMatrix( int fd, MappingMode mode )
+   : CustomType()          // Base class initialization
+   , segment_( fd, mode )  // The shared memory segment
+{
+   attach();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SharedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedMatrix<Type,SO>& SharedMatrix<Type,SO>::operator=( const SharedMatrix& rhs )
+{
+   CustomType::operator=( static_cast<const CustomType&>( rhs ) );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the name of the shared memory segment.
+//
+// \return The name of the segment (an empty string for anonymous and inherited segments).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const std::string& SharedMatrix<Type,SO>::name() const noexcept
+{
+   return segment_.name();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the file descriptor of the shared memory segment.
+//
+// \return The file descriptor of the segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline int SharedMatrix<Type,SO>::fd() const noexcept
+{
+   return segment_.fd();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappingMode SharedMatrix<Type,SO>::mode() const noexcept
+{
+   return segment_.mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of attached instances of all processes.
+//
+// \return The current number of instances attached to the shared memory segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedMatrix<Type,SO>::references() const noexcept
+{
+   return segment_.references();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Validates the header of an attached segment and initializes the custom matrix.
+//
+// \return void
+// \exception std::invalid_argument Invalid mapping mode for the element type.
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void SharedMatrix<Type,SO>::attach()
+{
+   if( !IsConst<Type>::value && segment_.mode() == readOnly ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read-only mapping of non-constant elements" );
+   }
+
+   const MappedHeader header( readMappedHeader<Type>( segment_, MappedHeader::denseMatrix, SO ) );
+
+   const size_t m ( header.rows    );
+   const size_t n ( header.columns );
+   const size_t nn( header.spacing );
+
+   const size_t capacity( ( segment_.size() - sizeof( MappedHeader ) ) / sizeof( Type ) );
+
+   if( nn < ( SO ? m : n ) || nn % SIMDSIZE != 0UL ||
+       ( ( SO ? n : m ) > 0UL && nn > capacity / ( SO ? n : m ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of shared memory segment" );
+   }
+
+   if( m > 0UL && n > 0UL ) {
+      CustomType::reset( elements(), m, n, nn );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first element of the shared matrix.
+//
+// \return Pointer to the first element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline Type* SharedMatrix<Type,SO>::elements() noexcept
+{
+   return reinterpret_cast<Type*>( segment_.data() + sizeof( MappedHeader ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SHAREDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given shared matrix is in default state.
+// \ingroup shared_matrix
+//
+// \param m The shared matrix to be tested for its default state.
+// \return \a true in case the given matrix is in default state, \a false otherwise.
+//
+// This overload forwards to the isDefault() function of the underlying custom matrix.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const SharedMatrix<Type,SO>& m )
+{
+   return isDefault<RF>( static_cast< const CustomMatrix<Type,aligned,padded,SO>& >( m ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
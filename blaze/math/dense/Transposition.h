@@ -0,0 +1,636 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transposition.h
+//  \brief Header file for the dense matrix transposition kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SIMD BLOCK TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size of the square blocks transposed in SIMD registers.
+// \ingroup math
+//
+// The \a value member constant specifies the number of rows and columns of the blocks that are
+// transposed by the transposeBlock() function, i.e. the number of values of type \a T within a
+// single SIMD register of the selected instruction set.
+*/
+template< typename T >  // Type of the elements
+struct TransposeBlockSize
+{
+   enum : size_t { value = ( IsDouble<T>::value )?( BLAZE_AVX_MODE ? 4UL : 2UL )
+                                                 :( BLAZE_AVX_MODE ? 8UL : 4UL ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposes a square block of double precision values in SIMD registers.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source block.
+// \param lds The spacing between two rows of the source block.
+// \param dst Pointer to the first element of the target block.
+// \param ldd The spacing between two rows of the target block.
+// \return void
+//
+// This function transposes a 4x4 (AVX) or 2x2 (SSE2) block of double precision values. The
+// rows of the block are loaded into SIMD registers, the registers are transposed by means of
+// unpack and permutation instructions, and the resulting registers are stored as rows of the
+// target block. Neither the source nor the target block has to be aligned.
+*/
+template< typename T >  // Type of the elements
+BLAZE_ALWAYS_INLINE EnableIf_< IsDouble<T> >
+   transposeBlock( const T* src, size_t lds, T* dst, size_t ldd ) noexcept
+{
+#if BLAZE_AVX_MODE
+   const __m256d r0( _mm256_loadu_pd( src       ) );
+   const __m256d r1( _mm256_loadu_pd( src+  lds ) );
+   const __m256d r2( _mm256_loadu_pd( src+2*lds ) );
+   const __m256d r3( _mm256_loadu_pd( src+3*lds ) );
+
+   const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+   const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+   const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+   const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+   _mm256_storeu_pd( dst      , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+   _mm256_storeu_pd( dst+  ldd, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+   _mm256_storeu_pd( dst+2*ldd, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+   _mm256_storeu_pd( dst+3*ldd, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+#elif BLAZE_SSE2_MODE
+   const __m128d r0( _mm_loadu_pd( src     ) );
+   const __m128d r1( _mm_loadu_pd( src+lds ) );
+
+   _mm_storeu_pd( dst    , _mm_unpacklo_pd( r0, r1 ) );
+   _mm_storeu_pd( dst+ldd, _mm_unpackhi_pd( r0, r1 ) );
+#else
+   for( size_t i=0UL; i<TransposeBlockSize<T>::value; ++i )
+      for( size_t j=0UL; j<TransposeBlockSize<T>::value; ++j )
+         dst[j*ldd+i] = src[i*lds+j];
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposes a square block of single precision values in SIMD registers.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source block.
+// \param lds The spacing between two rows of the source block.
+// \param dst Pointer to the first element of the target block.
+// \param ldd The spacing between two rows of the target block.
+// \return void
+//
+// This function transposes an 8x8 (AVX) or 4x4 (SSE) block of single precision values in SIMD
+// registers. Neither the source nor the target block has to be aligned.
+*/
+template< typename T >  // Type of the elements
+BLAZE_ALWAYS_INLINE EnableIf_< IsFloat<T> >
+   transposeBlock( const T* src, size_t lds, T* dst, size_t ldd ) noexcept
+{
+#if BLAZE_AVX_MODE
+   const __m256 r0( _mm256_loadu_ps( src       ) );
+   const __m256 r1( _mm256_loadu_ps( src+  lds ) );
+   const __m256 r2( _mm256_loadu_ps( src+2*lds ) );
+   const __m256 r3( _mm256_loadu_ps( src+3*lds ) );
+   const __m256 r4( _mm256_loadu_ps( src+4*lds ) );
+   const __m256 r5( _mm256_loadu_ps( src+5*lds ) );
+   const __m256 r6( _mm256_loadu_ps( src+6*lds ) );
+   const __m256 r7( _mm256_loadu_ps( src+7*lds ) );
+
+   const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+   const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+   const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+   const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+   const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+   const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+   const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+   const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+   const __m256 u0( _mm256_shuffle_ps( t0, t2, 0x44 ) );
+   const __m256 u1( _mm256_shuffle_ps( t0, t2, 0xEE ) );
+   const __m256 u2( _mm256_shuffle_ps( t1, t3, 0x44 ) );
+   const __m256 u3( _mm256_shuffle_ps( t1, t3, 0xEE ) );
+   const __m256 u4( _mm256_shuffle_ps( t4, t6, 0x44 ) );
+   const __m256 u5( _mm256_shuffle_ps( t4, t6, 0xEE ) );
+   const __m256 u6( _mm256_shuffle_ps( t5, t7, 0x44 ) );
+   const __m256 u7( _mm256_shuffle_ps( t5, t7, 0xEE ) );
+
+   _mm256_storeu_ps( dst      , _mm256_permute2f128_ps( u0, u4, 0x20 ) );
+   _mm256_storeu_ps( dst+  ldd, _mm256_permute2f128_ps( u1, u5, 0x20 ) );
+   _mm256_storeu_ps( dst+2*ldd, _mm256_permute2f128_ps( u2, u6, 0x20 ) );
+   _mm256_storeu_ps( dst+3*ldd, _mm256_permute2f128_ps( u3, u7, 0x20 ) );
+   _mm256_storeu_ps( dst+4*ldd, _mm256_permute2f128_ps( u0, u4, 0x31 ) );
+   _mm256_storeu_ps( dst+5*ldd, _mm256_permute2f128_ps( u1, u5, 0x31 ) );
+   _mm256_storeu_ps( dst+6*ldd, _mm256_permute2f128_ps( u2, u6, 0x31 ) );
+   _mm256_storeu_ps( dst+7*ldd, _mm256_permute2f128_ps( u3, u7, 0x31 ) );
+#elif BLAZE_SSE_MODE
+   __m128 r0( _mm_loadu_ps( src       ) );
+   __m128 r1( _mm_loadu_ps( src+  lds ) );
+   __m128 r2( _mm_loadu_ps( src+2*lds ) );
+   __m128 r3( _mm_loadu_ps( src+3*lds ) );
+
+   _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+   _mm_storeu_ps( dst      , r0 );
+   _mm_storeu_ps( dst+  ldd, r1 );
+   _mm_storeu_ps( dst+2*ldd, r2 );
+   _mm_storeu_ps( dst+3*ldd, r3 );
+#else
+   for( size_t i=0UL; i<TransposeBlockSize<T>::value; ++i )
+      for( size_t j=0UL; j<TransposeBlockSize<T>::value; ++j )
+         dst[j*ldd+i] = src[i*lds+j];
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUT-OF-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized out-of-place transposition of a dense block of elements.
+// \ingroup math
+//
+// \param src Pointer to the first element of the \f$ M \times N \f$ source block.
+// \param lds The spacing between two rows of the source block.
+// \param dst Pointer to the first element of the \f$ N \times M \f$ target block.
+// \param ldd The spacing between two rows of the target block.
+// \param m The number of rows of the source block.
+// \param n The number of columns of the source block.
+// \return void
+//
+// This function assigns the transpose of the source block to the target block, i.e. it sets
+// \c dst[j*ldd+i] to \c src[i*lds+j] for all \f$ i \in [0..M) \f$ and \f$ j \in [0..N) \f$.
+// The target block is written in tiles of eight SIMD blocks of rows and 1024 columns, such
+// that every touched cache line of the source block is completely consumed while it resides
+// in the cache and the target rows are streamed sequentially.
+// Within each tile the elements are transposed in square blocks in SIMD registers (see the
+// transposeBlock() function). The source and the target block must not overlap.
+*/
+template< typename T >  // Type of the elements
+inline EnableIf_< HasSIMDTranspose<T,T> >
+   transposeKernel( const T* src, size_t lds, T* dst, size_t ldd, size_t m, size_t n ) noexcept
+{
+   constexpr size_t S    ( TransposeBlockSize<T>::value );
+   constexpr size_t itile( 1024UL );
+   constexpr size_t jtile( 8UL*S );
+
+   const size_t mpos( m & size_t(-S) );
+   const size_t npos( n & size_t(-S) );
+
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % S ) ) == mpos, "Invalid end calculation" );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % S ) ) == npos, "Invalid end calculation" );
+
+   for( size_t jj=0UL; jj<n; jj+=jtile )
+   {
+      const size_t jend( min( jj+jtile, n ) );
+      const size_t jpos( min( jj+jtile, npos ) );
+
+      for( size_t ii=0UL; ii<m; ii+=itile )
+      {
+         const size_t iend( min( ii+itile, m ) );
+         const size_t ipos( min( ii+itile, mpos ) );
+
+         size_t j( jj );
+
+         for( ; j<jpos; j+=S ) {
+            size_t i( ii );
+            for( ; i<ipos; i+=S ) {
+               transposeBlock( src+i*lds+j, lds, dst+j*ldd+i, ldd );
+            }
+            for( ; i<iend; ++i ) {
+               for( size_t k=0UL; k<S; ++k ) {
+                  dst[(j+k)*ldd+i] = src[i*lds+j+k];
+               }
+            }
+         }
+         for( ; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               dst[j*ldd+i] = src[i*lds+j];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary structure for the in-place transposition of a contiguous array.
+// \ingroup math
+//
+// The TransposeDecomposition structure implements the in-place transposition of an array of
+// \f$ X \cdot Y \f$ elements (\f$ X \leq Y \f$), viewed as a row-major \f$ X \times Y \f$ grid,
+// by means of three independent permutations (see B. Catanzaro, A. Keller, M. Garland: "A
+// Decomposition for In-place Matrix Transposition", PPoPP 2014):
+//
+//  -# a rotation of every column by \f$ \lfloor j/b \rfloor \f$ (only if \f$ c > 1 \f$),
+//  -# a permutation within every row (row shuffle), and
+//  -# a permutation within every column (column shuffle),
+//
+// with \f$ c = \gcd(X,Y) \f$ and \f$ b = Y/c \f$. Applied in this order, the three steps move
+// the element \f$ (i,j) \f$ at the position \f$ iY+j \f$ to the position \f$ jX+i \f$, i.e.
+// they transpose a row-major \f$ X \times Y \f$ matrix. Applied in reverse order and with the
+// inverse permutations, they transpose a row-major \f$ Y \times X \f$ matrix. Every step only
+// requires an auxiliary buffer of a single row or of a block of columns. Columns are processed
+// in blocks of a cache line, rows and column blocks are distributed among the threads of the
+// active shared memory parallelization.
+*/
+template< typename Type >  // Data type of the elements
+struct TransposeDecomposition
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TransposeDecomposition structure.
+   //
+   // \param data Pointer to the first element of the array.
+   // \param x The number of rows of the grid.
+   // \param y The number of columns of the grid.
+   */
+   inline TransposeDecomposition( Type* data, size_t x, size_t y )
+      : data_( data )
+      , x_   ( x )
+      , y_   ( y )
+      , c_   ( gcd( x, y ) )
+      , b_   ( y / c_ )
+      , partitions_( ( x*y >= SMP_DMATASSIGN_THRESHOLD && !isSerialSectionActive() && !isParallelSectionActive() )
+                     ?( getNumThreads() ):( 1UL ) )
+      , buffer_( new Type[ max( y, partitions_*x*W ) ] )
+   {
+      BLAZE_INTERNAL_ASSERT( x <= y, "Invalid grid dimensions detected" );
+   }
+   //**********************************************************************************************
+
+   //**Transposition functions*********************************************************************
+   /*!\brief Transposes the row-major \f$ X \times Y \f$ matrix into a \f$ Y \times X \f$ matrix.
+   //
+   // \return void
+   */
+   inline void transposeWide() {
+      if( c_ > 1UL ) columnPass( [this]( size_t col, Type* column ) { rotate( col, column, false ); } );
+      rowPass( false );
+      columnPass( [this]( size_t col, Type* column ) { shuffle( col, column, false ); } );
+   }
+
+   /*!\brief Transposes the row-major \f$ Y \times X \f$ matrix into a \f$ X \times Y \f$ matrix.
+   //
+   // \return void
+   */
+   inline void transposeTall() {
+      columnPass( [this]( size_t col, Type* column ) { shuffle( col, column, true ); } );
+      rowPass( true );
+      if( c_ > 1UL ) columnPass( [this]( size_t col, Type* column ) { rotate( col, column, true ); } );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! The number of columns processed at once (a cache line of elements).
+   enum : size_t { W = ( sizeof( Type ) < 64UL )?( 64UL / sizeof( Type ) ):( 1UL ) };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Computes the greatest common divisor of two non-zero integers.
+   //
+   // \param a The first integer.
+   // \param b The second integer.
+   // \return The greatest common divisor of \a a and \a b.
+   */
+   static inline size_t gcd( size_t a, size_t b ) noexcept {
+      while( b != 0UL ) {
+         const size_t r( a % b );
+         a = b;
+         b = r;
+      }
+      return a;
+   }
+   //**********************************************************************************************
+
+   //**Row permutation*****************************************************************************
+   /*!\brief Permutes the elements within the given range of a row.
+   //
+   // \param r The index of the row.
+   // \param begin The first column of the range.
+   // \param end The column after the last column of the range.
+   // \param inverse \a true for the inverse permutation (gather), \a false for the scatter.
+   // \return void
+   //
+   // The element in column \a j is moved to column \f$ (jX + (r + \lfloor j/b \rfloor) \bmod X)
+   // \bmod Y \f$ of the buffer (or vice versa for the inverse permutation). All indices are
+   // updated incrementally to avoid divisions in the inner loop.
+   */
+   inline void permuteRow( size_t r, size_t begin, size_t end, bool inverse ) {
+      Type* row( data_ + r*y_ );
+
+      const size_t step( x_ % y_ );
+
+      size_t q  ( begin / b_ );
+      size_t t  ( begin % b_ );
+      size_t off( ( r + q ) % x_ );
+      size_t jx ( ( ( begin % y_ ) * ( x_ % y_ ) ) % y_ );
+
+      for( size_t j=begin; j<end; ++j )
+      {
+         const size_t pos( ( jx + off < y_ )?( jx + off ):( jx + off - y_ ) );
+
+         if( inverse )
+            buffer_[j] = std::move( row[pos] );
+         else
+            buffer_[pos] = std::move( row[j] );
+
+         jx += step;
+         if( jx >= y_ ) jx -= y_;
+
+         if( ++t == b_ ) {
+            t = 0UL;
+            if( ++off == x_ ) off = 0UL;
+         }
+      }
+   }
+
+   /*!\brief Applies the row shuffle to all rows.
+   //
+   // \param inverse \a true for the inverse permutation, \a false for the forward permutation.
+   // \return void
+   //
+   // Each row is permuted into the auxiliary buffer and moved back afterwards. In parallel mode,
+   // both the permutation and the move of every row are split among all threads.
+   */
+   inline void rowPass( bool inverse ) {
+      const size_t part( ( y_ + partitions_ - 1UL ) / partitions_ );
+
+      for( size_t r=0UL; r<x_; ++r )
+      {
+         Type* row( data_ + r*y_ );
+
+         smpForRange( partitions_, 2UL, [this,r,part,inverse]( size_t begin, size_t end ) {
+            permuteRow( r, min( begin*part, y_ ), min( end*part, y_ ), inverse );
+         } );
+         smpForRange( partitions_, 2UL, [this,row,part]( size_t begin, size_t end ) {
+            std::move( buffer_.get() + min( begin*part, y_ ), buffer_.get() + min( end*part, y_ ),
+                       row + min( begin*part, y_ ) );
+         } );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Column permutations*************************************************************************
+   /*!\brief Rotates a single column by \f$ \lfloor j/b \rfloor \f$ rows.
+   //
+   // \param col The index of the column.
+   // \param column The column buffer with a spacing of \a W elements.
+   // \param inverse \a true for the inverse rotation, \a false for the forward rotation.
+   // \return void
+   */
+   inline void rotate( size_t col, Type* column, bool inverse ) {
+      const size_t k( col / b_ );
+      size_t src( inverse ? ( x_ - k ) % x_ : k );
+
+      for( size_t r=0UL; r<x_; ++r ) {
+         column[r*W] = std::move( data_[src*y_+col] );
+         if( ++src == x_ ) src = 0UL;
+      }
+   }
+
+   /*!\brief Applies the column shuffle to a single column.
+   //
+   // \param col The index of the column.
+   // \param column The column buffer with a spacing of \a W elements.
+   // \param inverse \a true for the inverse permutation (scatter), \a false for the gather.
+   // \return void
+   //
+   // The target row \f$ r \f$ of the column receives the element of row \f$ (i - \lfloor j/b
+   // \rfloor) \bmod X \f$ with \f$ j = \lfloor (rY+col)/X \rfloor \f$ and \f$ i = (rY+col)
+   // \bmod X \f$ (or vice versa for the inverse permutation).
+   */
+   inline void shuffle( size_t col, Type* column, bool inverse ) {
+      const size_t di( y_ % x_ );
+      const size_t dj( y_ / x_ );
+
+      size_t i ( col % x_ );
+      size_t j ( col / x_ );
+      size_t jq( j / b_ );
+      size_t jr( j % b_ );
+
+      for( size_t r=0UL; r<x_; ++r )
+      {
+         const size_t src( ( i >= jq )?( i - jq ):( i + x_ - jq ) );
+
+         if( inverse )
+            column[src*W] = std::move( data_[r*y_+col] );
+         else
+            column[r*W] = std::move( data_[src*y_+col] );
+
+         i += di;
+         jr += dj;
+         if( i >= x_ ) { i -= x_; ++jr; }
+         while( jr >= b_ ) { jr -= b_; ++jq; }
+      }
+   }
+
+   /*!\brief Applies the given column permutation to all columns.
+   //
+   // \param op The permutation of a single column.
+   // \return void
+   //
+   // The columns are processed in blocks of \a W columns. The permuted columns of a block are
+   // gathered in an interleaved auxiliary buffer and written back row by row.
+   */
+   template< typename OP >  // Type of the column permutation
+   inline void columnPass( OP op ) {
+      const size_t blocks( ( y_ + W - 1UL ) / W );
+      const size_t part  ( ( blocks + partitions_ - 1UL ) / partitions_ );
+
+      auto process = [this,&op,blocks,part]( size_t p )
+      {
+         Type* tmp( buffer_.get() + p*x_*W );
+
+         for( size_t block=p*part; block<min( (p+1UL)*part, blocks ); ++block )
+         {
+            const size_t jbegin( block*W );
+            const size_t jend  ( min( jbegin+W, y_ ) );
+
+            for( size_t j=jbegin; j<jend; ++j ) {
+               op( j, tmp + ( j - jbegin ) );
+            }
+            for( size_t r=0UL; r<x_; ++r ) {
+               std::move( tmp + r*W, tmp + r*W + ( jend - jbegin ), data_ + r*y_ + jbegin );
+            }
+         }
+      };
+
+      smpForRange( partitions_, 2UL, [&process]( size_t begin, size_t end ) {
+         for( size_t p=begin; p<end; ++p ) {
+            process( p );
+         }
+      } );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type* const data_;                //!< Pointer to the first element of the array.
+   const size_t x_;                  //!< The number of rows of the grid.
+   const size_t y_;                  //!< The number of columns of the grid.
+   const size_t c_;                  //!< The greatest common divisor of the grid dimensions.
+   const size_t b_;                  //!< The number of columns per rotation step.
+   const size_t partitions_;         //!< The number of parallel partitions.
+   std::unique_ptr<Type[]> buffer_;  //!< The auxiliary buffer.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a contiguous row-major matrix with a preparation step.
+// \ingroup math
+//
+// \param data Pointer to the first element of the \f$ M \times N \f$ matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param prepare The preparation step to be performed before the transposition.
+// \return void
+// \exception std::bad_alloc Allocation of the auxiliary buffer failed.
+//
+// This function transposes the given row-major \f$ M \times N \f$ matrix like the function
+// below. The given \a prepare callable is invoked once all auxiliary memory has been allocated
+// and before the transposition starts. This allows the caller to rearrange the elements (for
+// instance to remove padding) without leaving the matrix in an inconsistent state in case the
+// allocation fails.
+*/
+template< typename Type       // Data type of the elements
+        , typename Prepare >  // Type of the preparation step
+void transposeInPlace( Type* data, size_t m, size_t n, Prepare prepare )
+{
+   if( m <= 1UL || n <= 1UL ) {
+      prepare();
+   }
+   else if( m <= n ) {
+      TransposeDecomposition<Type> decomposition( data, m, n );
+      prepare();
+      decomposition.transposeWide();
+   }
+   else {
+      TransposeDecomposition<Type> decomposition( data, n, m );
+      prepare();
+      decomposition.transposeTall();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a contiguous row-major matrix.
+// \ingroup math
+//
+// \param data Pointer to the first element of the \f$ M \times N \f$ matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// This function transposes the given row-major \f$ M \times N \f$ matrix without padding into
+// a row-major \f$ N \times M \f$ matrix without padding in the same memory. In contrast to an
+// out-of-place transposition it only requires an auxiliary buffer of \f$ \max(M,N) \f$
+// elements (see the TransposeDecomposition structure). Since the transposition of a column-major
+// matrix corresponds to the transposition of a row-major matrix with swapped dimensions, the
+// function can be used for both storage orders.
+*/
+template< typename Type >  // Data type of the elements
+void transposeInPlace( Type* data, size_t m, size_t n )
+{
+   transposeInPlace( data, m, n, [](){} );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,157 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX512.h
+//  \brief Header file for the AVX-512 variant of the dispatched compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX512_H_
+#define _BLAZE_MATH_DISPATCH_AVX512_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx512 {
+
+BLAZE_TARGET_REGION_BEGIN( "avx512f,avx2,fma" )
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 pack of the dispatched compute kernels.
+// \ingroup dispatch
+//
+// The AVX-512 variant of the dispatched compute kernels operates on 512-bit registers.
+// All functions of this variant are compiled for the AVX-512 instruction set, independent
+// of the instruction set selected on the command line, and must only be called on CPUs that
+// support this instruction set.
+*/
+template< typename T >
+struct Pack;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 pack for double precision floating point values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<double>
+{
+   using Type = __m512d;
+
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_pd(); }
+   static BLAZE_ALWAYS_INLINE Type set( double value ) noexcept { return _mm512_set1_pd( value ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* address ) noexcept { return _mm512_loadu_pd( address ); }
+   static BLAZE_ALWAYS_INLINE void store( double* address, Type value ) noexcept { _mm512_storeu_pd( address, value ); }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_pd( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE double sum( Type a ) noexcept {
+      alignas( 64 ) double v[8];
+      _mm512_store_pd( v, a );
+      return ( ( v[0] + v[1] ) + ( v[2] + v[3] ) ) + ( ( v[4] + v[5] ) + ( v[6] + v[7] ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 pack for single precision floating point values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<float>
+{
+   using Type = __m512;
+
+   static constexpr size_t size = 16UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_ps(); }
+   static BLAZE_ALWAYS_INLINE Type set( float value ) noexcept { return _mm512_set1_ps( value ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* address ) noexcept { return _mm512_loadu_ps( address ); }
+   static BLAZE_ALWAYS_INLINE void store( float* address, Type value ) noexcept { _mm512_storeu_ps( address, value ); }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_ps( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept {
+      alignas( 64 ) float v[16];
+      _mm512_store_ps( v, a );
+      return ( ( ( v[ 0] + v[ 1] ) + ( v[ 2] + v[ 3] ) ) + ( ( v[ 4] + v[ 5] ) + ( v[ 6] + v[ 7] ) ) ) +
+             ( ( ( v[ 8] + v[ 9] ) + ( v[10] + v[11] ) ) + ( ( v[12] + v[13] ) + ( v[14] + v[15] ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPUTE KERNELS
+//
+//=================================================================================================
+
+#include <blaze/math/dispatch/Kernels.h>
+
+BLAZE_TARGET_REGION_END
+
+} // namespace avx512
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
+
+#endif
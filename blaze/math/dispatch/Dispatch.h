@@ -0,0 +1,252 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Dispatch.h
+//  \brief Header file for the runtime dispatch of the compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_DISPATCH_H_
+#define _BLAZE_MATH_DISPATCH_DISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/dispatch/AVX2.h>
+#include <blaze/math/dispatch/AVX512.h>
+#include <blaze/math/dispatch/Generic.h>
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/SSE4.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dispatch Runtime dispatch
+// \ingroup math
+*/
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  DISPATCH MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the variant of the given kernel for the currently selected instruction set.
+// \ingroup dispatch
+*/
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  define BLAZE_DISPATCH_KERNEL( KERNEL, ... ) \
+   switch( getInstructionSet() ) { \
+      case isaAVX512: return avx512::KERNEL( __VA_ARGS__ ); \
+      case isaAVX2  : return avx2::KERNEL( __VA_ARGS__ ); \
+      case isaSSE4  : return sse4::KERNEL( __VA_ARGS__ ); \
+      default       : return generic::KERNEL( __VA_ARGS__ ); \
+   }
+#else
+#  define BLAZE_DISPATCH_KERNEL( KERNEL, ... ) \
+   return generic::KERNEL( __VA_ARGS__ );
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dispatched kernels */
+//@{
+template< typename T >
+T dot( size_t n, const T* x, const T* y );
+
+template< typename T >
+void axpy( size_t n, T alpha, const T* x, T* y );
+
+template< typename T, typename Iterator >
+T sparseDot( Iterator begin, Iterator end, const T* x );
+
+template< typename T >
+void gemm( size_t M, size_t N, size_t K, T alpha,
+           const T* A, ptrdiff_t rsA, ptrdiff_t csA,
+           const T* B, ptrdiff_t rsB, ptrdiff_t csB,
+           T beta, T* C, ptrdiff_t rsC, ptrdiff_t csC );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the dot product of two contiguous arrays (\f$ s=x^T*y \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of both arrays.
+// \param x Pointer to the first element of the left-hand side array.
+// \param y Pointer to the first element of the right-hand side array.
+// \return The dot product of the two arrays.
+//
+// This function computes the dot product by means of the kernel variant for the currently
+// selected instruction set (see the getInstructionSet() function). The function can only be
+// used for \c float and \c double arrays.
+*/
+template< typename T >
+T dot( size_t n, const T* x, const T* y )
+{
+   BLAZE_DISPATCH_KERNEL( dot, n, x, y )
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the scaled addition of two contiguous arrays (\f$ y+=\alpha*x \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of both arrays.
+// \param alpha The scaling factor for \a x.
+// \param x Pointer to the first element of the right-hand side array.
+// \param y Pointer to the first element of the target array.
+// \return void
+//
+// This function computes the scaled addition by means of the kernel variant for the currently
+// selected instruction set (see the getInstructionSet() function). The function can only be
+// used for \c float and \c double arrays.
+*/
+template< typename T >
+void axpy( size_t n, T alpha, const T* x, T* y )
+{
+   BLAZE_DISPATCH_KERNEL( axpy, n, alpha, x, y )
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the dot product of a range of sparse elements and a contiguous array.
+// \ingroup dispatch
+//
+// \param begin Iterator to the first sparse element.
+// \param end Iterator one past the last sparse element.
+// \param x Pointer to the first element of the dense array.
+// \return The dot product of the sparse elements and the dense array.
+//
+// This function computes the dot product by means of the kernel variant for the currently
+// selected instruction set (see the getInstructionSet() function). The given iterators must
+// be random access iterators to elements providing the \a value() and \a index() functions
+// (as for instance the iterators of a row of a row-major compressed matrix).
+*/
+template< typename T, typename Iterator >
+T sparseDot( Iterator begin, Iterator end, const T* x )
+{
+   BLAZE_DISPATCH_KERNEL( sparseDot, begin, end, x )
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the general matrix multiplication \f$ C=\alpha*A*B+\beta*C \f$.
+// \ingroup dispatch
+//
+// \param M The number of rows of \a A and \a C.
+// \param N The number of columns of \a B and \a C.
+// \param K The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the left-hand side operand.
+// \param rsA The row stride of \a A.
+// \param csA The column stride of \a A.
+// \param B Pointer to the first element of the right-hand side operand.
+// \param rsB The row stride of \a B.
+// \param csB The column stride of \a B.
+// \param beta The scaling factor for \a C.
+// \param C Pointer to the first element of the target matrix.
+// \param rsC The row stride of \a C.
+// \param csC The column stride of \a C.
+// \return void
+//
+// This function computes the matrix multiplication by means of the kernel variant for the
+// currently selected instruction set (see the getInstructionSet() function). All matrices
+// are specified by a pointer to their first element and the distance between two consecutive
+// rows and columns, respectively, which allows to pass both row-major and column-major
+// matrices. In case \a beta is 0, the initial values of \a C are ignored. The function can
+// only be used for \c float and \c double matrices.
+*/
+template< typename T >
+void gemm( size_t M, size_t N, size_t K, T alpha,
+           const T* A, ptrdiff_t rsA, ptrdiff_t csA,
+           const T* B, ptrdiff_t rsB, ptrdiff_t csB,
+           T beta, T* C, ptrdiff_t rsC, ptrdiff_t csC )
+{
+   using Blocking = generic::GemmBlocking<T>;
+
+   if( beta != T(1) ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            T& c( C[ptrdiff_t(i)*rsC + ptrdiff_t(j)*csC] );
+            c = ( beta == T(0) )?( T() ):( beta * c );
+         }
+      }
+   }
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const std::unique_ptr<T[]> bufferA( new T[Blocking::MC*Blocking::KC] );
+   const std::unique_ptr<T[]> bufferB( new T[Blocking::KC*Blocking::NC] );
+
+   BLAZE_DISPATCH_KERNEL( gemm, M, N, K, alpha, A, rsA, csA, B, rsB, csB, C, rsC, csC,
+                          bufferA.get(), bufferB.get() )
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
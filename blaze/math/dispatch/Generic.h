@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Generic.h
+//  \brief Header file for the generic variant of the dispatched compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_GENERIC_H_
+#define _BLAZE_MATH_DISPATCH_GENERIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace generic {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar pack of the generic compute kernels.
+// \ingroup dispatch
+//
+// The generic variant of the dispatched compute kernels operates on single elements. It is
+// used on CPUs without SSE4 support and in case the runtime dispatch is not active.
+*/
+template< typename T >
+struct Pack
+{
+   using Type = T;
+
+   static constexpr size_t size = 1UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return T(); }
+   static BLAZE_ALWAYS_INLINE Type set( T value ) noexcept { return value; }
+   static BLAZE_ALWAYS_INLINE Type load( const T* address ) noexcept { return *address; }
+   static BLAZE_ALWAYS_INLINE void store( T* address, Type value ) noexcept { *address = value; }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return a + b; }
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return a * b + c; }
+   static BLAZE_ALWAYS_INLINE T sum( Type a ) noexcept { return a; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPUTE KERNELS
+//
+//=================================================================================================
+
+#include <blaze/math/dispatch/Kernels.h>
+
+} // namespace generic
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,250 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/InstructionSet.h
+//  \brief Header file for the runtime selection of the instruction set
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <blaze/math/Exception.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FLAGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instruction sets supported by the runtime dispatch of the compute kernels.
+// \ingroup dispatch
+//
+// The instruction sets are ordered by capability, i.e. a CPU that supports a particular
+// instruction set also supports all instruction sets with a smaller value.
+*/
+enum InstructionSet : int
+{
+   isaGeneric = 0,  //!< Portable C++ kernels without explicit vectorization.
+   isaSSE4    = 1,  //!< Kernels based on the SSE4.2 instruction set.
+   isaAVX2    = 2,  //!< Kernels based on the AVX2 and FMA instruction sets.
+   isaAVX512  = 3   //!< Kernels based on the AVX-512F instruction set.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+inline InstructionSet detectInstructionSet() noexcept;
+inline InstructionSet getInstructionSet() noexcept;
+inline void setInstructionSet( InstructionSet isa );
+inline const char* getInstructionSetName( InstructionSet isa ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Queries the most capable instruction set supported by the executing CPU.
+// \ingroup dispatch
+//
+// \return The most capable instruction set of the executing CPU.
+//
+// This function queries the CPU features via the \c cpuid instruction (including the check
+// whether the operating system saves the extended register state) and returns the most capable
+// instruction set that is supported by the executing CPU. In case the runtime dispatch mode is
+// not active (see the \c BLAZE_USE_RUNTIME_DISPATCH switch), the function returns \a isaGeneric.
+*/
+inline InstructionSet detectInstructionSet() noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) &&
+       __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return isaAVX512;
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return isaAVX2;
+   else if( __builtin_cpu_supports( "sse4.2" ) )
+      return isaSSE4;
+   else return isaGeneric;
+#else
+   return isaGeneric;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the initially selected instruction set.
+// \ingroup dispatch
+//
+// \return The initially selected instruction set.
+//
+// This function determines the instruction set that is selected at startup. By default this
+// is the most capable instruction set of the executing CPU. Via the \c BLAZE_INSTRUCTION_SET
+// environment variable it is possible to restrict the selection to a less capable instruction
+// set (\c "generic", \c "sse4", \c "avx2", or \c "avx512"), which for instance allows to avoid
+// the frequency reduction of some CPUs when executing AVX-512 instructions. Requests for an
+// instruction set that is not supported by the CPU are ignored.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline InstructionSet initInstructionSet() noexcept
+{
+   const InstructionSet detected( detectInstructionSet() );
+   const char* env = std::getenv( "BLAZE_INSTRUCTION_SET" );
+
+   if( env == nullptr )
+      return detected;
+
+   InstructionSet requested( detected );
+
+   if     ( std::strcmp( env, "generic" ) == 0 ) requested = isaGeneric;
+   else if( std::strcmp( env, "sse4"    ) == 0 ) requested = isaSSE4;
+   else if( std::strcmp( env, "avx2"    ) == 0 ) requested = isaAVX2;
+   else if( std::strcmp( env, "avx512"  ) == 0 ) requested = isaAVX512;
+
+   return ( requested < detected )?( requested ):( detected );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the currently selected instruction set.
+// \ingroup dispatch
+//
+// \return Reference to the storage of the currently selected instruction set.
+//
+// The instruction set is determined exactly once, on the first call of the function.
+*/
+inline std::atomic<int>& instructionSetStorage() noexcept
+{
+   static std::atomic<int> isa( initInstructionSet() );
+   return isa;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set currently used by the dispatched compute kernels.
+// \ingroup dispatch
+//
+// \return The currently selected instruction set.
+//
+// This function returns the instruction set that is currently used by the compute kernels
+// that are subject to the runtime dispatch (see the \c BLAZE_USE_RUNTIME_DISPATCH switch).
+// Unless explicitly changed via the setInstructionSet() function, this is the most capable
+// instruction set supported by the executing CPU.
+*/
+inline InstructionSet getInstructionSet() noexcept
+{
+   return static_cast<InstructionSet>( instructionSetStorage().load( std::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the instruction set used by the dispatched compute kernels.
+// \ingroup dispatch
+//
+// \param isa The instruction set to be used.
+// \return void
+// \exception std::invalid_argument Instruction set is not supported by the CPU.
+//
+// This function explicitly selects the instruction set for all compute kernels that are subject
+// to the runtime dispatch. In case the given instruction set is not supported by the executing
+// CPU, a \a std::invalid_argument exception is thrown.
+
+   \code
+   blaze::setInstructionSet( blaze::isaAVX2 );  // Avoid the AVX-512 kernels
+   \endcode
+*/
+inline void setInstructionSet( InstructionSet isa )
+{
+   if( isa < isaGeneric || isa > detectInstructionSet() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Instruction set is not supported by the CPU" );
+   }
+
+   instructionSetStorage().store( isa, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a human-readable name of the given instruction set.
+// \ingroup dispatch
+//
+// \param isa The instruction set.
+// \return The name of the instruction set.
+*/
+inline const char* getInstructionSetName( InstructionSet isa ) noexcept
+{
+   switch( isa ) {
+      case isaAVX512: return "AVX-512";
+      case isaAVX2  : return "AVX2";
+      case isaSSE4  : return "SSE4";
+      default       : return "generic";
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
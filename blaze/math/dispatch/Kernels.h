@@ -0,0 +1,450 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Header file for the instruction set independent implementation of the dispatched kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+// NOTE: This header file intentionally has no include guard! It contains the implementation
+// of the dispatched compute kernels in terms of the Pack class template and is included once
+// per instruction set (see for instance <blaze/math/dispatch/AVX2.h>), each time within the
+// according target region and namespace. Therefore this header must not include any other
+// header file.
+
+
+//=================================================================================================
+//
+//  DOT PRODUCT KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the dot product of two contiguous arrays (\f$ s=x^T*y \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of both arrays.
+// \param x Pointer to the first element of the left-hand side array.
+// \param y Pointer to the first element of the right-hand side array.
+// \return The dot product of the two arrays.
+*/
+template< typename T >
+T dot( size_t n, const T* x, const T* y )
+{
+   using P = Pack<T>;
+   using Type = typename P::Type;
+
+   constexpr size_t W( P::size );
+
+   Type xmm1( P::zero() );
+   Type xmm2( P::zero() );
+   Type xmm3( P::zero() );
+   Type xmm4( P::zero() );
+
+   size_t i( 0UL );
+
+   for( ; (i+W*4UL) <= n; i+=W*4UL ) {
+      xmm1 = P::fmadd( P::load( x+i      ), P::load( y+i      ), xmm1 );
+      xmm2 = P::fmadd( P::load( x+i+W    ), P::load( y+i+W    ), xmm2 );
+      xmm3 = P::fmadd( P::load( x+i+W*2UL ), P::load( y+i+W*2UL ), xmm3 );
+      xmm4 = P::fmadd( P::load( x+i+W*3UL ), P::load( y+i+W*3UL ), xmm4 );
+   }
+   for( ; (i+W) <= n; i+=W ) {
+      xmm1 = P::fmadd( P::load( x+i ), P::load( y+i ), xmm1 );
+   }
+
+   T sum( P::sum( P::add( P::add( xmm1, xmm2 ), P::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      sum += x[i] * y[i];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AXPY KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the scaled addition of two contiguous arrays (\f$ y+=\alpha*x \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements of both arrays.
+// \param alpha The scaling factor for \a x.
+// \param x Pointer to the first element of the right-hand side array.
+// \param y Pointer to the first element of the target array.
+// \return void
+*/
+template< typename T >
+void axpy( size_t n, T alpha, const T* x, T* y )
+{
+   using P = Pack<T>;
+   using Type = typename P::Type;
+
+   constexpr size_t W( P::size );
+
+   const Type factor( P::set( alpha ) );
+
+   size_t i( 0UL );
+
+   for( ; (i+W*4UL) <= n; i+=W*4UL ) {
+      P::store( y+i      , P::fmadd( factor, P::load( x+i       ), P::load( y+i       ) ) );
+      P::store( y+i+W    , P::fmadd( factor, P::load( x+i+W     ), P::load( y+i+W     ) ) );
+      P::store( y+i+W*2UL, P::fmadd( factor, P::load( x+i+W*2UL ), P::load( y+i+W*2UL ) ) );
+      P::store( y+i+W*3UL, P::fmadd( factor, P::load( x+i+W*3UL ), P::load( y+i+W*3UL ) ) );
+   }
+   for( ; (i+W) <= n; i+=W ) {
+      P::store( y+i, P::fmadd( factor, P::load( x+i ), P::load( y+i ) ) );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += alpha * x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE DOT PRODUCT KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the dot product of a range of sparse elements and a contiguous array.
+// \ingroup dispatch
+//
+// \param begin Iterator to the first sparse element.
+// \param end Iterator one past the last sparse element.
+// \param x Pointer to the first element of the dense array.
+// \return The dot product of the sparse elements and the dense array.
+//
+// This kernel performs the indexed (gather) access to the dense array with four independent
+// accumulators to hide the latency of the loads and of the floating point additions.
+*/
+template< typename T, typename Iterator >
+T sparseDot( Iterator begin, Iterator end, const T* x )
+{
+   T sum1 = T();
+   T sum2 = T();
+   T sum3 = T();
+   T sum4 = T();
+
+   Iterator element( begin );
+
+   for( ; (end - element) >= 4; element+=4 ) {
+      sum1 += element[0].value() * x[element[0].index()];
+      sum2 += element[1].value() * x[element[1].index()];
+      sum3 += element[2].value() * x[element[2].index()];
+      sum4 += element[3].value() * x[element[3].index()];
+   }
+   for( ; element!=end; ++element ) {
+      sum1 += element->value() * x[element->index()];
+   }
+
+   return ( sum1 + sum2 ) + ( sum3 + sum4 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERAL MATRIX MULTIPLICATION KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the general matrix multiplication kernel.
+// \ingroup dispatch
+//
+// The micro-kernel computes a block of \a MR rows and \a NR columns, which results in twelve
+// accumulator registers. The \a KC, \a MC, and \a NC parameters determine the size of the
+// packed panels of the left-hand side and right-hand side operand.
+*/
+template< typename T >
+struct GemmBlocking
+{
+   static constexpr size_t MR = 6UL;
+   static constexpr size_t NR = 2UL * Pack<T>::size;
+   static constexpr size_t KC = 256UL;
+   static constexpr size_t MC = 96UL;
+   static constexpr size_t NC = 1024UL;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand of the matrix multiplication.
+// \ingroup dispatch
+//
+// \param mc The number of rows of the block.
+// \param kc The number of columns of the block.
+// \param A Pointer to the first element of the block.
+// \param rsA The row stride of \a A.
+// \param csA The column stride of \a A.
+// \param buffer The target buffer.
+// \return void
+//
+// The block is stored as a sequence of micro-panels of \a MR rows each, the elements of each
+// micro-panel in column-major order. The last micro-panel is padded with zeros.
+*/
+template< typename T >
+void packA( size_t mc, size_t kc, const T* A, ptrdiff_t rsA, ptrdiff_t csA, T* buffer )
+{
+   constexpr size_t MR( GemmBlocking<T>::MR );
+
+   for( size_t i=0UL; i<mc; i+=MR ) {
+      const size_t mr( ( mc - i < MR )?( mc - i ):( MR ) );
+      for( size_t k=0UL; k<kc; ++k ) {
+         for( size_t r=0UL; r<mr; ++r ) {
+            buffer[r] = A[ptrdiff_t(i+r)*rsA + ptrdiff_t(k)*csA];
+         }
+         for( size_t r=mr; r<MR; ++r ) {
+            buffer[r] = T();
+         }
+         buffer += MR;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the right-hand side operand of the matrix multiplication.
+// \ingroup dispatch
+//
+// \param kc The number of rows of the block.
+// \param nc The number of columns of the block.
+// \param B Pointer to the first element of the block.
+// \param rsB The row stride of \a B.
+// \param csB The column stride of \a B.
+// \param buffer The target buffer.
+// \return void
+//
+// The block is stored as a sequence of micro-panels of \a NR columns each, the elements of
+// each micro-panel in row-major order. The last micro-panel is padded with zeros.
+*/
+template< typename T >
+void packB( size_t kc, size_t nc, const T* B, ptrdiff_t rsB, ptrdiff_t csB, T* buffer )
+{
+   constexpr size_t NR( GemmBlocking<T>::NR );
+
+   for( size_t j=0UL; j<nc; j+=NR ) {
+      const size_t nr( ( nc - j < NR )?( nc - j ):( NR ) );
+      for( size_t k=0UL; k<kc; ++k ) {
+         for( size_t c=0UL; c<nr; ++c ) {
+            buffer[c] = B[ptrdiff_t(k)*rsB + ptrdiff_t(j+c)*csB];
+         }
+         for( size_t c=nr; c<NR; ++c ) {
+            buffer[c] = T();
+         }
+         buffer += NR;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel of the general matrix multiplication.
+// \ingroup dispatch
+//
+// \param kc The number of columns/rows of the packed micro-panels.
+// \param alpha The scaling factor for the product.
+// \param a The packed micro-panel of the left-hand side operand.
+// \param b The packed micro-panel of the right-hand side operand.
+// \param mr The number of valid rows of the block of \a C.
+// \param nr The number of valid columns of the block of \a C.
+// \param C Pointer to the first element of the block of \a C.
+// \param rsC The row stride of \a C.
+// \param csC The column stride of \a C.
+// \return void
+//
+// This function computes \f$ C+=\alpha*a*b \f$ for a block of \a MR rows and \a NR columns.
+// All products are accumulated in twelve explicit SIMD registers.
+*/
+template< typename T >
+void gemmMicroKernel( size_t kc, T alpha, const T* a, const T* b,
+                      size_t mr, size_t nr, T* C, ptrdiff_t rsC, ptrdiff_t csC )
+{
+   using P = Pack<T>;
+   using Type = typename P::Type;
+
+   constexpr size_t W ( P::size );
+   constexpr size_t MR( GemmBlocking<T>::MR );
+   constexpr size_t NR( GemmBlocking<T>::NR );
+
+   Type xmm00( P::zero() ), xmm01( P::zero() );
+   Type xmm10( P::zero() ), xmm11( P::zero() );
+   Type xmm20( P::zero() ), xmm21( P::zero() );
+   Type xmm30( P::zero() ), xmm31( P::zero() );
+   Type xmm40( P::zero() ), xmm41( P::zero() );
+   Type xmm50( P::zero() ), xmm51( P::zero() );
+
+   for( size_t k=0UL; k<kc; ++k, a+=MR, b+=NR )
+   {
+      const Type b0( P::load( b   ) );
+      const Type b1( P::load( b+W ) );
+
+      Type a1( P::set( a[0] ) );
+      xmm00 = P::fmadd( a1, b0, xmm00 );
+      xmm01 = P::fmadd( a1, b1, xmm01 );
+      a1 = P::set( a[1] );
+      xmm10 = P::fmadd( a1, b0, xmm10 );
+      xmm11 = P::fmadd( a1, b1, xmm11 );
+      a1 = P::set( a[2] );
+      xmm20 = P::fmadd( a1, b0, xmm20 );
+      xmm21 = P::fmadd( a1, b1, xmm21 );
+      a1 = P::set( a[3] );
+      xmm30 = P::fmadd( a1, b0, xmm30 );
+      xmm31 = P::fmadd( a1, b1, xmm31 );
+      a1 = P::set( a[4] );
+      xmm40 = P::fmadd( a1, b0, xmm40 );
+      xmm41 = P::fmadd( a1, b1, xmm41 );
+      a1 = P::set( a[5] );
+      xmm50 = P::fmadd( a1, b0, xmm50 );
+      xmm51 = P::fmadd( a1, b1, xmm51 );
+   }
+
+   T tile[MR*NR];
+
+   P::store( tile       , xmm00 ); P::store( tile         +W, xmm01 );
+   P::store( tile+NR    , xmm10 ); P::store( tile+NR      +W, xmm11 );
+   P::store( tile+NR*2UL, xmm20 ); P::store( tile+NR*2UL+W, xmm21 );
+   P::store( tile+NR*3UL, xmm30 ); P::store( tile+NR*3UL+W, xmm31 );
+   P::store( tile+NR*4UL, xmm40 ); P::store( tile+NR*4UL+W, xmm41 );
+   P::store( tile+NR*5UL, xmm50 ); P::store( tile+NR*5UL+W, xmm51 );
+
+   for( size_t r=0UL; r<mr; ++r ) {
+      for( size_t c=0UL; c<nr; ++c ) {
+         C[ptrdiff_t(r)*rsC + ptrdiff_t(c)*csC] += alpha * tile[r*NR+c];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the general matrix multiplication \f$ C+=\alpha*A*B \f$.
+// \ingroup dispatch
+//
+// \param M The number of rows of \a A and \a C.
+// \param N The number of columns of \a B and \a C.
+// \param K The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for the product.
+// \param A Pointer to the first element of the left-hand side operand.
+// \param rsA The row stride of \a A.
+// \param csA The column stride of \a A.
+// \param B Pointer to the first element of the right-hand side operand.
+// \param rsB The row stride of \a B.
+// \param csB The column stride of \a B.
+// \param C Pointer to the first element of the target matrix.
+// \param rsC The row stride of \a C.
+// \param csC The column stride of \a C.
+// \param bufferA Workspace for at least \a MC times \a KC elements.
+// \param bufferB Workspace for at least \a KC times \a NC elements (rounded up to \a NR).
+// \return void
+//
+// This kernel follows the well-known GotoBLAS scheme: blocks of \a B and \a A are packed into
+// contiguous micro-panels that fit into the L3 and L2 cache, respectively, and the micro-kernel
+// streams through the packed panels. Due to the explicit strides all combinations of row-major
+// and column-major operands are supported.
+*/
+template< typename T >
+void gemm( size_t M, size_t N, size_t K, T alpha,
+           const T* A, ptrdiff_t rsA, ptrdiff_t csA,
+           const T* B, ptrdiff_t rsB, ptrdiff_t csB,
+           T* C, ptrdiff_t rsC, ptrdiff_t csC,
+           T* bufferA, T* bufferB )
+{
+   constexpr size_t MR( GemmBlocking<T>::MR );
+   constexpr size_t NR( GemmBlocking<T>::NR );
+   constexpr size_t KC( GemmBlocking<T>::KC );
+   constexpr size_t MC( GemmBlocking<T>::MC );
+   constexpr size_t NC( GemmBlocking<T>::NC );
+
+   for( size_t jj=0UL; jj<N; jj+=NC )
+   {
+      const size_t nc( ( N - jj < NC )?( N - jj ):( NC ) );
+
+      for( size_t kk=0UL; kk<K; kk+=KC )
+      {
+         const size_t kc( ( K - kk < KC )?( K - kk ):( KC ) );
+
+         packB( kc, nc, B + ptrdiff_t(kk)*rsB + ptrdiff_t(jj)*csB, rsB, csB, bufferB );
+
+         for( size_t ii=0UL; ii<M; ii+=MC )
+         {
+            const size_t mc( ( M - ii < MC )?( M - ii ):( MC ) );
+
+            packA( mc, kc, A + ptrdiff_t(ii)*rsA + ptrdiff_t(kk)*csA, rsA, csA, bufferA );
+
+            for( size_t j=0UL; j<nc; j+=NR )
+            {
+               const size_t nr( ( nc - j < NR )?( nc - j ):( NR ) );
+
+               for( size_t i=0UL; i<mc; i+=MR )
+               {
+                  const size_t mr( ( mc - i < MR )?( mc - i ):( MR ) );
+
+                  gemmMicroKernel( kc, alpha, bufferA + i*kc, bufferB + j*kc, mr, nr,
+                                   C + ptrdiff_t(ii+i)*rsC + ptrdiff_t(jj+j)*csC, rsC, csC );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
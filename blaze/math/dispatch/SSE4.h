@@ -0,0 +1,148 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/SSE4.h
+//  \brief Header file for the SSE4 variant of the dispatched compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_SSE4_H_
+#define _BLAZE_MATH_DISPATCH_SSE4_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace sse4 {
+
+BLAZE_TARGET_REGION_BEGIN( "sse4.2" )
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SSE4 pack of the dispatched compute kernels.
+// \ingroup dispatch
+//
+// The SSE4 variant of the dispatched compute kernels operates on 128-bit registers.
+// All functions of this variant are compiled for the SSE4 instruction set, independent
+// of the instruction set selected on the command line, and must only be called on CPUs that
+// support this instruction set.
+*/
+template< typename T >
+struct Pack;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SSE4 pack for double precision floating point values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<double>
+{
+   using Type = __m128d;
+
+   static constexpr size_t size = 2UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm_setzero_pd(); }
+   static BLAZE_ALWAYS_INLINE Type set( double value ) noexcept { return _mm_set1_pd( value ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* address ) noexcept { return _mm_loadu_pd( address ); }
+   static BLAZE_ALWAYS_INLINE void store( double* address, Type value ) noexcept { _mm_storeu_pd( address, value ); }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_add_pd( _mm_mul_pd( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE double sum( Type a ) noexcept { return _mm_cvtsd_f64( _mm_add_sd( a, _mm_unpackhi_pd( a, a ) ) ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SSE4 pack for single precision floating point values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<float>
+{
+   using Type = __m128;
+
+   static constexpr size_t size = 4UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm_setzero_ps(); }
+   static BLAZE_ALWAYS_INLINE Type set( float value ) noexcept { return _mm_set1_ps( value ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* address ) noexcept { return _mm_loadu_ps( address ); }
+   static BLAZE_ALWAYS_INLINE void store( float* address, Type value ) noexcept { _mm_storeu_ps( address, value ); }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_add_ps( _mm_mul_ps( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept { return _mm_cvtss_f32( _mm_hadd_ps( _mm_hadd_ps( a, a ), _mm_hadd_ps( a, a ) ) ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPUTE KERNELS
+//
+//=================================================================================================
+
+#include <blaze/math/dispatch/Kernels.h>
+
+BLAZE_TARGET_REGION_END
+
+} // namespace sse4
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#endif
+
+#endif
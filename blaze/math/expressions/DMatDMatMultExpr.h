@@ -57,6 +57,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/expressions/MatrixChain.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/functors/DeclDiag.h>
@@ -81,6 +82,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMixedPrecisionCompatible.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -252,6 +254,21 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix multiplication can be computed by means of the mixed precision
+       kernels (see the IsMixedPrecisionCompatible type trait), the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            !SYM && !HERM && !LOW && !UPP &&
+                            IsMixedPrecisionCompatible<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -521,6 +538,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<true>( rhs, [&lhs]( const auto& chain ) { assign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1580,7 +1601,8 @@ class DMatDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5> > >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectDefaultAssignKernel( C, A, B );
@@ -1622,6 +1644,32 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense matrices (large matrices)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the assignment of a multiplication expression with bfloat16 or
+   // float16 operands to a single precision dense matrix. The operands are widened to single
+   // precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mixedMMM( C, A, B, 1.0F, 0.0F );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
@@ -1789,6 +1837,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<true>( rhs, [&lhs]( const auto& chain ) { addAssign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2831,7 +2883,8 @@ class DMatDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5> > >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectDefaultAddAssignKernel( C, A, B );
@@ -2870,6 +2923,32 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision addition assignment to dense matrices (large matrices)**********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision addition assignment of a large dense matrix-dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the addition assignment of a multiplication expression with bfloat16
+   // or float16 operands to a single precision dense matrix. The operands are widened to single
+   // precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mixedMMM( C, A, B, 1.0F, 1.0F );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense matrix multiplication
@@ -3005,6 +3084,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<true>( rhs, [&lhs]( const auto& chain ) { subAssign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4047,7 +4130,8 @@ class DMatDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5> > >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       selectDefaultSubAssignKernel( C, A, B );
@@ -4086,6 +4170,32 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision subtraction assignment to dense matrices (large matrices)*******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision subtraction assignment of a large dense matrix-dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a multiplication expression with
+   // bfloat16 or float16 operands to a single precision dense matrix. The operands are widened to
+   // single precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mixedMMM( C, A, B, -1.0F, 1.0F );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense matrix multiplication
@@ -4271,6 +4381,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<false>( rhs, [&lhs]( const auto& chain ) { smpAssign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4396,6 +4510,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<false>( rhs, [&lhs]( const auto& chain ) { smpAddAssign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4483,6 +4601,10 @@ class DMatDMatMultExpr
          return;
       }
 
+      if( evaluateMatrixChain<false>( rhs, [&lhs]( const auto& chain ) { smpSubAssign( ~lhs, chain ); } ) ) {
+         return;
+      }
+
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4724,6 +4846,20 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix multiplication can be computed by means of the mixed precision
+       kernels (see the IsMixedPrecisionCompatible type trait), the nested \a value will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            !SYM && !HERM && !LOW && !UPP &&
+                            !IsComplex<T4>::value &&
+                            IsMixedPrecisionCompatible<T1,T2,T3>::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Type of the functor for forwarding an expression to another assign kernel.
    /*! In case a temporary matrix needs to be created, this functor is used to forward the
@@ -6036,7 +6172,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> > >
       selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectDefaultAssignKernel( C, A, B, scalar );
@@ -6078,6 +6215,32 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense matrices (large matrices)*******************************
+   /*!\brief Mixed precision assignment of a large scaled dense matrix-dense matrix
+   //        multiplication (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the assignment of a scaled multiplication expression with bfloat16 or
+   // float16 operands to a single precision dense matrix. The operands are widened to single
+   // precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mixedMMM( C, A, B, scalar, ST2(0) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*!\brief Default assignment of a scaled dense matrix-dense matrix multiplication
    //        (\f$ C=s*A*B \f$).
@@ -7185,7 +7348,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> > >
       selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectDefaultAddAssignKernel( C, A, B, scalar );
@@ -7223,6 +7387,32 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed precision addition assignment to dense matrices (large matrices)**********************
+   /*!\brief Mixed precision addition assignment of a large scaled dense matrix-dense matrix
+   //        multiplication (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the addition assignment of a scaled multiplication expression with
+   // bfloat16 or float16 operands to a single precision dense matrix. The operands are widened to
+   // single precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> >
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mixedMMM( C, A, B, scalar, ST2(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*!\brief Default addition assignment of a scaled dense matrix-dense matrix multiplication
    //        (\f$ C+=s*A*B \f$).
@@ -8297,7 +8487,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline DisableIf_< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >
+   static inline DisableIf_< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                               , UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> > >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       selectDefaultSubAssignKernel( C, A, B, scalar );
@@ -8335,6 +8526,32 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed precision subtraction assignment to dense matrices (large matrices)*******************
+   /*!\brief Mixed precision subtraction assignment of a large scaled dense matrix-dense matrix
+   //        multiplication (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a scaled multiplication expression with
+   // bfloat16 or float16 operands to a single precision dense matrix. The operands are widened to
+   // single precision panel by panel and all products are accumulated in single precision.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<MT3,MT4,MT5,ST2> >
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mixedMMM( C, A, B, -scalar, ST2(1) );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*!\brief Default subtraction assignment of a scaled dense matrix-dense matrix multiplication
    //        (\f$ C-=s*A*B \f$).
@@ -41,18 +41,28 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/MixedPrecision.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConversion.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsDispatchable.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBFloat16.h>
+#include <blaze/util/typetraits/IsFloat16.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -95,6 +105,78 @@ struct DVecDVecInnerExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched dense vector/dense vector scalar
+//        multiplication.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+struct DVecDVecInnerExprDispatchHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side dense vector expression.
+   using CT1 = RemoveReference_< CompositeType_<VT1> >;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using CT2 = RemoveReference_< CompositeType_<VT2> >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         CT1::simdEnabled &&
+                         CT2::simdEnabled &&
+                         HasConstDataAccess<CT1>::value &&
+                         HasConstDataAccess<CT2>::value &&
+                         IsSame< ElementType_<CT1>, ElementType_<CT2> >::value &&
+                         IsDispatchable< ElementType_<CT1> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the mixed precision dense vector/dense vector scalar
+//        multiplication.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+struct DVecDVecInnerExprMixedHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side dense vector expression.
+   using CT1 = RemoveReference_< CompositeType_<VT1> >;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using CT2 = RemoveReference_< CompositeType_<VT2> >;
+
+   //! Element type of the left-hand side dense vector expression.
+   using ET1 = ElementType_<CT1>;
+
+   //! Element type of the right-hand side dense vector expression.
+   using ET2 = ElementType_<CT2>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         HasConstDataAccess<CT1>::value &&
+                         HasConstDataAccess<CT2>::value &&
+                         ( HasSIMDConversion<ET1,ET2>::value ||
+                           HasSIMDConversion<ET2,ET1>::value ||
+                           ( ( IsBFloat16<ET1>::value || IsFloat16<ET1>::value ) &&
+                             ( IsBFloat16<ET2>::value || IsFloat16<ET2>::value ) &&
+                             HasSIMDConversion<ET1,float>::value &&
+                             HasSIMDConversion<ET2,float>::value ) ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -119,7 +201,9 @@ struct DVecDVecInnerExprHelper
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline DisableIf_< DVecDVecInnerExprHelper<VT1,VT2>
+inline DisableIf_< Or< DVecDVecInnerExprHelper<VT1,VT2>
+                      , DVecDVecInnerExprDispatchHelper<VT1,VT2>
+                      , DVecDVecInnerExprMixedHelper<VT1,VT2> >
                  , const MultTrait_< ElementType_<VT1>, ElementType_<VT2> > >
    dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
 {
@@ -171,11 +255,13 @@ inline DisableIf_< DVecDVecInnerExprHelper<VT1,VT2>
 //
 // This function implements the performance optimized scalar product of two dense vectors.
 // Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// by the compiler in case vectorization can be applied and the runtime dispatched kernel cannot
+// be used.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline EnableIf_< DVecDVecInnerExprHelper<VT1,VT2>
+inline EnableIf_< And< DVecDVecInnerExprHelper<VT1,VT2>
+                     , Not< DVecDVecInnerExprDispatchHelper<VT1,VT2> > >
                 , const MultTrait_< ElementType_<VT1>, ElementType_<VT2> > >
    dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
 {
@@ -225,6 +311,79 @@ inline EnableIf_< DVecDVecInnerExprHelper<VT1,VT2>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched backend implementation of the scalar product (inner product) of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the scalar product of two dense vectors by means of the kernel
+// for the instruction set of the executing CPU (see the \c BLAZE_USE_RUNTIME_DISPATCH switch).
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case both vectors provide direct access to their contiguous elements.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< DVecDVecInnerExprDispatchHelper<VT1,VT2>
+                , const MultTrait_< ElementType_<VT1>, ElementType_<VT2> > >
+   dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+{
+   using Lhs = CompositeType_<VT1>;
+   using Rhs = CompositeType_<VT2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+
+   return dispatch::dot( left.size(), left.data(), right.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed precision backend implementation of the scalar product (inner product) of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the scalar product of two dense vectors with different floating
+// point element types. In case either vector is a double precision vector, the elements of
+// the other vector are converted to double precision in SIMD registers and all products are
+// accumulated in double precision. Otherwise (i.e. in case of \c bfloat16 or \c float16
+// elements) all elements are converted to and accumulated in single precision. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both vectors provide direct access to their contiguous elements.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline EnableIf_< DVecDVecInnerExprMixedHelper<VT1,VT2>
+                , const MultTrait_< ElementType_<VT1>, ElementType_<VT2> > >
+   dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+{
+   using Lhs = CompositeType_<VT1>;
+   using Rhs = CompositeType_<VT2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+
+   return mixedDot( left.data(), right.data(), left.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
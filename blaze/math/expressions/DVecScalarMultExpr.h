@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -57,9 +58,12 @@
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDispatchable.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsInvertible.h>
 #include <blaze/math/typetraits/IsPadded.h>
@@ -81,6 +85,7 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -145,6 +150,28 @@ class DVecScalarMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatch evaluation strategy********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseDispatchKernel struct is a helper struct for the selection of the runtime dispatched
+       evaluation strategy for the addition and subtraction assignment. In case the target vector
+       and the dense vector operand provide direct access to their contiguous elements of the
+       same floating point data type and the vector operand does not require an intermediate
+       evaluation, \a value is set to 1 and the kernel for the instruction set of the executing
+       CPU is used. Otherwise \a value is set to 0 and the default strategy is chosen. */
+   template< typename VT2 >
+   struct UseDispatchKernel {
+      enum : bool { value = !useAssign &&
+                            HasMutableDataAccess<VT2>::value && VT2::simdEnabled &&
+                            HasConstDataAccess<VT>::value && VT::simdEnabled &&
+                            IsSame< ElementType_<VT2>, ET >::value &&
+                            IsSame< ElementType_<ResultType_<VT>>, ET >::value &&
+                            IsSame< MultTrait_<ET,ST>, ET >::value &&
+                            IsDispatchable<ET>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -679,6 +706,36 @@ class DVecScalarMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a dense vector-scalar multiplication to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the addition assignment of a dense vector-scalar multiplication
+   // expression to a dense vector by means of the kernel for the instruction set of the executing
+   // CPU (see the \c BLAZE_USE_RUNTIME_DISPATCH switch). Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case both vectors
+   // provide direct access to their contiguous \c float or \c double elements.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseDispatchKernel<VT2> >
+      addAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      CT x( rhs.vector_ );
+      dispatch::axpy( x.size(), ET( rhs.scalar_ ), x.data(), (~lhs).data() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -715,6 +772,36 @@ class DVecScalarMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a dense vector-scalar multiplication to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a dense vector-scalar multiplication
+   // expression to a dense vector by means of the kernel for the instruction set of the executing
+   // CPU (see the \c BLAZE_USE_RUNTIME_DISPATCH switch). Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case both vectors
+   // provide direct access to their contiguous \c float or \c double elements.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseDispatchKernel<VT2> >
+      subAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      CT x( rhs.vector_ );
+      dispatch::axpy( x.size(), ET( -rhs.scalar_ ), x.data(), (~lhs).data() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -0,0 +1,948 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/KronDVecMultExpr.h
+//  \brief Header file for the Kronecker product/dense vector multiplication expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_KRONDVECMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_KRONDVECMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDMatKronExpr.h>
+#include <blaze/math/expressions/DMatSMatKronExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/KronKernels.h>
+#include <blaze/math/expressions/MatMatKronExpr.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/expressions/SMatDMatKronExpr.h>
+#include <blaze/math/expressions/SMatSMatKronExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRONDVECMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for multiplications between a Kronecker product and a dense vector.
+// \ingroup dense_vector_expression
+//
+// The KronDVecMultExpr class represents the compile time expression for multiplications between
+// a Kronecker product \f$ A \otimes B \f$ of an \f$ M \times N \f$ matrix \a A and a
+// \f$ P \times Q \f$ matrix \a B and a dense vector \f$ \vec{x} \f$. The Kronecker product is
+// never formed explicitly. Instead the vector \f$ \vec{x} \f$ is interpreted as row-major
+// \f$ N \times Q \f$ matrix \a X and the result is computed as row-major \f$ M \times P \f$
+// matrix \f$ Y = A X B^T \f$ (i.e. \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$ for row-wise
+// vectorization), which reduces the complexity from \f$ O(MNPQ) \f$ to \f$ O(MNQ + MPQ) \f$
+// (or \f$ O(NPQ + MNP) \f$, depending on which evaluation order is cheaper).
+*/
+template< typename MT    // Type of the left-hand side Kronecker product expression
+        , typename VT >  // Type of the right-hand side dense vector
+class KronDVecMultExpr
+   : public MultExpr< DenseVector< KronDVecMultExpr<MT,VT>, false > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT1 = Decay_< LeftOperand_<MT> >;   //!< Type of the left-hand side Kronecker product operand.
+   using MT2 = Decay_< RightOperand_<MT> >;  //!< Type of the right-hand side Kronecker product operand.
+   using RT1 = ResultType_<MT1>;             //!< Result type of the left-hand side Kronecker product operand.
+   using RT2 = ResultType_<MT2>;             //!< Result type of the right-hand side Kronecker product operand.
+   using CT1 = CompositeType_<MT1>;          //!< Composite type of the left-hand side Kronecker product operand.
+   using CT2 = CompositeType_<MT2>;          //!< Composite type of the right-hand side Kronecker product operand.
+   using MRT = ResultType_<MT>;              //!< Result type of the Kronecker product expression.
+   using VRT = ResultType_<VT>;              //!< Result type of the right-hand side dense vector expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the left-hand side Kronecker product operand.
+   enum : bool { evaluateLeft = IsComputation<MT1>::value || RequiresEvaluation<MT1>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side Kronecker product operand.
+   enum : bool { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense vector expression.
+   /*! The multiplication kernel requires direct access to the contiguous elements of the dense
+       vector operand. In case the vector operand is not its own result type (i.e. in case it
+       is an expression or a view) it is evaluated. */
+   enum : bool { evaluateVector = !IsSame<VT,VRT>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = KronDVecMultExpr<MT,VT>;     //!< Type of this KronDVecMultExpr instance.
+   using ResultType    = MultTrait_<MRT,VRT>;         //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side Kronecker product expression.
+   using LeftOperand = const MT;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using RightOperand = If_< IsExpression<VT>, const VT, const VT& >;
+
+   //! Type for the assignment of the left-hand side Kronecker product operand.
+   using LT1 = IfTrue_< evaluateLeft, const RT1, CT1 >;
+
+   //! Type for the assignment of the right-hand side Kronecker product operand.
+   using LT2 = IfTrue_< evaluateRight, const RT2, CT2 >;
+
+   //! Type for the assignment of the right-hand side dense vector operand.
+   using RT = IfTrue_< evaluateVector, const VRT, const VT& >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KronDVecMultExpr class.
+   //
+   // \param mat The left-hand side Kronecker product operand of the multiplication expression.
+   // \param vec The right-hand side dense vector operand of the multiplication expression.
+   */
+   explicit inline KronDVecMultExpr( const MT& mat, const VT& vec ) noexcept
+      : mat_( mat )  // Left-hand side Kronecker product of the multiplication expression
+      , vec_( vec )  // Right-hand side dense vector of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat_.columns() == vec_.size(), "Invalid matrix and vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // Element \f$ iP+k \f$ of the result is computed as \f$ \sum_{j,l} a_{ij} b_{kl} x_{jQ+l} \f$.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
+
+      const auto& A( mat_.leftOperand()  );
+      const auto& B( mat_.rightOperand() );
+
+      const size_t P( B.rows()    );
+      const size_t Q( B.columns() );
+      const size_t i( index / P );
+      const size_t k( index % P );
+
+      ElementType res = ElementType();
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         for( size_t l=0UL; l<Q; ++l ) {
+            res += A(i,j) * B(k,l) * vec_[j*Q+l];
+         }
+      }
+
+      return res;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= mat_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return mat_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side Kronecker product operand.
+   //
+   // \return The left-hand side Kronecker product operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense vector operand.
+   //
+   // \return The right-hand side dense vector operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return vec_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return vec_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( size() > SMP_DMATDVECMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  mat_;  //!< Left-hand side Kronecker product of the multiplication expression.
+   RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Multiplication kernel***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes \f$ vec(Y) = vec(A X B^T) \f$ directly into the given result vector.
+   // \ingroup dense_vector
+   //
+   // \param y The target result vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function reinterprets the contiguous elements of the vector operand and the target
+   // vector as row-major matrices and evaluates the two matrix multiplications in the order
+   // with fewer operations: \f$ (A X) B^T \f$ requires \f$ nnz(A) Q + M nnz(B) \f$ operations,
+   // \f$ A (X B^T) \f$ requires \f$ N nnz(B) + nnz(A) P \f$ operations (with \f$ nnz \f$ being
+   // the number of elements of dense operands). In case \a SMP is set to \a true, both matrix
+   // multiplications are evaluated in parallel.
+   */
+   template< bool SMP >  // Parallel evaluation flag
+   static inline void multKernel( ResultType& y, const KronDVecMultExpr& rhs )
+   {
+      using XET = ElementType_<VRT>;
+
+      LT1 A( serial( rhs.mat_.leftOperand()  ) );  // Evaluation of the left-hand side Kronecker product operand
+      LT2 B( serial( rhs.mat_.rightOperand() ) );  // Evaluation of the right-hand side Kronecker product operand
+      RT  x( serial( rhs.vec_ ) );                 // Evaluation of the right-hand side dense vector operand
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t P( B.rows()    );
+      const size_t Q( B.columns() );
+
+      BLAZE_INTERNAL_ASSERT( y.size() == M*P, "Invalid vector size" );
+      BLAZE_INTERNAL_ASSERT( x.size() == N*Q, "Invalid vector size" );
+
+      if( y.size() == 0UL ) {
+         return;
+      }
+      else if( x.size() == 0UL ) {
+         reset( y );
+         return;
+      }
+
+      const CustomMatrix<const XET,unaligned,unpadded,rowMajor> X( x.data(), N, Q );
+      CustomMatrix<ElementType,unaligned,unpadded,rowMajor> Y( y.data(), M, P );
+      DynamicMatrix<ElementType,rowMajor> T;
+
+      const size_t nnzA( kronNonZeros( A ) );
+      const size_t nnzB( kronNonZeros( B ) );
+
+      if( nnzA*Q + M*nnzB <= N*nnzB + nnzA*P ) {
+         if( SMP ) { T = A * X; Y = T * trans( B ); }
+         else { T = serial( A * X ); Y = serial( T * trans( B ) ); }
+      }
+      else {
+         if( SMP ) { T = X * trans( B ); Y = A * T; }
+         else { T = serial( X * trans( B ) ); Y = serial( A * T ); }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-
+   // dense vector multiplication expression to a dense vector. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // target vector is of the result type of the expression and can be used directly as target
+   // of the multiplication kernel.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< IsSame<VT1,ResultType> >
+      assign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      multKernel<false>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-
+   // dense vector multiplication expression to a dense vector that is not of the result type
+   // of the expression. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case the target vector cannot be used directly
+   // as target of the multiplication kernel.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline DisableIf_< IsSame<VT1,ResultType> >
+      assign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      ResultType tmp( rhs.size() );
+      multKernel<false>( tmp, rhs );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-
+   // dense vector multiplication expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a Kronecker product-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}*=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}/=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense vector multiplication expression to a dense vector. Both matrix multiplications of
+   // the kernel are evaluated in parallel. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the target vector
+   // is of the result type of the expression.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< IsSame<VT1,ResultType> >
+      smpAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      multKernel<true>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense vector multiplication expression to a dense vector that is not of the result type
+   // of the expression. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case the target vector cannot be used directly
+   // as target of the multiplication kernel.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline DisableIf_< IsSame<VT1,ResultType> >
+      smpAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      ResultType tmp( rhs.size() );
+      multKernel<true>( tmp, rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   // No special implementation for the SMP assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void smpAddAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a Kronecker product-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void smpSubAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a Kronecker product-dense vector multiplication to
+   //        a dense vector (\f$ \vec{y}*=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // Kronecker product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void smpMultAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a Kronecker product-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}/=(A \otimes B)*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a Kronecker
+   // product-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void smpDivAssign( DenseVector<VT1,false>& lhs, const KronDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( VT );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a dense
+//        vector (\f$ \vec{y}=(A \otimes B)*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side Kronecker product for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product expression and a dense vector:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+   y = kron( A, B ) * x;
+   \endcode
+
+// Instead of forming the Kronecker product explicitly, the multiplication is evaluated via the
+// identity \f$ (A \otimes B) vec(X) = vec(A X B^T) \f$, where \a X is the vector \a x
+// interpreted as row-major \f$ N \times Q \f$ matrix. In case the current size of the vector
+// \a vec doesn't match the current number of columns of the Kronecker product \a mat, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename MT    // Matrix base type of the left-hand side expression
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~mat).columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   using ReturnType = const KronDVecMultExpr< MatrixType_<MT>, VT >;
+   return ReturnType( ~mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        Kronecker product (\f$ \vec{y}^T=\vec{x}^T*(A \otimes B) \f$).
+// \ingroup dense_vector
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side Kronecker product for the multiplication.
+// \return The resulting transpose vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// transpose dense vector and a Kronecker product expression. It restructures the expression
+// \f$ \vec{y}^T=\vec{x}^T*(A \otimes B) \f$ to the expression
+// \f$ \vec{y}^T=((A^T \otimes B^T)*\vec{x})^T \f$. In case the current size of the vector
+// \a vec doesn't match the current number of rows of the Kronecker product \a mat, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& vec, const MatMatKronExpr<MT>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != (~mat).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return trans( kron( trans( (~mat).leftOperand() ), trans( (~mat).rightOperand() ) ) * trans( ~vec ) );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a dense
+//        vector-scalar multiplication expression (\f$ \vec{y}=(A \otimes B)*(\vec{x}*s1) \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side Kronecker product.
+// \param vec The right-hand side dense vector-scalar multiplication.
+// \return The scaled result vector.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// Kronecker product and a dense vector-scalar multiplication. It restructures the expression
+// \f$ \vec{y}=(A \otimes B)*(\vec{x}*s1) \f$ to the expression
+// \f$ \vec{y}=((A \otimes B)*\vec{x})*s1 \f$.
+*/
+template< typename MT    // Matrix base type of the left-hand side expression
+        , typename VT    // Type of the dense vector of the right-hand side expression
+        , typename ST >  // Type of the scalar of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT>& mat, const DVecScalarMultExpr<VT,ST,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~mat) * vec.leftOperand() ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector-scalar
+//        multiplication expression and a Kronecker product (\f$ \vec{y}^T=(\vec{x}^T*s1)*(A \otimes B) \f$).
+// \ingroup dense_vector
+//
+// \param vec The left-hand side transpose dense vector-scalar multiplication.
+// \param mat The right-hand side Kronecker product.
+// \return The scaled result vector.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// transpose dense vector-scalar multiplication and a Kronecker product. It restructures the
+// expression \f$ \vec{y}^T=(\vec{x}^T*s1)*(A \otimes B) \f$ to the expression
+// \f$ \vec{y}^T=(\vec{x}^T*(A \otimes B))*s1 \f$.
+*/
+template< typename VT    // Type of the dense vector of the left-hand side expression
+        , typename ST    // Type of the scalar of the left-hand side expression
+        , typename MT >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const DVecScalarMultExpr<VT,ST,true>& vec, const MatMatKronExpr<MT>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( vec.leftOperand() * (~mat) ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,389 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/KronKernels.h
+//  \brief Header file for the Kronecker product assignment kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_KRONKERNELS_H_
+#define _BLAZE_MATH_EXPRESSIONS_KRONKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TRAVERSAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given operation for all elements of a dense Kronecker product operand.
+// \ingroup math
+//
+// \param A The dense matrix operand.
+// \param op The operation to be called as \a op(i,j,value) for each element.
+// \return void
+//
+// In contrast to the sparse overloads, all elements of the dense matrix are visited (including
+// the default elements). The elements are traversed in the storage order of the matrix.
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO       // Storage order of the dense matrix
+        , typename OP > // Type of the operation
+inline void kronForEach( const DenseMatrix<MT,SO>& A, OP op )
+{
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   if( SO ) {
+      for( size_t j=0UL; j<N; ++j )
+         for( size_t i=0UL; i<M; ++i )
+            op( i, j, (~A)(i,j) );
+   }
+   else {
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            op( i, j, (~A)(i,j) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given operation for all non-zero elements of a row-major sparse Kronecker
+//        product operand.
+// \ingroup math
+//
+// \param A The row-major sparse matrix operand.
+// \param op The operation to be called as \a op(i,j,value) for each non-zero element.
+// \return void
+*/
+template< typename MT   // Type of the sparse matrix
+        , typename OP > // Type of the operation
+inline void kronForEach( const SparseMatrix<MT,false>& A, OP op )
+{
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      const auto end( (~A).end(i) );
+      for( auto element=(~A).begin(i); element!=end; ++element )
+         op( i, element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given operation for all non-zero elements of a column-major sparse Kronecker
+//        product operand.
+// \ingroup math
+//
+// \param A The column-major sparse matrix operand.
+// \param op The operation to be called as \a op(i,j,value) for each non-zero element.
+// \return void
+*/
+template< typename MT   // Type of the sparse matrix
+        , typename OP > // Type of the operation
+inline void kronForEach( const SparseMatrix<MT,true>& A, OP op )
+{
+   for( size_t j=0UL; j<(~A).columns(); ++j ) {
+      const auto end( (~A).end(j) );
+      for( auto element=(~A).begin(j); element!=end; ++element )
+         op( element->index(), j, element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given operation for all non-zero elements of a single row/column of a dense
+//        Kronecker product operand.
+// \ingroup math
+//
+// \param A The dense matrix operand.
+// \param k The index of the row (\a SO = \a false) or column (\a SO = \a true).
+// \param op The operation to be called as \a op(index,value) for each element.
+// \return void
+//
+// The elements are visited in ascending order of their index. In contrast to the sparse overload,
+// the default elements are visited as well, since their products with non-finite elements of the
+// other operand are not default.
+*/
+template< bool SO        // Traversal order (row-wise or column-wise)
+        , typename MT    // Type of the dense matrix
+        , bool SO2       // Storage order of the dense matrix
+        , typename OP >  // Type of the operation
+inline void kronForEachInLine( const DenseMatrix<MT,SO2>& A, size_t k, OP op )
+{
+   const size_t n( SO ? (~A).rows() : (~A).columns() );
+
+   for( size_t l=0UL; l<n; ++l ) {
+      op( l, SO ? (~A)(l,k) : (~A)(k,l) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given operation for all non-zero elements of a single row/column of a sparse
+//        Kronecker product operand.
+// \ingroup math
+//
+// \param A The sparse matrix operand (with storage order \a SO).
+// \param k The index of the row (\a SO = \a false) or column (\a SO = \a true).
+// \param op The operation to be called as \a op(index,value) for each non-zero element.
+// \return void
+*/
+template< bool SO        // Traversal and storage order of the sparse matrix
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the operation
+inline void kronForEachInLine( const SparseMatrix<MT,SO>& A, size_t k, OP op )
+{
+   const auto end( (~A).end(k) );
+   for( auto element=(~A).begin(k); element!=end; ++element )
+      op( element->index(), element->value() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SIZE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements of a row/column of a dense Kronecker product
+//        operand.
+// \ingroup math
+//
+// \param A The dense matrix operand.
+// \param k The index of the row (\a SO = \a false) or column (\a SO = \a true).
+// \return The number of elements in the row/column.
+*/
+template< bool SO      // Traversal order (row-wise or column-wise)
+        , typename MT  // Type of the dense matrix
+        , bool SO2 >   // Storage order of the dense matrix
+inline size_t kronNonZeros( const DenseMatrix<MT,SO2>& A, size_t k ) noexcept
+{
+   UNUSED_PARAMETER( k );
+
+   return ( SO ? (~A).rows() : (~A).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements of a row/column of a sparse Kronecker product
+//        operand.
+// \ingroup math
+//
+// \param A The sparse matrix operand.
+// \param k The index of the row (\a SO = \a false) or column (\a SO = \a true).
+// \return The number of non-zero elements in the row/column.
+//
+// In case the storage order of the sparse matrix doesn't match the traversal order the number
+// of non-zero elements is not available without evaluating the matrix and 0 is returned.
+*/
+template< bool SO      // Traversal order (row-wise or column-wise)
+        , typename MT  // Type of the sparse matrix
+        , bool SO2 >   // Storage order of the sparse matrix
+inline size_t kronNonZeros( const SparseMatrix<MT,SO2>& A, size_t k )
+{
+   return ( SO == SO2 ? (~A).nonZeros(k) : 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements of a dense Kronecker product operand.
+// \ingroup math
+//
+// \param A The dense matrix operand.
+// \return The total number of elements of the matrix.
+//
+// Since any element of a dense matrix may be non-zero, the total number of elements is used as
+// estimate for the number of non-zero elements.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline size_t kronNonZeros( const DenseMatrix<MT,SO>& A ) noexcept
+{
+   return (~A).rows() * (~A).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements of a sparse Kronecker product operand.
+// \ingroup math
+//
+// \param A The sparse matrix operand.
+// \return The number of non-zero elements of the matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline size_t kronNonZeros( const SparseMatrix<MT,SO>& A )
+{
+   return (~A).nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise assignment of a Kronecker product to a dense matrix.
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The evaluated left-hand side operand of the Kronecker product.
+// \param B The evaluated right-hand side operand of the Kronecker product.
+// \param op The assignment operation (Assign, AddAssign, SubAssign, or SchurAssign).
+// \return void
+//
+// This function assigns the \f$ M \times N \f$ blocks \f$ a_{ij} B \f$ of the Kronecker product
+// \f$ A \otimes B \f$ to the according submatrices of \a C via the given assignment operation.
+// Therefore the assignment of each block is performed by the (vectorized) assignment kernels
+// of the scaled operand \a B. For sparse left-hand side operands only the blocks of the
+// non-zero elements are visited, i.e. the target matrix is expected to be reset for a plain
+// assignment. For dense left-hand side operands all blocks are assigned, including the blocks
+// of default elements, such that non-finite elements of \a B are propagated correctly.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename OP >  // Type of the assignment operation
+void kronAssign( DenseMatrix<MT1,SO1>& C, const MT2& A, const MT3& B, OP op )
+{
+   const size_t P( B.rows()    );
+   const size_t Q( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()    * P, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == A.columns() * Q, "Invalid number of columns" );
+
+   if( P == 0UL || Q == 0UL ) return;
+
+   kronForEach( A, [&]( size_t i, size_t j, const auto& a )
+   {
+      auto block( submatrix( ~C, i*P, j*Q, P, Q, unchecked ) );
+      op( block, a * B );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel block-wise assignment of a Kronecker product to a dense matrix.
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The evaluated left-hand side operand of the Kronecker product.
+// \param B The evaluated right-hand side operand of the Kronecker product.
+// \param op The assignment operation (Assign, AddAssign, SubAssign, or SchurAssign).
+// \return void
+//
+// This function distributes the block rows of the Kronecker product \f$ A \otimes B \f$ evenly
+// among the available threads. Each thread performs the serial kronAssign() kernel for its
+// row range of \a A on the according rows of \a C. In case the target matrix is smaller than
+// the SMP_DMATASSIGN_THRESHOLD or in case a serial or parallel section is already active, the
+// assignment is performed serially.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename OP >  // Type of the assignment operation
+void smpKronAssign( DenseMatrix<MT1,SO1>& C, const MT2& A, const MT3& B, OP op )
+{
+   const size_t M( A.rows() );
+   const size_t P( B.rows() );
+
+   if( (~C).rows() * (~C).columns() < SMP_DMATASSIGN_THRESHOLD || !(~C).canSMPAssign() ) {
+      kronAssign( ~C, A, B, op );
+      return;
+   }
+
+   smpForRange( M, 2UL, [&]( size_t begin, size_t end )
+   {
+      auto Cs( submatrix( ~C, begin*P, 0UL, ( end - begin )*P, (~C).columns(), unchecked ) );
+      kronAssign( Cs, submatrix( A, begin, 0UL, end - begin, A.columns(), unchecked ), B, op );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
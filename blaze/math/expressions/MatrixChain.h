@@ -0,0 +1,652 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/MatrixChain.h
+//  \brief Header file for the runtime reordering of matrix product chains
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_MATRIXCHAIN_H_
+#define _BLAZE_MATH_EXPRESSIONS_MATRIXCHAIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <tuple>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATRIXCHAINNODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost estimate of a (partial) matrix product chain.
+// \ingroup math
+//
+// The MatrixChainNode class describes either a single factor of a matrix product chain or the
+// result of multiplying a contiguous subchain in a specific order. Next to the dimensions of
+// the (intermediate) matrix it records the estimated number of non-zero elements, whether the
+// matrix is sparse, the estimated number of multiply-add operations required to compute it and
+// the total number of elements of all intermediate results involved in its computation.
+*/
+struct MatrixChainNode
+{
+   size_t rows;      //!< The number of rows of the matrix.
+   size_t columns;   //!< The number of columns of the matrix.
+   double nonZeros;  //!< The (estimated) number of non-zero elements of the matrix.
+   bool   sparse;    //!< \a true in case the matrix is a sparse matrix.
+   double flops;     //!< The accumulated number of multiply-add operations.
+   double temps;     //!< The accumulated number of elements of all intermediate results.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the cost of the multiplication of two (partial) matrix product chains.
+// \ingroup math
+//
+// \param lhs The cost estimate of the left-hand side subchain.
+// \param rhs The cost estimate of the right-hand side subchain.
+// \return The cost estimate of the product of both subchains.
+//
+// The number of operations is estimated based on the sparsity of the two operands: a dense
+// matrix multiplication requires \f$ m \cdot k \cdot n \f$ operations, a sparse matrix-dense
+// matrix multiplication requires \f$ nnz(A) \cdot n \f$ operations (and vice versa), and a
+// sparse matrix multiplication is assumed to require \f$ nnz(A) \cdot nnz(B) / k \f$ operations.
+// The result is only considered sparse in case both operands are sparse.
+*/
+inline MatrixChainNode multiply( const MatrixChainNode& lhs, const MatrixChainNode& rhs ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( lhs.columns == rhs.rows, "Invalid matrix sizes" );
+
+   const double m( lhs.rows    );
+   const double k( lhs.columns );
+   const double n( rhs.columns );
+
+   double flops( 0.0 );
+
+   if( lhs.sparse && rhs.sparse )
+      flops = ( k > 0.0 )?( lhs.nonZeros * rhs.nonZeros / k ):( 0.0 );
+   else if( lhs.sparse )
+      flops = lhs.nonZeros * n;
+   else if( rhs.sparse )
+      flops = m * rhs.nonZeros;
+   else
+      flops = m * k * n;
+
+   MatrixChainNode result;
+   result.rows     = lhs.rows;
+   result.columns  = rhs.columns;
+   result.sparse   = lhs.sparse && rhs.sparse;
+   result.nonZeros = ( result.sparse && flops < m*n )?( flops ):( m*n );
+   result.flops    = lhs.flops + rhs.flops + flops;
+   result.temps    = lhs.temps + rhs.temps + result.nonZeros;
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the first cost estimate is strictly cheaper than the second.
+// \ingroup math
+//
+// \param lhs The first cost estimate.
+// \param rhs The second cost estimate.
+// \return \a true in case the first estimate is cheaper, \a false if not.
+//
+// The number of operations is the primary criterion, the total size of all intermediate
+// results breaks ties.
+*/
+inline bool isCheaper( const MatrixChainNode& lhs, const MatrixChainNode& rhs ) noexcept
+{
+   return ( lhs.flops < rhs.flops ) ||
+          ( lhs.flops == rhs.flops && lhs.temps < rhs.temps );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXCHAINPLAN
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimal order of evaluation of a matrix product chain.
+// \ingroup math
+//
+// The MatrixChainPlan class computes the cheapest parenthesization of a chain of at most
+// \a limit matrix factors by means of the classic \f$ O(N^3) \f$ matrix-chain dynamic program.
+// The cost of every parenthesization is estimated via the multiply() function, i.e. based on
+// the actual dimensions and number of non-zero elements of the factors.
+*/
+class MatrixChainPlan
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The maximum number of factors of a reorderable matrix product chain.
+   enum : size_t { limit = 6UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Computes the optimal order of evaluation for the given factors.
+   //
+   // \param factors The cost estimates of the factors of the chain.
+   // \param n The number of factors \f$[1..limit]\f$.
+   */
+   explicit inline MatrixChainPlan( const MatrixChainNode* factors, size_t n ) noexcept
+      : n_( n )  // The number of factors of the chain
+   {
+      BLAZE_INTERNAL_ASSERT( n > 0UL && n <= limit, "Invalid number of factors" );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         nodes_[i][i] = factors[i];
+         split_[i][i] = i;
+      }
+
+      for( size_t length=2UL; length<=n; ++length ) {
+         for( size_t i=0UL; i+length<=n; ++i )
+         {
+            const size_t j( i+length-1UL );
+
+            for( size_t k=i; k<j; ++k ) {
+               const MatrixChainNode node( multiply( nodes_[i][k], nodes_[k+1UL][j] ) );
+               if( k == i || isCheaper( node, nodes_[i][j] ) ) {
+                  nodes_[i][j] = node;
+                  split_[i][j] = k;
+               }
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Split function******************************************************************************
+   /*!\brief Returns the optimal split of the subchain \f$[i..j]\f$.
+   //
+   // \param i The index of the first factor of the subchain.
+   // \param j The index of the last factor of the subchain.
+   // \return The index of the last factor of the left-hand side of the optimal split.
+   */
+   inline size_t split( size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( i < j && j < n_, "Invalid subchain" );
+      return split_[i][j];
+   }
+   //**********************************************************************************************
+
+   //**Optimum function****************************************************************************
+   /*!\brief Returns the cost estimate of the optimal order of evaluation.
+   //
+   // \return The cost estimate of the complete chain.
+   */
+   inline const MatrixChainNode& optimum() const noexcept {
+      return nodes_[0UL][n_-1UL];
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t          n_;                   //!< The number of factors of the chain.
+   MatrixChainNode nodes_[limit][limit];  //!< The optimal cost estimates of all subchains.
+   size_t          split_[limit][limit];  //!< The optimal splits of all subchains.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXCHAINFACTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flattening of a matrix product chain into its factors.
+// \ingroup math
+//
+// The MatrixChainFactors class template flattens a tree of matrix/matrix multiplications into
+// a tuple of its factors. Expression factors are stored by value, all other factors are stored
+// by reference. Additionally, it provides the cost estimates of the individual factors and of
+// the order of evaluation given by the expression tree.
+*/
+template< typename MT       // Type of the matrix or expression
+        , typename = void >  // Restricting condition
+struct MatrixChainFactors
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the factor.
+   using Operand = If_< IsExpression<MT>, const MT, const MT& >;
+
+   //! Tuple of all factors.
+   using Type = std::tuple<Operand>;
+   //**********************************************************************************************
+
+   //**Get function********************************************************************************
+   /*!\brief Returns the tuple of all factors.
+   //
+   // \param mat The given matrix or expression.
+   // \return The tuple of all factors.
+   */
+   static inline Type get( const MT& mat ) {
+      return Type( mat );
+   }
+   //**********************************************************************************************
+
+   //**Cost function*******************************************************************************
+   /*!\brief Returns the cost estimate of the given factor.
+   //
+   // \param mat The given matrix or expression.
+   // \return The cost estimate of the factor.
+   */
+   static inline MatrixChainNode cost( const MT& mat ) {
+      const double size( double( mat.rows() ) * double( mat.columns() ) );
+      return { mat.rows(), mat.columns(), nonZeros( mat, size, IsSparseMatrix<MT>() ),
+               IsSparseMatrix<MT>::value, 0.0, 0.0 };
+   }
+   //**********************************************************************************************
+
+ private:
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements of a sparse factor.
+   */
+   static inline double nonZeros( const MT& mat, double, TrueType ) {
+      return double( mat.nonZeros() );
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of elements of a dense factor.
+   */
+   static inline double nonZeros( const MT&, double size, FalseType ) noexcept {
+      return size;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatrixChainFactors class template for matrix/matrix
+//        multiplications.
+// \ingroup math
+*/
+template< typename MT >  // Type of the multiplication expression
+struct MatrixChainFactors< MT, EnableIf_< IsMatMatMultExpr<MT> > >
+{
+   //**Type definitions****************************************************************************
+   //! Type of the left-hand side operand.
+   using LT = Decay_< decltype( std::declval<const MT&>().leftOperand() ) >;
+
+   //! Type of the right-hand side operand.
+   using RT = Decay_< decltype( std::declval<const MT&>().rightOperand() ) >;
+
+   //! Tuple of all factors.
+   using Type = decltype( std::tuple_cat( std::declval< typename MatrixChainFactors<LT>::Type >()
+                                        , std::declval< typename MatrixChainFactors<RT>::Type >() ) );
+   //**********************************************************************************************
+
+   //**Get function********************************************************************************
+   /*!\brief Returns the tuple of all factors.
+   //
+   // \param mat The given multiplication expression.
+   // \return The tuple of all factors.
+   */
+   static inline Type get( const MT& mat ) {
+      return std::tuple_cat( MatrixChainFactors<LT>::get( mat.leftOperand()  )
+                           , MatrixChainFactors<RT>::get( mat.rightOperand() ) );
+   }
+   //**********************************************************************************************
+
+   //**Cost function*******************************************************************************
+   /*!\brief Returns the cost estimate of the order of evaluation given by the expression.
+   //
+   // \param mat The given multiplication expression.
+   // \return The cost estimate of the expression.
+   */
+   static inline MatrixChainNode cost( const MT& mat ) {
+      return multiply( MatrixChainFactors<LT>::cost( mat.leftOperand()  )
+                     , MatrixChainFactors<RT>::cost( mat.rightOperand() ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXCHAINEVALUATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Result type of the subchain \f$[I..J]\f$ of a flattened matrix product chain.
+// \ingroup math
+*/
+template< typename Tuple  // Type of the tuple of factors
+        , size_t I        // Index of the first factor of the subchain
+        , size_t J >      // Index of the last factor of the subchain
+struct MatrixChainResult
+{
+   using Type = MultTrait_< typename MatrixChainResult<Tuple,I,J-1UL>::Type
+                          , ResultType_< Decay_< std::tuple_element_t<J,Tuple> > > >;
+};
+
+template< typename Tuple, size_t I >
+struct MatrixChainResult<Tuple,I,I>
+{
+   using Type = ResultType_< Decay_< std::tuple_element_t<I,Tuple> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the subchain \f$[I..J]\f$ of a flattened matrix product chain.
+// \ingroup math
+//
+// The MatrixChainEvaluator class template evaluates a subchain of a flattened matrix product
+// chain in the order given by a MatrixChainPlan. Since the optimal split is only known at
+// runtime, all \f$ J-I \f$ possible splits are instantiated and the one chosen by the plan is
+// selected via the \a K template parameter. Intermediate results are evaluated serially in
+// case \a Serial is set to \a true and via the SMP assignment otherwise.
+*/
+template< bool Serial    // Serial or SMP evaluation
+        , size_t I       // Index of the first factor of the subchain
+        , size_t J       // Index of the last factor of the subchain
+        , size_t K = I >  // Index of the currently considered split
+struct MatrixChainEvaluator
+{
+   //**Apply function******************************************************************************
+   /*!\brief Passes the product of the subchain \f$[I..J]\f$ to the given operation.
+   //
+   // \param factors The tuple of factors.
+   // \param plan The order of evaluation.
+   // \param op The operation to be applied to the product expression.
+   // \return void
+   */
+   template< typename Tuple, typename OP >
+   static inline void apply( const Tuple& factors, const MatrixChainPlan& plan, OP op )
+   {
+      if( plan.split( I, J ) == K ) {
+         op( MatrixChainEvaluator<Serial,I,K>::evaluate( factors, plan ) *
+             MatrixChainEvaluator<Serial,K+1UL,J>::evaluate( factors, plan ) );
+      }
+      else {
+         MatrixChainEvaluator<Serial,I,J,K+1UL>::apply( factors, plan, op );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluates the subchain \f$[I..J]\f$ into a temporary matrix.
+   //
+   // \param factors The tuple of factors.
+   // \param plan The order of evaluation.
+   // \return The result of the subchain.
+   */
+   template< typename Tuple >
+   static inline typename MatrixChainResult<Tuple,I,J>::Type
+      evaluate( const Tuple& factors, const MatrixChainPlan& plan )
+   {
+      typename MatrixChainResult<Tuple,I,J>::Type tmp;
+      apply( factors, plan, [&tmp]( const auto& product ) {
+         store( tmp, product, BoolConstant<Serial>() );
+      } );
+      return tmp;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Store function******************************************************************************
+   /*!\brief Serial evaluation of an intermediate product.
+   */
+   template< typename MT, typename ET >
+   static inline void store( MT& tmp, const ET& product, TrueType ) {
+      tmp = serial( product );
+   }
+   //**********************************************************************************************
+
+   //**Store function******************************************************************************
+   /*!\brief SMP evaluation of an intermediate product.
+   */
+   template< typename MT, typename ET >
+   static inline void store( MT& tmp, const ET& product, FalseType ) {
+      tmp = product;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatrixChainEvaluator class template for the last (invalid)
+//        split of a subchain.
+// \ingroup math
+*/
+template< bool Serial, size_t I, size_t J >
+struct MatrixChainEvaluator<Serial,I,J,J>
+{
+   template< typename Tuple, typename OP >
+   static inline void apply( const Tuple&, const MatrixChainPlan&, OP ) {
+      BLAZE_INTERNAL_ASSERT( false, "Invalid matrix chain split" );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatrixChainEvaluator class template for single factors.
+// \ingroup math
+*/
+template< bool Serial, size_t I >
+struct MatrixChainEvaluator<Serial,I,I,I>
+{
+   template< typename Tuple >
+   static inline decltype(auto) evaluate( const Tuple& factors, const MatrixChainPlan& ) {
+      return std::get<I>( factors );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX CHAIN REORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the given type is a reorderable matrix product chain.
+// \ingroup math
+//
+// This type trait tests whether the given type \a MT is a matrix/matrix multiplication of at
+// least three and at most MatrixChainPlan::limit factors. In case the runtime reordering of
+// matrix product chains is disabled (see the BLAZE_USE_CHAIN_REORDERING switch), the value
+// is always \a false.
+*/
+template< typename MT >
+struct IsMatrixChain
+   : public BoolConstant< useChainReordering &&
+                          ( std::tuple_size< typename MatrixChainFactors<MT>::Type >::value > 2UL ) &&
+                          ( std::tuple_size< typename MatrixChainFactors<MT>::Type >::value <= MatrixChainPlan::limit ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the cost estimates of the factors \f$[I..N)\f$ of a flattened chain.
+// \ingroup math
+*/
+template< size_t I, size_t N >
+struct MatrixChainCosts
+{
+   template< typename Tuple >
+   static inline void collect( const Tuple& factors, MatrixChainNode* costs ) {
+      using FT = Decay_< std::tuple_element_t<I,Tuple> >;
+      costs[I] = MatrixChainFactors<FT>::cost( std::get<I>( factors ) );
+      MatrixChainCosts<I+1UL,N>::collect( factors, costs );
+   }
+};
+
+template< size_t N >
+struct MatrixChainCosts<N,N>
+{
+   template< typename Tuple >
+   static inline void collect( const Tuple&, MatrixChainNode* ) noexcept {}
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a matrix product chain in the optimal order of evaluation.
+// \ingroup math
+//
+// \param chain The matrix/matrix multiplication expression.
+// \param op The operation to be applied to the reordered product expression.
+// \return \a true in case the chain has been reordered, \a false if not.
+//
+// This function flattens the given chain of matrix/matrix multiplications, computes the
+// cheapest order of evaluation based on the actual dimensions and number of non-zero elements
+// of the factors and, in case this order is strictly cheaper than the order given by the
+// expression, evaluates all but the final multiplication into temporaries and passes the final
+// product expression to the given operation. In case the chain is not reordered the function
+// returns \a false and the caller is expected to evaluate the expression as usual. The \a Serial
+// template parameter selects between the serial and the SMP evaluation of the temporaries.
+*/
+template< bool Serial     // Serial or SMP evaluation
+        , typename MT     // Type of the matrix/matrix multiplication expression
+        , typename OP >   // Type of the operation
+inline EnableIf_< IsMatrixChain<MT>, bool >
+   evaluateMatrixChain( const MT& chain, OP op )
+{
+   using Factors = MatrixChainFactors<MT>;
+   using Tuple   = typename Factors::Type;
+
+   constexpr size_t N( std::tuple_size<Tuple>::value );
+
+   const Tuple factors( Factors::get( chain ) );
+
+   MatrixChainNode costs[N];
+   MatrixChainCosts<0UL,N>::collect( factors, costs );
+
+   const MatrixChainPlan plan( costs, N );
+
+   if( !isCheaper( plan.optimum(), Factors::cost( chain ) ) )
+      return false;
+
+   MatrixChainEvaluator<Serial,0UL,N-1UL>::apply( factors, plan, op );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for expressions that are not reorderable matrix product chains.
+// \ingroup math
+//
+// \return \a false.
+*/
+template< bool Serial     // Serial or SMP evaluation
+        , typename MT     // Type of the matrix/matrix multiplication expression
+        , typename OP >   // Type of the operation
+inline DisableIf_< IsMatrixChain<MT>, bool >
+   evaluateMatrixChain( const MT& chain, OP op ) noexcept
+{
+   UNUSED_PARAMETER( chain, op );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
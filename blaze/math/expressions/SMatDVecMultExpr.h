@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -56,9 +57,12 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDispatchable.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/views/Check.h>
@@ -67,13 +71,57 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/typetraits/Void.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  AUXILIARY HELPER STRUCTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatched sparse matrix/dense vector
+//        multiplication.
+// \ingroup sparse_matrix
+//
+// This helper struct determines whether the given sparse matrix type stores its non-zero
+// elements in plain arrays, i.e. whether its iterators are plain pointers.
+*/
+template< typename MT           // Type of the sparse matrix
+        , typename = Void_<> >  // Restricting condition
+struct SMatDVecMultExprHasPointerIterator
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SMatDVecMultExprHasPointerIterator helper struct for sparse
+//        matrix types with an iterator type.
+// \ingroup sparse_matrix
+*/
+template< typename MT >  // Type of the sparse matrix
+struct SMatDVecMultExprHasPointerIterator< MT, Void_< ConstIterator_<MT> > >
+   : public IsPointer< ConstIterator_<MT> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  CLASS SMATDVECMULTEXPR
@@ -145,6 +193,25 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a row-major sparse matrix that stores its elements in plain
+       arrays, the vector operand provides direct access to its contiguous elements, and both
+       operands have the same floating point element type, the nested \value will be set to 1
+       and the subscript operator uses the kernel for the instruction set of the executing CPU.
+       Otherwise \value will be 0. */
+   template< typename T1, typename T2 >
+   struct UseDispatchKernel {
+      enum : bool { value = IsRowMajorMatrix<T1>::value &&
+                            SMatDVecMultExprHasPointerIterator<T1>::value &&
+                            HasConstDataAccess<T2>::value && T2::simdEnabled &&
+                            IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                            IsDispatchable< ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = SMatDVecMultExpr<MT,VT>;     //!< Type of this SMatDVecMultExpr instance.
@@ -200,7 +267,7 @@ class SMatDVecMultExpr
    */
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
-      return row( mat_, index, unchecked ) * vec_;
+      return selectSubscriptKernel( mat_, vec_, index );
    }
    //**********************************************************************************************
 
@@ -299,6 +366,51 @@ class SMatDVecMultExpr
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**Default subscript kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default computation of a single element of the sparse matrix-dense vector product.
+   // \ingroup dense_vector
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param index The index of the element to be computed.
+   // \return The resulting value.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline DisableIf_< UseDispatchKernel<MT1,VT1>, ReturnType >
+      selectSubscriptKernel( const MT1& A, const VT1& x, size_t index )
+   {
+      return row( A, index, unchecked ) * x;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Runtime dispatched subscript kernel*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched computation of a single element of the sparse matrix-dense vector
+   //        product.
+   // \ingroup dense_vector
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param index The index of the element to be computed.
+   // \return The resulting value.
+   //
+   // This function computes the dot product of a single row of the sparse matrix and the dense
+   // vector by means of the kernel for the instruction set of the executing CPU (see the \c
+   // BLAZE_USE_RUNTIME_DISPATCH switch).
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseDispatchKernel<MT1,VT1>, ReturnType >
+      selectSubscriptKernel( const MT1& A, const VT1& x, size_t index )
+   {
+      return dispatch::sparseDot( A.begin( index ), A.end( index ), x.data() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
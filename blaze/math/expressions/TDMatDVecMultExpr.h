@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/MixedPrecision.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -63,6 +64,7 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConversion.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
@@ -99,6 +101,8 @@
 #include <blaze/util/typetraits/IsComplexFloat.h>
 #include <blaze/util/typetraits/IsDouble.h>
 #include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsBFloat16.h>
+#include <blaze/util/typetraits/IsFloat16.h>
 #include <blaze/util/typetraits/IsSame.h>
 
 
@@ -199,6 +203,38 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a mixed precision
+       computation of the matrix/vector multiplication (i.e. single and double precision
+       operands and a double precision target or a bfloat16/float16 matrix and a single
+       precision target), the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            !IsLower<T2>::value && !IsUpper<T2>::value &&
+                            ( ( IsSame< ElementType_<T1>, double >::value &&
+                                ( IsSame< ElementType_<T2>, float  >::value ||
+                                  IsSame< ElementType_<T2>, double >::value ) &&
+                                ( IsSame< ElementType_<T3>, float  >::value ||
+                                  IsSame< ElementType_<T3>, double >::value ) &&
+                                !( IsSame< ElementType_<T2>, double >::value &&
+                                   IsSame< ElementType_<T3>, double >::value ) &&
+                                HasSIMDConversion<float,double>::value ) ||
+                              ( IsSame< ElementType_<T1>, float >::value &&
+                                ( IsBFloat16< ElementType_<T2> >::value ||
+                                  IsFloat16 < ElementType_<T2> >::value ) &&
+                                ( IsSame< ElementType_<T3>, float >::value ||
+                                  IsBFloat16< ElementType_<T3> >::value ||
+                                  IsFloat16 < ElementType_<T3> >::value ) &&
+                                HasSIMDConversion< ElementType_<T2>, float >::value ) ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = TDMatDVecMultExpr<MT,VT>;    //!< Type of this TDMatDVecMultExpr instance.
@@ -470,7 +506,8 @@ class TDMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -525,6 +562,33 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the mixed precision assignment kernel for the transpose dense
+   // matrix-dense vector multiplication of mixed precision operands. The product is computed
+   // in the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+      mixedTDMatDVecMult( y.data(), A, x, 1.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors (small matrices)****************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a small transpose dense matrix-dense vector multiplication
@@ -1071,7 +1135,8 @@ class TDMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -1108,6 +1173,32 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision addition assignment to dense vectors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision addition assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the mixed precision addition assignment kernel for the transpose
+   // dense matrix-dense vector multiplication of mixed precision operands. The product is computed
+   // in the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      mixedTDMatDVecMult( y.data(), A, x, 1.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors (small matrices)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a small transpose dense matrix-dense vector
@@ -1640,7 +1731,8 @@ class TDMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -1677,6 +1769,32 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision subtraction assignment to dense vectors*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision subtraction assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the mixed precision subtraction assignment kernel for the transpose
+   // dense matrix-dense vector multiplication of mixed precision operands. The product is computed
+   // in the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2> >
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      mixedTDMatDVecMult( y.data(), A, x, -1.0 );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors (small matrices)****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a small transpose dense matrix-dense vector
@@ -2549,6 +2667,38 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the two involved vector types, the matrix type, and the scalar type are suited
+       for a mixed precision computation of the scaled matrix/vector multiplication (i.e. single
+       and double precision operands and a double precision target or a bfloat16/float16 matrix
+       and a single precision target), the nested \a value will be set to 1, otherwise it will
+       be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseMixedPrecisionKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<T1>::value &&
+                            HasConstDataAccess<T2>::value &&
+                            !IsLower<T2>::value && !IsUpper<T2>::value &&
+                            !IsComplex<T4>::value &&
+                            ( ( IsSame< ElementType_<T1>, double >::value &&
+                                ( IsSame< ElementType_<T2>, float  >::value ||
+                                  IsSame< ElementType_<T2>, double >::value ) &&
+                                ( IsSame< ElementType_<T3>, float  >::value ||
+                                  IsSame< ElementType_<T3>, double >::value ) &&
+                                !( IsSame< ElementType_<T2>, double >::value &&
+                                   IsSame< ElementType_<T3>, double >::value ) &&
+                                HasSIMDConversion<float,double>::value ) ||
+                              ( IsSame< ElementType_<T1>, float >::value &&
+                                ( IsBFloat16< ElementType_<T2> >::value ||
+                                  IsFloat16 < ElementType_<T2> >::value ) &&
+                                ( IsSame< ElementType_<T3>, float >::value ||
+                                  IsBFloat16< ElementType_<T3> >::value ||
+                                  IsFloat16 < ElementType_<T3> >::value ) &&
+                                HasSIMDConversion< ElementType_<T2>, float >::value ) ) };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DVecScalarMultExpr<MVM,ST,false>;  //!< Type of this DVecScalarMultExpr instance.
@@ -2801,7 +2951,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -2863,6 +3014,33 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense vectors*************************************************
+   /*!\brief Mixed precision assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor
+   // \return void
+   //
+   // This function implements the mixed precision assignment kernel for the scaled transpose dense
+   // matrix-dense vector multiplication of mixed precision operands. The product is computed in
+   // the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      reset( y );
+      mixedTDMatDVecMult( y.data(), A, x, static_cast<double>( scalar ) );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors (small matrices)****************************************
    /*!\brief Default assignment of a small scaled transpose dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3414,12 +3592,39 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       y.addAssign( A * x * scalar );
    }
    //**********************************************************************************************
 
+   //**Mixed precision addition assignment to dense vectors****************************************
+   /*!\brief Mixed precision addition assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor
+   // \return void
+   //
+   // This function implements the mixed precision addition assignment kernel for the scaled
+   // transpose dense matrix-dense vector multiplication of mixed precision operands. The product
+   // is computed in the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      mixedTDMatDVecMult( y.data(), A, x, static_cast<double>( scalar ) );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors (small matrices)*******************************
    /*!\brief Default addition assignment of a small scaled transpose dense matrix-dense vector
    //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
@@ -3947,12 +4152,39 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   static inline DisableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
       y.subAssign( A * x * scalar );
    }
    //**********************************************************************************************
 
+   //**Mixed precision subtraction assignment to dense vectors*************************************
+   /*!\brief Mixed precision subtraction assignment of a scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor
+   // \return void
+   //
+   // This function implements the mixed precision subtraction assignment kernel for the scaled
+   // transpose dense matrix-dense vector multiplication of mixed precision operands. The product
+   // is computed in the precision of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_< UseMixedPrecisionKernel<VT1,MT1,VT2,ST2> >
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+   {
+      mixedTDMatDVecMult( y.data(), A, x, -static_cast<double>( scalar ) );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors (small matrices)****************************
    /*!\brief Default subtraction assignment of a small scaled transpose dense matrix-dense vector
    //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
@@ -47,6 +47,7 @@ namespace blaze {
 struct Abs;
 struct Acos;
 struct Acosh;
+struct Add;
 struct AddAssign;
 struct Asin;
 struct Asinh;
@@ -0,0 +1,680 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMarket.h
+//  \brief Header file for the Matrix Market exchange format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MATRIX MARKET UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The properties of a Matrix Market file given by its banner.
+// \ingroup math_serialization
+*/
+struct MatrixMarketBanner
+{
+   //**Type definitions****************************************************************************
+   //! The supported fields of the elements.
+   enum Field { real, integer, complex, pattern };
+
+   //! The supported symmetry structures of the matrix.
+   enum Symmetry { general, symmetric, skewSymmetric, hermitian };
+   //**********************************************************************************************
+
+   Field field;        //!< The field of the elements.
+   Symmetry symmetry;  //!< The symmetry structure of the matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the banner of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param line The first line of the file.
+// \return The parsed banner.
+// \exception std::invalid_argument Invalid or unsupported Matrix Market banner.
+*/
+inline MatrixMarketBanner parseMatrixMarketBanner( std::string line )
+{
+   std::transform( line.begin(), line.end(), line.begin(),
+                   []( char c ) { return static_cast<char>( std::tolower( c ) ); } );
+
+   std::istringstream iss( line );
+   std::string token[5];
+   iss >> token[0] >> token[1] >> token[2] >> token[3] >> token[4];
+
+   if( token[0] != "%%matrixmarket" || token[1] != "matrix" ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market banner" );
+   }
+
+   if( token[2] != "coordinate" ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market format" );
+   }
+
+   MatrixMarketBanner banner;
+
+   if     ( token[3] == "real"    ) banner.field = MatrixMarketBanner::real;
+   else if( token[3] == "double"  ) banner.field = MatrixMarketBanner::real;
+   else if( token[3] == "integer" ) banner.field = MatrixMarketBanner::integer;
+   else if( token[3] == "complex" ) banner.field = MatrixMarketBanner::complex;
+   else if( token[3] == "pattern" ) banner.field = MatrixMarketBanner::pattern;
+   else {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market field" );
+   }
+
+   if     ( token[4] == "general"        ) banner.symmetry = MatrixMarketBanner::general;
+   else if( token[4] == "symmetric"      ) banner.symmetry = MatrixMarketBanner::symmetric;
+   else if( token[4] == "skew-symmetric" ) banner.symmetry = MatrixMarketBanner::skewSymmetric;
+   else if( token[4] == "hermitian"      ) banner.symmetry = MatrixMarketBanner::hermitian;
+   else {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market symmetry" );
+   }
+
+   return banner;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a one-based index of a Matrix Market entry.
+// \ingroup math_serialization
+//
+// \param pos The current position within the line (updated to the end of the index).
+// \param end The end of the line.
+// \param index The parsed zero-based index.
+// \return \a true in case a valid index was parsed, \a false if not.
+//
+// Indices that are zero or that exceed the range of \a size_t are considered invalid.
+*/
+inline bool parseMatrixMarketIndex( const char*& pos, const char* end, size_t& index ) noexcept
+{
+   while( pos != end && ( *pos == ' ' || *pos == '\t' ) ) ++pos;
+
+   if( pos == end || *pos < '0' || *pos > '9' )
+      return false;
+
+   size_t value( 0UL );
+   while( pos != end && *pos >= '0' && *pos <= '9' ) {
+      const size_t digit( *pos - '0' );
+      if( value > ( std::numeric_limits<size_t>::max() - digit ) / 10UL )
+         return false;
+      value = value*10UL + digit;
+      ++pos;
+   }
+
+   if( value == 0UL )
+      return false;
+
+   index = value - 1UL;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a numeric value of a Matrix Market entry.
+// \ingroup math_serialization
+//
+// \param pos The current position within the line (updated to the end of the value).
+// \param end The end of the line.
+// \param value The parsed value.
+// \return \a true in case a valid value was parsed, \a false if not.
+//
+// Since the memory-mapped file is not null-terminated, the token is copied into a local buffer
+// before it is converted.
+*/
+inline bool parseMatrixMarketValue( const char*& pos, const char* end, double& value ) noexcept
+{
+   while( pos != end && ( *pos == ' ' || *pos == '\t' ) ) ++pos;
+
+   char buffer[64];
+   size_t length( 0UL );
+
+   while( pos != end && *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n' ) {
+      if( length == sizeof( buffer ) - 1UL )
+         return false;
+      buffer[length++] = *pos++;
+   }
+
+   if( length == 0UL )
+      return false;
+
+   buffer[length] = '\0';
+
+   char* last( nullptr );
+   value = std::strtod( buffer, &last );
+   return last == buffer + length;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a complex element from the parsed real and imaginary part.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the element
+inline EnableIf_< IsComplex<Type>, Type > makeMatrixMarketValue( double real, double imag )
+{
+   using VT = typename Type::value_type;
+   return Type( VT( real ), VT( imag ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a real element from the parsed real part.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the element
+inline DisableIf_< IsComplex<Type>, Type > makeMatrixMarketValue( double real, double )
+{
+   return Type( real );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a complex element in the Matrix Market format.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the element
+inline EnableIf_< IsComplex<Type> > writeMatrixMarketValue( std::ostream& os, const Type& value )
+{
+   os << value.real() << ' ' << value.imag();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a real element in the Matrix Market format.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the element
+inline DisableIf_< IsComplex<Type> > writeMatrixMarketValue( std::ostream& os, const Type& value )
+{
+   os << +value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A single parsed Matrix Market entry.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the element
+struct MatrixMarketEntry
+{
+   size_t index;  //!< The minor index of the entry (column index in case of a row-major matrix).
+   Type value;    //!< The value of the entry.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The parsed entries of a contiguous chunk of lines of a Matrix Market file.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the elements
+struct MatrixMarketChunk
+{
+   std::vector<size_t> majors;                      //!< The major indices of the entries.
+   std::vector< MatrixMarketEntry<Type> > entries;  //!< The minor indices and values of the entries.
+   std::vector<size_t> counts;                      //!< The number of entries per touched major index.
+   size_t first;                                    //!< The smallest major index of the entries.
+   size_t last;                                     //!< One past the largest major index of the entries.
+   size_t lines;                                    //!< The number of parsed entry lines.
+   bool valid;                                      //!< Flag for a successfully parsed chunk.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a contiguous chunk of lines of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param begin The beginning of the chunk (the beginning of a line).
+// \param end The end of the chunk (the end of a line).
+// \param banner The banner of the file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param so The storage order of the target matrix.
+// \param chunk The resulting chunk.
+// \return void
+//
+// This function parses all entry lines of the given chunk and mirrors the entries of symmetric,
+// skew-symmetric, and Hermitian matrices. The number of entries per major index is only counted
+// for the range of major indices touched by the chunk. Since the function is executed concurrently
+// by several threads, errors are not reported via exceptions, but via the \a valid flag of the
+// chunk.
+*/
+template< typename Type >  // Data type of the elements
+void parseMatrixMarketChunk( const char* begin, const char* end, const MatrixMarketBanner& banner,
+                             size_t m, size_t n, bool so, MatrixMarketChunk<Type>& chunk )
+{
+   chunk.first = so ? n : m;
+   chunk.last  = 0UL;
+   chunk.lines = 0UL;
+   chunk.valid = false;
+
+   const bool mirror( banner.symmetry != MatrixMarketBanner::general );
+
+   for( const char* pos=begin; pos!=end; )
+   {
+      const char* const eol( std::find( pos, end, '\n' ) );
+      const char* next( eol == end ? end : eol+1 );
+
+      while( pos != eol && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) ) ++pos;
+
+      if( pos == eol || *pos == '%' ) {
+         pos = next;
+         continue;
+      }
+
+      size_t i, j;
+      double real( 1.0 ), imag( 0.0 );
+
+      if( !parseMatrixMarketIndex( pos, eol, i ) || !parseMatrixMarketIndex( pos, eol, j ) ||
+          i >= m || j >= n ||
+          ( banner.field != MatrixMarketBanner::pattern && !parseMatrixMarketValue( pos, eol, real ) ) ||
+          ( banner.field == MatrixMarketBanner::complex && !parseMatrixMarketValue( pos, eol, imag ) ) ) {
+         return;
+      }
+
+      const Type value( makeMatrixMarketValue<Type>( real, imag ) );
+
+      chunk.majors.push_back( so ? j : i );
+      chunk.entries.push_back( MatrixMarketEntry<Type>{ so ? i : j, value } );
+
+      if( mirror && i != j )
+      {
+         const Type mirrored( banner.symmetry == MatrixMarketBanner::symmetric ? value :
+                              banner.symmetry == MatrixMarketBanner::skewSymmetric ? Type( -value ) :
+                              Type( conj( value ) ) );
+
+         if( j >= m || i >= n )
+            return;
+
+         chunk.majors.push_back( so ? i : j );
+         chunk.entries.push_back( MatrixMarketEntry<Type>{ so ? j : i, mirrored } );
+      }
+
+      ++chunk.lines;
+      pos = next;
+   }
+
+   for( size_t major : chunk.majors ) {
+      chunk.first = min( chunk.first, major );
+      chunk.last  = max( chunk.last, major+1UL );
+   }
+
+   chunk.counts.assign( chunk.last > chunk.first ? chunk.last - chunk.first : 0UL, 0UL );
+
+   for( size_t major : chunk.majors ) {
+      ++chunk.counts[major-chunk.first];
+   }
+
+   chunk.valid = true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Matrix Market functions */
+//@{
+template< typename Type, bool SO >
+void readMatrixMarket( const std::string& path, CompressedMatrix<Type,SO>& sm );
+
+template< typename MT, bool SO >
+void writeMatrixMarket( const std::string& path, const SparseMatrix<MT,SO>& sm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a sparse matrix from a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param path The path of the Matrix Market file.
+// \param sm The target compressed matrix.
+// \return void
+// \exception std::invalid_argument Invalid or unsupported Matrix Market file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This function reads a sparse matrix in the coordinate format of the Matrix Market exchange
+// format (see https://math.nist.gov/MatrixMarket/formats.html) into the given compressed
+// matrix. All fields (\c real, \c integer, \c complex, and \c pattern) and all symmetry
+// structures (\c general, \c symmetric, \c skew-symmetric, and \c hermitian) are supported.
+// Entries of a \c pattern matrix are set to 1, duplicate entries are summed up:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "A.mtx", A );
+   blaze::writeMatrixMarket( "B.mtx", A*A );
+   \endcode
+
+// The file is mapped into memory and split into one chunk of lines per thread of the active SMP
+// backend. The chunks are parsed in parallel. Afterwards the entries are scattered into their
+// final rows (or columns in case of a column-major matrix), which are sorted in parallel, and
+// the compressed matrix is built in a single sequential pass via append(). \c complex files
+// can only be read into complex matrices. In case of an error, the target matrix remains
+// unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void readMatrixMarket( const std::string& path, CompressedMatrix<Type,SO>& sm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   using Entry = MatrixMarketEntry<Type>;
+
+   const MappedFile file( path, readOnly );
+   file.advise( sequentialAccess );
+
+   const char* pos( reinterpret_cast<const char*>( file.data() ) );
+   const char* const end( pos + file.size() );
+
+   // Parsing the banner
+   const char* eol( std::find( pos, end, '\n' ) );
+   const MatrixMarketBanner banner( parseMatrixMarketBanner( std::string( pos, eol ) ) );
+
+   if( banner.field == MatrixMarketBanner::complex && !IsComplex<Type>::value ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid conversion from complex to real elements" );
+   }
+
+   // Parsing the size line
+   std::string sizeLine;
+
+   while( eol != end && sizeLine.find_first_not_of( " \t\r" ) == std::string::npos ) {
+      pos = eol + 1;
+      eol = std::find( pos, end, '\n' );
+      sizeLine = ( pos != eol && *pos == '%' )?( std::string() ):( std::string( pos, eol ) );
+   }
+
+   size_t m( 0UL ), n( 0UL ), lines( 0UL );
+   std::istringstream iss( sizeLine );
+
+   if( !( iss >> m >> n >> lines ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market size line" );
+   }
+
+   const char* const body( eol == end ? end : eol+1 );
+
+   // Parsing the entries in parallel
+   const bool parallel( lines >= SMP_DVECASSIGN_THRESHOLD &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+
+   const size_t partitions( parallel ? min( getNumThreads(), lines ) : 1UL );
+
+   std::vector<const char*> bounds( partitions+1UL, end );
+   bounds[0UL] = body;
+
+   for( size_t p=1UL; p<partitions; ++p ) {
+      const char* split( body + ( ( end - body ) / partitions ) * p );
+      split = std::find( std::max( split, bounds[p-1UL] ), end, '\n' );
+      bounds[p] = ( split == end ? end : split+1 );
+   }
+
+   std::vector< MatrixMarketChunk<Type> > chunks( partitions );
+
+   auto parse = [&]( size_t p ) {
+      parseMatrixMarketChunk( bounds[p], bounds[p+1UL], banner, m, n, SO, chunks[p] );
+   };
+
+   smpForRange( partitions, 2UL, [&parse]( size_t begin, size_t end ) {
+      for( size_t p=begin; p<end; ++p ) {
+         parse( p );
+      }
+   } );
+
+   size_t parsed( 0UL );
+
+   for( const MatrixMarketChunk<Type>& chunk : chunks ) {
+      if( !chunk.valid ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market entry" );
+      }
+      parsed += chunk.lines;
+   }
+
+   if( parsed != lines ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of Matrix Market entries" );
+   }
+
+   // Computing the offsets of the entries of each chunk within the rows/columns
+   const size_t major( SO ? n : m );
+
+   std::vector<size_t> offsets( major+1UL, 0UL );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      size_t offset( offsets[i] );
+      for( MatrixMarketChunk<Type>& chunk : chunks ) {
+         if( i < chunk.first || i >= chunk.last ) continue;
+         const size_t count( chunk.counts[i-chunk.first] );
+         chunk.counts[i-chunk.first] = offset;
+         offset += count;
+      }
+      offsets[i+1UL] = offset;
+   }
+
+   // Scattering the entries into their rows/columns
+   std::vector<Entry> entries( offsets[major] );
+
+   auto scatter = [&]( size_t p ) {
+      MatrixMarketChunk<Type>& chunk( chunks[p] );
+      for( size_t k=0UL; k<chunk.entries.size(); ++k ) {
+         entries[chunk.counts[chunk.majors[k]-chunk.first]++] = chunk.entries[k];
+      }
+      chunk.majors  = std::vector<size_t>();
+      chunk.entries = std::vector<Entry>();
+   };
+
+   // Sorting the rows/columns and summing up duplicate entries
+   std::vector<size_t> sizes( major, 0UL );
+
+   auto sort = [&]( size_t p ) {
+      const size_t begin( ( major * p ) / partitions );
+      const size_t last ( ( major * ( p+1UL ) ) / partitions );
+      for( size_t i=begin; i<last; ++i )
+      {
+         Entry* const first( entries.data() + offsets[i] );
+         Entry* const final( entries.data() + offsets[i+1UL] );
+
+         std::sort( first, final, []( const Entry& a, const Entry& b ) { return a.index < b.index; } );
+
+         Entry* current( first );
+         for( Entry* e=first; e!=final; ++e ) {
+            if( e != first && e->index == (current-1)->index ) {
+               (current-1)->value += e->value;
+            }
+            else {
+               *current++ = *e;
+            }
+         }
+
+         sizes[i] = static_cast<size_t>( current - first );
+      }
+   };
+
+   smpForRange( partitions, 2UL, [&scatter]( size_t begin, size_t end ) {
+      for( size_t p=begin; p<end; ++p ) {
+         scatter( p );
+      }
+   } );
+   smpForRange( partitions, 2UL, [&sort]( size_t begin, size_t end ) {
+      for( size_t p=begin; p<end; ++p ) {
+         sort( p );
+      }
+   } );
+
+   // Building the compressed matrix
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<major; ++i ) {
+      nonzeros += sizes[i];
+   }
+
+   CompressedMatrix<Type,SO> tmp( m, n, nonzeros );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t k=offsets[i]; k<offsets[i]+sizes[i]; ++k ) {
+         if( SO ) tmp.append( entries[k].index, i, entries[k].value );
+         else     tmp.append( i, entries[k].index, entries[k].value );
+      }
+      tmp.finalize( i );
+   }
+
+   sm.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix into a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param path The path of the Matrix Market file.
+// \param sm The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error The file could not be written.
+//
+// This function writes the given sparse matrix in the coordinate format of the Matrix Market
+// exchange format. Depending on the element type of the matrix, the field of the file is
+// \c complex, \c integer, or \c real. The symmetry structure of the file is always \c general.
+// Floating point values are written with the precision required for an exact round trip.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void writeMatrixMarket( const std::string& path, const SparseMatrix<MT,SO>& sm )
+{
+   using ET = ElementType_<MT>;
+
+   CompositeType_<MT> A( ~sm );  // Evaluation of the sparse matrix operand
+
+   std::ofstream out( path.c_str(), std::ofstream::trunc );
+   out.precision( std::numeric_limits< UnderlyingBuiltin_<ET> >::max_digits10 );
+
+   out << "%%MatrixMarket matrix coordinate "
+       << ( IsComplex<ET>::value ? "complex" : IsIntegral<ET>::value ? "integer" : "real" )
+       << " general\n"
+       << A.rows() << ' ' << A.columns() << ' ' << A.nonZeros() << '\n';
+
+   const size_t major( SO ? A.columns() : A.rows() );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         if( SO ) out << element->index()+1UL << ' ' << i+1UL << ' ';
+         else     out << i+1UL << ' ' << element->index()+1UL << ' ';
+         writeMatrixMarketValue( out, element->value() );
+         out << '\n';
+      }
+   }
+
+   if( !out ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write Matrix Market file" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
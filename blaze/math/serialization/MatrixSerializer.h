@@ -47,11 +47,13 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/serialization/SparseEncoding.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -154,6 +156,21 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// By default, the non-zero elements of sparse matrices are serialized as index/value pairs. In
+// order to reduce the size of the archive, the MatrixSerializer can be configured to use the
+// \a blaze::deltaEncoding for sparse matrices with numeric elements:
+
+   \code
+   blaze::CompressedMatrix<double,rowMajor> S;
+
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "matrix.blaze" );
+   blaze::MatrixSerializer( blaze::deltaEncoding ).serialize( archive, S );
+   \endcode
+
+// Archives written in the delta encoding are automatically recognized during deserialization.
 */
 class MatrixSerializer
 {
@@ -198,7 +215,7 @@ class MatrixSerializer
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline MatrixSerializer();
+   explicit inline MatrixSerializer( SparseEncoding encoding = plainEncoding );
    // No explicitly declared copy constructor.
    //@}
    //**********************************************************************************************
@@ -239,6 +256,14 @@ class MatrixSerializer
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   EnableIf_< IsNumeric< ElementType_<MT> > >
+      serializeEncodedMatrix( Archive& archive, const MT& mat );
+
+   template< typename Archive, typename MT >
+   DisableIf_< IsNumeric< ElementType_<MT> > >
+      serializeEncodedMatrix( Archive& archive, const MT& mat );
    //@}
    //**********************************************************************************************
 
@@ -307,12 +332,27 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename MT >
+   EnableIf_< IsNumeric< ElementType_<MT> > >
+      deserializeEncodedMatrix( Archive& archive, MT& mat );
+
+   template< typename Archive, typename MT >
+   DisableIf_< IsNumeric< ElementType_<MT> > >
+      deserializeEncodedMatrix( Archive& archive, MT& mat );
+
+   template< typename MT, typename Type, bool SO >
+   void assignEncodedMatrix( MT& mat, CompressedMatrix<Type,SO>& tmp );
+
+   template< typename Type, bool SO >
+   void assignEncodedMatrix( CompressedMatrix<Type,SO>& mat, CompressedMatrix<Type,SO>& tmp );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   SparseEncoding encoding_;  //!< The encoding of sparse matrices.
    uint8_t  version_;      //!< The version of the archive.
    uint8_t  type_;         //!< The type of the matrix.
    uint8_t  elementType_;  //!< The type of an element.
@@ -336,9 +376,12 @@ class MatrixSerializer
 
 //*************************************************************************************************
 /*!\brief The default constructor of the MatrixSerializer class.
+//
+// \param encoding The encoding of sparse matrices (\a plainEncoding or \a deltaEncoding).
 */
-MatrixSerializer::MatrixSerializer()
-   : version_    ( 0U  )  // The version of the archive
+MatrixSerializer::MatrixSerializer( SparseEncoding encoding )
+   : encoding_   ( encoding )  // The encoding of sparse matrices
+   , version_    ( 0U  )  // The version of the archive
    , type_       ( 0U  )  // The type of the matrix
    , elementType_( 0U  )  // The type of an element
    , elementSize_( 0U  )  // The size in bytes of a single element of the matrix
@@ -394,7 +437,10 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 {
    using ET = ElementType_<MT>;
 
-   archive << uint8_t ( 1U );
+   version_ = ( encoding_ == deltaEncoding && IsSparseMatrix<MT>::value && IsNumeric<ET>::value )
+              ?( 2U ):( 1U );
+
+   archive << uint8_t ( version_ );
    archive << uint8_t ( MatrixValueMapping<MT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
@@ -459,7 +505,10 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 {
    using ConstIterator = ConstIterator_<MT>;
 
-   if( IsRowMajorMatrix<MT>::value ) {
+   if( version_ == 2U ) {
+      serializeEncodedMatrix( archive, ~mat );
+   }
+   else if( IsRowMajorMatrix<MT>::value ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
          archive << uint64_t( (~mat).nonZeros( i ) );
          for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
@@ -485,6 +534,45 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix with numeric elements in the delta encoding.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+EnableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeEncodedMatrix( Archive& archive, const MT& mat )
+{
+   encodeSparseMatrix( archive, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix with non-numeric elements in the delta encoding.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// Sparse matrices with non-numeric elements are always serialized in the plain encoding.
+// Therefore this function is never called.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::serializeEncodedMatrix( Archive& /*archive*/, const MT& /*mat*/ )
+{
+   BLAZE_INTERNAL_ASSERT( false, "Invalid encoding of a non-numeric sparse matrix" );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  DESERIALIZATION FUNCTIONS
@@ -509,8 +597,14 @@ void MatrixSerializer::deserialize( Archive& archive, Matrix<MT,SO>& mat )
    }
 
    deserializeHeader( archive, ~mat );
-   prepareMatrix( ~mat );
-   deserializeMatrix( archive, ~mat );
+
+   if( version_ == 2U ) {
+      deserializeEncodedMatrix( archive, ~mat );
+   }
+   else {
+      prepareMatrix( ~mat );
+      deserializeMatrix( archive, ~mat );
+   }
 }
 //*************************************************************************************************
 
@@ -532,9 +626,12 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ != 1UL && version_ != 2UL ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
+   else if( version_ == 2UL && type_ != 3U && type_ != 7U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
    else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
    }
@@ -1129,6 +1226,94 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a delta encoded sparse matrix with numeric elements.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function decodes the delta encoded sparse matrix from the archive into a temporary
+// compressed matrix of the serialized storage order and assigns it to the given matrix. In case
+// any error is detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+EnableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::deserializeEncodedMatrix( Archive& archive, MT& mat )
+{
+   using ET = ElementType_<MT>;
+
+   if( type_ == 3U ) {
+      CompressedMatrix<ET,rowMajor> tmp;
+      decodeSparseMatrix( archive, tmp, rows_, columns_, number_ );
+      assignEncodedMatrix( mat, tmp );
+   }
+   else {
+      CompressedMatrix<ET,columnMajor> tmp;
+      decodeSparseMatrix( archive, tmp, rows_, columns_, number_ );
+      assignEncodedMatrix( mat, tmp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a delta encoded sparse matrix with non-numeric elements.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+//
+// Since only sparse matrices with numeric elements can be delta encoded, this function always
+// throws a \a std::runtime_error exception.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_< IsNumeric< ElementType_<MT> > >
+   MatrixSerializer::deserializeEncodedMatrix( Archive& /*archive*/, MT& /*mat*/ )
+{
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigns a decoded sparse matrix to the given matrix.
+//
+// \param mat The matrix to be reconstituted.
+// \param tmp The decoded sparse matrix.
+// \return void
+*/
+template< typename MT    // Type of the matrix
+        , typename Type  // Data type of the decoded matrix
+        , bool SO >      // Storage order of the decoded matrix
+void MatrixSerializer::assignEncodedMatrix( MT& mat, CompressedMatrix<Type,SO>& tmp )
+{
+   resize( mat, rows_, columns_, false );
+   mat = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigns a decoded sparse matrix to a compressed matrix of the same type.
+//
+// \param mat The matrix to be reconstituted.
+// \param tmp The decoded sparse matrix.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void MatrixSerializer::assignEncodedMatrix( CompressedMatrix<Type,SO>& mat, CompressedMatrix<Type,SO>& tmp )
+{
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1272,6 +1457,42 @@ void serialize( Archive& archive, const Matrix<MT,SO>& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the given matrix with the given sparse encoding and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \param encoding The encoding of sparse matrices (\a plainEncoding or \a deltaEncoding).
+// \return void
+// \exception std::runtime_error Matrix could not be serialized.
+//
+// This function serializes the given matrix in the same way as the serialize() function above.
+// However, in case \a encoding is set to \a blaze::deltaEncoding, sparse matrices with numeric
+// elements are stored in a compact encoding, which is considerably smaller than the default
+// encoding (especially for matrices with many non-zero elements per row and for matrices with
+// few distinct values):
+
+   \code
+   blaze::CompressedMatrix<float,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "graph.blaze" );
+   serialize( archive, A, blaze::deltaEncoding );
+   \endcode
+
+// The resulting archive can be deserialized via the deserialize() function. Dense matrices and
+// matrices with non-numeric elements are not affected by the encoding.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void serialize( Archive& archive, const Matrix<MT,SO>& mat, SparseEncoding encoding )
+{
+   MatrixSerializer( encoding ).serialize( archive, ~mat );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a matrix from the given archive.
 //
@@ -0,0 +1,882 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Npy.h
+//  \brief Header file for the NumPy .npy file format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_NPY_H_
+#define _BLAZE_MATH_SERIALIZATION_NPY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS NPYHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The parsed header of a NumPy .npy array.
+// \ingroup math_serialization
+*/
+struct NpyHeader
+{
+   char kind;                  //!< The kind of the elements ('b', 'i', 'u', 'f', or 'c').
+   size_t itemsize;            //!< The size of a single element in bytes.
+   bool swap;                  //!< Flag for a byte order that differs from the native byte order.
+   bool fortran;               //!< Flag for column-major (Fortran) order.
+   std::string descr;          //!< The dtype descriptor of the elements (e.g. "<f8").
+   std::vector<size_t> shape;  //!< The shape of the array.
+   size_t offset;              //!< The offset of the first element from the start of the array.
+
+   //**********************************************************************************************
+   /*!\brief Returns the total number of elements of the array.
+   //
+   // \return The total number of elements.
+   */
+   inline size_t elements() const noexcept {
+      size_t n( 1UL );
+      for( size_t extent : shape ) n *= extent;
+      return n;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A NumPy .npy array within a (possibly shared) memory-mapped file.
+// \ingroup math_serialization
+//
+// The NpySource represents the bytes of a single .npy array, which is either an entire .npy file
+// or an uncompressed entry of a .npz archive. The mapping is shared between all arrays of the
+// same file.
+*/
+struct NpySource
+{
+   std::shared_ptr<MappedFile> file;  //!< The mapped file containing the array.
+   size_t offset;                     //!< The offset of the array within the file.
+   size_t size;                       //!< The size of the array in bytes.
+
+   //**********************************************************************************************
+   /*!\brief Returns a pointer to the first byte of the array.
+   //
+   // \return Pointer to the first byte of the array.
+   */
+   inline byte_t* data() const noexcept {
+      return file->data() + offset;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the system uses a little endian byte order.
+// \ingroup math_serialization
+//
+// \return \a true in case of a little endian system, \a false otherwise.
+*/
+inline bool isLittleEndian() noexcept
+{
+   const uint16_t one( 1U );
+   return *reinterpret_cast<const byte_t*>( &one ) == 1U;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy dtype descriptor of the given element type.
+// \ingroup math_serialization
+//
+// \return The dtype descriptor in native byte order (e.g. "<f8" for \c double).
+*/
+template< typename Type >  // Data type of the elements
+std::string npyDescriptor()
+{
+   using T = RemoveConst_<Type>;
+
+   const char kind( IsSame<T,bool>::value ? 'b'
+                  : IsComplex<T>::value ? 'c'
+                  : IsFloatingPoint<T>::value ? 'f'
+                  : IsSigned<T>::value ? 'i' : 'u' );
+
+   const char order( sizeof( T ) == 1UL ? '|' : ( isLittleEndian() ? '<' : '>' ) );
+
+   return std::string( 1UL, order ) + kind + std::to_string( sizeof( T ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the value of the given key from the header dictionary of a .npy array.
+// \ingroup math_serialization
+//
+// \param dict The header dictionary.
+// \param key The key of the requested value.
+// \return The (unparsed) value of the given key.
+// \exception std::invalid_argument Invalid .npy header.
+*/
+inline std::string npyValue( const std::string& dict, const std::string& key )
+{
+   const size_t pos( dict.find( "'" + key + "'" ) );
+
+   if( pos == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   size_t begin( dict.find( ':', pos ) );
+
+   if( begin == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   begin = dict.find_first_not_of( " ", begin+1UL );
+
+   if( begin == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   const char open( dict[begin] );
+   const size_t end( ( open == '\'' )?( dict.find( '\'', begin+1UL ) )
+                                     :( ( open == '(' )?( dict.find( ')', begin ) )
+                                                       :( dict.find_first_of( ",}", begin ) ) ) );
+
+   if( end == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   return ( open == '\'' || open == '(' )?( dict.substr( begin+1UL, end-begin-1UL ) )
+                                         :( dict.substr( begin, end-begin ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the header of a .npy array.
+// \ingroup math_serialization
+//
+// \param data Pointer to the first byte of the array.
+// \param size The size of the array in bytes.
+// \return The parsed header.
+// \exception std::invalid_argument Invalid .npy header.
+//
+// This function parses the header of a .npy array of version 1.0, 2.0, or 3.0 and checks that
+// the size of the array is sufficient for the given shape and element type. Structured and
+// object dtypes are not supported.
+*/
+inline NpyHeader parseNpyHeader( const byte_t* data, size_t size )
+{
+   if( size < 10UL || std::memcmp( data, "\x93NUMPY", 6UL ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   const size_t major( data[6] );
+   size_t begin, length;
+
+   if( major == 1UL ) {
+      begin  = 10UL;
+      length = size_t( data[8] ) | ( size_t( data[9] ) << 8 );
+   }
+   else if( ( major == 2UL || major == 3UL ) && size >= 12UL ) {
+      begin  = 12UL;
+      length = size_t( data[8] ) | ( size_t( data[9] ) << 8 ) |
+               ( size_t( data[10] ) << 16 ) | ( size_t( data[11] ) << 24 );
+   }
+   else {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy version" );
+   }
+
+   if( size < begin + length ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   const std::string dict( reinterpret_cast<const char*>( data ) + begin, length );
+
+   NpyHeader header;
+   header.offset = begin + length;
+   header.descr  = npyValue( dict, "descr" );
+
+   if( header.descr.size() < 3UL || ( header.descr[0] != '<' && header.descr[0] != '>' &&
+                                      header.descr[0] != '|' && header.descr[0] != '=' ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported .npy element type" );
+   }
+
+   header.kind     = header.descr[1];
+   header.itemsize = std::strtoul( header.descr.c_str()+2, nullptr, 10 );
+   header.swap     = ( header.descr[0] == '<' && !isLittleEndian() ) ||
+                     ( header.descr[0] == '>' &&  isLittleEndian() );
+
+   const bool valid( ( header.kind == 'b' && header.itemsize == 1UL ) ||
+                     ( ( header.kind == 'i' || header.kind == 'u' ) &&
+                       ( header.itemsize == 1UL || header.itemsize == 2UL ||
+                         header.itemsize == 4UL || header.itemsize == 8UL ) ) ||
+                     ( header.kind == 'f' && ( header.itemsize == 4UL || header.itemsize == 8UL ) ) ||
+                     ( header.kind == 'c' && ( header.itemsize == 8UL || header.itemsize == 16UL ) ) );
+
+   if( !valid ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported .npy element type" );
+   }
+
+   const std::string order( npyValue( dict, "fortran_order" ) );
+
+   if( order != "True" && order != "False" ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy header" );
+   }
+
+   header.fortran = ( order == "True" );
+
+   const std::string shape( npyValue( dict, "shape" ) );
+
+   if( shape.find_first_not_of( "0123456789, ", 0UL ) != std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy shape" );
+   }
+
+   for( size_t pos=0UL; pos<shape.size(); )
+   {
+      pos = shape.find_first_of( "0123456789", pos );
+      if( pos == std::string::npos ) break;
+
+      const size_t end( shape.find_first_not_of( "0123456789", pos ) );
+
+      errno = 0;
+      const size_t extent( std::strtoul( shape.substr( pos, end-pos ).c_str(), nullptr, 10 ) );
+
+      if( errno == ERANGE ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy shape" );
+      }
+
+      header.shape.push_back( extent );
+      pos = end;
+   }
+
+   // Checking the number of elements against the number of elements that actually fit into
+   // the array (in a form that cannot overflow)
+   const size_t capacity( ( size - header.offset ) / header.itemsize );
+
+   if( std::find( header.shape.begin(), header.shape.end(), 0UL ) == header.shape.end() )
+   {
+      size_t elements( 1UL );
+
+      for( size_t extent : header.shape ) {
+         if( elements > capacity / extent ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of .npy array" );
+         }
+         elements *= extent;
+      }
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements of a .npy array can be used in place.
+// \ingroup math_serialization
+//
+// \param header The parsed header of the array.
+// \param data Pointer to the first byte of the array.
+// \return \a true in case the elements can be used in place, \a false if not.
+//
+// The elements of a .npy array can be used in place in case the dtype exactly matches the given
+// element type (including the byte order) and in case the elements are properly aligned.
+*/
+template< typename Type >  // Data type of the elements
+bool isNpyCompatible( const NpyHeader& header, const byte_t* data )
+{
+   const std::string descr( npyDescriptor<Type>() );
+
+   return ( header.descr == descr ||
+            ( header.descr[0] == '=' && header.descr.substr( 1UL ) == descr.substr( 1UL ) ) ) &&
+          ( reinterpret_cast<size_t>( data + header.offset ) % alignof( Type ) == 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a single scalar of type \a Src from the given memory location.
+// \ingroup math_serialization
+//
+// \param ptr Pointer to the scalar.
+// \param swap \a true in case the byte order has to be reversed, \a false if not.
+// \return The loaded scalar.
+*/
+template< typename Src >  // Data type of the scalar
+inline Src loadNpyScalar( const byte_t* ptr, bool swap ) noexcept
+{
+   byte_t bytes[sizeof( Src )];
+   std::memcpy( bytes, ptr, sizeof( Src ) );
+
+   if( swap ) {
+      std::reverse( bytes, bytes+sizeof( Src ) );
+   }
+
+   Src value;
+   std::memcpy( &value, bytes, sizeof( Src ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a real .npy element to the given element type.
+// \ingroup math_serialization
+*/
+template< typename Type, typename Src >
+inline Type convertNpyElement( const byte_t* ptr, bool swap ) noexcept
+{
+   return Type( loadNpyScalar<Src>( ptr, swap ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a complex .npy element to the given complex element type.
+// \ingroup math_serialization
+*/
+template< typename Type, typename Src >
+inline EnableIf_< IsComplex<Type>, Type > convertNpyComplex( const byte_t* ptr, bool swap ) noexcept
+{
+   using VT = typename Type::value_type;
+   return Type( VT( loadNpyScalar<Src>( ptr, swap ) ),
+                VT( loadNpyScalar<Src>( ptr+sizeof( Src ), swap ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a complex .npy element to the given real element type (never selected).
+// \ingroup math_serialization
+*/
+template< typename Type, typename Src >
+inline DisableIf_< IsComplex<Type>, Type > convertNpyComplex( const byte_t*, bool ) noexcept
+{
+   return Type();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the elements of a .npy array to the given element type.
+// \ingroup math_serialization
+//
+// \param header The parsed header of the array.
+// \param data Pointer to the first byte of the array.
+// \param m The number of rows of the target.
+// \param n The number of columns of the target.
+// \param fortran \a true in case the target is stored in column-major order, \a false if not.
+// \param target Pointer to the first element of the (contiguous) target.
+// \return void
+// \exception std::invalid_argument Invalid conversion from complex to real elements.
+//
+// This function converts all elements of the given .npy array to the given element type. The
+// conversion reverses the byte order if necessary and transposes the elements in case the order
+// of the array differs from the order of the target.
+*/
+template< typename Type >  // Data type of the elements
+void convertNpy( const NpyHeader& header, const byte_t* data,
+                 size_t m, size_t n, bool fortran, Type* target )
+{
+   using Converter = Type (*)( const byte_t*, bool );
+
+   Converter convert( nullptr );
+
+   switch( header.kind ) {
+      case 'b': convert = &convertNpyElement<Type,uint8_t>; break;
+      case 'i': convert = ( header.itemsize == 1UL )?( &convertNpyElement<Type,int8_t > )
+                         :( header.itemsize == 2UL )?( &convertNpyElement<Type,int16_t> )
+                         :( header.itemsize == 4UL )?( &convertNpyElement<Type,int32_t> )
+                                                    :( &convertNpyElement<Type,int64_t> ); break;
+      case 'u': convert = ( header.itemsize == 1UL )?( &convertNpyElement<Type,uint8_t > )
+                         :( header.itemsize == 2UL )?( &convertNpyElement<Type,uint16_t> )
+                         :( header.itemsize == 4UL )?( &convertNpyElement<Type,uint32_t> )
+                                                    :( &convertNpyElement<Type,uint64_t> ); break;
+      case 'f': convert = ( header.itemsize == 4UL )?( &convertNpyElement<Type,float> )
+                                                    :( &convertNpyElement<Type,double> ); break;
+      case 'c': convert = ( header.itemsize == 8UL )?( &convertNpyComplex<Type,float> )
+                                                    :( &convertNpyComplex<Type,double> ); break;
+   }
+
+   if( header.kind == 'c' && !IsComplex<Type>::value ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid conversion from complex to real elements" );
+   }
+
+   const byte_t* src( data + header.offset );
+   const size_t itemsize( header.itemsize );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t s( header.fortran ? i+j*m : i*n+j );
+         const size_t t( fortran ? i+j*m : i*n+j );
+         target[t] = convert( src + s*itemsize, header.swap );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the header of a .npy array.
+// \ingroup math_serialization
+//
+// \param shape The shape of the array (e.g. "3, 4" or "5,").
+// \param fortran \a true in case of column-major order, \a false in case of row-major order.
+// \return The complete header including the magic string and the header length.
+//
+// The header is padded such that the elements of the array start at a 64-byte boundary.
+*/
+template< typename Type >  // Data type of the elements
+std::string npyHeader( const std::string& shape, bool fortran )
+{
+   std::string dict( "{'descr': '" + npyDescriptor<Type>() + "', 'fortran_order': " +
+                     ( fortran ? "True" : "False" ) + ", 'shape': (" + shape + "), }" );
+
+   const size_t length( ( ( 10UL + dict.size() + 1UL + 63UL ) & ~size_t( 63UL ) ) - 10UL );
+
+   dict.append( length - dict.size() - 1UL, ' ' );
+   dict.push_back( '\n' );
+
+   std::string header( "\x93NUMPY\x01\x00", 8UL );
+   header.push_back( static_cast<char>(   length        & 0xFFUL ) );
+   header.push_back( static_cast<char>( ( length >> 8 ) & 0xFFUL ) );
+
+   return header + dict;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given dense vector in the .npy format.
+// \ingroup math_serialization
+//
+// \param dv The dense vector to be written.
+// \param write The sink for the bytes of the array (called as \c write(ptr,size)).
+// \return The number of written bytes.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF         // Transpose flag of the dense vector
+        , typename Sink >  // Type of the byte sink
+size_t writeNpyData( const DenseVector<VT,TF>& dv, Sink write )
+{
+   using ET = RemoveConst_< ElementType_<VT> >;
+
+   CompositeType_<VT> v( ~dv );  // Evaluation of the dense vector operand
+
+   const std::string header( npyHeader<ET>( std::to_string( v.size() ) + ",", false ) );
+   write( reinterpret_cast<const byte_t*>( header.data() ), header.size() );
+
+   std::vector<ET> buffer( v.size() );
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      buffer[i] = v[i];
+   }
+   write( reinterpret_cast<const byte_t*>( buffer.data() ), buffer.size()*sizeof( ET ) );
+
+   return header.size() + buffer.size()*sizeof( ET );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given dense matrix in the .npy format.
+// \ingroup math_serialization
+//
+// \param dm The dense matrix to be written.
+// \param write The sink for the bytes of the array (called as \c write(ptr,size)).
+// \return The number of written bytes.
+//
+// Row-major matrices are written in C order, column-major matrices in Fortran order.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO         // Storage order of the dense matrix
+        , typename Sink >  // Type of the byte sink
+size_t writeNpyData( const DenseMatrix<MT,SO>& dm, Sink write )
+{
+   using ET = RemoveConst_< ElementType_<MT> >;
+
+   CompositeType_<MT> A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( SO ? A.columns() : A.rows() );
+   const size_t N( SO ? A.rows() : A.columns() );
+
+   const std::string header( npyHeader<ET>( std::to_string( A.rows() ) + ", " +
+                                            std::to_string( A.columns() ), SO ) );
+   write( reinterpret_cast<const byte_t*>( header.data() ), header.size() );
+
+   std::vector<ET> buffer( N );
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         buffer[j] = SO ? A(j,i) : A(i,j);
+      }
+      write( reinterpret_cast<const byte_t*>( buffer.data() ), N*sizeof( ET ) );
+   }
+
+   return header.size() + M*N*sizeof( ET );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a .npy array into the given dense vector.
+// \ingroup math_serialization
+//
+// \param source The .npy array.
+// \param dv The target dense vector.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy array.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void readNpyData( const NpySource& source, DenseVector<VT,TF>& dv )
+{
+   using ET = ElementType_<VT>;
+
+   const byte_t* data( source.data() );
+   const NpyHeader header( parseNpyHeader( data, source.size ) );
+
+   if( header.shape.size() != 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of .npy array" );
+   }
+
+   const size_t n( header.shape[0] );
+
+   resize( ~dv, n, false );
+
+   if( n == 0UL )
+      return;
+
+   if( isNpyCompatible<ET>( header, data ) ) {
+      const CustomVector<const ET,unaligned,unpadded,TF> v(
+         reinterpret_cast<const ET*>( data + header.offset ), n );
+      ~dv = v;
+   }
+   else {
+      std::vector<ET> buffer( n );
+      convertNpy( header, data, n, 1UL, false, buffer.data() );
+      ~dv = CustomVector<const ET,unaligned,unpadded,TF>( buffer.data(), n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a .npy array into the given dense matrix.
+// \ingroup math_serialization
+//
+// \param source The .npy array.
+// \param dm The target dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy array.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void readNpyData( const NpySource& source, DenseMatrix<MT,SO>& dm )
+{
+   using ET = ElementType_<MT>;
+
+   const byte_t* data( source.data() );
+   const NpyHeader header( parseNpyHeader( data, source.size ) );
+
+   if( header.shape.size() != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of .npy array" );
+   }
+
+   const size_t m( header.shape[0] );
+   const size_t n( header.shape[1] );
+
+   resize( ~dm, m, n, false );
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   if( isNpyCompatible<ET>( header, data ) && header.fortran == SO ) {
+      const CustomMatrix<const ET,unaligned,unpadded,SO> A(
+         reinterpret_cast<const ET*>( data + header.offset ), m, n );
+      ~dm = A;
+   }
+   else if( isNpyCompatible<ET>( header, data ) ) {
+      const CustomMatrix<const ET,unaligned,unpadded,!SO> A(
+         reinterpret_cast<const ET*>( data + header.offset ), m, n );
+      ~dm = A;
+   }
+   else {
+      std::vector<ET> buffer( m*n );
+      convertNpy( header, data, m, n, SO, buffer.data() );
+      ~dm = CustomMatrix<const ET,unaligned,unpadded,SO>( buffer.data(), m, n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NumPy .npy functions */
+//@{
+template< typename VT, bool TF >
+void readNpy( const std::string& path, DenseVector<VT,TF>& dv );
+
+template< typename MT, bool SO >
+void readNpy( const std::string& path, DenseMatrix<MT,SO>& dm );
+
+template< typename VT, bool TF >
+void writeNpy( const std::string& path, const DenseVector<VT,TF>& dv );
+
+template< typename MT, bool SO >
+void writeNpy( const std::string& path, const DenseMatrix<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maps the .npy file at the given path.
+// \ingroup math_serialization
+//
+// \param path The path of the .npy file.
+// \param mode The access mode of the mapping.
+// \return The mapped .npy array.
+// \exception std::runtime_error The file could not be opened or mapped.
+*/
+inline NpySource openNpy( const std::string& path, MappingMode mode = readOnly )
+{
+   NpySource source;
+   source.file   = std::make_shared<MappedFile>( path, mode );
+   source.offset = 0UL;
+   source.size   = source.file->size();
+   return source;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a one-dimensional NumPy array from a .npy file into the given dense vector.
+// \ingroup math_serialization
+//
+// \param path The path of the .npy file.
+// \param dv The target dense vector.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This function reads the one-dimensional NumPy array stored in the given .npy file into the
+// given dense vector, which is resized accordingly. In case the dtype of the array matches the
+// element type of the vector, the elements are copied directly from the memory-mapped file.
+// Otherwise the elements are converted (including a conversion of the byte order). Complex
+// arrays can only be read into complex vectors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void readNpy( const std::string& path, DenseVector<VT,TF>& dv )
+{
+   readNpyData( openNpy( path ), ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a two-dimensional NumPy array from a .npy file into the given dense matrix.
+// \ingroup math_serialization
+//
+// \param path The path of the .npy file.
+// \param dm The target dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible .npy file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This function reads the two-dimensional NumPy array stored in the given .npy file into the
+// given dense matrix, which is resized accordingly. Both C and Fortran ordered arrays can be
+// read into row-major and column-major matrices. In case the dtype of the array matches the
+// element type of the matrix, the elements are copied directly from the memory-mapped file.
+// Otherwise the elements are converted (including a conversion of the byte order).
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   blaze::readNpy( "A.npy", A );     // Reading the array saved via numpy.save( "A.npy", A )
+   blaze::writeNpy( "B.npy", A*A );  // Writing an array that can be loaded via numpy.load()
+   \endcode
+
+// Use the NpyMatrix class template to use the elements of a .npy file in place without any
+// copy operation.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void readNpy( const std::string& path, DenseMatrix<MT,SO>& dm )
+{
+   readNpyData( openNpy( path ), ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector as one-dimensional NumPy array into a .npy file.
+// \ingroup math_serialization
+//
+// \param path The path of the .npy file.
+// \param dv The dense vector to be written.
+// \return void
+// \exception std::runtime_error The file could not be written.
+//
+// The elements are written in native byte order. The header is padded such that the elements
+// start at a 64-byte boundary, which allows to map the file via NpyVector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void writeNpy( const std::string& path, const DenseVector<VT,TF>& dv )
+{
+   std::ofstream out( path.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   writeNpyData( ~dv, [&out]( const byte_t* ptr, size_t size ) {
+      out.write( reinterpret_cast<const char*>( ptr ), static_cast<std::streamsize>( size ) );
+   } );
+
+   if( !out ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write .npy file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix as two-dimensional NumPy array into a .npy file.
+// \ingroup math_serialization
+//
+// \param path The path of the .npy file.
+// \param dm The dense matrix to be written.
+// \return void
+// \exception std::runtime_error The file could not be written.
+//
+// Row-major matrices are written in C order, column-major matrices in Fortran order. The
+// elements are written in native byte order. The header is padded such that the elements start
+// at a 64-byte boundary, which allows to map the file via NpyMatrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void writeNpy( const std::string& path, const DenseMatrix<MT,SO>& dm )
+{
+   std::ofstream out( path.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   writeNpyData( ~dm, [&out]( const byte_t* ptr, size_t size ) {
+      out.write( reinterpret_cast<const char*>( ptr ), static_cast<std::streamsize>( size ) );
+   } );
+
+   if( !out ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write .npy file" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,795 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Npz.h
+//  \brief Header file for the NumPy .npz archive format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_NPZ_H_
+#define _BLAZE_MATH_SERIALIZATION_NPZ_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ZIP UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a little endian integer of the given number of bytes.
+// \ingroup math_serialization
+//
+// \param ptr Pointer to the first byte of the integer.
+// \param bytes The number of bytes of the integer (at most 8).
+// \return The integer value.
+*/
+inline uint64_t readLittleEndian( const byte_t* ptr, size_t bytes ) noexcept
+{
+   uint64_t value( 0UL );
+   for( size_t i=0UL; i<bytes; ++i ) {
+      value |= uint64_t( ptr[i] ) << ( 8UL*i );
+   }
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends a little endian integer of the given number of bytes to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The target buffer.
+// \param value The integer value.
+// \param bytes The number of bytes of the integer (at most 8).
+// \return void
+*/
+inline void writeLittleEndian( std::string& buffer, uint64_t value, size_t bytes )
+{
+   for( size_t i=0UL; i<bytes; ++i ) {
+      buffer.push_back( static_cast<char>( ( value >> ( 8UL*i ) ) & 0xFFUL ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the given CRC-32 checksum (as used by the zip format) by the given bytes.
+// \ingroup math_serialization
+//
+// \param crc The current checksum (0 for the first block of bytes).
+// \param ptr Pointer to the first byte.
+// \param size The number of bytes.
+// \return The updated checksum.
+*/
+inline uint32_t updateCRC32( uint32_t crc, const byte_t* ptr, size_t size ) noexcept
+{
+   struct Table {
+      uint32_t values[256];
+      Table() noexcept {
+         for( uint32_t i=0U; i<256U; ++i ) {
+            uint32_t c( i );
+            for( size_t k=0UL; k<8UL; ++k ) {
+               c = ( c & 1U )?( 0xEDB88320U ^ ( c >> 1 ) ):( c >> 1 );
+            }
+            values[i] = c;
+         }
+      }
+   };
+
+   static const Table table;
+
+   crc = ~crc;
+   for( size_t i=0UL; i<size; ++i ) {
+      crc = table.values[( crc ^ ptr[i] ) & 0xFFU] ^ ( crc >> 8 );
+   }
+   return ~crc;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZARCHIVE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read access to the arrays of a NumPy .npz archive.
+// \ingroup math_serialization
+//
+// The NpzArchive class maps a .npz archive (as created by \c numpy.savez() or by the NpzWriter
+// class) into memory and provides access to the contained arrays by name. The names of the
+// arrays do not contain the ".npy" extension of the archive entries:
+
+   \code
+   blaze::NpzArchive archive( "data.npz" );
+
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> b;
+
+   archive.read( "A", A );
+   archive.read( "b", b );
+
+   // Using the elements of the array "A" in place (without any copy operation)
+   blaze::NpyMatrix<const double> C( archive, "A" );
+   \endcode
+
+// Since the arrays are used directly from the mapped archive, only uncompressed archives (as
+// created by \c numpy.savez()) are supported. Compressed archives (as created by
+// \c numpy.savez_compressed()) result in a \a std::invalid_argument exception when accessing
+// a compressed array.
+*/
+class NpzArchive
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline NpzArchive( const std::string& path, MappingMode mode = readOnly );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                   size() const noexcept;
+   inline std::vector<std::string> names() const;
+   inline bool                     contains( const std::string& name ) const noexcept;
+   inline MappingMode              mode() const noexcept;
+
+   template< typename VT, bool TF > inline void read( const std::string& name, DenseVector<VT,TF>& dv ) const;
+   template< typename MT, bool SO > inline void read( const std::string& name, DenseMatrix<MT,SO>& dm ) const;
+
+   inline NpySource source( const std::string& name ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! A single entry of the archive.
+   struct Entry {
+      std::string name;    //!< The name of the entry (without the ".npy" extension).
+      size_t method;       //!< The compression method of the entry.
+      size_t offset;       //!< The offset of the local header of the entry.
+      size_t size;         //!< The (compressed) size of the entry.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const Entry* find( const std::string& name ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<MappedFile> file_;  //!< The mapped archive.
+   std::vector<Entry> entries_;        //!< The entries of the archive.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the .npz archive at the given path and reads its central directory.
+//
+// \param path The path of the .npz archive.
+// \param mode The access mode of the mapping.
+// \exception std::invalid_argument Invalid .npz archive.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// Both standard zip archives and zip64 archives (as created by NumPy for large arrays) are
+// supported. The \a mode of the mapping determines the access mode of all NpyVector and
+// NpyMatrix instances created from the archive.
+*/
+inline NpzArchive::NpzArchive( const std::string& path, MappingMode mode )
+   : file_( std::make_shared<MappedFile>( path, mode ) )  // The mapped archive
+   , entries_()                                            // The entries of the archive
+{
+   const byte_t* data( file_->data() );
+   const size_t size( file_->size() );
+
+   // Locating the end of central directory record
+   if( size < 22UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+   }
+
+   size_t eocd( size - 22UL );
+   while( readLittleEndian( data+eocd, 4UL ) != 0x06054B50UL ) {
+      if( eocd == 0UL || size - eocd > 22UL + 0xFFFFUL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+      }
+      --eocd;
+   }
+
+   size_t count ( readLittleEndian( data+eocd+10UL, 2UL ) );
+   size_t offset( readLittleEndian( data+eocd+16UL, 4UL ) );
+
+   // Reading the zip64 end of central directory record
+   if( eocd >= 20UL && readLittleEndian( data+eocd-20UL, 4UL ) == 0x07064B50UL )
+   {
+      const size_t record( readLittleEndian( data+eocd-12UL, 8UL ) );
+
+      if( record > size || size - record < 56UL || readLittleEndian( data+record, 4UL ) != 0x06064B50UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+      }
+
+      count  = readLittleEndian( data+record+32UL, 8UL );
+      offset = readLittleEndian( data+record+48UL, 8UL );
+   }
+
+   // Reading the central directory (each entry requires at least 46 bytes)
+   entries_.reserve( min( count, size / 46UL ) );
+
+   for( size_t i=0UL; i<count; ++i )
+   {
+      if( offset > size || size - offset < 46UL || readLittleEndian( data+offset, 4UL ) != 0x02014B50UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+      }
+
+      const size_t nameLength   ( readLittleEndian( data+offset+28UL, 2UL ) );
+      const size_t extraLength  ( readLittleEndian( data+offset+30UL, 2UL ) );
+      const size_t commentLength( readLittleEndian( data+offset+32UL, 2UL ) );
+
+      if( size - offset - 46UL < nameLength + extraLength ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+      }
+
+      Entry entry;
+      entry.method = readLittleEndian( data+offset+10UL, 2UL );
+      entry.size   = readLittleEndian( data+offset+20UL, 4UL );
+      entry.offset = readLittleEndian( data+offset+42UL, 4UL );
+      entry.name.assign( reinterpret_cast<const char*>( data+offset+46UL ), nameLength );
+
+      // Reading the zip64 extended information
+      const byte_t* extra( data+offset+46UL+nameLength );
+      for( size_t pos=0UL; pos+4UL<=extraLength; )
+      {
+         const size_t id    ( readLittleEndian( extra+pos    , 2UL ) );
+         const size_t length( readLittleEndian( extra+pos+2UL, 2UL ) );
+
+         if( length > extraLength - pos - 4UL ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+         }
+
+         if( id == 0x0001UL ) {
+            size_t field( pos+4UL );
+            if( readLittleEndian( data+offset+24UL, 4UL ) == 0xFFFFFFFFUL && field+8UL <= pos+4UL+length ) {
+               field += 8UL;
+            }
+            if( entry.size == 0xFFFFFFFFUL && field+8UL <= pos+4UL+length ) {
+               entry.size = readLittleEndian( extra+field, 8UL );
+               field += 8UL;
+            }
+            if( entry.offset == 0xFFFFFFFFUL && field+8UL <= pos+4UL+length ) {
+               entry.offset = readLittleEndian( extra+field, 8UL );
+            }
+         }
+
+         pos += 4UL + length;
+      }
+
+      if( entry.name.size() > 4UL && entry.name.compare( entry.name.size()-4UL, 4UL, ".npy" ) == 0 ) {
+         entry.name.resize( entry.name.size()-4UL );
+      }
+
+      entries_.push_back( entry );
+
+      offset += 46UL + nameLength + extraLength + commentLength;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of arrays in the archive.
+//
+// \return The number of arrays in the archive.
+*/
+inline size_t NpzArchive::size() const noexcept
+{
+   return entries_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the names of all arrays in the archive.
+//
+// \return The names of all arrays in the archive.
+*/
+inline std::vector<std::string> NpzArchive::names() const
+{
+   std::vector<std::string> names;
+   names.reserve( entries_.size() );
+
+   for( const Entry& entry : entries_ ) {
+      names.push_back( entry.name );
+   }
+
+   return names;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the archive contains an array of the given name.
+//
+// \param name The name of the array.
+// \return \a true in case the archive contains the array, \a false if not.
+*/
+inline bool NpzArchive::contains( const std::string& name ) const noexcept
+{
+   return find( name ) != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MappingMode NpzArchive::mode() const noexcept
+{
+   return file_->mode();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given one-dimensional array of the archive into the given dense vector.
+//
+// \param name The name of the array.
+// \param dv The target dense vector.
+// \return void
+// \exception std::invalid_argument Invalid, compressed, or incompatible array.
+//
+// This function reads the given array into the given dense vector, which is resized accordingly
+// (see the readNpy() function for details).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void NpzArchive::read( const std::string& name, DenseVector<VT,TF>& dv ) const
+{
+   readNpyData( source( name ), ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given two-dimensional array of the archive into the given dense matrix.
+//
+// \param name The name of the array.
+// \param dm The target dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid, compressed, or incompatible array.
+//
+// This function reads the given array into the given dense matrix, which is resized accordingly
+// (see the readNpy() function for details).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void NpzArchive::read( const std::string& name, DenseMatrix<MT,SO>& dm ) const
+{
+   readNpyData( source( name ), ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the mapped .npy array of the given name.
+//
+// \param name The name of the array.
+// \return The mapped .npy array.
+// \exception std::invalid_argument Invalid or compressed array.
+*/
+inline NpySource NpzArchive::source( const std::string& name ) const
+{
+   const Entry* entry( find( name ) );
+
+   if( entry == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array name" );
+   }
+
+   if( entry->method != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Compressed .npz archives are not supported" );
+   }
+
+   const byte_t* data( file_->data() );
+   const size_t size( file_->size() );
+
+   if( entry->offset > size || size - entry->offset < 30UL ||
+       readLittleEndian( data+entry->offset, 4UL ) != 0x04034B50UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+   }
+
+   const size_t header( 30UL + readLittleEndian( data+entry->offset+26UL, 2UL )
+                             + readLittleEndian( data+entry->offset+28UL, 2UL ) );
+
+   if( size - entry->offset < header ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+   }
+
+   NpySource source;
+   source.file   = file_;
+   source.offset = entry->offset + header;
+   source.size   = entry->size;
+
+   if( source.size > size - source.offset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npz archive" );
+   }
+
+   return source;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the entry of the given name.
+//
+// \param name The name of the array.
+// \return Pointer to the entry or \a nullptr in case the archive does not contain the array.
+*/
+inline const NpzArchive::Entry* NpzArchive::find( const std::string& name ) const noexcept
+{
+   for( const Entry& entry : entries_ ) {
+      if( entry.name == name )
+         return &entry;
+   }
+   return nullptr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for NumPy .npz archives.
+// \ingroup math_serialization
+//
+// The NpzWriter class writes dense vectors and matrices as uncompressed .npz archive, which can
+// be loaded via \c numpy.load():
+
+   \code
+   blaze::DynamicMatrix<double> A( 100UL, 100UL );
+   blaze::DynamicVector<double> b( 100UL );
+   // ... Initialization
+
+   blaze::NpzWriter archive( "data.npz" );
+   archive.write( "A", A );
+   archive.write( "b", b );
+   archive.close();
+   \endcode
+
+// The elements of all arrays start at a 64-byte boundary within the archive, which allows to
+// use the arrays in place via NpyVector and NpyMatrix. The archive is completed by the close()
+// function or at the latest on destruction of the writer. The total size of the archive is
+// limited to 4 GiB.
+*/
+class NpzWriter
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline NpzWriter( const std::string& path );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~NpzWriter();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT, bool TF > inline void write( const std::string& name, const DenseVector<VT,TF>& dv );
+   template< typename MT, bool SO > inline void write( const std::string& name, const DenseMatrix<MT,SO>& dm );
+
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Array > inline void writeEntry( const std::string& name, const Array& array );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream out_;        //!< The output stream of the archive.
+   std::string directory_;    //!< The central directory of the archive.
+   size_t count_;             //!< The number of written arrays.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the .npz archive at the given path.
+//
+// \param path The path of the .npz archive.
+// \exception std::runtime_error The file could not be created.
+*/
+inline NpzWriter::NpzWriter( const std::string& path )
+   : out_( path.c_str(), std::ofstream::binary | std::ofstream::trunc )  // The output stream
+   , directory_()                                                      // The central directory
+   , count_( 0UL )                                                     // The number of arrays
+{
+   if( !out_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to create .npz archive" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor of NpzWriter.
+//
+// The destructor completes the archive in case the close() function has not been called.
+*/
+inline NpzWriter::~NpzWriter()
+{
+   try {
+      close();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector as one-dimensional array into the archive.
+//
+// \param name The name of the array (without the ".npy" extension).
+// \param dv The dense vector to be written.
+// \return void
+// \exception std::logic_error Invalid write to a closed archive.
+// \exception std::length_error Maximum size of the archive exceeded.
+// \exception std::runtime_error The archive could not be written.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void NpzWriter::write( const std::string& name, const DenseVector<VT,TF>& dv )
+{
+   writeEntry( name, ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix as two-dimensional array into the archive.
+//
+// \param name The name of the array (without the ".npy" extension).
+// \param dm The dense matrix to be written.
+// \return void
+// \exception std::logic_error Invalid write to a closed archive.
+// \exception std::length_error Maximum size of the archive exceeded.
+// \exception std::runtime_error The archive could not be written.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void NpzWriter::write( const std::string& name, const DenseMatrix<MT,SO>& dm )
+{
+   writeEntry( name, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Completes the archive by writing the central directory.
+//
+// \return void
+// \exception std::runtime_error The archive could not be written.
+//
+// After the archive has been closed, no further arrays can be written. Calling close() on a
+// closed archive has no effect.
+*/
+inline void NpzWriter::close()
+{
+   if( !out_.is_open() )
+      return;
+
+   const size_t offset( static_cast<size_t>( out_.tellp() ) );
+
+   std::string record;
+   writeLittleEndian( record, 0x06054B50UL, 4UL );        // End of central directory signature
+   writeLittleEndian( record, 0UL, 4UL );                 // Disk numbers
+   writeLittleEndian( record, count_, 2UL );              // Number of entries on this disk
+   writeLittleEndian( record, count_, 2UL );              // Total number of entries
+   writeLittleEndian( record, directory_.size(), 4UL );   // Size of the central directory
+   writeLittleEndian( record, offset, 4UL );              // Offset of the central directory
+   writeLittleEndian( record, 0UL, 2UL );                 // Comment length
+
+   out_.write( directory_.data(), static_cast<std::streamsize>( directory_.size() ) );
+   out_.write( record.data(), static_cast<std::streamsize>( record.size() ) );
+   out_.close();
+
+   if( !out_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write .npz archive" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given dense vector or matrix as uncompressed entry into the archive.
+//
+// \param name The name of the array (without the ".npy" extension).
+// \param array The dense vector or matrix to be written.
+// \return void
+// \exception std::logic_error Invalid write to a closed archive.
+// \exception std::length_error Maximum size of the archive exceeded.
+// \exception std::runtime_error The archive could not be written.
+//
+// The local header of the entry is padded via an extra field such that the array starts at a
+// 64-byte boundary. The checksum and the size of the entry are patched after the array has
+// been written.
+*/
+template< typename Array >  // Type of the dense vector or matrix
+inline void NpzWriter::writeEntry( const std::string& name, const Array& array )
+{
+   if( !out_.is_open() ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid write to a closed .npz archive" );
+   }
+
+   if( count_ == 0xFFFFUL ) {
+      BLAZE_THROW_LENGTH_ERROR( "Maximum number of arrays exceeded" );
+   }
+
+   const std::string filename( name + ".npy" );
+   const size_t offset( static_cast<size_t>( out_.tellp() ) );
+   const size_t padding( ( 64UL - ( offset + 30UL + filename.size() + 4UL ) % 64UL ) % 64UL );
+
+   std::string header;
+   writeLittleEndian( header, 0x04034B50UL, 4UL );        // Local file header signature
+   writeLittleEndian( header, 20UL, 2UL );                // Version needed to extract
+   writeLittleEndian( header, 0UL, 2UL );                 // General purpose flags
+   writeLittleEndian( header, 0UL, 2UL );                 // Compression method (stored)
+   writeLittleEndian( header, 0UL, 2UL );                 // Modification time
+   writeLittleEndian( header, 0x21UL, 2UL );              // Modification date (1980-01-01)
+   writeLittleEndian( header, 0UL, 4UL );                 // CRC-32 (patched)
+   writeLittleEndian( header, 0UL, 4UL );                 // Compressed size (patched)
+   writeLittleEndian( header, 0UL, 4UL );                 // Uncompressed size (patched)
+   writeLittleEndian( header, filename.size(), 2UL );     // File name length
+   writeLittleEndian( header, padding+4UL, 2UL );         // Extra field length
+   header += filename;
+   writeLittleEndian( header, 0xD935UL, 2UL );            // Alignment extra field
+   writeLittleEndian( header, padding, 2UL );
+   header.append( padding, '\0' );
+
+   out_.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+
+   uint32_t crc( 0U );
+   std::ofstream& out( out_ );
+
+   const size_t size( writeNpyData( array, [&out,&crc]( const byte_t* ptr, size_t n ) {
+      crc = updateCRC32( crc, ptr, n );
+      out.write( reinterpret_cast<const char*>( ptr ), static_cast<std::streamsize>( n ) );
+   } ) );
+
+   if( offset + header.size() + size > 0xFFFFFFFFUL ) {
+      out_.close();
+      BLAZE_THROW_LENGTH_ERROR( "Maximum size of .npz archive exceeded" );
+   }
+
+   const std::streampos end( out_.tellp() );
+
+   std::string patch;
+   writeLittleEndian( patch, crc, 4UL );
+   writeLittleEndian( patch, size, 4UL );
+   writeLittleEndian( patch, size, 4UL );
+
+   out_.seekp( static_cast<std::streamoff>( offset + 14UL ) );
+   out_.write( patch.data(), static_cast<std::streamsize>( patch.size() ) );
+   out_.seekp( end );
+
+   writeLittleEndian( directory_, 0x02014B50UL, 4UL );    // Central file header signature
+   writeLittleEndian( directory_, 20UL, 2UL );            // Version made by
+   writeLittleEndian( directory_, 20UL, 2UL );            // Version needed to extract
+   writeLittleEndian( directory_, 0UL, 2UL );             // General purpose flags
+   writeLittleEndian( directory_, 0UL, 2UL );             // Compression method (stored)
+   writeLittleEndian( directory_, 0UL, 2UL );             // Modification time
+   writeLittleEndian( directory_, 0x21UL, 2UL );          // Modification date (1980-01-01)
+   directory_ += patch;                                   // CRC-32 and sizes
+   writeLittleEndian( directory_, filename.size(), 2UL ); // File name length
+   writeLittleEndian( directory_, 0UL, 2UL );             // Extra field length
+   writeLittleEndian( directory_, 0UL, 2UL );             // Comment length
+   writeLittleEndian( directory_, 0UL, 4UL );             // Disk number and internal attributes
+   writeLittleEndian( directory_, 0UL, 4UL );             // External attributes
+   writeLittleEndian( directory_, offset, 4UL );          // Offset of the local header
+   directory_ += filename;
+
+   ++count_;
+
+   if( !out_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write .npz archive" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,705 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/SparseEncoding.h
+//  \brief Header file for the compressed encoding of serialized sparse matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_SPARSEENCODING_H_
+#define _BLAZE_MATH_SERIALIZATION_SPARSEENCODING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE ENCODING FLAGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Encoding of the elements of serialized sparse matrices.
+// \ingroup math_serialization
+//
+// The SparseEncoding flags select the representation of the non-zero elements of sparse matrices
+// within an archive (see the serialize() function):
+//
+//  - \a plainEncoding: Every non-zero element is stored as full index plus value. This is the
+//    default encoding, which results in archives of version 1.
+//  - \a deltaEncoding: The number of non-zero elements of every row (or column) and the gaps
+//    between the indices of consecutive non-zero elements are stored as variable-length
+//    integers. Matrices whose non-zero elements are all 1 are stored without any values,
+//    0/1 matrices as bitmask, and matrices with at most 256 distinct values via a value
+//    dictionary. This encoding results in archives of version 2.
+*/
+enum SparseEncoding
+{
+   plainEncoding = 0,  //!< Index/value pairs.
+   deltaEncoding = 1   //!< Delta/varint encoded indices and dictionary/bitmask encoded values.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE ENCODING UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The representation of the values of a delta encoded sparse matrix.
+// \ingroup math_serialization
+*/
+enum SparseValueEncoding : uint8_t
+{
+   rawValues        = 0,  //!< All values are stored as they are.
+   unitValues       = 1,  //!< All values are 1 and are not stored.
+   bitmaskValues    = 2,  //!< All values are 0 or 1 and are stored as bitmask.
+   dictionaryValues = 3   //!< All values are stored as one byte index into a dictionary.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Number of rows (or columns) per independently encoded block of a delta encoded sparse matrix.
+constexpr size_t sparseEncodingBlockSize = 1024UL;
+
+//! Maximum number of entries of the value dictionary of a delta encoded sparse matrix.
+constexpr size_t sparseEncodingDictionarySize = 256UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends the given value as variable-length integer to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The target buffer.
+// \param value The value to be encoded.
+// \return void
+//
+// The value is stored in groups of 7 bits, starting with the least significant group. The most
+// significant bit of every byte indicates whether another byte follows.
+*/
+inline void encodeVarint( std::vector<uint8_t>& buffer, uint64_t value )
+{
+   while( value >= 0x80UL ) {
+      buffer.push_back( static_cast<uint8_t>( value | 0x80UL ) );
+      value >>= 7;
+   }
+   buffer.push_back( static_cast<uint8_t>( value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decodes a variable-length integer.
+// \ingroup math_serialization
+//
+// \param pos The current position within the buffer (updated to the end of the integer).
+// \param end The end of the buffer.
+// \param value The decoded value.
+// \return \a true in case a valid integer was decoded, \a false if not.
+*/
+inline bool decodeVarint( const uint8_t*& pos, const uint8_t* end, uint64_t& value ) noexcept
+{
+   value = 0UL;
+
+   for( size_t shift=0UL; shift<64UL; shift+=7UL ) {
+      if( pos == end )
+         return false;
+      const uint8_t byte( *pos++ );
+      value |= uint64_t( byte & 0x7FU ) << shift;
+      if( ( byte & 0x80U ) == 0U )
+         return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise comparison of two values.
+// \ingroup math_serialization
+//
+// The bitwise comparison guarantees a lossless encoding (e.g. of negative zeros and NaNs).
+*/
+template< typename Type >  // Data type of the values
+inline bool isBitwiseEqual( const Type& a, const Type& b ) noexcept
+{
+   return std::memcmp( &a, &b, sizeof( Type ) ) == 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise strict weak ordering of values for the value dictionary.
+// \ingroup math_serialization
+*/
+struct BitwiseLess
+{
+   template< typename Type >  // Data type of the values
+   inline bool operator()( const Type& a, const Type& b ) const noexcept {
+      return std::memcmp( &a, &b, sizeof( Type ) ) < 0;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of partitions for the parallel encoding or decoding of a sparse matrix.
+// \ingroup math_serialization
+//
+// \param blocks The number of blocks of the sparse matrix.
+// \param nonzeros The number of non-zero elements of the sparse matrix.
+// \return The number of partitions.
+*/
+inline size_t sparseEncodingPartitions( size_t blocks, size_t nonzeros )
+{
+   const bool parallel( nonzeros >= SMP_DVECASSIGN_THRESHOLD &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+
+   return ( parallel && blocks > 1UL )?( min( getNumThreads(), blocks ) ):( 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given function for all partitions of the given range.
+// \ingroup math_serialization
+//
+// \param partitions The number of partitions.
+// \param n The size of the range.
+// \param func The function to be called as \c func(partition,begin,end).
+// \return void
+//
+// The partitions are executed in parallel via smpForRange(). In case the function throws for
+// any partition, the first exception is rethrown after all partitions have been processed.
+*/
+template< typename Func >  // Type of the function
+void sparseEncodingFor( size_t partitions, size_t n, Func func )
+{
+   smpForRange( partitions, 2UL, [partitions,n,&func]( size_t begin, size_t end ) {
+      for( size_t p=begin; p<end; ++p ) {
+         func( p, ( n * p ) / partitions, ( n * ( p+1UL ) ) / partitions );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Properties of the values of a partition of a sparse matrix.
+// \ingroup math_serialization
+*/
+template< typename Type >  // Data type of the values
+struct SparseValueStats
+{
+   bool unit;                 //!< Flag for values that are all 1.
+   bool binary;               //!< Flag for values that are all 0 or 1.
+   bool dictionary;           //!< Flag for at most 256 distinct values.
+   std::vector<Type> values;  //!< The bitwise sorted distinct values.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the properties of the given range of values.
+// \ingroup math_serialization
+//
+// \param first Pointer to the first value.
+// \param last Pointer one past the last value.
+// \param stats The resulting properties.
+// \return void
+*/
+template< typename Type >  // Data type of the values
+void analyzeSparseValues( const Type* first, const Type* last, SparseValueStats<Type>& stats )
+{
+   const Type zero( 0 ), one( 1 );
+
+   stats.unit       = true;
+   stats.binary     = true;
+   stats.dictionary = true;
+
+   for( ; first!=last; ++first )
+   {
+      const bool isOne( isBitwiseEqual( *first, one ) );
+
+      stats.unit   = stats.unit && isOne;
+      stats.binary = stats.binary && ( isOne || isBitwiseEqual( *first, zero ) );
+
+      if( stats.dictionary ) {
+         const auto pos( std::lower_bound( stats.values.begin(), stats.values.end(), *first, BitwiseLess() ) );
+         if( pos == stats.values.end() || !isBitwiseEqual( *pos, *first ) ) {
+            if( stats.values.size() == sparseEncodingDictionarySize ) {
+               stats.dictionary = false;
+               stats.values.clear();
+            }
+            else stats.values.insert( pos, *first );
+         }
+      }
+      else if( !stats.binary ) {
+         break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given sparse matrix in the delta encoding to the given archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param sm The (evaluated) sparse matrix to be written.
+// \return void
+//
+// The rows (or columns in case of a column-major matrix) are split into blocks of 1024 rows,
+// which are encoded independently (and in parallel). For every row, the number of non-zero
+// elements and the gaps between the indices of consecutive non-zero elements are encoded as
+// variable-length integers. The encoding of the values is selected by the properties of all
+// values. The layout of the encoded matrix is
+
+   \code
+   uint8_t  value encoding
+   uint64_t block size
+   uint64_t number of blocks
+   uint64_t byte size and number of non-zero elements of each block
+   uint8_t  encoded indices of all blocks
+            encoded values
+   \endcode
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+void encodeSparseMatrix( Archive& archive, const SparseMatrix<MT,SO>& sm )
+{
+   using ET = ElementType_<MT>;
+
+   const MT& A( ~sm );
+
+   const size_t major ( IsRowMajorMatrix<MT>::value ? A.rows() : A.columns() );
+   const size_t blocks( ( major + sparseEncodingBlockSize - 1UL ) / sparseEncodingBlockSize );
+
+   std::vector<size_t> offsets( blocks+1UL, 0UL );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      size_t nonzeros( offsets[b] );
+      for( size_t i=b*sparseEncodingBlockSize; i<min( (b+1UL)*sparseEncodingBlockSize, major ); ++i ) {
+         nonzeros += A.nonZeros( i );
+      }
+      offsets[b+1UL] = nonzeros;
+   }
+
+   const size_t nonzeros  ( offsets[blocks] );
+   const size_t partitions( sparseEncodingPartitions( blocks, nonzeros ) );
+
+   std::vector< std::vector<uint8_t> > buffers( blocks );
+   std::vector<ET> values( nonzeros );
+   std::vector< SparseValueStats<ET> > stats( partitions );
+
+   // Encoding the indices and gathering the values
+   sparseEncodingFor( partitions, blocks, [&]( size_t p, size_t begin, size_t end )
+   {
+      for( size_t b=begin; b<end; ++b )
+      {
+         std::vector<uint8_t>& buffer( buffers[b] );
+         buffer.reserve( offsets[b+1UL] - offsets[b] + sparseEncodingBlockSize );
+
+         size_t k( offsets[b] );
+
+         for( size_t i=b*sparseEncodingBlockSize; i<min( (b+1UL)*sparseEncodingBlockSize, major ); ++i )
+         {
+            encodeVarint( buffer, A.nonZeros( i ) );
+
+            size_t next( 0UL );
+            for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+               encodeVarint( buffer, element->index() - next );
+               next = element->index() + 1UL;
+               values[k++] = element->value();
+            }
+         }
+      }
+
+      analyzeSparseValues( values.data() + offsets[begin], values.data() + offsets[end], stats[p] );
+   } );
+
+   // Selecting the encoding of the values
+   bool unit( true ), binary( true ), dictionary( true );
+   std::vector<ET> dict;
+
+   for( const SparseValueStats<ET>& s : stats )
+   {
+      unit       = unit && s.unit;
+      binary     = binary && s.binary;
+      dictionary = dictionary && s.dictionary;
+
+      if( dictionary ) {
+         std::vector<ET> merged;
+         std::set_union( dict.begin(), dict.end(), s.values.begin(), s.values.end(),
+                         std::back_inserter( merged ), BitwiseLess() );
+         dict.swap( merged );
+         dictionary = ( dict.size() <= sparseEncodingDictionarySize );
+      }
+   }
+
+   const SparseValueEncoding encoding(
+      ( unit )?( unitValues )
+              :( ( binary )?( bitmaskValues )
+                           :( ( dictionary && sizeof( ET ) > 1UL && nonzeros >= 4UL*dict.size() )
+                              ?( dictionaryValues ):( rawValues ) ) ) );
+
+   // Writing the encoded indices
+   archive << uint8_t( encoding ) << uint64_t( sparseEncodingBlockSize ) << uint64_t( blocks );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      archive << uint64_t( buffers[b].size() ) << uint64_t( offsets[b+1UL] - offsets[b] );
+   }
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      if( !buffers[b].empty() )
+         archive.write( buffers[b].data(), buffers[b].size() );
+   }
+
+   // Writing the encoded values
+   if( encoding == rawValues && nonzeros > 0UL )
+   {
+      archive.write( values.data(), nonzeros );
+   }
+   else if( encoding == bitmaskValues )
+   {
+      std::vector<uint8_t> bits( ( nonzeros + 7UL ) / 8UL, 0U );
+
+      sparseEncodingFor( partitions, bits.size(), [&]( size_t, size_t begin, size_t end ) {
+         const ET one( 1 );
+         for( size_t k=begin*8UL; k<min( end*8UL, nonzeros ); ++k ) {
+            if( isBitwiseEqual( values[k], one ) )
+               bits[k/8UL] |= static_cast<uint8_t>( 1U << ( k%8UL ) );
+         }
+      } );
+
+      if( !bits.empty() )
+         archive.write( bits.data(), bits.size() );
+   }
+   else if( encoding == dictionaryValues )
+   {
+      std::vector<uint8_t> codes( nonzeros );
+
+      sparseEncodingFor( partitions, nonzeros, [&]( size_t, size_t begin, size_t end ) {
+         for( size_t k=begin; k<end; ++k ) {
+            codes[k] = static_cast<uint8_t>(
+               std::lower_bound( dict.begin(), dict.end(), values[k], BitwiseLess() ) - dict.begin() );
+         }
+      } );
+
+      archive << uint64_t( dict.size() );
+      archive.write( dict.data(), dict.size() );
+      archive.write( codes.data(), codes.size() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decodes the indices of a single block of a delta encoded sparse matrix.
+// \ingroup math_serialization
+//
+// \param pos The beginning of the encoded block.
+// \param end The end of the encoded block.
+// \param first The first row (or column) of the block.
+// \param last One past the last row (or column) of the block.
+// \param minor The number of columns (or rows) of the matrix.
+// \param counts The number of non-zero elements of each row (or column).
+// \param indices The column (or row) indices of the non-zero elements of the block.
+// \param nonzeros The number of non-zero elements of the block.
+// \return \a true in case the block is valid, \a false if not.
+//
+// Gaps that are encoded in a single byte dominate for matrices with a dense structure (as for
+// instance adjacency matrices). Therefore eight gaps at a time are checked via a single 64-bit
+// operation and are decoded without any branch.
+*/
+inline bool decodeSparseBlock( const uint8_t* pos, const uint8_t* end, size_t first, size_t last,
+                               size_t minor, size_t* counts, size_t* indices, size_t nonzeros ) noexcept
+{
+   const size_t* const final( indices + nonzeros );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      uint64_t count( 0UL );
+
+      if( !decodeVarint( pos, end, count ) || count > size_t( final - indices ) )
+         return false;
+
+      counts[i] = count;
+
+      size_t next( 0UL );
+      size_t* const rowEnd( indices + count );
+
+      while( indices != rowEnd )
+      {
+         uint64_t word;
+
+         if( rowEnd - indices >= 8 && end - pos >= 8 &&
+             ( std::memcpy( &word, pos, 8UL ), ( word & 0x8080808080808080UL ) == 0UL ) )
+         {
+            for( size_t l=0UL; l<8UL; ++l ) {
+               next += pos[l];
+               indices[l] = next++;
+            }
+            if( next > minor )
+               return false;
+            pos     += 8;
+            indices += 8;
+            continue;
+         }
+
+         uint64_t gap( 0UL );
+
+         if( !decodeVarint( pos, end, gap ) || next > minor || gap >= minor - next )
+            return false;
+
+         next += gap;
+         *indices++ = next++;
+      }
+
+      if( next > minor )
+         return false;
+   }
+
+   return pos == end && indices == final;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a delta encoded sparse matrix from the given archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be read from.
+// \param sm The target compressed matrix.
+// \param rows The number of rows of the matrix.
+// \param columns The number of columns of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// The storage order of the target matrix must match the storage order of the encoded matrix.
+// The blocks are decoded in parallel and the compressed matrix is built in a single pass.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+void decodeSparseMatrix( Archive& archive, CompressedMatrix<Type,SO>& sm,
+                         size_t rows, size_t columns, size_t nonzeros )
+{
+   const size_t major( SO ? columns : rows );
+   const size_t minor( SO ? rows : columns );
+
+   uint8_t  encoding ( 0U  );
+   uint64_t blockSize( 0UL );
+   uint64_t blocks   ( 0UL );
+
+   if( !( archive >> encoding >> blockSize >> blocks ) || encoding > dictionaryValues ||
+       blockSize == 0UL || blocks != ( major + blockSize - 1UL ) / blockSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+
+   // Reading the encoded indices
+   std::vector<size_t> bytes( blocks+1UL, 0UL ), offsets( blocks+1UL, 0UL );
+
+   for( size_t b=0UL; b<blocks; ++b )
+   {
+      uint64_t size( 0UL ), count( 0UL );
+
+      if( !( archive >> size >> count ) || count > nonzeros - offsets[b] ||
+          size > 10UL*( blockSize + count ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      bytes  [b+1UL] = bytes  [b] + size;
+      offsets[b+1UL] = offsets[b] + count;
+   }
+
+   if( offsets[blocks] != nonzeros ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+
+   std::vector<uint8_t> stream( bytes[blocks] );
+
+   if( !stream.empty() && !archive.read( stream.data(), stream.size() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+
+   // Decoding the indices
+   const size_t partitions( sparseEncodingPartitions( blocks, nonzeros ) );
+
+   std::vector<size_t> counts( major, 0UL ), indices( nonzeros );
+   std::vector<uint8_t> valid( partitions, 1U );
+
+   sparseEncodingFor( partitions, blocks, [&]( size_t p, size_t begin, size_t end ) {
+      for( size_t b=begin; b<end && valid[p]; ++b ) {
+         valid[p] = decodeSparseBlock( stream.data() + bytes[b], stream.data() + bytes[b+1UL],
+                                       b*blockSize, min( (b+1UL)*blockSize, major ), minor,
+                                       counts.data(), indices.data() + offsets[b],
+                                       offsets[b+1UL] - offsets[b] );
+      }
+   } );
+
+   // Decoding the values
+   std::vector<Type> values;
+
+   if( encoding == rawValues )
+   {
+      values.resize( nonzeros );
+      if( nonzeros > 0UL && !archive.read( values.data(), nonzeros ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+   }
+   else if( encoding == unitValues )
+   {
+      values.assign( nonzeros, Type( 1 ) );
+   }
+   else if( encoding == bitmaskValues )
+   {
+      std::vector<uint8_t> bits( ( nonzeros + 7UL ) / 8UL );
+
+      if( !bits.empty() && !archive.read( bits.data(), bits.size() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      values.resize( nonzeros );
+
+      sparseEncodingFor( partitions, nonzeros, [&]( size_t, size_t begin, size_t end ) {
+         for( size_t k=begin; k<end; ++k ) {
+            values[k] = Type( ( bits[k/8UL] >> ( k%8UL ) ) & 1U );
+         }
+      } );
+   }
+   else
+   {
+      uint64_t size( 0UL );
+
+      if( !( archive >> size ) || size == 0UL || size > sparseEncodingDictionarySize ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      std::vector<Type> dict( size );
+      std::vector<uint8_t> codes( nonzeros );
+
+      if( !archive.read( dict.data(), size ) ||
+          ( nonzeros > 0UL && !archive.read( codes.data(), nonzeros ) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      values.resize( nonzeros );
+
+      sparseEncodingFor( partitions, nonzeros, [&]( size_t p, size_t begin, size_t end ) {
+         for( size_t k=begin; k<end; ++k ) {
+            if( codes[k] >= size ) {
+               valid[p] = 0U;
+               break;
+            }
+            values[k] = dict[codes[k]];
+         }
+      } );
+   }
+
+   if( std::find( valid.begin(), valid.end(), 0U ) != valid.end() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+
+   // Building the compressed matrix
+   CompressedMatrix<Type,SO> tmp( rows, columns, nonzeros );
+
+   for( size_t i=0UL, k=0UL; i<major; ++i ) {
+      for( const size_t kend=k+counts[i]; k<kend; ++k ) {
+         if( SO ) tmp.append( indices[k], i, values[k] );
+         else     tmp.append( i, indices[k], values[k] );
+      }
+      tmp.finalize( i );
+   }
+
+   sm.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
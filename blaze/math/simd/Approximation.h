@@ -0,0 +1,1330 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Approximation.h
+//  \brief Header file for the built-in SIMD approximation of transcendental functions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_APPROXIMATION_H_
+#define _BLAZE_MATH_SIMD_APPROXIMATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Primitive operations of the built-in SIMD approximations.
+// \ingroup simd
+//
+// The SIMDApproxTraits class template provides the elementary operations on a particular
+// intrinsic type \a T that are required by the built-in polynomial approximations of the
+// transcendental functions (see the SIMDApproximation class template) and by other branch-free
+// SIMD kernels. Besides the basic arithmetic operations this includes comparisons, blending,
+// round-to-nearest, and several bit manipulations of the IEEE 754 representation. The traits
+// are available whenever SSE2, AVX, or AVX-512 is enabled. Note that all operations assume
+// IEEE 754 semantics, i.e. the approximations must not be compiled with options such as
+// -ffast-math that permit the reassociation of floating point operations.
+*/
+template< typename T >  // Type of the intrinsic SIMD vector
+struct SIMDApproxTraits;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR SSE2
+//
+//=================================================================================================
+
+#if BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for SSE2 double precision vectors.
+// \ingroup simd
+*/
+template<>
+struct SIMDApproxTraits<double>
+{
+   using Type        = __m128d;  //!< Type of the intrinsic SIMD vector.
+   using ElementType = double;   //!< Type of the vector elements.
+   using Mask        = __m128d;  //!< Type of the comparison masks.
+
+   enum : size_t { size  = 2UL };
+   enum : bool   { fused = BLAZE_FMA_MODE };
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const double* p ) noexcept { return _mm_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, Type a ) noexcept { _mm_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm_sqrt_pd( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm_max_pd( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_fmadd_pd( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm_fmsub_pd( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_add_pd( _mm_mul_pd( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm_sub_pd( _mm_mul_pd( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type band   ( Type a, Type b ) noexcept { return _mm_and_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bor    ( Type a, Type b ) noexcept { return _mm_or_pd    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bxor   ( Type a, Type b ) noexcept { return _mm_xor_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept { return _mm_andnot_pd( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm_cmplt_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm_cmple_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm_cmpeq_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm_cmpneq_pd  ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm_cmpunord_pd( a, a ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return _mm_and_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return _mm_or_pd    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return _mm_andnot_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return _mm_movemask_pd( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+#if BLAZE_SSE4_MODE
+      return _mm_blendv_pd( b, a, m );
+#else
+      return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+#if BLAZE_SSE4_MODE
+      return _mm_round_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+      const __m128d sign ( _mm_and_pd( a, _mm_set1_pd( -0.0 ) ) );
+      const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );
+      const __m128d abs  ( _mm_xor_pd( a, sign ) );
+      const __m128d r    ( _mm_or_pd( _mm_sub_pd( _mm_add_pd( abs, magic ), magic ), sign ) );
+      const __m128d m    ( _mm_cmplt_pd( abs, magic ) );
+      return _mm_or_pd( _mm_and_pd( m, r ), _mm_andnot_pd( m, a ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      const __m128i bits( _mm_castpd_si128( _mm_add_pd( n, _mm_set1_pd( 4503599627371519.0 ) ) ) );
+      return _mm_castsi128_pd( _mm_slli_epi64( bits, 52 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m128d bits( _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a ), 52 ) ) );
+      return _mm_sub_pd( _mm_or_pd( bits, _mm_set1_pd( 4503599627370496.0 ) ),
+                         _mm_set1_pd( 4503599627371519.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m128d mask( _mm_castsi128_pd( _mm_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) );
+      return _mm_or_pd( _mm_and_pd( a, mask ), _mm_set1_pd( 1.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      const __m128i bits( _mm_castpd_si128( _mm_add_pd( q, _mm_set1_pd( 6755399441055744.0 ) ) ) );
+      return _mm_and_pd( _mm_castsi128_pd( _mm_slli_epi64( bits, 62 ) ), _mm_set1_pd( -0.0 ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for SSE2 single precision vectors.
+// \ingroup simd
+*/
+template<>
+struct SIMDApproxTraits<float>
+{
+   using Type        = __m128;   //!< Type of the intrinsic SIMD vector.
+   using ElementType = float;    //!< Type of the vector elements.
+   using Mask        = __m128;   //!< Type of the comparison masks.
+   using WideType    = __m128d;  //!< Type of the corresponding double precision vector.
+
+   enum : size_t { size  = 4UL };
+   enum : bool   { fused = BLAZE_FMA_MODE };
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const float* p ) noexcept { return _mm_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, Type a ) noexcept { _mm_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm_sqrt_ps( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm_max_ps( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_fmadd_ps( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm_fmsub_ps( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm_add_ps( _mm_mul_ps( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm_sub_ps( _mm_mul_ps( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type band   ( Type a, Type b ) noexcept { return _mm_and_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bor    ( Type a, Type b ) noexcept { return _mm_or_ps    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bxor   ( Type a, Type b ) noexcept { return _mm_xor_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept { return _mm_andnot_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm_cmplt_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm_cmple_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm_cmpeq_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm_cmpneq_ps  ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm_cmpunord_ps( a, a ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return _mm_and_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return _mm_or_ps    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return _mm_andnot_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return _mm_movemask_ps( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+#if BLAZE_SSE4_MODE
+      return _mm_blendv_ps( b, a, m );
+#else
+      return _mm_or_ps( _mm_and_ps( m, a ), _mm_andnot_ps( m, b ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+#if BLAZE_SSE4_MODE
+      return _mm_round_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+      const __m128 sign ( _mm_and_ps( a, _mm_set1_ps( -0.0F ) ) );
+      const __m128 magic( _mm_set1_ps( 8388608.0F ) );
+      const __m128 abs  ( _mm_xor_ps( a, sign ) );
+      const __m128 r    ( _mm_or_ps( _mm_sub_ps( _mm_add_ps( abs, magic ), magic ), sign ) );
+      const __m128 m    ( _mm_cmplt_ps( abs, magic ) );
+      return _mm_or_ps( _mm_and_ps( m, r ), _mm_andnot_ps( m, a ) );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      const __m128i bits( _mm_castps_si128( _mm_add_ps( n, _mm_set1_ps( 8388735.0F ) ) ) );
+      return _mm_castsi128_ps( _mm_slli_epi32( bits, 23 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m128 bits( _mm_castsi128_ps( _mm_srli_epi32( _mm_castps_si128( a ), 23 ) ) );
+      return _mm_sub_ps( _mm_or_ps( bits, _mm_set1_ps( 8388608.0F ) ), _mm_set1_ps( 8388735.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m128 mask( _mm_castsi128_ps( _mm_set1_epi32( 0x007FFFFF ) ) );
+      return _mm_or_ps( _mm_and_ps( a, mask ), _mm_set1_ps( 1.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      const __m128i bits( _mm_castps_si128( _mm_add_ps( q, _mm_set1_ps( 12582912.0F ) ) ) );
+      return _mm_and_ps( _mm_castsi128_ps( _mm_slli_epi32( bits, 30 ) ), _mm_set1_ps( -0.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE void widen( Type a, WideType& lo, WideType& hi ) noexcept {
+      lo = _mm_cvtps_pd( a );
+      hi = _mm_cvtps_pd( _mm_movehl_ps( a, a ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type narrow( WideType lo, WideType hi ) noexcept {
+      return _mm_movelh_ps( _mm_cvtpd_ps( lo ), _mm_cvtpd_ps( hi ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR AVX
+//
+//=================================================================================================
+
+#if BLAZE_AVX_MODE && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for AVX double precision vectors.
+// \ingroup simd
+//
+// In case AVX2 is not available, the integer operations are performed on the two 128-bit
+// halves of the vector.
+*/
+template<>
+struct SIMDApproxTraits<double>
+{
+   using Type        = __m256d;  //!< Type of the intrinsic SIMD vector.
+   using ElementType = double;   //!< Type of the vector elements.
+   using Mask        = __m256d;  //!< Type of the comparison masks.
+
+   enum : size_t { size  = 4UL };
+   enum : bool   { fused = BLAZE_FMA_MODE };
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm256_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const double* p ) noexcept { return _mm256_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, Type a ) noexcept { _mm256_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm256_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm256_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm256_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm256_sqrt_pd( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm256_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm256_max_pd( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_fmadd_pd( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm256_fmsub_pd( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_add_pd( _mm256_mul_pd( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm256_sub_pd( _mm256_mul_pd( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type band   ( Type a, Type b ) noexcept { return _mm256_and_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bor    ( Type a, Type b ) noexcept { return _mm256_or_pd    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bxor   ( Type a, Type b ) noexcept { return _mm256_xor_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept { return _mm256_andnot_pd( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_LT_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_LE_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_EQ_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_NEQ_UQ  ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm256_cmp_pd( a, a, _CMP_UNORD_Q ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return _mm256_and_pd   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return _mm256_or_pd    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return _mm256_andnot_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return _mm256_movemask_pd( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept { return _mm256_blendv_pd( b, a, m ); }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm256_round_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+
+   template< int S >
+   static BLAZE_ALWAYS_INLINE Type shiftLeft( Type a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( a ), S ) );
+#else
+      const __m128i lo( _mm_slli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( a ) ), S ) );
+      const __m128i hi( _mm_slli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( a, 1 ) ), S ) );
+      return _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ), _mm_castsi128_pd( hi ), 1 );
+#endif
+   }
+
+   template< int S >
+   static BLAZE_ALWAYS_INLINE Type shiftRight( Type a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a ), S ) );
+#else
+      const __m128i lo( _mm_srli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( a ) ), S ) );
+      const __m128i hi( _mm_srli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( a, 1 ) ), S ) );
+      return _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ), _mm_castsi128_pd( hi ), 1 );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      return shiftLeft<52>( _mm256_add_pd( n, _mm256_set1_pd( 4503599627371519.0 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      return _mm256_sub_pd( _mm256_or_pd( shiftRight<52>( a ), _mm256_set1_pd( 4503599627370496.0 ) ),
+                            _mm256_set1_pd( 4503599627371519.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m256d mask( _mm256_castsi256_pd( _mm256_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) );
+      return _mm256_or_pd( _mm256_and_pd( a, mask ), _mm256_set1_pd( 1.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      return _mm256_and_pd( shiftLeft<62>( _mm256_add_pd( q, _mm256_set1_pd( 6755399441055744.0 ) ) ),
+                            _mm256_set1_pd( -0.0 ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for AVX single precision vectors.
+// \ingroup simd
+//
+// In case AVX2 is not available, the integer operations are performed on the two 128-bit
+// halves of the vector.
+*/
+template<>
+struct SIMDApproxTraits<float>
+{
+   using Type        = __m256;   //!< Type of the intrinsic SIMD vector.
+   using ElementType = float;    //!< Type of the vector elements.
+   using Mask        = __m256;   //!< Type of the comparison masks.
+   using WideType    = __m256d;  //!< Type of the corresponding double precision vector.
+
+   enum : size_t { size  = 8UL };
+   enum : bool   { fused = BLAZE_FMA_MODE };
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm256_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const float* p ) noexcept { return _mm256_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, Type a ) noexcept { _mm256_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm256_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm256_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm256_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm256_sqrt_ps( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm256_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm256_max_ps( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_fmadd_ps( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm256_fmsub_ps( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_add_ps( _mm256_mul_ps( a, b ), c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm256_sub_ps( _mm256_mul_ps( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type band   ( Type a, Type b ) noexcept { return _mm256_and_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bor    ( Type a, Type b ) noexcept { return _mm256_or_ps    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bxor   ( Type a, Type b ) noexcept { return _mm256_xor_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept { return _mm256_andnot_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_LT_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_LE_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_NEQ_UQ  ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm256_cmp_ps( a, a, _CMP_UNORD_Q ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return _mm256_and_ps   ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return _mm256_or_ps    ( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return _mm256_andnot_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return _mm256_movemask_ps( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept { return _mm256_blendv_ps( b, a, m ); }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm256_round_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+
+   template< int S >
+   static BLAZE_ALWAYS_INLINE Type shiftLeft( Type a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( a ), S ) );
+#else
+      const __m128i lo( _mm_slli_epi32( _mm_castps_si128( _mm256_castps256_ps128( a ) ), S ) );
+      const __m128i hi( _mm_slli_epi32( _mm_castps_si128( _mm256_extractf128_ps( a, 1 ) ), S ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ), _mm_castsi128_ps( hi ), 1 );
+#endif
+   }
+
+   template< int S >
+   static BLAZE_ALWAYS_INLINE Type shiftRight( Type a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_ps( _mm256_srli_epi32( _mm256_castps_si256( a ), S ) );
+#else
+      const __m128i lo( _mm_srli_epi32( _mm_castps_si128( _mm256_castps256_ps128( a ) ), S ) );
+      const __m128i hi( _mm_srli_epi32( _mm_castps_si128( _mm256_extractf128_ps( a, 1 ) ), S ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ), _mm_castsi128_ps( hi ), 1 );
+#endif
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      return shiftLeft<23>( _mm256_add_ps( n, _mm256_set1_ps( 8388735.0F ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      return _mm256_sub_ps( _mm256_or_ps( shiftRight<23>( a ), _mm256_set1_ps( 8388608.0F ) ),
+                            _mm256_set1_ps( 8388735.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m256 mask( _mm256_castsi256_ps( _mm256_set1_epi32( 0x007FFFFF ) ) );
+      return _mm256_or_ps( _mm256_and_ps( a, mask ), _mm256_set1_ps( 1.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      return _mm256_and_ps( shiftLeft<30>( _mm256_add_ps( q, _mm256_set1_ps( 12582912.0F ) ) ),
+                            _mm256_set1_ps( -0.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE void widen( Type a, WideType& lo, WideType& hi ) noexcept {
+      lo = _mm256_cvtps_pd( _mm256_castps256_ps128( a ) );
+      hi = _mm256_cvtps_pd( _mm256_extractf128_ps( a, 1 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type narrow( WideType lo, WideType hi ) noexcept {
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo ) ), _mm256_cvtpd_ps( hi ), 1 );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR AVX-512
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for AVX-512 double precision
+//        vectors.
+// \ingroup simd
+//
+// The bitwise operations are based on the integer instructions of AVX-512F, i.e. AVX-512DQ
+// is not required. Several operations use the zero-masking form of the intrinsics with a full
+// mask, which avoids spurious uninitialized value warnings of some GCC versions.
+*/
+template<>
+struct SIMDApproxTraits<double>
+{
+   using Type        = __m512d;  //!< Type of the intrinsic SIMD vector.
+   using ElementType = double;   //!< Type of the vector elements.
+   using Mask        = __mmask8; //!< Type of the comparison masks.
+
+   enum : size_t { size  = 8UL };
+   enum : bool   { fused = true };
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm512_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const double* p ) noexcept { return _mm512_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, Type a ) noexcept { _mm512_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm512_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm512_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm512_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm512_sqrt_pd( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm512_maskz_min_pd( 0xFF, a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm512_maskz_max_pd( 0xFF, a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_pd( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm512_fmsub_pd( a, b, c ); }
+
+   static BLAZE_ALWAYS_INLINE Type band( Type a, Type b ) noexcept {
+      return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_pd( _mm512_or_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bxor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept {
+      return _mm512_castsi512_pd( _mm512_maskz_andnot_epi64( 0xFF, _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_LE_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_EQ_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_NEQ_UQ  ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm512_cmp_pd_mask( a, a, _CMP_UNORD_Q ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return static_cast<Mask>(  a & b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return static_cast<Mask>(  a | b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return static_cast<Mask>( ~a & b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept { return _mm512_mask_blend_pd( m, b, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm512_maskz_roundscale_pd( 0xFF, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      const __m512i bits( _mm512_castpd_si512( _mm512_add_pd( n, _mm512_set1_pd( 4503599627371519.0 ) ) ) );
+      return _mm512_castsi512_pd( _mm512_maskz_slli_epi64( 0xFF, bits, 52 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m512d bits( _mm512_castsi512_pd( _mm512_maskz_srli_epi64( 0xFF, _mm512_castpd_si512( a ), 52 ) ) );
+      return _mm512_sub_pd( bor( bits, _mm512_set1_pd( 4503599627370496.0 ) ),
+                            _mm512_set1_pd( 4503599627371519.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m512d mask( _mm512_castsi512_pd( _mm512_set1_epi64( 0x000FFFFFFFFFFFFFLL ) ) );
+      return bor( band( a, mask ), _mm512_set1_pd( 1.0 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      const __m512i bits( _mm512_castpd_si512( _mm512_add_pd( q, _mm512_set1_pd( 6755399441055744.0 ) ) ) );
+      return band( _mm512_castsi512_pd( _mm512_maskz_slli_epi64( 0xFF, bits, 62 ) ), _mm512_set1_pd( -0.0 ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproxTraits class template for AVX-512 single precision
+//        vectors.
+// \ingroup simd
+//
+// The bitwise operations are based on the integer instructions of AVX-512F, i.e. AVX-512DQ
+// is not required.
+*/
+template<>
+struct SIMDApproxTraits<float>
+{
+   using Type        = __m512;    //!< Type of the intrinsic SIMD vector.
+   using ElementType = float;     //!< Type of the vector elements.
+   using Mask        = __mmask16; //!< Type of the comparison masks.
+   using WideType    = __m512d;   //!< Type of the corresponding double precision vector.
+
+   enum : size_t { size  = 16UL };
+   enum : bool   { fused = true };
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm512_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type loadu( const float* p ) noexcept { return _mm512_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, Type a ) noexcept { _mm512_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm512_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm512_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm512_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sqrt( Type a         ) noexcept { return _mm512_sqrt_ps( a ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm512_maskz_min_ps( 0xFFFF, a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm512_maskz_max_ps( 0xFFFF, a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_ps( a, b, c ); }
+   static BLAZE_ALWAYS_INLINE Type fmsub( Type a, Type b, Type c ) noexcept { return _mm512_fmsub_ps( a, b, c ); }
+
+   static BLAZE_ALWAYS_INLINE Type band( Type a, Type b ) noexcept {
+      return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_ps( _mm512_or_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bxor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_ps( _mm512_xor_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type bandnot( Type a, Type b ) noexcept {
+      return _mm512_castsi512_ps( _mm512_maskz_andnot_epi32( 0xFFFF, _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask cmplt ( Type a, Type b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmple ( Type a, Type b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_LE_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpeq ( Type a, Type b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_EQ_OQ   ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpneq( Type a, Type b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_NEQ_UQ  ); }
+   static BLAZE_ALWAYS_INLINE Mask cmpnan( Type a         ) noexcept { return _mm512_cmp_ps_mask( a, a, _CMP_UNORD_Q ); }
+
+   static BLAZE_ALWAYS_INLINE Mask mand   ( Mask a, Mask b ) noexcept { return static_cast<Mask>(  a & b ); }
+   static BLAZE_ALWAYS_INLINE Mask mor    ( Mask a, Mask b ) noexcept { return static_cast<Mask>(  a | b ); }
+   static BLAZE_ALWAYS_INLINE Mask mandnot( Mask a, Mask b ) noexcept { return static_cast<Mask>( ~a & b ); }
+   static BLAZE_ALWAYS_INLINE bool any    ( Mask m         ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept { return _mm512_mask_blend_ps( m, b, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm512_maskz_roundscale_ps( 0xFFFF, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type pow2n( Type n ) noexcept {
+      const __m512i bits( _mm512_castps_si512( _mm512_add_ps( n, _mm512_set1_ps( 8388735.0F ) ) ) );
+      return _mm512_castsi512_ps( _mm512_maskz_slli_epi32( 0xFFFF, bits, 23 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m512 bits( _mm512_castsi512_ps( _mm512_maskz_srli_epi32( 0xFFFF, _mm512_castps_si512( a ), 23 ) ) );
+      return _mm512_sub_ps( bor( bits, _mm512_set1_ps( 8388608.0F ) ), _mm512_set1_ps( 8388735.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m512 mask( _mm512_castsi512_ps( _mm512_set1_epi32( 0x007FFFFF ) ) );
+      return bor( band( a, mask ), _mm512_set1_ps( 1.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type quadrantSign( Type q ) noexcept {
+      const __m512i bits( _mm512_castps_si512( _mm512_add_ps( q, _mm512_set1_ps( 12582912.0F ) ) ) );
+      return band( _mm512_castsi512_ps( _mm512_maskz_slli_epi32( 0xFFFF, bits, 30 ) ), _mm512_set1_ps( -0.0F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE void widen( Type a, WideType& lo, WideType& hi ) noexcept {
+      lo = _mm512_maskz_cvtps_pd( 0xFF, _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, _mm512_castps_pd( a ), 0 ) ) );
+      hi = _mm512_maskz_cvtps_pd( 0xFF, _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, _mm512_castps_pd( a ), 1 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type narrow( WideType lo, WideType hi ) noexcept {
+      const __m512d tmp( _mm512_castps_pd( _mm512_castps256_ps512( _mm512_maskz_cvtpd_ps( 0xFF, lo ) ) ) );
+      return _mm512_castpd_ps( _mm512_maskz_insertf64x4( 0xFF, tmp, _mm256_castps_pd( _mm512_maskz_cvtpd_ps( 0xFF, hi ) ), 1 ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SIMDAPPROXHELPER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary operations of the built-in SIMD approximations.
+// \ingroup simd
+//
+// The SIMDApproxHelper class template extends the primitive operations of the SIMDApproxTraits
+// class template by the operations that can be expressed independently of the particular
+// instruction set (polynomial evaluation, error-free transformations, ...).
+*/
+template< typename ET >  // Type of the vector elements
+struct SIMDApproxHelper
+   : public SIMDApproxTraits<ET>
+{
+   using Traits      = SIMDApproxTraits<ET>;   //!< Primitive operations.
+   using Type        = typename Traits::Type;  //!< Type of the intrinsic SIMD vector.
+   using ElementType = ET;                     //!< Type of the vector elements.
+
+   //**Absolute value******************************************************************************
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept {
+      return Traits::bandnot( Traits::set( ElementType(-0.0) ), a );
+   }
+   //**********************************************************************************************
+
+   //**Transfer of the sign************************************************************************
+   static BLAZE_ALWAYS_INLINE Type copysign( Type a, Type s ) noexcept {
+      const Type sign( Traits::set( ElementType(-0.0) ) );
+      return Traits::bor( Traits::bandnot( sign, a ), Traits::band( sign, s ) );
+   }
+   //**********************************************************************************************
+
+   //**Odd integral values*************************************************************************
+   static BLAZE_ALWAYS_INLINE typename Traits::Mask odd( Type q ) noexcept {
+      const Type h( Traits::mul( q, Traits::set( ElementType(0.5) ) ) );
+      return Traits::cmpneq( h, Traits::round( h ) );
+   }
+   //**********************************************************************************************
+
+   //**Horner scheme*******************************************************************************
+   /*!\brief Evaluation of the polynomial \f$ p x^n + c_1 x^{n-1} + \ldots + c_n \f$. */
+   static BLAZE_ALWAYS_INLINE Type horner( Type /*x*/, Type p ) noexcept {
+      return p;
+   }
+
+   template< typename... Cs >
+   static BLAZE_ALWAYS_INLINE Type horner( Type x, Type p, ElementType c, Cs... cs ) noexcept {
+      return horner( x, Traits::fmadd( p, x, Traits::set( c ) ), cs... );
+   }
+   //**********************************************************************************************
+
+   //**Error-free transformations******************************************************************
+   /*!\brief Computes \f$ s = fl(a+b) \f$ and the rounding error \a e such that \f$ a+b = s+e \f$. */
+   static BLAZE_ALWAYS_INLINE void twoSum( Type a, Type b, Type& s, Type& e ) noexcept {
+      s = Traits::add( a, b );
+      const Type bb( Traits::sub( s, a ) );
+      e = Traits::add( Traits::sub( a, Traits::sub( s, bb ) ), Traits::sub( b, bb ) );
+   }
+
+   /*!\brief Variant of twoSum() for \f$ |a| \geq |b| \f$. */
+   static BLAZE_ALWAYS_INLINE void fastTwoSum( Type a, Type b, Type& s, Type& e ) noexcept {
+      s = Traits::add( a, b );
+      e = Traits::sub( b, Traits::sub( s, a ) );
+   }
+
+   /*!\brief Computes the rounding error of the product \f$ p = fl(a \cdot b) \f$. */
+   static BLAZE_ALWAYS_INLINE Type productError( Type a, Type b, Type p ) noexcept {
+      return productError( a, b, p, BoolConstant<Traits::fused>() );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type productError( Type a, Type b, Type p, TrueType ) noexcept {
+      return Traits::fmsub( a, b, p );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type productError( Type a, Type b, Type p, FalseType ) noexcept {
+      const Type ah( split( a ) ), al( Traits::sub( a, ah ) );
+      const Type bh( split( b ) ), bl( Traits::sub( b, bh ) );
+      Type e( Traits::sub( Traits::mul( ah, bh ), p ) );
+      e = Traits::add( e, Traits::mul( ah, bl ) );
+      e = Traits::add( e, Traits::mul( al, bh ) );
+      return Traits::add( e, Traits::mul( al, bl ) );
+   }
+
+   /*!\brief Computes the upper half of the significand of \a a (Veltkamp splitting). */
+   static BLAZE_ALWAYS_INLINE Type split( Type a ) noexcept {
+      const ElementType factor( std::numeric_limits<ElementType>::digits == 53 ? 134217729.0 : 4097.0 );
+      const Type t( Traits::mul( a, Traits::set( factor ) ) );
+      return Traits::sub( t, Traits::sub( t, a ) );
+   }
+   //**********************************************************************************************
+
+   //**Scalar fallback*****************************************************************************
+   /*!\brief Elementwise evaluation of the given scalar function. */
+   template< typename F >
+   static inline Type map( Type a, F f ) {
+      ElementType tmp[Traits::size];
+      Traits::storeu( tmp, a );
+      for( size_t i=0UL; i<Traits::size; ++i )
+         tmp[i] = f( tmp[i] );
+      return Traits::loadu( tmp );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SIMDAPPROXIMATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD approximation of transcendental functions.
+// \ingroup simd
+//
+// The SIMDApproximation class template provides vectorized implementations of exp(), log(),
+// pow(), sin(), cos(), tanh(), and erf() for SIMD vectors with element type \a T. They are used
+// by the according SIMD functions in case the Intel SVML is not available (see the
+// \c BLAZE_SIMD_APPROXIMATION_MODE switch). All functions are based on a range reduction
+// followed by a minimax polynomial or rational approximation (Cody-Waite reduction and the
+// coefficients of the FDLIBM and Cephes libraries) and handle infinities, NaNs, and subnormal
+// numbers according to the C standard. Measured against the correctly rounded result, the
+// maximum errors are:
+
+   \f[\begin{array}{|l|c|c|l|}
+   \hline
+   Function & \mbox{double} & \mbox{float} & Remarks \\
+   \hline
+   exp()    & 2 ULP & 1 ULP & \mbox{double: 1 ULP with FMA} \\
+   log()    & 1 ULP & 1 ULP &  \\
+   pow()    & 2 ULP & 1 ULP &  \\
+   sin()    & 3 ULP & 3 ULP & \mbox{scalar fallback beyond } |x| = 10^5 \mbox{ (float: 8192)} \\
+   cos()    & 3 ULP & 3 ULP & \mbox{scalar fallback beyond } |x| = 10^5 \mbox{ (float: 8192)} \\
+   tanh()   & 2 ULP & 2 ULP &  \\
+   erf()    & 3 ULP & 1 ULP &  \\
+   \hline
+   \end{array}\f]
+
+// The single precision pow() and erf() functions are evaluated in double precision.
+*/
+template< typename T >  // Type of the vector elements
+struct SIMDApproximation;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DOUBLE PRECISION APPROXIMATIONS
+//
+//=================================================================================================
+
+#if BLAZE_SIMD_APPROXIMATION_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproximation class template for double precision vectors.
+// \ingroup simd
+*/
+template<>
+struct SIMDApproximation<double>
+   : public SIMDApproxHelper<double>
+{
+   //**exp() function******************************************************************************
+   /*!\brief Computes \f$ e^x \f$. */
+   static BLAZE_ALWAYS_INLINE Type exp( Type x ) noexcept {
+      return exp( x, set( 0.0 ) );
+   }
+
+   /*!\brief Computes \f$ e^{x+xl} \f$ for a small correction \a xl. */
+   static BLAZE_ALWAYS_INLINE Type exp( Type x, Type xl ) noexcept {
+      // Reduction to r = x - n*ln(2) with |r| <= ln(2)/2; results beyond the clamped range
+      // over- and underflow naturally
+      const Type xc( min( max( x, set( -746.0 ) ), set( 710.0 ) ) );
+      const Type n ( round( mul( xc, set( 1.4426950408889634 ) ) ) );
+      Type r( fmadd( n, set( -6.93147180369123816490E-01 ), xc ) );
+      r = add( fmadd( n, set( -1.90821492927058770002E-10 ), r ), xl );
+
+      // Taylor polynomial of degree 13 (truncation error below 2^-57)
+      const Type p( horner( r, set( 1.0/6227020800.0 ), 1.0/479001600.0, 1.0/39916800.0,
+                         1.0/3628800.0, 1.0/362880.0, 1.0/40320.0, 1.0/5040.0, 1.0/720.0,
+                         1.0/120.0, 1.0/24.0, 1.0/6.0, 0.5, 1.0, 1.0 ) );
+
+      // Scaling by 2^n in two steps to cover subnormal results
+      const Type n1( round( mul( n, set( 0.5 ) ) ) );
+      const Type y( mul( mul( p, pow2n( n1 ) ), pow2n( sub( n, n1 ) ) ) );
+
+      return select( cmpnan( x ), x, y );
+   }
+   //**********************************************************************************************
+
+   //**log() function******************************************************************************
+   /*!\brief Computes the natural logarithm \f$ \ln(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type log( Type x ) noexcept {
+      Type e, m;
+      decompose( x, e, m );
+
+      // log(m) = f - hfsq + s*(hfsq+R) with f = m - 1 and s = f/(2+f) (FDLIBM)
+      const Type f( sub( m, set( 1.0 ) ) );
+      const Type s( div( f, add( f, set( 2.0 ) ) ) );
+      const Type z( mul( s, s ) );
+      const Type R( series( z ) );
+      const Type hfsq( mul( set( 0.5 ), mul( f, f ) ) );
+
+      Type y( fmadd( s, add( hfsq, R ), mul( e, set( 1.90821492927058770002E-10 ) ) ) );
+      y = sub( mul( e, set( 6.93147180369123816490E-01 ) ), sub( sub( hfsq, y ), f ) );
+
+      y = select( cmplt( x, set( 0.0 ) ), set( std::numeric_limits<double>::quiet_NaN() ), y );
+      y = select( cmpeq( x, set( 0.0 ) ), set( -std::numeric_limits<double>::infinity() ), y );
+      y = select( cmpeq( x, set( std::numeric_limits<double>::infinity() ) ), x, y );
+      return select( cmpnan( x ), x, y );
+   }
+   //**********************************************************************************************
+
+   //**pow() function******************************************************************************
+   /*!\brief Computes \f$ x^y \f$. */
+   static BLAZE_ALWAYS_INLINE Type pow( Type x, Type y ) noexcept {
+      const Type ax( abs( x ) );
+
+      // Double-double evaluation of log|x| = e*ln(2) + 2*atanh(s) with s = (m-1)/(m+1)
+      Type e, m;
+      decompose( ax, e, m );
+
+      const Type num( sub( m, set( 1.0 ) ) );
+      Type den, denl;
+      twoSum( m, set( 1.0 ), den, denl );
+
+      const Type sh( div( num, den ) );
+      const Type p ( mul( sh, den ) );
+      const Type sl( div( sub( sub( sub( num, p ), productError( sh, den, p ) ), mul( sh, denl ) ), den ) );
+
+      // 2*atanh(s) - 2*s = s^3 * ( 2/3 + 2/5 s^2 + ... + 2/25 s^22 ) (truncation error below 2^-62)
+      const Type z  ( mul( sh, sh ) );
+      const Type s3 ( mul( sh, z ) );
+      const Type s3l( fmadd( sh, productError( sh, sh, z ), productError( sh, z, s3 ) ) );
+
+      Type c, cl;
+      twoSum( set( 2.0/3.0 ), mul( z, horner( z, set( 2.0/25.0 ), 2.0/23.0, 2.0/21.0, 2.0/19.0,
+                                              2.0/17.0, 2.0/15.0, 2.0/13.0, 2.0/11.0, 2.0/9.0,
+                                              2.0/7.0, 2.0/5.0 ) ), c, cl );
+      cl = add( cl, set( 3.700743415417188E-17 ) );
+
+      const Type th( mul( s3, c ) );
+      const Type tl( fmadd( s3, cl, fmadd( s3l, c, productError( s3, c, th ) ) ) );
+
+      Type a, al, lh, ll;
+      fastTwoSum( add( sh, sh ), th, a, al );
+      twoSum( mul( e, set( 6.93147180369123816490E-01 ) ), a, lh, ll );
+      ll = add( ll, add( add( al, fmadd( add( z, z ), sl, tl ) ),
+                         fmadd( e, set( 1.90821492927058770002E-10 ), add( sl, sl ) ) ) );
+      fastTwoSum( lh, ll, lh, ll );
+
+      lh = select( cmpeq( ax, set( 0.0 ) ), set( -std::numeric_limits<double>::infinity() ), lh );
+      lh = select( cmpeq( ax, set( std::numeric_limits<double>::infinity() ) ), ax, lh );
+      lh = select( cmpnan( ax ), ax, lh );
+
+      // Double-double product y*log|x|
+      const Type ph( mul( y, lh ) );
+      Type pl( fmadd( y, ll, productError( y, lh, ph ) ) );
+      pl = select( cmplt( abs( ph ), set( 1024.0 ) ), pl, set( 0.0 ) );
+
+      Type r( exp( ph, pl ) );
+
+      // Special cases according to the C standard
+      const Type hy( mul( y, set( 0.5 ) ) );
+      const Mask yint( mor( cmpeq( round( y ), y ), cmple( set( 4503599627370496.0 ), abs( y ) ) ) );
+      const Mask yodd( mandnot( cmpeq( round( hy ), hy ), mand( yint, cmplt( abs( y ), set( 9007199254740992.0 ) ) ) ) );
+      const Mask xneg( mand( cmplt( x, set( 0.0 ) ), cmplt( set( -std::numeric_limits<double>::infinity() ), x ) ) );
+
+      r = select( cmpeq( ax, set( 1.0 ) ), set( 1.0 ), r );
+      r = select( mandnot( yint, xneg ), set( std::numeric_limits<double>::quiet_NaN() ), r );
+      r = bxor( r, select( yodd, band( x, set( -0.0 ) ), set( 0.0 ) ) );
+      return select( mor( cmpeq( y, set( 0.0 ) ), cmpeq( x, set( 1.0 ) ) ), set( 1.0 ), r );
+   }
+   //**********************************************************************************************
+
+   //**sin() function******************************************************************************
+   /*!\brief Computes the sine \f$ \sin(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type sin( Type x ) noexcept {
+      if( any( cmplt( set( 1E5 ), abs( x ) ) ) )
+         return map( x, []( double v ){ return std::sin( v ); } );
+
+      Type q, r;
+      reduce( x, q, r );
+      return bxor( select( odd( q ), cosk( r ), sink( r ) ), quadrantSign( q ) );
+   }
+   //**********************************************************************************************
+
+   //**cos() function******************************************************************************
+   /*!\brief Computes the cosine \f$ \cos(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type cos( Type x ) noexcept {
+      if( any( cmplt( set( 1E5 ), abs( x ) ) ) )
+         return map( x, []( double v ){ return std::cos( v ); } );
+
+      Type q, r;
+      reduce( x, q, r );
+      return bxor( select( odd( q ), sink( r ), cosk( r ) ), quadrantSign( add( q, set( 1.0 ) ) ) );
+   }
+   //**********************************************************************************************
+
+   //**tanh() function*****************************************************************************
+   /*!\brief Computes the hyperbolic tangent \f$ \tanh(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type tanh( Type x ) noexcept {
+      const Type ax( abs( x ) );
+      const Type z ( mul( x, x ) );
+
+      // Rational approximation for |x| < 0.625 (Cephes)
+      const Type ys( fmadd( mul( x, z ),
+                         div( horner( z, set( -9.64399179425052238628E-1 ), -9.92877231001918586564E1,
+                                      -1.61468768441708447952E3 ),
+                              horner( z, set( 1.0 ), 1.12811678491632931402E2, 2.23548839060100448583E3,
+                                      4.84406305325125486048E3 ) ), x ) );
+
+      // tanh(x) = 1 - 2/(exp(2x)+1) for |x| >= 0.625
+      const Type yl( sub( set( 1.0 ), div( set( 2.0 ), add( exp( add( ax, ax ) ), set( 1.0 ) ) ) ) );
+
+      return copysign( select( cmplt( ax, set( 0.625 ) ), ys, yl ), x );
+   }
+   //**********************************************************************************************
+
+   //**erf() function******************************************************************************
+   /*!\brief Computes the error function \f$ \mbox{erf}(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type erf( Type x ) noexcept {
+      const Type ax( abs( x ) );
+      const Type z ( mul( x, x ) );
+
+      // Rational approximation for |x| < 1 (Cephes)
+      const Type ys( div( mul( x, horner( z, set( 9.60497373987051638749E0 ), 9.00260197203842689217E1,
+                                       2.23200534594684319226E3, 7.00332514112805075473E3,
+                                       5.55923013010394962768E4 ) ),
+                       horner( z, set( 1.0 ), 3.35617141647503099647E1, 5.21357949780152679795E2,
+                               4.59432382970980127987E3, 2.26290000613890934246E4,
+                               4.92673942608635921086E4 ) ) );
+
+      // erf(x) = 1 - erfc(x) for |x| >= 1, erfc(x) = exp(-x^2) P(x)/Q(x) (Cephes)
+      const Type a( min( ax, set( 6.0 ) ) );
+      const Type c( div( mul( exp( sub( set( 0.0 ), mul( a, a ) ) ),
+                           horner( a, set( 2.46196981473530512524E-10 ), 5.64189564831068821977E-1,
+                                   7.46321056442269912687E0, 4.86371970985681366614E1,
+                                   1.96520832956077098242E2, 5.26445194995477358631E2,
+                                   9.34528527171957607540E2, 1.02755188689515710272E3,
+                                   5.57535335369399327526E2 ) ),
+                      horner( a, set( 1.0 ), 1.32281951154744992508E1, 8.67072140885989742329E1,
+                              3.54937778887819891062E2, 9.75708501743205489753E2,
+                              1.82390916687909736289E3, 2.24633760818710981792E3,
+                              1.65666309194161350182E3, 5.57535340817727675546E2 ) ) );
+      const Type yl( copysign( sub( set( 1.0 ), c ), x ) );
+
+      return select( cmpnan( x ), x, select( cmplt( ax, set( 1.0 ) ), ys, yl ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Reduction for the logarithm*****************************************************************
+   /*!\brief Computes \a e and \a m such that \f$ x = 2^e m \f$ with \f$ m \in [\sqrt{2}/2,\sqrt{2}) \f$. */
+   static BLAZE_ALWAYS_INLINE void decompose( Type x, Type& e, Type& m ) noexcept {
+      const Mask tiny( cmplt( x, set( 2.2250738585072014E-308 ) ) );
+      const Type xs( select( tiny, mul( x, set( 18014398509481984.0 ) ), x ) );
+      e = sub( exponent( xs ), select( tiny, set( 54.0 ), set( 0.0 ) ) );
+      m = mantissa( xs );
+
+      const Mask big( cmplt( set( 1.4142135623730951 ), m ) );
+      m = select( big, mul( m, set( 0.5 ) ), m );
+      e = select( big, add( e, set( 1.0 ) ), e );
+   }
+   //**********************************************************************************************
+
+   //**Series of the logarithm*********************************************************************
+   /*!\brief Computes R(z) with \f$ \ln\frac{1+s}{1-s} = 2s + sR(s^2) \f$ (FDLIBM, error < 2^-58.45). */
+   static BLAZE_ALWAYS_INLINE Type series( Type z ) noexcept {
+      const Type w( mul( z, z ) );
+      const Type t1( mul( w, horner( w, set( 1.531383769920937332E-01 ), 2.222219843214978396E-01,
+                                  3.999999999940941908E-01 ) ) );
+      const Type t2( mul( z, horner( w, set( 1.479819860511658591E-01 ), 1.818357216161805012E-01,
+                                  2.857142874366239149E-01, 6.666666666666735130E-01 ) ) );
+      return add( t1, t2 );
+   }
+   //**********************************************************************************************
+
+   //**Reduction for the trigonometric functions***************************************************
+   /*!\brief Computes \a q and \a r such that \f$ x = q\pi/2 + r \f$ with \f$ |r| \leq \pi/4 \f$. */
+   static BLAZE_ALWAYS_INLINE void reduce( Type x, Type& q, Type& r ) noexcept {
+      q = round( mul( x, set( 6.36619772367581382433E-01 ) ) );
+      r = fmadd( q, set( -1.57079632673412561417E+00 ), x );
+      r = fmadd( q, set( -6.07710050630396597660E-11 ), r );
+      r = fmadd( q, set( -2.02226624871116645580E-21 ), r );
+   }
+   //**********************************************************************************************
+
+   //**Kernel functions of sin() and cos()*********************************************************
+   /*!\brief Sine on \f$ [-\pi/4,\pi/4] \f$ (FDLIBM, error < 2^-58). */
+   static BLAZE_ALWAYS_INLINE Type sink( Type r ) noexcept {
+      const Type z( mul( r, r ) );
+      return fmadd( mul( r, z ), horner( z, set( 1.58969099521155010221E-10 ), -2.50507602534068634195E-08,
+                                         2.75573137070700676789E-06, -1.98412698298579493134E-04,
+                                         8.33333333332248946124E-03, -1.66666666666666324348E-01 ), r );
+   }
+
+   /*!\brief Cosine on \f$ [-\pi/4,\pi/4] \f$ (FDLIBM, error < 2^-58). */
+   static BLAZE_ALWAYS_INLINE Type cosk( Type r ) noexcept {
+      const Type z ( mul( r, r ) );
+      const Type hz( mul( z, set( 0.5 ) ) );
+      const Type w ( sub( set( 1.0 ), hz ) );
+      const Type c ( horner( z, set( -1.13596475577881948265E-11 ), 2.08757232129817482790E-09,
+                          -2.75573143513906633035E-07, 2.48015872894767294178E-05,
+                          -1.38888888888741095749E-03, 4.16666666666666019037E-02 ) );
+      return add( w, fmadd( mul( z, z ), c, sub( sub( set( 1.0 ), w ), hz ) ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  SINGLE PRECISION APPROXIMATIONS
+//
+//=================================================================================================
+
+#if BLAZE_SIMD_APPROXIMATION_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDApproximation class template for single precision vectors.
+// \ingroup simd
+*/
+template<>
+struct SIMDApproximation<float>
+   : public SIMDApproxHelper<float>
+{
+   using Wide = SIMDApproximation<double>;  //!< Double precision approximations.
+
+   //**exp() function******************************************************************************
+   /*!\brief Computes \f$ e^x \f$. */
+   static BLAZE_ALWAYS_INLINE Type exp( Type x ) noexcept {
+      // Reduction to r = x - n*ln(2) with |r| <= ln(2)/2; results beyond the clamped range
+      // over- and underflow naturally
+      const Type xc( min( max( x, set( -104.0F ) ), set( 89.0F ) ) );
+      const Type n ( round( mul( xc, set( 1.44269504088896341F ) ) ) );
+      Type r( fmadd( n, set( -6.93359375E-1F ), xc ) );
+      r = fmadd( n, set( 2.12194440E-4F ), r );
+
+      // Minimax polynomial of degree 7 (Cephes)
+      const Type p( horner( r, set( 1.9875691500E-4F ), 1.3981999507E-3F, 8.3334519073E-3F,
+                         4.1665795894E-2F, 1.6666665459E-1F, 5.0000001201E-1F ) );
+      const Type e( add( fmadd( p, mul( r, r ), r ), set( 1.0F ) ) );
+
+      // Scaling by 2^n in two steps to cover subnormal results
+      const Type n1( round( mul( n, set( 0.5F ) ) ) );
+      const Type y( mul( mul( e, pow2n( n1 ) ), pow2n( sub( n, n1 ) ) ) );
+
+      return select( cmpnan( x ), x, y );
+   }
+   //**********************************************************************************************
+
+   //**log() function******************************************************************************
+   /*!\brief Computes the natural logarithm \f$ \ln(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type log( Type x ) noexcept {
+      const Mask tiny( cmplt( x, set( 1.17549435E-38F ) ) );
+      const Type xs( select( tiny, mul( x, set( 33554432.0F ) ), x ) );
+      Type e( sub( exponent( xs ), select( tiny, set( 25.0F ), set( 0.0F ) ) ) );
+      Type m( mantissa( xs ) );
+
+      const Mask big( cmplt( set( 1.41421356F ), m ) );
+      m = select( big, mul( m, set( 0.5F ) ), m );
+      e = select( big, add( e, set( 1.0F ) ), e );
+
+      // log(m) = f - hfsq + s*(hfsq+R) with f = m - 1 and s = f/(2+f) (FDLIBM)
+      const Type f( sub( m, set( 1.0F ) ) );
+      const Type s( div( f, add( f, set( 2.0F ) ) ) );
+      const Type z( mul( s, s ) );
+      const Type w( mul( z, z ) );
+      const Type R( add( mul( z, horner( w, set( 0.28498786688F ), 0.66666662693F ) ),
+                      mul( w, horner( w, set( 0.24279078841F ), 0.40000972152F ) ) ) );
+      const Type hfsq( mul( set( 0.5F ), mul( f, f ) ) );
+
+      Type y( fmadd( s, add( hfsq, R ), mul( e, set( 9.0580006145E-06F ) ) ) );
+      y = add( add( sub( y, hfsq ), f ), mul( e, set( 6.9313812256E-01F ) ) );
+
+      y = select( cmplt( x, set( 0.0F ) ), set( std::numeric_limits<float>::quiet_NaN() ), y );
+      y = select( cmpeq( x, set( 0.0F ) ), set( -std::numeric_limits<float>::infinity() ), y );
+      y = select( cmpeq( x, set( std::numeric_limits<float>::infinity() ) ), x, y );
+      return select( cmpnan( x ), x, y );
+   }
+   //**********************************************************************************************
+
+   //**pow() function******************************************************************************
+   /*!\brief Computes \f$ x^y \f$ (evaluated in double precision). */
+   static BLAZE_ALWAYS_INLINE Type pow( Type x, Type y ) noexcept {
+      WideType xl, xh, yl, yh;
+      widen( x, xl, xh );
+      widen( y, yl, yh );
+      return narrow( Wide::pow( xl, yl ), Wide::pow( xh, yh ) );
+   }
+   //**********************************************************************************************
+
+   //**sin() function******************************************************************************
+   /*!\brief Computes the sine \f$ \sin(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type sin( Type x ) noexcept {
+      if( any( cmplt( set( 8192.0F ), abs( x ) ) ) )
+         return map( x, []( float v ){ return std::sin( v ); } );
+
+      Type q, r;
+      reduce( x, q, r );
+      return bxor( select( odd( q ), cosk( r ), sink( r ) ), quadrantSign( q ) );
+   }
+   //**********************************************************************************************
+
+   //**cos() function******************************************************************************
+   /*!\brief Computes the cosine \f$ \cos(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type cos( Type x ) noexcept {
+      if( any( cmplt( set( 8192.0F ), abs( x ) ) ) )
+         return map( x, []( float v ){ return std::cos( v ); } );
+
+      Type q, r;
+      reduce( x, q, r );
+      return bxor( select( odd( q ), sink( r ), cosk( r ) ), quadrantSign( add( q, set( 1.0F ) ) ) );
+   }
+   //**********************************************************************************************
+
+   //**tanh() function*****************************************************************************
+   /*!\brief Computes the hyperbolic tangent \f$ \tanh(x) \f$. */
+   static BLAZE_ALWAYS_INLINE Type tanh( Type x ) noexcept {
+      const Type ax( abs( x ) );
+      const Type z ( mul( x, x ) );
+
+      // Polynomial approximation for |x| < 0.625 (Cephes)
+      const Type ys( fmadd( mul( x, z ), horner( z, set( -5.70498872745E-3F ), 2.06390887954E-2F,
+                                              -5.37397155531E-2F, 1.33314422036E-1F,
+                                              -3.33332819422E-1F ), x ) );
+
+      // tanh(x) = 1 - 2/(exp(2x)+1) for |x| >= 0.625
+      const Type yl( sub( set( 1.0F ), div( set( 2.0F ), add( exp( add( ax, ax ) ), set( 1.0F ) ) ) ) );
+
+      return copysign( select( cmplt( ax, set( 0.625F ) ), ys, yl ), x );
+   }
+   //**********************************************************************************************
+
+   //**erf() function******************************************************************************
+   /*!\brief Computes the error function \f$ \mbox{erf}(x) \f$ (evaluated in double precision). */
+   static BLAZE_ALWAYS_INLINE Type erf( Type x ) noexcept {
+      WideType lo, hi;
+      widen( x, lo, hi );
+      return narrow( Wide::erf( lo ), Wide::erf( hi ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Reduction for the trigonometric functions***************************************************
+   /*!\brief Computes \a q and \a r such that \f$ x = q\pi/2 + r \f$ with \f$ |r| \leq \pi/4 \f$. */
+   static BLAZE_ALWAYS_INLINE void reduce( Type x, Type& q, Type& r ) noexcept {
+      q = round( mul( x, set( 0.636619772367581343F ) ) );
+      r = fmadd( q, set( -1.5703125F ), x );
+      r = fmadd( q, set( -4.837512969970703125E-4F ), r );
+      r = fmadd( q, set( -7.549533620476722717E-8F ), r );
+      r = fmadd( q, set( -2.563344068257089592E-12F ), r );
+   }
+   //**********************************************************************************************
+
+   //**Kernel functions of sin() and cos()*********************************************************
+   /*!\brief Sine on \f$ [-\pi/4,\pi/4] \f$ (Cephes). */
+   static BLAZE_ALWAYS_INLINE Type sink( Type r ) noexcept {
+      const Type z( mul( r, r ) );
+      return fmadd( mul( r, z ), horner( z, set( -1.9515295891E-4F ), 8.3321608736E-3F,
+                                         -1.6666654611E-1F ), r );
+   }
+
+   /*!\brief Cosine on \f$ [-\pi/4,\pi/4] \f$ (Cephes). */
+   static BLAZE_ALWAYS_INLINE Type cosk( Type r ) noexcept {
+      const Type z( mul( r, r ) );
+      return fmadd( mul( z, z ), horner( z, set( 2.443315711809948E-5F ), -1.388731625493765E-3F,
+                                         4.166664568298827E-2F ),
+                    fmadd( z, set( -0.5F ), set( 1.0F ) ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Conversion.h
+//  \brief Header file for the SIMD conversion functionality
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SIMD_CONVERSION_H_
+#define _BLAZE_MATH_SIMD_CONVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Converts the lower half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision floating point values.
+// \return The vector of double precision values converted from the lower half of \a a.
+//
+// This function converts the first \a SIMDdouble::size elements of the given single precision
+// vector to double precision. The conversion is exact. This operation is only available for
+// SSE2, AVX, and AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE const SIMDdouble widenLow( const SIMDf32<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_cvtps_pd( 0xFF, _mm256_castpd_ps(
+      _mm512_maskz_extractf64x4_pd( 0xF, _mm512_castps_pd( (~a).eval().value ), 0 ) ) );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cvtps_pd( _mm256_castps256_ps128( (~a).eval().value ) );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cvtps_pd( (~a).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the upper half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision floating point values.
+// \return The vector of double precision values converted from the upper half of \a a.
+//
+// This function converts the last \a SIMDdouble::size elements of the given single precision
+// vector to double precision. The conversion is exact. This operation is only available for
+// SSE2, AVX, and AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE const SIMDdouble widenHigh( const SIMDf32<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return _mm512_maskz_cvtps_pd( 0xFF, _mm256_castpd_ps(
+      _mm512_maskz_extractf64x4_pd( 0xF, _mm512_castps_pd( (~a).eval().value ), 1 ) ) );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cvtps_pd( _mm256_extractf128_ps( (~a).eval().value, 1 ) );
+}
+#elif BLAZE_SSE2_MODE
+{
+   const __m128 v( (~a).eval().value );
+   return _mm_cvtps_pd( _mm_movehl_ps( v, v ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Converts two vectors of double precision values to a single precision vector.
+// \ingroup simd
+//
+// \param lo The vector of double precision values for the lower half of the result.
+// \param hi The vector of double precision values for the upper half of the result.
+// \return The vector of single precision values.
+//
+// This function rounds the elements of the two given double precision vectors to single
+// precision (according to the current rounding mode) and combines them into a single vector.
+// It is the inverse operation of the widenLow() and widenHigh() functions. This operation is
+// only available for SSE2, AVX, and AVX-512.
+*/
+template< typename T1    // Type of the lower operand
+        , typename T2 >  // Type of the upper operand
+BLAZE_ALWAYS_INLINE const SIMDfloat narrow( const SIMDf64<T1>& lo, const SIMDf64<T2>& hi ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   const __m512d l( _mm512_castps_pd( _mm512_castps256_ps512( _mm512_maskz_cvtpd_ps( 0xFF, (~lo).eval().value ) ) ) );
+   const __m256d h( _mm256_castps_pd( _mm512_maskz_cvtpd_ps( 0xFF, (~hi).eval().value ) ) );
+   return _mm512_castpd_ps( _mm512_maskz_insertf64x4( 0xFF, l, h, 1 ) );
+}
+#elif BLAZE_AVX_MODE
+{
+   const __m128 l( _mm256_cvtpd_ps( (~lo).eval().value ) );
+   const __m128 h( _mm256_cvtpd_ps( (~hi).eval().value ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( l ), h, 1 );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_movelh_ps( _mm_cvtpd_ps( (~lo).eval().value ), _mm_cvtpd_ps( (~hi).eval().value ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
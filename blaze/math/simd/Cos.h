@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/simd/Approximation.h>
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
@@ -60,7 +61,9 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. In case the SVML
+// is not available, the built-in SIMD approximation is used for SSE2, AVX, and AVX-512 (see
+// the \c BLAZE_SIMD_APPROXIMATION_MODE switch).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
@@ -76,6 +79,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 {
    return _mm_cos_ps( (~a).eval().value );
 }
+#elif BLAZE_SIMD_APPROXIMATION_MODE
+{
+   return SIMDApproximation<float>::cos( (~a).eval().value );
+}
 #else
 = delete;
 #endif
@@ -97,7 +104,9 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. In case the SVML
+// is not available, the built-in SIMD approximation is used for SSE2, AVX, and AVX-512 (see
+// the \c BLAZE_SIMD_APPROXIMATION_MODE switch).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
@@ -113,6 +122,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
 {
    return _mm_cos_pd( (~a).eval().value );
 }
+#elif BLAZE_SIMD_APPROXIMATION_MODE
+{
+   return SIMDApproximation<double>::cos( (~a).eval().value );
+}
 #else
 = delete;
 #endif
@@ -52,6 +52,7 @@
 #include <blaze/math/simd/Cbrt.h>
 #include <blaze/math/simd/Ceil.h>
 #include <blaze/math/simd/Conj.h>
+#include <blaze/math/simd/Conversion.h>
 #include <blaze/math/simd/Cos.h>
 #include <blaze/math/simd/Cosh.h>
 #include <blaze/math/simd/Division.h>
@@ -69,6 +70,7 @@
 #include <blaze/math/simd/Log.h>
 #include <blaze/math/simd/Log2.h>
 #include <blaze/math/simd/Log10.h>
+#include <blaze/math/simd/Madd.h>
 #include <blaze/math/simd/Max.h>
 #include <blaze/math/simd/Min.h>
 #include <blaze/math/simd/Multiplication.h>
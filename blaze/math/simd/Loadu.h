@@ -43,7 +43,9 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
@@ -409,6 +411,83 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat loadu( const complex<float>* address ) noex
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'bfloat16' values and converts them to 'float' values.
+// \ingroup simd
+//
+// \param address The first 'bfloat16' value to be loaded.
+// \return The loaded vector of converted 'float' values.
+//
+// This function loads \a SIMDfloat::size 'bfloat16' values and converts them to a vector of
+// 'float' values. The conversion is exact. The given address is not required to be properly
+// aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadu( const bfloat16* address ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512i tmp( _mm512_maskz_cvtepu16_epi32( 0xFFFF,
+      _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) ) ) );
+   return _mm512_castsi512_ps( _mm512_maskz_slli_epi32( 0xFFFF, tmp, 16 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256i tmp( _mm256_cvtepu16_epi32(
+      _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) ) );
+   return _mm256_castsi256_ps( _mm256_slli_epi32( tmp, 16 ) );
+#elif BLAZE_AVX_MODE
+   const __m128i zero( _mm_setzero_si128() );
+   const __m128i tmp ( _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( _mm_unpacklo_epi16( zero, tmp ) ) ),
+                                _mm_castsi128_ps( _mm_unpackhi_epi16( zero, tmp ) ), 1 );
+#elif BLAZE_SSE2_MODE
+   const __m128i tmp( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( address ) ) );
+   return _mm_castsi128_ps( _mm_unpacklo_epi16( _mm_setzero_si128(), tmp ) );
+#else
+   float tmp[SIMDfloat::size];
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      tmp[i] = address[i];
+   }
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float16' values and converts them to 'float' values.
+// \ingroup simd
+//
+// \param address The first 'float16' value to be loaded.
+// \return The loaded vector of converted 'float' values.
+//
+// This function loads \a SIMDfloat::size 'float16' values and converts them to a vector of
+// 'float' values. The conversion is exact. The given address is not required to be properly
+// aligned. The conversion is vectorized for AVX-512 and in case the F16C mode is active (see
+// the \c BLAZE_F16C_MODE switch).
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadu( const float16* address ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_cvtph_ps( 0xFFFF, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) ) );
+#elif BLAZE_F16C_MODE
+   return _mm256_cvtph_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) );
+#else
+   float tmp[SIMDfloat::size];
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      tmp[i] = address[i];
+   }
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -0,0 +1,139 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Madd.h
+//  \brief Header file for the SIMD multiply-add functionality for 16-bit integral values
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_MADD_H_
+#define _BLAZE_MATH_SIMD_MADD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  16-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of two vectors of 16-bit signed integral SIMD values and horizontal
+//        addition of adjacent pairs of the 32-bit intermediate results.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The vector of 32-bit sums of adjacent products.
+//
+// This function multiplies the 16-bit signed integral values of \a a and \a b and adds the
+// adjacent pairs of the resulting 32-bit products, i.e. element \a i of the result is given
+// by \f$ a_{2i}*b_{2i}+a_{2i+1}*b_{2i+1} \f$. The products are computed without any loss of
+// precision, the only case of overflow is the sum of two products of the value -32768. This
+// operation is only available for SSE2, AVX2, and AVX-512BW.
+*/
+BLAZE_ALWAYS_INLINE const SIMDint32
+   madd( const SIMDint16& a, const SIMDint16& b ) noexcept
+#if BLAZE_AVX512BW_MODE
+{
+   return _mm512_madd_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+= delete;
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_madd_epi16( (~a).value, (~b).value );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_madd_epi16( (~a).value, (~b).value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Accumulation of the pairwise multiply-add of two vectors of 16-bit signed integral
+//        SIMD values.
+// \ingroup simd
+//
+// \param c The vector of 32-bit accumulators.
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The updated vector of 32-bit accumulators.
+//
+// This function computes \f$ c_i+a_{2i}*b_{2i}+a_{2i+1}*b_{2i+1} \f$ for all elements of the
+// accumulator \a c. In case AVX512VNNI or AVXVNNI is available, the operation is performed by
+// a single dot product instruction, else it is composed of a multiply-add and an addition.
+// This operation is only available for SSE2, AVX2, and AVX-512BW.
+*/
+BLAZE_ALWAYS_INLINE const SIMDint32
+   madd( const SIMDint32& c, const SIMDint16& a, const SIMDint16& b ) noexcept
+#if BLAZE_AVX512BW_MODE && BLAZE_AVX512VNNI_MODE
+{
+   return _mm512_dpwssd_epi32( (~c).value, (~a).value, (~b).value );
+}
+#elif BLAZE_AVX512BW_MODE
+{
+   return _mm512_add_epi32( (~c).value, _mm512_madd_epi16( (~a).value, (~b).value ) );
+}
+#elif BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+= delete;
+#elif BLAZE_AVX2_MODE && BLAZE_AVXVNNI_MODE
+{
+   return _mm256_dpwssd_avx_epi32( (~c).value, (~a).value, (~b).value );
+}
+#elif BLAZE_AVX2_MODE
+{
+   return _mm256_add_epi32( (~c).value, _mm256_madd_epi16( (~a).value, (~b).value ) );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_add_epi32( (~c).value, _mm_madd_epi16( (~a).value, (~b).value ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
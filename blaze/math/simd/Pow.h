@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/simd/Approximation.h>
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
@@ -61,7 +62,9 @@ namespace blaze {
 // \param b The vector of single precision floating point exponents.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. In case the SVML
+// is not available, the built-in SIMD approximation is used for SSE2, AVX, and AVX-512 (see
+// the \c BLAZE_SIMD_APPROXIMATION_MODE switch).
 */
 template< typename T >  // Type of the operands
 BLAZE_ALWAYS_INLINE const SIMDfloat pow( const SIMDf32<T>& a, const SIMDf32<T>& b ) noexcept
@@ -77,6 +80,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat pow( const SIMDf32<T>& a, const SIMDf32<T>&
 {
    return _mm_pow_ps( (~a).eval().value, (~b).eval().value );
 }
+#elif BLAZE_SIMD_APPROXIMATION_MODE
+{
+   return SIMDApproximation<float>::pow( (~a).eval().value, (~b).eval().value );
+}
 #else
 = delete;
 #endif
@@ -99,7 +106,9 @@ BLAZE_ALWAYS_INLINE const SIMDfloat pow( const SIMDf32<T>& a, const SIMDf32<T>&
 // \param b The vector of double precision floating point exponents.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512. In case the SVML
+// is not available, the built-in SIMD approximation is used for SSE2, AVX, and AVX-512 (see
+// the \c BLAZE_SIMD_APPROXIMATION_MODE switch).
 */
 template< typename T >  // Type of the operands
 BLAZE_ALWAYS_INLINE const SIMDdouble pow( const SIMDf64<T>& a, const SIMDf64<T>& b ) noexcept
@@ -115,6 +124,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble pow( const SIMDf64<T>& a, const SIMDf64<T>&
 {
    return _mm_pow_pd( (~a).eval().value, (~b).eval().value );
 }
+#elif BLAZE_SIMD_APPROXIMATION_MODE
+{
+   return SIMDApproximation<double>::pow( (~a).eval().value, (~b).eval().value );
+}
 #else
 = delete;
 #endif
@@ -43,7 +43,9 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/StaticAssert.h>
@@ -407,6 +409,119 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+#if BLAZE_SSE2_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds four 'float' values to 'bfloat16' values (ties to even).
+// \ingroup simd
+//
+// \param value The vector of 'float' values to be rounded.
+// \return The bit patterns of the 'bfloat16' values, sign extended to 32-bit integral values.
+//
+// This auxiliary function rounds the given 'float' values to the nearest 'bfloat16' values and
+// converts NaN values to quiet NaN values. The bit patterns are sign extended such that they
+// can be narrowed via the signed saturating pack instructions.
+*/
+BLAZE_ALWAYS_INLINE __m128i roundToBFloat16( __m128 value ) noexcept
+{
+   const __m128i bits ( _mm_castps_si128( value ) );
+   const __m128i lsb  ( _mm_and_si128( _mm_srli_epi32( bits, 16 ), _mm_set1_epi32( 1 ) ) );
+   const __m128i round( _mm_add_epi32( _mm_add_epi32( bits, _mm_set1_epi32( 0x7FFF ) ), lsb ) );
+   const __m128i qnan ( _mm_or_si128( bits, _mm_set1_epi32( 0x00400000 ) ) );
+   const __m128i isnan( _mm_castps_si128( _mm_cmpunord_ps( value, value ) ) );
+
+   return _mm_srai_epi32( _mm_or_si128( _mm_and_si128( isnan, qnan ),
+                                        _mm_andnot_si128( isnan, round ) ), 16 );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'float' values as 'bfloat16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given vector of 'float' values to the nearest 'bfloat16' values
+// (ties to even) and stores them to the given address. The given address is not required to
+// be properly aligned.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( bfloat16* address, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512  tmp  ( (~value).eval().value );
+   const __m512i bits ( _mm512_castps_si512( tmp ) );
+   const __m512i lsb  ( _mm512_and_si512( _mm512_maskz_srli_epi32( 0xFFFF, bits, 16 ), _mm512_set1_epi32( 1 ) ) );
+   const __m512i round( _mm512_add_epi32( _mm512_add_epi32( bits, _mm512_set1_epi32( 0x7FFF ) ), lsb ) );
+   const __m512i qnan ( _mm512_or_si512( bits, _mm512_set1_epi32( 0x00400000 ) ) );
+   const __m512i res  ( _mm512_mask_mov_epi32( round, _mm512_cmp_ps_mask( tmp, tmp, _CMP_UNORD_Q ), qnan ) );
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ),
+                        _mm512_maskz_cvtepi32_epi16( 0xFFFF, _mm512_maskz_srli_epi32( 0xFFFF, res, 16 ) ) );
+#elif BLAZE_AVX_MODE
+   const __m256 tmp( (~value).eval().value );
+   const __m128i lo( roundToBFloat16( _mm256_castps256_ps128( tmp ) ) );
+   const __m128i hi( roundToBFloat16( _mm256_extractf128_ps( tmp, 1 ) ) );
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), _mm_packs_epi32( lo, hi ) );
+#elif BLAZE_SSE2_MODE
+   const __m128i tmp( roundToBFloat16( (~value).eval().value ) );
+   _mm_storel_epi64( reinterpret_cast<__m128i*>( address ), _mm_packs_epi32( tmp, tmp ) );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'float' values as 'float16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given vector of 'float' values to the nearest 'float16' values
+// (ties to even) and stores them to the given address. The given address is not required to
+// be properly aligned. The conversion is vectorized for AVX-512 and in case the F16C mode is
+// active (see the \c BLAZE_F16C_MODE switch).
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( float16* address, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ),
+                        _mm512_maskz_cvtps_ph( 0xFFFF, (~value).eval().value, _MM_FROUND_TO_NEAREST_INT ) );
+#elif BLAZE_F16C_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ),
+                     _mm256_cvtps_ph( (~value).eval().value, _MM_FROUND_TO_NEAREST_INT ) );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -0,0 +1,279 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Async.h
+//  \brief Header file for the asynchronous assignment functionality
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_SMP_ASYNC_H_
+#define _BLAZE_MATH_SMP_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/mpl/If.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#include <blaze/math/smp/openmp/Async.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/Async.h>
+#elif BLAZE_HPX_PARALLEL_MODE
+#include <blaze/math/smp/hpx/Async.h>
+#else
+#include <blaze/math/smp/default/Async.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the asynchronous execution of an assignment.
+// \ingroup smp
+//
+// The AsyncAssigner class template represents the task of an asynchronous assignment. It
+// performs the assignment within a serial section and reports the completion of the
+// assignment (or the exception thrown during the assignment) via a shared promise.
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+struct AsyncAssigner
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the target operand.
+   using TargetOperand = If_< IsExpression<Target>, Target, Target& >;
+
+   //! Composite type of the source operand.
+   using SourceOperand = If_< IsExpression<Source>, const Source, const Source& >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target operand to be assigned to.
+   // \param source The source operand to be assigned to the target.
+   */
+   explicit inline AsyncAssigner( Target& target, const Source& source )
+      : target_ ( target )  // The target operand
+      , source_ ( source )  // The source operand
+      , promise_( std::make_shared< std::promise<void> >() )  // The promise for the completion
+   {}
+   //**********************************************************************************************
+
+   //**Future function*****************************************************************************
+   /*!\brief Returns the future for the completion of the assignment.
+   //
+   // \return The future for the completion of the assignment.
+   */
+   inline std::future<void> future() {
+      return promise_->get_future();
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment between the two operands.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      try {
+         if( isSerialSectionActive() ) {
+            target_ = source_;
+         }
+         else BLAZE_SERIAL_SECTION {
+            target_ = source_;
+         }
+         promise_->set_value();
+      }
+      catch( ... ) {
+         promise_->set_exception( std::current_exception() );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   TargetOperand target_;  //!< The target operand.
+   SourceOperand source_;  //!< The source operand.
+   std::shared_ptr< std::promise<void> > promise_;  //!< The promise for the completion.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+std::future<void> asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (or vector expression) to be assigned.
+// \return The future for the completion of the assignment.
+// \exception std::invalid_argument Aliased asynchronous assignment.
+//
+// This function schedules the assignment of the given right-hand side vector (or vector
+// expression) to the given left-hand side vector for execution and returns immediately.
+// Via the returned future it is possible to wait for the completion of the assignment. Any
+// exception thrown during the assignment (as for instance due to a size mismatch) is rethrown
+// by the \c get() function of the future:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y, z;
+   // ... Resizing and initialization
+
+   std::future<void> f1 = blaze::asyncAssign( y, A * x );
+   std::future<void> f2 = blaze::asyncAssign( z, B * x );
+
+   // ... Independent work, as for instance I/O
+
+   f1.get();
+   f2.get();
+   \endcode
+
+// In case the C++11 or Boost thread-based parallelization is active, the assignment is executed
+// by a separate pool of asynchronous threads, in case the HPX-based parallelization is
+// active by an HPX thread, and in case the OpenMP-based parallelization is active by a separate
+// thread. Without shared memory parallelization the assignment is executed immediately. The
+// assignment itself is always performed serially (i.e. within a serial section). Thus several
+// independent asynchronous assignments run concurrently.
+//
+// The assignment is performed in-place. Therefore in case the right-hand side expression can
+// alias with the left-hand side vector in a way that would require an intermediate temporary
+// (as for instance in \c x = A * x), a \a std::invalid_argument exception is thrown. Note that
+// the left-hand side vector and all vectors and matrices referenced by the right-hand side
+// expression must remain alive and must not be modified until the assignment has completed.
+// Also note that the left-hand side vector must not be accessed until the assignment has
+// completed.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of the vectors
+        , typename VT2 >  // Type of the right-hand side vector
+std::future<void> asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~rhs).canAlias( &~lhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Aliased asynchronous assignment" );
+   }
+
+   AsyncAssigner<VT1,VT2> assigner( ~lhs, ~rhs );
+   std::future<void> future( assigner.future() );
+   smpLaunch( assigner );
+   return future;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (or matrix expression) to be assigned.
+// \return The future for the completion of the assignment.
+// \exception std::invalid_argument Aliased asynchronous assignment.
+//
+// This function schedules the assignment of the given right-hand side matrix (or matrix
+// expression) to the given left-hand side matrix for execution and returns immediately.
+// Via the returned future it is possible to wait for the completion of the assignment. Any
+// exception thrown during the assignment is rethrown by the \c get() function of the future:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+
+   std::future<void> f = blaze::asyncAssign( C, A * B );
+
+   D = A + B;  // Serial or parallel evaluation of an independent expression
+
+   f.get();
+   \endcode
+
+// The assignment is performed serially by a thread of the active shared memory parallelization
+// (see the vector overload for details). In case the right-hand side expression can alias with
+// the left-hand side matrix in a way that would require an intermediate temporary (as for
+// instance in \c A = A * B), a \a std::invalid_argument exception is thrown. Note that the
+// left-hand side matrix and all vectors and matrices referenced by the right-hand side
+// expression must remain alive and must not be modified until the assignment has completed.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).canAlias( &~lhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Aliased asynchronous assignment" );
+   }
+
+   AsyncAssigner<MT1,MT2> assigner( ~lhs, ~rhs );
+   std::future<void> future( assigner.future() );
+   smpLaunch( assigner );
+   return future;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,131 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ParallelFor.h
+//  \brief Header file for the parallel execution of independent tasks
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_SMP_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <vector>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#include <blaze/math/smp/openmp/ParallelFor.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/ParallelFor.h>
+#elif BLAZE_HPX_PARALLEL_MODE
+#include <blaze/math/smp/hpx/ParallelFor.h>
+#else
+#include <blaze/math/smp/default/ParallelFor.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL EXECUTION OF INDEX RANGES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of the given operation for contiguous parts of an index range.
+// \ingroup smp
+//
+// \param n The size of the index range.
+// \param threshold The minimum size of the index range for a parallel execution.
+// \param op The operation to be called as \c op(begin,end) for each part of the index range.
+// \return void
+//
+// This function splits the index range \f$[0..n)\f$ into one contiguous part per thread of the
+// active shared memory parallelization and calls the given operation for all parts in parallel,
+// each call within a serial section. The calls for different parts must be independent of each
+// other. In case the range is smaller than the given threshold or in case a serial or parallel
+// section is already active, the operation is called once for the entire range. In case any
+// call throws an exception, the exception of the first failing part is rethrown after all calls
+// have been completed.
+*/
+template< typename OP >  // Type of the operation
+void smpForRange( size_t n, size_t threshold, OP op )
+{
+   const bool parallel( n >= max( threshold, 2UL ) &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+
+   const size_t partitions( parallel ? min( getNumThreads(), n ) : 1UL );
+
+   if( partitions == 1UL ) {
+      op( 0UL, n );
+      return;
+   }
+
+   const size_t partSize( ( n + partitions - 1UL ) / partitions );
+   std::vector<std::exception_ptr> errors( partitions );
+
+   smpFor( partitions, [n,partSize,&op,&errors]( size_t partition )
+   {
+      BLAZE_SERIAL_SECTION
+      {
+         try {
+            const size_t begin( min( partition*partSize, n ) );
+            const size_t end  ( min( begin+partSize, n ) );
+            if( begin < end ) {
+               op( begin, end );
+            }
+         }
+         catch( ... ) {
+            errors[partition] = std::current_exception();
+         }
+      }
+   } );
+
+   for( const std::exception_ptr& error : errors ) {
+      if( error ) std::rethrow_exception( error );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
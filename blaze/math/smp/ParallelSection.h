@@ -40,7 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -58,7 +62,10 @@ namespace blaze {
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
 // It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// that serves as a utility for debugging the shared-memory parallelization. Since the activity
+// flag is thread-local, a parallel section only affects the thread of execution it is used in.
+// In case of the OpenMP parallelization the threads of the team executing an OpenMP parallel
+// region are also considered to be inside the parallel section (see isParallelSectionActive()).
 */
 template< typename T >
 class ParallelSection
@@ -89,10 +96,11 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the
+                                           currently executed code of the calling thread
+                                           is inside a parallel section), the flag is set
+                                           to \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +124,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+thread_local bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -209,10 +217,18 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// In case of the OpenMP parallelization the function also returns \a true for all threads
+// executing an OpenMP parallel region, since the worker threads of the team do not share the
+// thread-local activity flag of the thread that started the parallel section.
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelSection<int>::active_ || omp_in_parallel();
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
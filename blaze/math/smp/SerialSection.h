@@ -58,7 +58,8 @@ namespace blaze {
 //
 // The SerialSection class is an auxiliary helper class for the \a BLAZE_SERIAL_SECTION macro.
 // It provides the functionality to detect whether a serial section is active, i.e. if the
-// currently executed code is inside a serial section.
+// currently executed code is inside a serial section. Since the activity flag is thread-local,
+// a serial section only affects the thread of execution it is used in.
 */
 template< typename T >
 class SerialSection
@@ -89,10 +90,11 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static thread_local bool active_;  //!< Activity flag for the serial section.
+                                      /*!< In case a serial section is active (i.e. the
+                                           currently executed code of the calling thread
+                                           is inside a serial section), the flag is set
+                                           to \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +118,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+thread_local bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
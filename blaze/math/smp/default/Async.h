@@ -0,0 +1,71 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Async.h
+//  \brief Header file for the default asynchronous task execution
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS TASK EXECUTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the execution of an asynchronous task.
+// \ingroup smp
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function executes the given task of an asynchronous operation (see for instance the
+// asyncAssign() function). Since no shared memory parallelization is active, the task is
+// executed immediately by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the asynchronous
+// execution of operations. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the asyncAssign() function.
+*/
+template< typename Task >  // Type of the asynchronous task
+inline void smpLaunch( Task task )
+{
+   task();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,14 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -76,6 +79,13 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsDenseMatrix<MT1> >
    smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO >
+inline void smpInitialize( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& init );
+
+template< typename MT1, bool SO, typename MT2 >
+inline void smpInitialize( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO>& rhs,
+                           const ElementType_<MT1>& init );
 //@}
 //*************************************************************************************************
 
@@ -205,6 +215,67 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param init The initial value of all matrix elements.
+// \return void
+//
+// This function implements the default SMP initialization of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO >    // Storage order of the left-hand side dense matrix
+inline void smpInitialize( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   ~lhs = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP copy initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix providing the leading elements.
+// \param init The initial value of all remaining matrix elements.
+// \return void
+//
+// This function implements the default SMP copy initialization of a dense matrix. The leading
+// \f$ min(lhs.rows(),rhs.rows()) \times min(lhs.columns(),rhs.columns()) \f$ elements of \a lhs
+// are initialized with the corresponding elements of \a rhs, all remaining elements with the
+// given initial value.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO         // Storage order of both dense matrices
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void smpInitialize( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO>& rhs,
+                           const ElementType_<MT1>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( min( (~lhs).rows()   , (~rhs).rows()    ) );
+   const size_t n( min( (~lhs).columns(), (~rhs).columns() ) );
+
+   for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
+      for( size_t j=0UL; j<(~lhs).columns(); ++j ) {
+         (~lhs)(i,j) = ( i < m && j < n )?( (~rhs)(i,j) ):( init );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
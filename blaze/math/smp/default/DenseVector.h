@@ -40,14 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -80,6 +83,13 @@ inline EnableIf_< IsDenseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsDenseVector<VT1> >
    smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF >
+inline void smpInitialize( DenseVector<VT,TF>& lhs, const ElementType_<VT>& init );
+
+template< typename VT1, bool TF, typename VT2 >
+inline void smpInitialize( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs,
+                           const ElementType_<VT1>& init );
 //@}
 //*************************************************************************************************
 
@@ -229,6 +239,66 @@ inline EnableIf_< IsDenseVector<VT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param init The initial value of all vector elements.
+// \return void
+//
+// This function implements the default SMP initialization of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , bool TF >    // Transpose flag of the left-hand side dense vector
+inline void smpInitialize( DenseVector<VT,TF>& lhs, const ElementType_<VT>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   ~lhs = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP copy initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector providing the leading elements.
+// \param init The initial value of all remaining vector elements.
+// \return void
+//
+// This function implements the default SMP copy initialization of a dense vector. The leading
+// \f$ min(lhs.size(),rhs.size()) \f$ elements of \a lhs are initialized with the corresponding
+// elements of \a rhs, all remaining elements with the given initial value.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void smpInitialize( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs,
+                           const ElementType_<VT1>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( min( (~lhs).size(), (~rhs).size() ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      (~lhs)[i] = (~rhs)[i];
+   }
+   for( size_t i=n; i<(~lhs).size(); ++i ) {
+      (~lhs)[i] = init;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/Unused.h>
 
@@ -58,9 +60,12 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t getNumThreads    ();
+BLAZE_ALWAYS_INLINE void   setNumThreads    ( size_t number );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( AffinityPolicy policy );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( const std::vector<size_t>& cpus );
+BLAZE_ALWAYS_INLINE void   setThreadSpinTime( size_t time );
+BLAZE_ALWAYS_INLINE void   shutDownThreads  ();
 //@}
 //*************************************************************************************************
 
@@ -101,6 +106,60 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy.
+// \return void
+//
+// Via this function the placement of the threads used for thread parallel operations can be
+// specified (see blaze::AffinityPolicy). Note that in case no C++11 or Boost thread-based
+// parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   UNUSED_PARAMETER( policy );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs (empty for unpinned threads).
+// \return void
+//
+// Via this function the threads used for thread parallel operations can be pinned to the given
+// list of CPUs. Note that in case no C++11 or Boost thread-based parallelization is active,
+// the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   UNUSED_PARAMETER( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the spin time of idle threads for thread parallel operations.
+// \ingroup smp
+//
+// \param time The spin time in microseconds (0 for no spinning).
+// \return void
+//
+// Via this function the time the idle threads for thread parallel operations busily wait for
+// new tasks can be specified. Note that in case no C++11 or Boost thread-based parallelization
+// is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t time )
+{
+   UNUSED_PARAMETER( time );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -668,6 +668,175 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param op The initialization operation, called as \c op(target,index) for each part.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP initialization of a dense
+// vector. The vector is partitioned in the same way as by the SMP assignment and the parts are
+// statically distributed among the OpenMP threads, which initialize them via the given operation.
+// In combination with the \c OMP_PROC_BIND environment variable this distributes the memory
+// pages of the vector across NUMA nodes.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , bool TF        // Transpose flag of the left-hand side dense vector
+        , typename OP >  // Type of the initialization operation
+void openmpInitialize( DenseVector<VT,TF>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT> >::size );
+
+   const bool lhsAligned( (~lhs).isAligned() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+#pragma omp for schedule(static,1) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      if( simdEnabled && lhsAligned ) {
+         auto target( subvector<aligned>( ~lhs, index, size, unchecked ) );
+         op( target, index );
+      }
+      else {
+         auto target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
+         op( target, index );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param init The initial value of all vector elements.
+// \return void
+//
+// This function assigns the given initial value to all elements of the given dense vector. In
+// case the vector is SMP-assignable, is large enough for an SMP assignment and the function is
+// not called from within a parallel or serial section, the elements are initialized in parallel
+// by the OpenMP threads. Otherwise the vector is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , bool TF >    // Transpose flag of the left-hand side dense vector
+inline void smpInitialize( DenseVector<VT,TF>& lhs, const ElementType_<VT>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !IsSMPAssignable<VT>::value || IsSMPAssignable< ElementType_<VT> >::value ||
+       isParallelSectionActive() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+      ~lhs = init;
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( lhs, init )
+         openmpInitialize( ~lhs, [&init]( auto& target, size_t ) { target = init; } );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP copy initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector providing the leading elements.
+// \param init The initial value of all remaining vector elements.
+// \return void
+//
+// This function initializes the leading \f$ min(lhs.size(),rhs.size()) \f$ elements of the given
+// dense vector with the corresponding elements of \a rhs and all remaining elements with the
+// given initial value. The vector is partitioned in the same way as by smpInitialize() and each
+// element is written exactly once, i.e. each memory page is first touched by the OpenMP thread
+// that later works on it. In case the vector cannot be initialized in parallel, it is initialized
+// serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both dense vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void smpInitialize( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs,
+                           const ElementType_<VT1>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto op = [&rhs,&init]( auto& target, size_t index )
+   {
+      const size_t n( ( index < (~rhs).size() )
+                      ?( min( (~rhs).size() - index, target.size() ) )
+                      :( 0UL ) );
+
+      if( n > 0UL ) {
+         auto copied( subvector( target, 0UL, n, unchecked ) );
+         assign( copied, subvector( ~rhs, index, n, unchecked ) );
+      }
+      if( n < target.size() ) {
+         auto remaining( subvector( target, n, target.size() - n, unchecked ) );
+         remaining = init;
+      }
+   };
+
+   if( !IsSMPAssignable<VT1>::value || IsSMPAssignable< ElementType_<VT1> >::value ||
+       isParallelSectionActive() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+      op( ~lhs, 0UL );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+#pragma omp parallel shared( lhs, op )
+         openmpInitialize( ~lhs, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
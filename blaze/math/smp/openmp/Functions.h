@@ -40,12 +40,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Exception.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -100,6 +103,67 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy.
+// \return void
+//
+// Via this function the placement of the threads used for thread parallel operations can be
+// specified (see blaze::AffinityPolicy). Note that the placement of OpenMP threads is controlled
+// via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables and that therefore this
+// function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   UNUSED_PARAMETER( policy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs (empty for unpinned threads).
+// \return void
+//
+// Via this function the threads used for thread parallel operations can be pinned to the given
+// list of CPUs. Note that the placement of OpenMP threads is controlled via the \c OMP_PROC_BIND
+// and \c OMP_PLACES environment variables and that therefore this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   UNUSED_PARAMETER( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of idle threads for thread parallel operations.
+// \ingroup smp
+//
+// \param time The spin time in microseconds (0 for no spinning).
+// \return void
+//
+// Via this function the time the idle threads for thread parallel operations busily wait for
+// new tasks can be specified. Note that the waiting policy of OpenMP threads is controlled via
+// the \c OMP_WAIT_POLICY environment variable and that therefore this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t time )
+{
+   UNUSED_PARAMETER( time );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
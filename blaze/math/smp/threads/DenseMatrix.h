@@ -90,7 +90,9 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a dense matrix to a dense matrix.\n
+// of a dense matrix to a dense matrix. The \a i-th block of the matrix is always assigned by
+// the \a i-th thread of the backend system, i.e. repeated operations on the same data are
+// executed by the same (potentially pinned) threads.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -148,22 +150,22 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( i*threads.second+j, target, source, op );
          }
          else if( simdEnabled && lhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( i*threads.second+j, target, source, op );
          }
          else if( simdEnabled && rhsAligned ) {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( i*threads.second+j, target, source, op );
          }
          else {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( i*threads.second+j, target, source, op );
          }
       }
    }
@@ -230,7 +232,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
          auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( i*threads.second+j, target, source, op );
       }
    }
 
@@ -662,6 +664,200 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param op The initialization operation, called as \c op(target,row,column) for each block.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP initialization
+// of a dense matrix. The matrix is partitioned in the same way as by the SMP assignment and the
+// \a i-th block of the matrix is initialized by the \a i-th thread of the backend system. Thus
+// the memory pages of the matrix are first touched by the threads that later work on them.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , bool SO        // Storage order of the left-hand side dense matrix
+        , typename OP >  // Type of the initialization operation
+void threadInitialize( DenseMatrix<MT,SO>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT> >::size );
+
+   const bool lhsAligned( (~lhs).isAligned() );
+
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<threads.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~lhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+         if( simdEnabled && lhsAligned ) {
+            auto target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::execute( i*threads.second+j, [target,row,column,op]() mutable {
+               BLAZE_SERIAL_SECTION { op( target, row, column ); }
+            } );
+         }
+         else {
+            auto target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::execute( i*threads.second+j, [target,row,column,op]() mutable {
+               BLAZE_SERIAL_SECTION { op( target, row, column ); }
+            } );
+         }
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param init The initial value of all matrix elements.
+// \return void
+//
+// This function assigns the given initial value to all elements of the given dense matrix. In
+// case the matrix is SMP-assignable, is large enough for an SMP assignment and the function is
+// not called from within a parallel or serial section, the elements are initialized in parallel
+// by the threads of the backend system. Otherwise the matrix is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO >    // Storage order of the left-hand side dense matrix
+inline void smpInitialize( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !IsSMPAssignable<MT>::value || IsSMPAssignable< ElementType_<MT> >::value ||
+       isParallelSectionActive() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+      ~lhs = init;
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+         threadInitialize( ~lhs, [&init]( auto& target, size_t, size_t ) { target = init; } );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP copy initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix providing the leading elements.
+// \param init The initial value of all remaining matrix elements.
+// \return void
+//
+// This function initializes the leading \f$ min(lhs.rows(),rhs.rows()) \times
+// min(lhs.columns(),rhs.columns()) \f$ elements of the given dense matrix with the corresponding
+// elements of \a rhs and all remaining elements with the given initial value. The matrix is
+// partitioned in the same way as by smpInitialize() and each element is written exactly once,
+// i.e. each memory page is first touched by the thread of the backend system that later works
+// on it. In case the matrix cannot be initialized in parallel, it is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO         // Storage order of both dense matrices
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void smpInitialize( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO>& rhs,
+                           const ElementType_<MT1>& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto op = [&rhs,&init]( auto& target, size_t row, size_t column )
+   {
+      const size_t m( ( row < (~rhs).rows() )
+                      ?( min( (~rhs).rows() - row, target.rows() ) )
+                      :( 0UL ) );
+      const size_t n( ( column < (~rhs).columns() )
+                      ?( min( (~rhs).columns() - column, target.columns() ) )
+                      :( 0UL ) );
+
+      if( m > 0UL && n > 0UL ) {
+         auto copied( submatrix( target, 0UL, 0UL, m, n, unchecked ) );
+         assign( copied, submatrix( ~rhs, row, column, m, n, unchecked ) );
+      }
+      if( m > 0UL && n < target.columns() ) {
+         auto remaining( submatrix( target, 0UL, n, m, target.columns() - n, unchecked ) );
+         remaining = init;
+      }
+      if( m < target.rows() ) {
+         auto remaining( submatrix( target, m, 0UL, target.rows() - m, target.columns(),
+                                    unchecked ) );
+         remaining = init;
+      }
+   };
+
+   if( !IsSMPAssignable<MT1>::value || IsSMPAssignable< ElementType_<MT1> >::value ||
+       isParallelSectionActive() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+      op( ~lhs, 0UL, 0UL );
+   }
+   else {
+      BLAZE_PARALLEL_SECTION
+      {
+         threadInitialize( ~lhs, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
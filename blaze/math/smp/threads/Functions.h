@@ -40,11 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <blaze/math/Exception.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -98,6 +101,87 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy.
+// \return void
+//
+// Via this function the placement of the threads used for thread parallel operations can be
+// specified (see blaze::AffinityPolicy). The initial placement can be specified via the
+// \c BLAZE_THREAD_AFFINITY environment variable. Note that the dense SMP assignments always
+// assign the same part of an operation to the same thread. Therefore in combination with
+// pinned threads, repeated operations on the same data are executed on the same CPUs. Also
+// note that thread pinning is currently only supported on Linux.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   TheThreadBackend::setAffinity( threadpool::affinityCPUs( policy ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The list of CPUs (empty for unpinned threads).
+// \return void
+// \exception std::invalid_argument Invalid CPU.
+//
+// Via this function the threads used for thread parallel operations can be pinned to the given
+// list of CPUs: the thread with index \a i is pinned to the CPU \f$ cpus[i \% cpus.size()] \f$.
+// In case the list is empty, the threads are unpinned. In case the list contains a CPU that
+// is not available to the process, a \a std::invalid_argument exception is thrown. Note that
+// thread pinning is currently only supported on Linux.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   const std::vector<size_t>& available( threadpool::availableCPUs() );
+
+   for( size_t cpu : cpus ) {
+      if( !available.empty() && std::find( available.begin(), available.end(), cpu ) == available.end() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU" );
+      }
+   }
+
+   TheThreadBackend::setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of idle threads for thread parallel operations.
+// \ingroup smp
+//
+// \param time The spin time in microseconds (0 for no spinning).
+// \return void
+//
+// Via this function the time the idle threads for thread parallel operations busily wait for
+// new tasks before they go to sleep can be specified. The same time is used to busily wait for
+// the completion of a parallel operation. Spinning threads react within fractions of a
+// microsecond, whereas waking up a sleeping thread takes several microseconds. Therefore a
+// spin time (as for instance 100 microseconds) considerably reduces the overhead of short
+// parallel operations, which allows to lower the SMP thresholds (see the
+// <tt>./blaze/config/Thresholds.h</tt> configuration file). However, spinning threads occupy
+// their CPU and should therefore only be used in case the threads have the CPUs of the system
+// to themselves. The initial spin time can be specified via the \c BLAZE_THREAD_SPIN_TIME
+// environment variable. A spin time of 0 (the default) disables the busy waiting.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t time )
+{
+   TheThreadBackend::setSpinTime( time );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -51,11 +51,14 @@
 #endif
 
 #include <cstdlib>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
 
@@ -89,9 +92,13 @@ class ThreadBackend
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t              size       ();
+   static inline void                resize     ( size_t n, bool block=false );
+   static inline void                wait       ();
+   static inline std::vector<size_t> affinity   ();
+   static inline void                setAffinity( const std::vector<size_t>& cpus );
+   static inline size_t              spinTime   ();
+   static inline void                setSpinTime( size_t spin );
    //@}
    //**********************************************************************************************
 
@@ -100,6 +107,15 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Target, typename Source, typename OP >
+   static inline void schedule( size_t index, Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void execute( Callable func );
+
+   template< typename Callable >
+   static inline void execute( size_t index, Callable func );
    //@}
    //**********************************************************************************************
 
@@ -130,9 +146,14 @@ class ThreadBackend
       /*!\brief Performs the assignment between the two given operands.
       //
       // \return void
+      //
+      // The assignment is performed within a serial section, which guarantees that the
+      // executing thread does not try to schedule further tasks for the thread pool.
       */
       inline void operator()() {
-         op_( target_, source_ );
+         BLAZE_SERIAL_SECTION {
+            op_( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -152,7 +173,11 @@ class ThreadBackend
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t              initPool();
+   static inline std::vector<size_t> initAffinity();
+   static inline size_t              initSpinTime();
+
+   static inline ThreadPool<TT,MT,LT,CT>& asyncPool();
    //@}
    //**********************************************************************************************
 
@@ -162,9 +187,13 @@ class ThreadBackend
    static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
                                                 /*!< It is initialized with the number of threads
                                                      specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+                                                     \c BLAZE_NUM_THREADS and the thread affinity
+                                                     specified via the environment variable
+                                                     \c BLAZE_THREAD_AFFINITY. The spin time of
+                                                     idle threads is specified via the environment
+                                                     variable \c BLAZE_THREAD_SPIN_TIME. However,
+                                                     it can be explicitly resized to arbitrary
+                                                     numbers of threads. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +212,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initAffinity(), initSpinTime() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -248,7 +277,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. In case any of the tasks
+// has thrown an exception, the first of these exceptions is rethrown.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -262,6 +292,80 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads of the thread backend system are pinned to.
+//
+// \return The list of CPUs (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::affinity()
+{
+   return threadpool_.affinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the CPUs the threads of the thread backend system are pinned to.
+//
+// \param cpus The new list of CPUs (empty for unpinned threads).
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   threadpool_.setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spin time of the idle threads of the thread backend system.
+//
+// \return The spin time in microseconds (0 in case idle threads don't spin).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::spinTime()
+{
+   return threadpool_.spinTime();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the spin time of the idle threads of the thread backend system.
+//
+// \param spin The new spin time in microseconds (0 for no spinning).
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setSpinTime( size_t spin )
+{
+   threadpool_.setSpinTime( spin );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -297,6 +401,94 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an assignment of the given operands for execution by a specific thread.
+//
+// \param index The index of the partition of the assignment.
+// \param target The target operand to be assigned to.
+// \param source The source operand to be assigned to the target.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function schedules a (compound) assignment of the two given operands for execution by
+// the thread with index \f$ index \% size() \f$. Since the partitioning of an operation only
+// depends on the size of the operands and the number of threads, repeated operations on the
+// same data assign the same partition to the same (pinned) thread.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Target  // Type of the target operand
+        , typename Source  // Type of the source operand
+        , typename OP >    // Type of the assignment operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( size_t index, Target& target, const Source& source, OP op )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   threadpool_.scheduleOn( index % threadpool_.size(), Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for asynchronous execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution by the next idle thread
+// of the pool of asynchronous threads (see the asyncPool() function). In contrast to the
+// schedule() functions the given function/functor is not part of a parallel assignment and
+// the calling thread is not required to wait for its completion. Since the asynchronous
+// threads are separate from the threads executing the parallel assignments, the wait()
+// function does not wait for the completion of the function/functor.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::execute( Callable func )
+{
+   asyncPool().schedule( func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution by a specific thread.
+//
+// \param index The index of the executing thread.
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution by the thread with index
+// \a index (modulo the number of threads) of the thread pool. In contrast to the schedule()
+// functions the given function/functor is not restricted to assignments. The function/functor
+// is executed as is, i.e. it is not executed within a serial section.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::execute( size_t index, Callable func )
+{
+   threadpool_.scheduleOn( index % threadpool_.size(), func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -338,6 +530,100 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial thread affinity of the thread pool.
+//
+// \return The initial list of CPUs the threads are pinned to.
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// environment variable. The variable may either specify one of the affinity policies \c none,
+// \c compact, and \c scatter or an explicit list of CPUs (as for instance \c "0,2,4-7"). In
+// case the environment variable is not defined or invalid, the function returns an empty list
+// (i.e. the threads are not pinned).
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr )
+      return std::vector<size_t>();
+   else return threadpool::parseAffinity( env );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial spin time of the idle threads of the thread pool.
+//
+// \return The initial spin time in microseconds.
+//
+// This function determines the initial spin time based on the \c BLAZE_THREAD_SPIN_TIME
+// environment variable. In case the environment variable is not defined or not set, the
+// function returns 0 (i.e. idle threads immediately go to sleep). Otherwise it returns the
+// specified number of microseconds.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::initSpinTime()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_SPIN_TIME" );
+
+   if( env == nullptr )
+      return 0UL;
+   else return max( 0, atoi( env ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pool of threads for the execution of asynchronous tasks.
+//
+// \return Reference to the pool of asynchronous threads.
+//
+// Asynchronous tasks (see the execute() function) are executed by a pool of unpinned threads
+// that is separate from the pool executing the parallel assignments. Thus a long running
+// asynchronous task neither occupies a thread that is assigned a partition of a parallel
+// assignment nor is waited for by the wait() function. The pool is created on first use with
+// the number of threads specified via the environment variable \c BLAZE_NUM_THREADS.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadPool<TT,MT,LT,CT>& ThreadBackend<TT,MT,LT,CT>::asyncPool()
+{
+   static ThreadPool<TT,MT,LT,CT> pool( initPool() );
+   return pool;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
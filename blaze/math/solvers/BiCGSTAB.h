@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the BiCGSTAB solver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICONJUGATE GRADIENT STABILIZED METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Biconjugate gradient stabilized method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+SolverResult bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& M, const SolverSettings& settings = SolverSettings() );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+SolverResult bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Right-preconditioned biconjugate gradient stabilized method for general systems.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param settings The termination criteria of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a general square
+// matrix \a A (dense, sparse, or an adaptor) by means of the BiCGSTAB method. The given vector
+// \a x is used as the initial guess. In case the size of \a x doesn't match the size of the
+// system, \a x is resized and reset to zero. The given preconditioner \a M (for instance the
+// JacobiPreconditioner or the ILU0Preconditioner) is applied from the right, i.e. the solver
+// iterates on \f$ AM^{-1}y = b \f$ with \f$ x = M^{-1}y \f$, such that the residual norm used
+// as termination criterion is the residual norm of the original system:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::SolverResult result( blaze::bicgstab( A, x, b, blaze::ILU0Preconditioner<double>( A ) ) );
+   \endcode
+
+// Both matrix/vector multiplications per iteration are fused with the subsequent dot products
+// and the final update of the solution and the residual is fused with the computation of the
+// two dot products required by the next iteration. All kernels are parallelized via the active
+// shared memory parallelization. In case of a breakdown of the method (i.e. a vanishing inner
+// product), the function returns the current approximation without convergence.
+//
+// Note that the element type of \a x has to be a floating point type.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& M, const SolverSettings& settings )
+{
+   using ET = ElementType_<VT1>;
+   using RT = StaticVector<ET,2UL>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+   const bool precond( !IsSame<PT,IdentityPreconditioner>::value );
+
+   if( (~x).size() != n ) {
+      resize( ~x, n, false );
+      reset( ~x );
+   }
+
+   SolverResult result;
+
+   const ET bnorm( std::sqrt( ET( dot( ~b, ~b ) ) ) );
+
+   if( bnorm == ET(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const ET tol( ET( settings.tolerance ) * bnorm );
+   const ET tol2( tol * tol );
+
+   DynamicVector<ET,false> r( ~b - ~A * ~x ), r0( r ), p( r ), v( n ), s( n ), t( n ), ph, sh;
+
+   if( precond ) {
+      ph.resize( n, false );
+      sh.resize( n, false );
+   }
+
+   const DynamicVector<ET,false>& pm( precond ? ph : p );
+   const DynamicVector<ET,false>& sm( precond ? sh : s );
+
+   ET rr( dot( r, r ) );
+   ET rho( rr ), rhoOld( 1 ), alpha( 1 ), omega( 1 );
+
+   while( rr > tol2 && result.iterations < settings.maxIterations )
+   {
+      if( result.iterations > 0UL ) {
+         p = r + ( rho / rhoOld ) * ( alpha / omega ) * ( p - omega * v );
+      }
+
+      if( precond ) {
+         M.apply( ph, p );
+      }
+
+      const ET rv( spmvDot( v, ~A, pm, r0 ) );
+
+      if( !isDivisor( rv ) )
+         break;
+
+      alpha = rho / rv;
+
+      const ET ss = solverSweep<ET>( n, 3UL*sizeof(ET), SMP_DVECASSIGN_THRESHOLD, [&]( size_t i, size_t m )
+      {
+         auto sb( subvector<unaligned>( s, i, m, unchecked ) );
+         sb = subvector<unaligned>( r, i, m, unchecked ) - alpha * subvector<unaligned>( v, i, m, unchecked );
+         return ET( dot( sb, sb ) );
+      } );
+
+      ++result.iterations;
+
+      if( ss <= tol2 ) {
+         ~x += alpha * pm;
+         rr = ss;
+         break;
+      }
+
+      if( precond ) {
+         M.apply( sh, s );
+      }
+
+      const RT ts( spmvDots( t, ~A, sm, s ) );
+
+      if( !isDivisor( ts[1] ) ) {
+         ~x += alpha * pm;
+         rr = ss;
+         break;
+      }
+
+      omega  = ts[0] / ts[1];
+      rhoOld = rho;
+
+      const RT dots = solverSweep<RT>( n, 7UL*sizeof(ET), SMP_DVECASSIGN_THRESHOLD, [&]( size_t i, size_t m )
+      {
+         auto rb( subvector<unaligned>( r, i, m, unchecked ) );
+         subvector<unaligned>( ~x, i, m, unchecked ) += alpha * subvector<unaligned>( pm, i, m, unchecked ) +
+                                                        omega * subvector<unaligned>( sm, i, m, unchecked );
+         rb = subvector<unaligned>( s, i, m, unchecked ) - omega * subvector<unaligned>( t, i, m, unchecked );
+         return RT{ ET( dot( rb, rb ) ), ET( dot( subvector<unaligned>( r0, i, m, unchecked ), rb ) ) };
+      } );
+
+      rr  = dots[0];
+      rho = dots[1];
+
+      if( !isDivisor( omega ) || !isDivisor( rho ) )
+         break;
+   }
+
+   result.residual  = std::sqrt( rr ) / bnorm;
+   result.converged = ( rr <= tol2 );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Biconjugate gradient stabilized method for general systems.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param settings The termination criteria of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a general square
+// matrix \a A by means of the unpreconditioned BiCGSTAB method. For more details see the
+// preconditioned version of the bicgstab() function.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings )
+{
+   return bicgstab( ~A, ~x, ~b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
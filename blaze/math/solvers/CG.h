@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient solver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+SolverResult cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& M, const SolverSettings& settings = SolverSettings() );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+SolverResult cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Preconditioned conjugate gradient method for symmetric positive definite systems.
+// \ingroup solvers
+//
+// \param A The symmetric positive definite system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param settings The termination criteria of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a symmetric positive
+// definite matrix \a A (dense, sparse, or an adaptor such as the SymmetricMatrix) by means of
+// the preconditioned conjugate gradient method. The given vector \a x is used as the initial
+// guess. In case the size of \a x doesn't match the size of the system, \a x is resized and
+// reset to zero. The given preconditioner \a M has to approximate \f$ A^{-1} \f$ and has to be
+// symmetric positive definite itself (for instance the JacobiPreconditioner):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::SolverResult result( blaze::cg( A, x, b, blaze::JacobiPreconditioner<double>( A ) ) );
+   \endcode
+
+// In contrast to an implementation via separate vector expressions, the inner loop of the
+// solver is based on fused kernels: The matrix/vector multiplication is combined with the
+// subsequent dot product and the two axpy updates of the solution and the residual are
+// combined with the computation of the residual norm. Without preconditioner this reduces
+// the memory traffic from five to three sweeps over the vectors per iteration. All kernels
+// are parallelized via the active shared memory parallelization.
+//
+// Note that the element type of \a x has to be a floating point type.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& M, const SolverSettings& settings )
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+   const bool precond( !IsSame<PT,IdentityPreconditioner>::value );
+
+   if( (~x).size() != n ) {
+      resize( ~x, n, false );
+      reset( ~x );
+   }
+
+   SolverResult result;
+
+   const ET bnorm( std::sqrt( ET( dot( ~b, ~b ) ) ) );
+
+   if( bnorm == ET(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const ET tol( ET( settings.tolerance ) * bnorm );
+   const ET tol2( tol * tol );
+
+   DynamicVector<ET,false> r( ~b - ~A * ~x ), p( n ), q( n ), z;
+
+   ET rr( dot( r, r ) );
+   ET rz( rr );
+
+   if( precond ) {
+      z.resize( n, false );
+      M.apply( z, r );
+      rz = dot( r, z );
+      p = z;
+   }
+   else {
+      p = r;
+   }
+
+   while( rr > tol2 && result.iterations < settings.maxIterations )
+   {
+      const ET pq( spmvDot( q, ~A, p, p ) );
+
+      if( !isDivisor( pq ) )
+         break;
+
+      const ET alpha( rz / pq );
+
+      rr = solverSweep<ET>( n, 4UL*sizeof(ET), SMP_DVECASSIGN_THRESHOLD, [&]( size_t i, size_t m )
+      {
+         auto rs( subvector<unaligned>( r, i, m, unchecked ) );
+         subvector<unaligned>( ~x, i, m, unchecked ) += alpha * subvector<unaligned>( p, i, m, unchecked );
+         rs -= alpha * subvector<unaligned>( q, i, m, unchecked );
+         return ET( dot( rs, rs ) );
+      } );
+
+      ++result.iterations;
+
+      if( rr <= tol2 )
+         break;
+
+      ET rzNew( rr );
+
+      if( precond ) {
+         M.apply( z, r );
+         rzNew = dot( r, z );
+      }
+
+      const ET beta( rzNew / rz );
+      rz = rzNew;
+
+      if( precond ) p = z + beta * p;
+      else          p = r + beta * p;
+   }
+
+   result.residual  = std::sqrt( rr ) / bnorm;
+   result.converged = ( rr <= tol2 );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conjugate gradient method for symmetric positive definite systems.
+// \ingroup solvers
+//
+// \param A The symmetric positive definite system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param settings The termination criteria of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a symmetric positive
+// definite matrix \a A by means of the unpreconditioned conjugate gradient method. For more
+// details see the preconditioned version of the cg() function.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverSettings settings;
+   settings.tolerance = 1E-10;
+
+   const blaze::SolverResult result( blaze::cg( A, x, b, settings ) );
+   \endcode
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings )
+{
+   return cg( ~A, ~x, ~b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
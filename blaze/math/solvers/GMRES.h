@@ -0,0 +1,311 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the restarted GMRES solver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Generalized minimal residual method */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2, typename PT >
+SolverResult gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& M, const SolverSettings& settings = SolverSettings() );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+SolverResult gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Right-preconditioned restarted GMRES method for general systems.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param settings The termination criteria and the restart length of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a general square
+// matrix \a A (dense, sparse, or an adaptor) by means of the GMRES(m) method, which is
+// restarted every \a settings.restart iterations. The given vector \a x is used as the initial
+// guess. In case the size of \a x doesn't match the size of the system, \a x is resized and
+// reset to zero. The given preconditioner \a M is applied from the right, such that the
+// residual norm used as termination criterion is the residual norm of the original system:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverSettings settings;
+   settings.restart = 50UL;
+
+   const blaze::SolverResult result( blaze::gmres( A, x, b, blaze::ILU0Preconditioner<double>( A ), settings ) );
+   \endcode
+
+// The Krylov basis is stored in a column-major matrix and is orthogonalized by means of the
+// classical Gram-Schmidt method with one reorthogonalization step. Therefore the complete
+// orthogonalization of each new basis vector is performed by four dense matrix/vector
+// multiplications, which are parallelized via the active shared memory parallelization,
+// instead of by a sequence of dot products and axpy operations. The Hessenberg matrix is
+// triangulated via Givens rotations, which provides the residual norm in every iteration
+// without any additional computation.
+//
+// Note that the element type of \a x has to be a floating point type.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& M, const SolverSettings& settings )
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( (~A).rows() );
+   const bool precond( !IsSame<PT,IdentityPreconditioner>::value );
+
+   if( (~x).size() != n ) {
+      resize( ~x, n, false );
+      reset( ~x );
+   }
+
+   SolverResult result;
+
+   const ET bnorm( std::sqrt( ET( dot( ~b, ~b ) ) ) );
+
+   if( bnorm == ET(0) ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const ET tol( ET( settings.tolerance ) * bnorm );
+   const size_t m( max( min( settings.restart, n ), 1UL ) );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL );
+   DynamicMatrix<ET,rowMajor> H( m, m );
+   DynamicVector<ET,false> cs( m ), sn( m ), g( m+1UL ), h( m+1UL ), c( m+1UL ), y( m ), r( n ), w( n ), z;
+
+   if( precond ) {
+      z.resize( n, false );
+   }
+
+   ET rnorm( 0 );
+
+   while( true )
+   {
+      r = ~b - ~A * ~x;
+      rnorm = std::sqrt( dot( r, r ) );
+
+      if( rnorm <= tol || result.iterations >= settings.maxIterations )
+         break;
+
+      column( V, 0UL ) = r / rnorm;
+      reset( g );
+      g[0UL] = rnorm;
+
+      size_t j( 0UL );
+
+      while( j < m && result.iterations < settings.maxIterations )
+      {
+         // Computing the next Krylov vector
+         if( precond ) {
+            M.apply( z, column( V, j ) );
+            w = ~A * z;
+         }
+         else {
+            w = ~A * column( V, j );
+         }
+
+         // Classical Gram-Schmidt orthogonalization with reorthogonalization
+         auto Vj( submatrix( V, 0UL, 0UL, n, j+1UL ) );
+         auto hj( subvector( h, 0UL, j+1UL ) );
+         auto cj( subvector( c, 0UL, j+1UL ) );
+
+         hj = trans( Vj ) * w;
+         w -= Vj * hj;
+         cj = trans( Vj ) * w;
+         w -= Vj * cj;
+         hj += cj;
+
+         const ET wnorm( std::sqrt( dot( w, w ) ) );
+
+         // Triangulation of the Hessenberg matrix via Givens rotations
+         for( size_t i=0UL; i<j; ++i ) {
+            const ET tmp( cs[i]*h[i] + sn[i]*h[i+1UL] );
+            h[i+1UL] = cs[i]*h[i+1UL] - sn[i]*h[i];
+            h[i] = tmp;
+         }
+
+         const ET rho( std::sqrt( h[j]*h[j] + wnorm*wnorm ) );
+
+         if( isDivisor( rho ) ) {
+            cs[j] = h[j] / rho;
+            sn[j] = wnorm / rho;
+         }
+         else {
+            cs[j] = ET(1);
+            sn[j] = ET(0);
+         }
+
+         h[j] = rho;
+         g[j+1UL] = -sn[j] * g[j];
+         g[j] = cs[j] * g[j];
+
+         for( size_t i=0UL; i<=j; ++i ) {
+            H(i,j) = h[i];
+         }
+
+         ++j;
+         ++result.iterations;
+
+         if( !isDivisor( wnorm ) || std::abs( g[j] ) <= tol )
+            break;
+
+         column( V, j ) = w / wnorm;
+      }
+
+      // Solving the triangular least squares problem
+      for( size_t i=j; i-->0UL; ) {
+         ET sum( g[i] );
+         for( size_t k=i+1UL; k<j; ++k ) {
+            sum -= H(i,k) * y[k];
+         }
+         y[i] = isDivisor( H(i,i) ) ? sum / H(i,i) : ET(0);
+      }
+
+      // Updating the solution
+      w = submatrix( V, 0UL, 0UL, n, j ) * subvector( y, 0UL, j );
+
+      if( precond ) {
+         M.apply( z, w );
+         ~x += z;
+      }
+      else {
+         ~x += w;
+      }
+   }
+
+   result.residual  = rnorm / bnorm;
+   result.converged = ( rnorm <= tol );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restarted GMRES method for general systems.
+// \ingroup solvers
+//
+// \param A The square system matrix.
+// \param x The initial guess and the resulting solution.
+// \param b The right-hand side vector.
+// \param settings The termination criteria and the restart length of the solver.
+// \return The number of iterations, the final relative residual norm, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a general square
+// matrix \a A by means of the unpreconditioned GMRES(m) method. For more details see the
+// preconditioned version of the gmres() function.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings )
+{
+   return gmres( ~A, ~x, ~b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
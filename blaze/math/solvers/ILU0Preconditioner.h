@@ -0,0 +1,315 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the ILU(0) preconditioner
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)) for the iterative solvers.
+// \ingroup solvers_preconditioner
+//
+// The ILU0Preconditioner class template computes an incomplete LU decomposition \f$ A \approx
+// LU \f$ of the system matrix, where \f$ L \f$ is a lower unitriangular and \f$ U \f$ is an
+// upper triangular matrix. Both factors are restricted to the sparsity pattern of the system
+// matrix, i.e. all fill-in of a complete decomposition is discarded. The factors are stored in
+// a single row-major CompressedMatrix with the same sparsity pattern as the system matrix. The
+// application of the preconditioner consists of a forward and a backward substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::ILU0Preconditioner<double> M( A );
+   blaze::bicgstab( A, x, b, M );
+   \endcode
+
+// All diagonal elements of the system matrix must be explicitly stored. In case a zero pivot
+// is encountered during the decomposition, a \a std::invalid_argument exception is thrown.
+// Note that for dense system matrices, the sparsity pattern is given by the non-zero elements
+// of the matrix. Also note that the substitutions are inherently sequential and are therefore
+// not parallelized.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline const CompressedMatrix<Type,false>& factors() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void decompose();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,false> lu_;  //!< The combined \f$ L \f$ and \f$ U \f$ factors.
+   std::vector<size_t> diag_;         //!< The offset of the diagonal element within each row.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the ILU(0) preconditioner for the given system matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Zero pivot detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : lu_  ()  // The combined L and U factors
+   , diag_()  // The offset of the diagonal element within each row
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   lu_ = ~A;
+   decompose();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t ILU0Preconditioner<Type>::size() const noexcept
+{
+   return lu_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete LU factors.
+//
+// \return The combined \f$ L \f$ (strictly lower part) and \f$ U \f$ (upper part) factors.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,false>& ILU0Preconditioner<Type>::factors() const noexcept
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the ILU(0) preconditioner (\f$ z = U^{-1} L^{-1} r \f$).
+//
+// \param z The target vector.
+// \param r The vector the preconditioner is applied to.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the source vector
+inline void ILU0Preconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                             const DenseVector<VT2,false>& r ) const
+{
+   using ConstIterator = typename CompressedMatrix<Type,false>::ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( (~r).size() == lu_.rows(), "Invalid vector size detected" );
+
+   const size_t n( lu_.rows() );
+
+   ~z = ~r;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      Type sum( (~z)[i] );
+      for( ConstIterator element=lu_.begin(i); element!=diag; ++element ) {
+         sum -= element->value() * (~z)[element->index()];
+      }
+      (~z)[i] = sum;
+   }
+
+   for( size_t i=n; i-->0UL; ) {
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      const ConstIterator end ( lu_.end(i) );
+      Type sum( (~z)[i] );
+      for( ConstIterator element=diag+1UL; element!=end; ++element ) {
+         sum -= element->value() * (~z)[element->index()];
+      }
+      (~z)[i] = sum / diag->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete LU decomposition of the stored system matrix.
+//
+// \return void
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Zero pivot detected.
+//
+// This function performs the IKJ variant of the Gaussian elimination restricted to the
+// sparsity pattern of the system matrix. The elimination of row \a i with a previous row
+// \a k is performed by a simultaneous traversal of the sorted non-zero elements of both
+// rows.
+*/
+template< typename Type >  // Data type of the preconditioner
+void ILU0Preconditioner<Type>::decompose()
+{
+   using Iterator = typename CompressedMatrix<Type,false>::Iterator;
+
+   const size_t n( lu_.rows() );
+
+   diag_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const Iterator diag( lu_.find( i, i ) );
+      if( diag == lu_.end(i) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element detected" );
+      }
+      diag_[i] = static_cast<size_t>( diag - lu_.begin(i) );
+   }
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator diag( lu_.begin(i) + diag_[i] );
+      const Iterator end ( lu_.end(i) );
+
+      for( Iterator ik=lu_.begin(i); ik!=diag; ++ik )
+      {
+         const size_t k( ik->index() );
+         const Iterator kk( lu_.begin(k) + diag_[k] );
+         const Iterator kend( lu_.end(k) );
+
+         ik->value() /= kk->value();
+
+         Iterator kj( kk+1UL );
+         Iterator ij( ik+1UL );
+
+         while( kj != kend && ij != end ) {
+            if( kj->index() < ij->index() ) {
+               ++kj;
+            }
+            else if( ij->index() < kj->index() ) {
+               ++ij;
+            }
+            else {
+               ij->value() -= ik->value() * kj->value();
+               ++kj;
+               ++ij;
+            }
+         }
+      }
+
+      if( !isDivisor( diag->value() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Zero pivot detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,241 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Kernels.h
+//  \brief Header file for the fused compute kernels of the iterative solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FUSED SWEEP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused sweep over the index range \f$[0..n)\f$ of a set of vectors.
+// \ingroup solvers
+//
+// \param n The size of the index range.
+// \param bytes The number of bytes accessed per index.
+// \param threshold The minimum size for a parallel execution.
+// \param op The operation to be applied to each block of the index range.
+// \return The sum of the partial results of all blocks.
+//
+// This function calls the given operation for consecutive, cache sized blocks of the index
+// range \f$[0..n)\f$ and returns the sum of the results of all calls. The operation is passed
+// the first index and the size of a block and is expected to perform all updates of the block
+// (for instance several axpy operations followed by the partial dot product of an updated
+// vector). This way, all vectors are streamed from and to the main memory only once, instead
+// of once per individual operation. In case the index range exceeds the given threshold, it is
+// split into one partition per thread of the active shared memory parallelization and the
+// partitions are processed in parallel, each of them within a serial section. In order to
+// guarantee a deterministic result for a given number of threads, the partial results of the
+// partitions are summed up in order.
+*/
+template< typename T     // Type of the result
+        , typename OP >  // Type of the block operation
+T solverSweep( size_t n, size_t bytes, size_t threshold, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( bytes > 0UL, "Invalid number of bytes per index detected" );
+
+   const bool parallel( n >= threshold && !isSerialSectionActive() && !isParallelSectionActive() );
+
+   const size_t partitions( parallel ? getNumThreads() : 1UL );
+   const size_t blockSize ( max( 64UL, ( cacheSize / ( 4UL * bytes ) ) & ~size_t(63) ) );
+   const size_t partSize  ( nextMultiple( ( n + partitions - 1UL ) / partitions, 64UL ) );
+
+   std::vector< T, AlignedAllocator<T> > partials( partitions, T() );
+
+   auto process = [n,blockSize,partSize,&partials,&op]( size_t partition )
+   {
+      const size_t begin( partition * partSize );
+      const size_t end  ( min( begin + partSize, n ) );
+
+      for( size_t i=begin; i<end; i+=blockSize ) {
+         partials[partition] += op( i, min( blockSize, end - i ) );
+      }
+   };
+
+   smpForRange( partitions, 2UL, [&process]( size_t begin, size_t end ) {
+      for( size_t partition=begin; partition<end; ++partition ) {
+         process( partition );
+      }
+   } );
+
+   T sum( partials[0UL] );
+   for( size_t p=1UL; p<partitions; ++p ) {
+      sum += partials[p];
+   }
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused matrix/vector multiplication and dot product (\f$ y = Ax, \f$ returning
+//        \f$ z \cdot y \f$).
+// \ingroup solvers
+//
+// \param y The target vector of the multiplication.
+// \param A The square system matrix.
+// \param x The vector to be multiplied with the system matrix.
+// \param z The vector to be multiplied with the result of the multiplication.
+// \return The dot product \f$ z \cdot y \f$.
+//
+// For row-major matrices the multiplication is performed block-wise on consecutive row blocks
+// of \a A and the partial dot product of each block is computed while the block of \a y is
+// still cached. For column-major matrices the dot product is computed separately.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT2    // Type of the multiplied vector
+        , typename VT3 >  // Type of the dot product vector
+ElementType_<VT1> spmvDot( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+                           const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& z )
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~y).size(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~z).size(), "Invalid vector size detected" );
+
+   if( !IsRowMajorMatrix<MT>::value ) {
+      ~y = ~A * ~x;
+      return dot( ~z, ~y );
+   }
+
+   const size_t threshold( IsSparseMatrix<MT>::value ? SMP_SMATDVECMULT_THRESHOLD
+                                                     : SMP_DMATDVECMULT_THRESHOLD );
+
+   return solverSweep<ET>( (~y).size(), 2UL*sizeof(ET), threshold, [&]( size_t i, size_t m )
+   {
+      auto ys( subvector<unaligned>( ~y, i, m, unchecked ) );
+      ys = submatrix<unaligned>( ~A, i, 0UL, m, (~A).columns(), unchecked ) * ~x;
+      return ET( dot( subvector<unaligned>( ~z, i, m, unchecked ), ys ) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused matrix/vector multiplication and two dot products (\f$ y = Ax, \f$ returning
+//        \f$ z \cdot y \f$ and \f$ y \cdot y \f$).
+// \ingroup solvers
+//
+// \param y The target vector of the multiplication.
+// \param A The square system matrix.
+// \param x The vector to be multiplied with the system matrix.
+// \param z The vector to be multiplied with the result of the multiplication.
+// \return The dot products \f$ z \cdot y \f$ (first element) and \f$ y \cdot y \f$ (second element).
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT2    // Type of the multiplied vector
+        , typename VT3 >  // Type of the dot product vector
+StaticVector<ElementType_<VT1>,2UL>
+   spmvDots( DenseVector<VT1,false>& y, const Matrix<MT,SO>& A,
+             const DenseVector<VT2,false>& x, const DenseVector<VT3,false>& z )
+{
+   using ET = ElementType_<VT1>;
+   using RT = StaticVector<ET,2UL>;
+
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~y).size(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~z).size(), "Invalid vector size detected" );
+
+   if( !IsRowMajorMatrix<MT>::value ) {
+      ~y = ~A * ~x;
+      return RT{ ET( dot( ~z, ~y ) ), ET( dot( ~y, ~y ) ) };
+   }
+
+   const size_t threshold( IsSparseMatrix<MT>::value ? SMP_SMATDVECMULT_THRESHOLD
+                                                     : SMP_DMATDVECMULT_THRESHOLD );
+
+   return solverSweep<RT>( (~y).size(), 2UL*sizeof(ET), threshold, [&]( size_t i, size_t m )
+   {
+      auto ys( subvector<unaligned>( ~y, i, m, unchecked ) );
+      ys = submatrix<unaligned>( ~A, i, 0UL, m, (~A).columns(), unchecked ) * ~x;
+      return RT{ ET( dot( subvector<unaligned>( ~z, i, m, unchecked ), ys ) ), ET( dot( ys, ys ) ) };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,547 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LevelSchedule.h
+//  \brief Header file for the level schedule of sparse triangular solves
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level schedule for the forward and backward substitution with sparse triangular matrices.
+// \ingroup solvers
+//
+// The LevelSchedule class represents the result of the dependency analysis of a sparse lower or
+// upper triangular matrix. Each row of the matrix is assigned to a level such that all rows it
+// depends on (i.e. all rows that correspond to the non-zero off-diagonal elements of the row)
+// belong to previous levels. Thus all rows within a level can be solved concurrently. The
+// analysis depends only on the sparsity pattern of the matrix. Therefore a schedule can be
+// computed once and can be reused for all subsequent solves with matrices of the same pattern
+// (as for instance the incomplete factors of a preconditioner that are recomputed in every time
+// step):
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );
+
+   solve( L, x, b, schedule );
+   \endcode
+
+// In case of a column-major matrix, the schedule additionally stores the positions of the
+// off-diagonal elements of each row within the columns of the matrix. This enables the row-wise
+// (and therefore race-free) parallel substitution without copying the matrix. Note that in this
+// case the positions are computed via iterator arithmetic, i.e. the underlying sparse matrix has
+// to provide random access iterators (as for instance the CompressedMatrix does).
+//
+// Since the matches() function is called by every solve, it only compares the size, the number
+// of non-zero elements, the triangular form, and the storage order of a matrix with the analyzed
+// matrix. Only in case user assertions are activated (see the BLAZE_USER_ASSERTION switch), the
+// schedule additionally stores a copy of the sparsity pattern of the analyzed matrix, which is
+// compared exactly by the matches() function.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LevelSchedule();
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size      () const noexcept;
+   inline size_t nonZeros  () const noexcept;
+   inline size_t levels    () const noexcept;
+   inline size_t levelSize ( size_t level ) const noexcept;
+   inline bool   isLower   () const noexcept;
+   inline bool   isRowMajor() const noexcept;
+
+   template< typename MT, bool SO >
+   inline bool matches( const SparseMatrix<MT,SO>& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline const size_t* rows    ( size_t level ) const noexcept;
+   inline const size_t* deps    ( size_t i ) const noexcept;
+   inline const size_t* offsets ( size_t i ) const noexcept;
+   inline size_t        numDeps ( size_t i ) const noexcept;
+   inline size_t        diagonal( size_t i ) const noexcept;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! Marker for a diagonal element that is not explicitly stored.
+   static constexpr size_t npos = size_t(-1);
+   //**********************************************************************************************
+
+ private:
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                    //!< The number of rows and columns of the analyzed matrix.
+   size_t nonZeros_;             //!< The number of non-zero elements of the analyzed matrix.
+   bool lower_;                  //!< \a true in case of a lower triangular matrix.
+   bool rowMajor_;               //!< \a true in case of a row-major matrix.
+   std::vector<size_t> begin_;   //!< The first element of each row/column (debug only).
+   std::vector<size_t> indices_; //!< The indices of all non-zero elements (debug only).
+   std::vector<size_t> levels_;  //!< The index of the first row of each level in the row order.
+   std::vector<size_t> order_;   //!< The rows of the matrix ordered by level.
+   std::vector<size_t> ptr_;     //!< The first dependency of each row (column-major only).
+   std::vector<size_t> deps_;    //!< The dependencies of each row (column-major only).
+   std::vector<size_t> offsets_; //!< The positions of the dependencies in the columns.
+   std::vector<size_t> diag_;    //!< The positions of the diagonal elements in the columns.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+//
+// The default constructor creates the empty schedule of a 0x0 matrix.
+*/
+inline LevelSchedule::LevelSchedule()
+   : n_       ( 0UL )       // The number of rows and columns of the analyzed matrix
+   , nonZeros_( 0UL )       // The number of non-zero elements of the analyzed matrix
+   , lower_   ( true )      // true in case of a lower triangular matrix
+   , rowMajor_( true )      // true in case of a row-major matrix
+   , begin_   ( 1UL, 0UL )  // The first element of each row/column of the analyzed pattern
+   , indices_ ()            // The indices of all non-zero elements of the analyzed pattern
+   , levels_  ( 1UL, 0UL )  // The index of the first row of each level in the row order
+   , order_   ()            // The rows of the matrix ordered by level
+   , ptr_     ()            // The first dependency of each row
+   , deps_    ()            // The dependencies of each row
+   , offsets_ ()            // The positions of the dependencies in the columns
+   , diag_    ()            // The positions of the diagonal elements in the columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the level schedule of the given sparse triangular matrix.
+//
+// \param A The sparse lower or upper triangular matrix.
+//
+// This constructor assigns each row of the given matrix to the earliest level that succeeds
+// the levels of all rows it depends on. The analysis requires a single sweep over the sparsity
+// pattern of the matrix. Note that the constructor can only be used for triangular matrix types
+// (as for instance the LowerMatrix or UniUpperMatrix adaptors). The attempt to use it with any
+// other matrix type results in a compile time error!
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A )
+   : n_       ( (~A).rows() )          // The number of rows and columns of the analyzed matrix
+   , nonZeros_( (~A).nonZeros() )      // The number of non-zero elements of the analyzed matrix
+   , lower_   ( IsLower<MT>::value )   // true in case of a lower triangular matrix
+   , rowMajor_( !SO )                  // true in case of a row-major matrix
+   , begin_   ()                       // The first element of each row/column of the analyzed pattern
+   , indices_ ()                       // The indices of all non-zero elements of the analyzed pattern
+   , levels_  ()                       // The index of the first row of each level in the row order
+   , order_   ( (~A).rows() )          // The rows of the matrix ordered by level
+   , ptr_     ()                       // The first dependency of each row
+   , deps_    ()                       // The dependencies of each row
+   , offsets_ ()                       // The positions of the dependencies in the columns
+   , diag_    ()                       // The positions of the diagonal elements in the columns
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+
+   const size_t n( n_ );
+
+#if BLAZE_USER_ASSERTION
+   begin_.reserve( n+1UL );
+   indices_.reserve( nonZeros_ );
+   begin_.push_back( 0UL );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=(~A).begin(k); element!=(~A).end(k); ++element ) {
+         indices_.push_back( element->index() );
+      }
+      begin_.push_back( indices_.size() );
+   }
+#endif
+
+   if( SO )
+   {
+      ptr_.assign( n+1UL, 0UL );
+      diag_.assign( n, size_t( npos ) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( auto element=(~A).begin(j); element!=(~A).end(j); ++element ) {
+            if( element->index() != j )
+               ++ptr_[element->index()+1UL];
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         ptr_[i+1UL] += ptr_[i];
+      }
+
+      deps_.resize( ptr_[n] );
+      offsets_.resize( ptr_[n] );
+
+      std::vector<size_t> pos( ptr_.begin(), ptr_.end()-1 );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         const auto begin( (~A).begin(j) );
+         for( auto element=begin; element!=(~A).end(j); ++element ) {
+            const size_t i( element->index() );
+            if( i == j ) {
+               diag_[j] = static_cast<size_t>( element - begin );
+            }
+            else {
+               deps_[pos[i]] = j;
+               offsets_[pos[i]] = static_cast<size_t>( element - begin );
+               ++pos[i];
+            }
+         }
+      }
+   }
+
+   std::vector<size_t> level( n, 0UL );
+   size_t numLevels( n > 0UL ? 1UL : 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( lower_ ? k : n-k-1UL );
+      size_t lvl( 0UL );
+
+      if( SO ) {
+         for( size_t d=ptr_[i]; d<ptr_[i+1UL]; ++d ) {
+            lvl = max( lvl, level[deps_[d]]+1UL );
+         }
+      }
+      else {
+         for( auto element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() != i )
+               lvl = max( lvl, level[element->index()]+1UL );
+         }
+      }
+
+      level[i] = lvl;
+      numLevels = max( numLevels, lvl+1UL );
+   }
+
+   levels_.assign( numLevels+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++levels_[level[i]+1UL];
+   }
+   for( size_t l=0UL; l<numLevels; ++l ) {
+      levels_[l+1UL] += levels_[l];
+   }
+
+   std::vector<size_t> pos( levels_.begin(), levels_.end()-1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      order_[pos[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the analyzed matrix.
+//
+// \return The number of rows and columns of the analyzed matrix.
+*/
+inline size_t LevelSchedule::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the analyzed matrix.
+//
+// \return The number of non-zero elements of the analyzed matrix.
+*/
+inline size_t LevelSchedule::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the schedule.
+//
+// \return The number of levels.
+//
+// The number of levels corresponds to the length of the longest dependency chain of the matrix,
+// i.e. to the number of sequential steps of a parallel substitution.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return levels_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given level.
+//
+// \param level The index of the level \f$[0..levels())\f$.
+// \return The number of rows of the level.
+*/
+inline size_t LevelSchedule::levelSize( size_t level ) const noexcept
+{
+   BLAZE_USER_ASSERT( level < levels(), "Invalid level access index" );
+
+   return levels_[level+1UL] - levels_[level];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule has been computed for a lower triangular matrix.
+//
+// \return \a true in case of a lower triangular matrix, \a false in case of an upper one.
+*/
+inline bool LevelSchedule::isLower() const noexcept
+{
+   return lower_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule has been computed for a row-major matrix.
+//
+// \return \a true in case of a row-major matrix, \a false in case of a column-major one.
+*/
+inline bool LevelSchedule::isRowMajor() const noexcept
+{
+   return rowMajor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule can be used for the given sparse triangular matrix.
+//
+// \param A The sparse triangular matrix.
+// \return \a true in case the schedule can be used for the matrix, \a false if not.
+//
+// This function checks that the given matrix has the same size, number of non-zero elements,
+// triangular form, and storage order as the analyzed matrix. This check is performed in constant
+// time, i.e. a change of the sparsity pattern that preserves the number of non-zero elements is
+// not detected. Only in case user assertions are activated (see the BLAZE_USER_ASSERTION
+// switch), the sparsity pattern is additionally compared exactly, which requires a sweep over
+// the sparsity pattern of the given matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline bool LevelSchedule::matches( const SparseMatrix<MT,SO>& A ) const
+{
+   if( (~A).rows() != n_ || (~A).columns() != n_ || IsLower<MT>::value != lower_ ||
+       !SO != rowMajor_ || (~A).nonZeros() != nonZeros_ ) {
+      return false;
+   }
+
+#if BLAZE_USER_ASSERTION
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      size_t pos( begin_[k] );
+
+      for( auto element=(~A).begin(k); element!=(~A).end(k); ++element, ++pos ) {
+         if( pos == begin_[k+1UL] || indices_[pos] != element->index() )
+            return false;
+      }
+
+      if( pos != begin_[k+1UL] )
+         return false;
+   }
+#endif
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the rows of the given level.
+//
+// \param level The index of the level \f$[0..levels())\f$.
+// \return Pointer to the first of the levelSize() rows of the level in ascending order.
+*/
+inline const size_t* LevelSchedule::rows( size_t level ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( level < levels(), "Invalid level access index" );
+
+   return order_.data() + levels_[level];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the dependencies of the given row of a column-major matrix.
+//
+// \param i The index of the row \f$[0..size())\f$.
+// \return Pointer to the first of the numDeps() column indices of the row.
+*/
+inline const size_t* LevelSchedule::deps( size_t i ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( !rowMajor_, "Invalid access to row-major schedule" );
+   BLAZE_INTERNAL_ASSERT( i < n_, "Invalid row access index" );
+
+   return deps_.data() + ptr_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the positions of the dependencies of the given row of a column-major matrix.
+//
+// \param i The index of the row \f$[0..size())\f$.
+// \return Pointer to the first of the numDeps() positions within the according columns.
+*/
+inline const size_t* LevelSchedule::offsets( size_t i ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( !rowMajor_, "Invalid access to row-major schedule" );
+   BLAZE_INTERNAL_ASSERT( i < n_, "Invalid row access index" );
+
+   return offsets_.data() + ptr_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of dependencies of the given row of a column-major matrix.
+//
+// \param i The index of the row \f$[0..size())\f$.
+// \return The number of off-diagonal non-zero elements of the row.
+*/
+inline size_t LevelSchedule::numDeps( size_t i ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( !rowMajor_, "Invalid access to row-major schedule" );
+   BLAZE_INTERNAL_ASSERT( i < n_, "Invalid row access index" );
+
+   return ptr_[i+1UL] - ptr_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the position of the diagonal element of the given column of a column-major matrix.
+//
+// \param i The index of the column \f$[0..size())\f$.
+// \return The position of the diagonal element within the column or \a npos if it isn't stored.
+*/
+inline size_t LevelSchedule::diagonal( size_t i ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( !rowMajor_, "Invalid access to row-major schedule" );
+   BLAZE_INTERNAL_ASSERT( i < n_, "Invalid column access index" );
+
+   return diag_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverSettings.h
+//  \brief Header file for the settings and results of the iterative solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERSETTINGS_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERSETTINGS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SOLVERSETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Settings of the iterative solvers.
+// \ingroup solvers
+//
+// The SolverSettings class bundles the termination criteria of the iterative solvers (see
+// cg(), bicgstab(), and gmres()). The solvers terminate as soon as the Euclidean norm of the
+// residual \f$ r = b - Ax \f$ relative to the norm of the right-hand side \f$ b \f$ drops below
+// the given \a tolerance or after \a maxIterations iterations:
+
+   \code
+   blaze::SolverSettings settings;
+   settings.tolerance     = 1E-10;  // Relative residual norm
+   settings.maxIterations = 500UL;  // Maximum number of iterations
+   settings.restart       = 50UL;   // Restart length of GMRES
+   \endcode
+*/
+struct SolverSettings
+{
+   size_t maxIterations = 1000UL;  //!< The maximum number of iterations.
+   double tolerance     = 1E-8;    //!< The relative residual norm to be achieved.
+   size_t restart       = 30UL;    //!< The number of iterations between two GMRES restarts.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SOLVERRESULT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result of an iterative solver.
+// \ingroup solvers
+//
+// The SolverResult class is returned by all iterative solvers (see cg(), bicgstab(), and
+// gmres()) and provides the number of performed iterations, the final relative residual norm,
+// and whether the requested tolerance has been achieved:
+
+   \code
+   const blaze::SolverResult result( blaze::cg( A, x, b ) );
+
+   if( !result.converged ) {
+      std::cerr << "No convergence after " << result.iterations << " iterations "
+                << "(relative residual " << result.residual << ")\n";
+   }
+   \endcode
+*/
+struct SolverResult
+{
+   size_t iterations = 0UL;    //!< The number of performed iterations.
+   double residual   = 0.0;    //!< The final relative residual norm.
+   bool   converged  = false;  //!< \a true if the tolerance has been achieved, \a false if not.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,993 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/TriangularSolve.h
+//  \brief Header file for the sparse triangular solve functions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SOLVERS_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum amount of work of a level for its parallel substitution.
+// \ingroup solvers
+//
+// The rows of a level of a LevelSchedule are only distributed among the available threads in
+// case the product of the number of rows, the average number of non-zero elements per row, and
+// the number of right-hand sides is larger or equal to this threshold. Smaller levels are
+// processed by the calling thread in order to avoid the synchronization overhead.
+*/
+constexpr size_t SPTRSV_SMP_THRESHOLD = 4096UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the vectorized multiple right-hand side substitution.
+// \ingroup solvers
+*/
+template< typename T1    // Element type of the right-hand sides
+        , typename T2 >  // Element type of the triangular matrix
+struct SpTrsmVectorized
+{
+   enum : bool { value = useOptimizedKernels &&
+                         IsSame<T1,T2>::value &&
+                         IsVectorizable<T1>::value &&
+                         HasSIMDSub<T1,T1>::value &&
+                         HasSIMDMult<T1,T1>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single row of a row-major sparse triangular system.
+// \ingroup solvers
+//
+// \param A The row-major sparse triangular matrix.
+// \param x The right-hand side on entry, the (partial) solution on exit.
+// \param i The index of the row to be solved.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+*/
+template< bool Lower     // Lower triangular flag
+        , bool Uni       // Unitriangular flag
+        , typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector
+inline EnableIf_< IsRowMajorMatrix<MT>, bool >
+   sptrsvRow( const MT& A, VT& x, size_t i, const LevelSchedule* /*schedule*/ )
+{
+   using ET = ElementType_<VT>;
+
+   auto begin( A.begin(i) );
+   auto end  ( A.end(i) );
+
+   ET diag( 0 );
+
+   if( begin != end ) {
+      if( Lower && (end-1)->index() == i ) {
+         --end;
+         diag = end->value();
+      }
+      else if( !Lower && begin->index() == i ) {
+         diag = begin->value();
+         ++begin;
+      }
+   }
+
+   ET sum( x[i] );
+
+   for( ; begin!=end; ++begin ) {
+      sum -= begin->value() * x[begin->index()];
+   }
+
+   if( Uni ) {
+      x[i] = sum;
+      return true;
+   }
+
+   x[i] = sum * ( ET(1) / diag );
+   return isDivisor( diag );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single row of a column-major sparse triangular system.
+// \ingroup solvers
+//
+// \param A The column-major sparse triangular matrix.
+// \param x The right-hand side on entry, the (partial) solution on exit.
+// \param i The index of the row to be solved.
+// \param schedule The level schedule providing the positions of the elements of the row.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+*/
+template< bool Lower     // Lower triangular flag
+        , bool Uni       // Unitriangular flag
+        , typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector
+inline DisableIf_< IsRowMajorMatrix<MT>, bool >
+   sptrsvRow( const MT& A, VT& x, size_t i, const LevelSchedule* schedule )
+{
+   using ET = ElementType_<VT>;
+
+   const size_t* deps   ( schedule->deps( i ) );
+   const size_t* offsets( schedule->offsets( i ) );
+   const size_t  num    ( schedule->numDeps( i ) );
+
+   ET sum( x[i] );
+
+   for( size_t k=0UL; k<num; ++k ) {
+      const size_t j( deps[k] );
+      sum -= ( A.begin(j) + offsets[k] )->value() * x[j];
+   }
+
+   if( Uni ) {
+      x[i] = sum;
+      return true;
+   }
+
+   const size_t d( schedule->diagonal( i ) );
+
+   if( d == LevelSchedule::npos )
+      return false;
+
+   const ET diag( ( A.begin(i) + d )->value() );
+   x[i] = sum * ( ET(1) / diag );
+   return isDivisor( diag );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized update of a row of right-hand sides (\f$ \vec{y} -= a \cdot \vec{x} \f$).
+// \ingroup solvers
+//
+// \param y Pointer to the first of the \a k elements of the updated row.
+// \param x Pointer to the first of the \a k elements of the solved row.
+// \param a The scaling factor.
+// \param k The number of right-hand sides.
+// \return void
+*/
+template< typename T1    // Element type of the right-hand sides
+        , typename T2 >  // Element type of the triangular matrix
+inline EnableIf_< SpTrsmVectorized<T1,T2> >
+   sptrsmUpdate( T1* y, const T1* x, const T2& a, size_t k ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T1>::size );
+
+   const size_t kpos( k & size_t(-SIMDSIZE) );
+   const auto factor( set( a ) );
+
+   size_t j( 0UL );
+
+   for( ; j<kpos; j+=SIMDSIZE ) {
+      storeu( y+j, loadu( y+j ) - factor * loadu( x+j ) );
+   }
+   for( ; j<k; ++j ) {
+      y[j] -= a * x[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default update of a row of right-hand sides (\f$ \vec{y} -= a \cdot \vec{x} \f$).
+// \ingroup solvers
+//
+// \param y Pointer to the first of the \a k elements of the updated row.
+// \param x Pointer to the first of the \a k elements of the solved row.
+// \param a The scaling factor.
+// \param k The number of right-hand sides.
+// \return void
+*/
+template< typename T1    // Element type of the right-hand sides
+        , typename T2 >  // Element type of the triangular matrix
+inline DisableIf_< SpTrsmVectorized<T1,T2> >
+   sptrsmUpdate( T1* y, const T1* x, const T2& a, size_t k ) noexcept
+{
+   for( size_t j=0UL; j<k; ++j ) {
+      y[j] -= a * x[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single row of a row-major sparse triangular system with multiple
+//        right-hand sides.
+// \ingroup solvers
+//
+// \param A The row-major sparse triangular matrix.
+// \param X The row-major right-hand sides on entry, the (partial) solutions on exit.
+// \param i The index of the row to be solved.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+*/
+template< bool Uni       // Unitriangular flag
+        , typename MT1   // Type of the sparse matrix
+        , typename MT2 > // Type of the dense matrix
+inline EnableIf_< IsRowMajorMatrix<MT1>, bool >
+   sptrsmRow( const MT1& A, MT2& X, size_t i, const LevelSchedule* /*schedule*/ )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t k( X.columns() );
+   ET* xi( X.data(i) );
+   ET diag( 0 );
+
+   const auto end( A.end(i) );
+   for( auto element=A.begin(i); element!=end; ++element ) {
+      const size_t j( element->index() );
+      if( j != i ) sptrsmUpdate( xi, X.data(j), element->value(), k );
+      else diag = element->value();
+   }
+
+   if( Uni )
+      return true;
+
+   const ET inv( ET(1) / diag );
+   for( size_t j=0UL; j<k; ++j ) {
+      xi[j] *= inv;
+   }
+   return isDivisor( diag );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single row of a column-major sparse triangular system with multiple
+//        right-hand sides.
+// \ingroup solvers
+//
+// \param A The column-major sparse triangular matrix.
+// \param X The row-major right-hand sides on entry, the (partial) solutions on exit.
+// \param i The index of the row to be solved.
+// \param schedule The level schedule providing the positions of the elements of the row.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+*/
+template< bool Uni       // Unitriangular flag
+        , typename MT1   // Type of the sparse matrix
+        , typename MT2 > // Type of the dense matrix
+inline DisableIf_< IsRowMajorMatrix<MT1>, bool >
+   sptrsmRow( const MT1& A, MT2& X, size_t i, const LevelSchedule* schedule )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t* deps   ( schedule->deps( i ) );
+   const size_t* offsets( schedule->offsets( i ) );
+   const size_t  num    ( schedule->numDeps( i ) );
+
+   const size_t k( X.columns() );
+   ET* xi( X.data(i) );
+
+   for( size_t d=0UL; d<num; ++d ) {
+      const size_t j( deps[d] );
+      sptrsmUpdate( xi, X.data(j), ( A.begin(j) + offsets[d] )->value(), k );
+   }
+
+   if( Uni )
+      return true;
+
+   const size_t d( schedule->diagonal( i ) );
+
+   if( d == LevelSchedule::npos )
+      return false;
+
+   const ET diag( ( A.begin(i) + d )->value() );
+   const ET inv( ET(1) / diag );
+   for( size_t j=0UL; j<k; ++j ) {
+      xi[j] *= inv;
+   }
+   return isDivisor( diag );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMN KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single column of a column-major sparse triangular system.
+// \ingroup solvers
+//
+// \param A The column-major sparse triangular matrix.
+// \param x The right-hand side on entry, the (partial) solution on exit.
+// \param j The index of the column to be solved.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+//
+// This function computes the \a j-th element of the solution and eliminates it from all
+// remaining rows. Thus it solves the system in case it is applied to all columns in the natural
+// order of the substitution and does not require a level schedule.
+*/
+template< bool Lower     // Lower triangular flag
+        , bool Uni       // Unitriangular flag
+        , typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector
+inline bool sptrsvColumn( const MT& A, VT& x, size_t j )
+{
+   using ET = ElementType_<VT>;
+
+   auto begin( A.begin(j) );
+   auto end  ( A.end(j) );
+
+   ET diag( 0 );
+
+   if( begin != end ) {
+      if( Lower && begin->index() == j ) {
+         diag = begin->value();
+         ++begin;
+      }
+      else if( !Lower && (end-1)->index() == j ) {
+         --end;
+         diag = end->value();
+      }
+   }
+
+   if( !Uni ) {
+      if( !isDivisor( diag ) )
+         return false;
+      x[j] *= ET(1) / diag;
+   }
+
+   const ET xj( x[j] );
+
+   for( ; begin!=end; ++begin ) {
+      x[begin->index()] -= begin->value() * xj;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a single column of a column-major sparse triangular system with
+//        multiple right-hand sides.
+// \ingroup solvers
+//
+// \param A The column-major sparse triangular matrix.
+// \param X The row-major right-hand sides on entry, the (partial) solutions on exit.
+// \param j The index of the column to be solved.
+// \return \a false in case of a zero diagonal element, \a true otherwise.
+*/
+template< bool Lower     // Lower triangular flag
+        , bool Uni       // Unitriangular flag
+        , typename MT1   // Type of the sparse matrix
+        , typename MT2 > // Type of the dense matrix
+inline bool sptrsmColumn( const MT1& A, MT2& X, size_t j )
+{
+   using ET = ElementType_<MT2>;
+
+   const size_t k( X.columns() );
+   ET* xj( X.data(j) );
+
+   auto begin( A.begin(j) );
+   auto end  ( A.end(j) );
+
+   ET diag( 0 );
+
+   if( begin != end ) {
+      if( Lower && begin->index() == j ) {
+         diag = begin->value();
+         ++begin;
+      }
+      else if( !Lower && (end-1)->index() == j ) {
+         --end;
+         diag = end->value();
+      }
+   }
+
+   if( !Uni ) {
+      if( !isDivisor( diag ) )
+         return false;
+      const ET inv( ET(1) / diag );
+      for( size_t l=0UL; l<k; ++l ) {
+         xj[l] *= inv;
+      }
+   }
+
+   for( ; begin!=end; ++begin ) {
+      sptrsmUpdate( X.data( begin->index() ), xj, begin->value(), k );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBSTITUTION DRIVER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward or backward substitution of all rows of a sparse triangular system.
+// \ingroup solvers
+//
+// \param n The number of rows of the triangular system.
+// \param lower \a true for a forward substitution, \a false for a backward substitution.
+// \param schedule The level schedule of the system (\a nullptr for a serial substitution).
+// \param work The average amount of work per row.
+// \param op The operation solving a single row, returning \a false in case of a zero pivot.
+// \return void
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// The row operations multiply by the reciprocal of the diagonal element instead of dividing by
+// it, which removes the division from the chain of dependent rows of a serial substitution.
+// In case no schedule is given or in case the substitution cannot be performed in parallel,
+// all rows are solved in the natural order of the substitution. Otherwise the levels of the
+// given schedule are processed in order. The rows of each sufficiently large level are split
+// into one contiguous partition per thread, which are solved in parallel.
+*/
+template< typename OP >  // Type of the row operation
+void sptrsvExecute( size_t n, bool lower, const LevelSchedule* schedule, size_t work, OP op )
+{
+   const bool parallel( schedule != nullptr && schedule->levels() < n && getNumThreads() > 1UL &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+
+   bool singular( false );
+
+   if( !parallel )
+   {
+      for( size_t k=0UL; k<n && !singular; ++k ) {
+         singular = !op( lower ? k : n-k-1UL );
+      }
+   }
+   else
+   {
+      const size_t threshold( ( SPTRSV_SMP_THRESHOLD - 1UL ) / max( work, 1UL ) + 1UL );
+      std::atomic<bool> failed( false );
+
+      for( size_t l=0UL; l<schedule->levels() && !failed; ++l )
+      {
+         const size_t* rows( schedule->rows( l ) );
+
+         smpForRange( schedule->levelSize( l ), threshold, [rows,&op,&failed]( size_t begin, size_t end ) {
+            for( size_t r=begin; r<end && !failed; ++r ) {
+               if( !op( rows[r] ) )
+                  failed = true;
+            }
+         } );
+      }
+
+      singular = failed;
+   }
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solution of singular triangular system failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a sparse triangular system with a single right-hand side.
+// \ingroup solvers
+//
+// \param A The sparse triangular matrix.
+// \param x The right-hand side on entry, the solution on exit.
+// \param schedule The level schedule of the matrix (\a nullptr for a serial substitution).
+// \return void
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// In case no schedule is given, a column-major matrix is solved column by column.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT >  // Type of the dense vector
+void sptrsv( const SparseMatrix<MT,SO>& A, DenseVector<VT,false>& x, const LevelSchedule* schedule )
+{
+   constexpr bool lower( IsLower<MT>::value );
+   constexpr bool uni  ( IsUniTriangular<MT>::value );
+
+   const size_t n( (~A).rows() );
+   const size_t work( n > 0UL ? max( 1UL, (~A).nonZeros() / n ) : 1UL );
+
+   if( SO && schedule == nullptr ) {
+      sptrsvExecute( n, lower, nullptr, work, [&A,&x]( size_t j ) {
+         return sptrsvColumn<lower,uni>( ~A, ~x, j );
+      } );
+   }
+   else {
+      sptrsvExecute( n, lower, schedule, work, [&A,&x,schedule]( size_t i ) {
+         return sptrsvRow<lower,uni>( ~A, ~x, i, schedule );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a sparse triangular system with multiple right-hand sides.
+// \ingroup solvers
+//
+// \param A The sparse triangular matrix.
+// \param X The row-major right-hand sides on entry, the solutions on exit.
+// \param schedule The level schedule of the matrix (\a nullptr for a serial substitution).
+// \return void
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// In case no schedule is given, a column-major matrix is solved column by column.
+*/
+template< typename MT1   // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename MT2 > // Type of the dense matrix
+void sptrsm( const SparseMatrix<MT1,SO>& A, DenseMatrix<MT2,false>& X, const LevelSchedule* schedule )
+{
+   constexpr bool lower( IsLower<MT1>::value );
+   constexpr bool uni  ( IsUniTriangular<MT1>::value );
+
+   const size_t n( (~A).rows() );
+   const size_t work( n > 0UL ? max( 1UL, (~A).nonZeros() / n ) * (~X).columns() : 1UL );
+
+   if( SO && schedule == nullptr ) {
+      sptrsvExecute( n, lower, nullptr, work, [&A,&X]( size_t j ) {
+         return sptrsmColumn<lower,uni>( ~A, ~X, j );
+      } );
+   }
+   else {
+      sptrsvExecute( n, lower, schedule, work, [&A,&X,schedule]( size_t i ) {
+         return sptrsmRow<uni>( ~A, ~X, i, schedule );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a sparse triangular system with multiple right-hand sides stored in a
+//        row-major dense matrix with direct access to its elements.
+// \ingroup solvers
+//
+// \param A The sparse triangular matrix.
+// \param X The resulting solutions.
+// \param B The right-hand sides.
+// \param schedule The level schedule of the matrix (\a nullptr for a serial substitution).
+// \return void
+*/
+template< typename MT1   // Type of the sparse matrix
+        , bool SO1       // Storage order of the sparse matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsRowMajorMatrix<MT2>, HasMutableDataAccess<MT2> > >
+   sptrsmAssign( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                 const DenseMatrix<MT3,SO3>& B, const LevelSchedule* schedule )
+{
+   ~X = ~B;
+   sptrsm( ~A, ~X, schedule );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution of a sparse triangular system with multiple right-hand sides stored in a
+//        column-major dense matrix or a dense matrix without direct access to its elements.
+// \ingroup solvers
+//
+// \param A The sparse triangular matrix.
+// \param X The resulting solutions.
+// \param B The right-hand sides.
+// \param schedule The level schedule of the matrix (\a nullptr for a serial substitution).
+// \return void
+//
+// The substitution is performed on a row-major copy of the right-hand sides, since this
+// allows to update all right-hand sides of a row at once by means of vectorized operations.
+*/
+template< typename MT1   // Type of the sparse matrix
+        , bool SO1       // Storage order of the sparse matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+inline DisableIf_< And< IsRowMajorMatrix<MT2>, HasMutableDataAccess<MT2> > >
+   sptrsmAssign( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                 const DenseMatrix<MT3,SO3>& B, const LevelSchedule* schedule )
+{
+   DynamicMatrix< ElementType_<MT2>, false > W( ~B );
+   sptrsm( ~A, W, schedule );
+   ~X = W;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE TRIANGULAR SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular solve functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b, const LevelSchedule& schedule );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b );
+
+template< typename MT, bool SO, typename VT >
+DynamicVector< ElementType_<VT> > solve( const SparseMatrix<MT,SO>& A, const DenseVector<VT,false>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B, const LevelSchedule& schedule );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse triangular system \f$ Ax = b \f$ by means of the given level schedule.
+// \ingroup solvers
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Level schedule does not match the system matrix.
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a sparse lower (forward
+// substitution) or upper (backward substitution) triangular matrix \a A. \a A has to be a sparse
+// LowerMatrix, UniLowerMatrix, UpperMatrix, or UniUpperMatrix (or any other sparse triangular
+// matrix type, except strictly triangular matrices). The given level schedule has to be computed
+// for a matrix with the same sparsity pattern:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );
+
+   for( ... ) {
+      // ... Updating the values of L and b
+      solve( L, x, b, schedule );
+   }
+   \endcode
+
+// In case parallelization is enabled, the rows of each level of the schedule are distributed
+// among all available threads. Levels that don't contain enough work are solved by the calling
+// thread. In case the diagonal of \a A contains a zero element, a \a std::runtime_error exception
+// is thrown and the content of \a x is undefined. \a x and \a b may refer to the same vector.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b, const LevelSchedule& schedule )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !schedule.matches( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Level schedule does not match the system matrix" );
+   }
+
+   ~x = ~b;
+   sptrsv( ~A, ~x, &schedule );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse triangular system \f$ Ax = b \f$.
+// \ingroup solvers
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// This function solves the linear system of equations \f$ Ax = b \f$ for a sparse lower or upper
+// triangular matrix \a A by forward or backward substitution:
+
+   \code
+   blaze::UpperMatrix< blaze::CompressedMatrix<double> > U;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   solve( U, x, b );
+   \endcode
+
+// In contrast to the solve() function with level schedule, this function performs a serial
+// substitution (row by row for a row-major matrix and column by column for a column-major
+// matrix) and therefore doesn't have to analyze the sparsity pattern of \a A. In order to solve
+// the system in parallel, a LevelSchedule has to be computed and the solve() function with level
+// schedule has to be used. In case the diagonal of \a A contains a zero element, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   ~x = ~b;
+
+   sptrsv( ~A, ~x, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse triangular system \f$ Ax = b \f$.
+// \ingroup solvers
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param b The right-hand side vector.
+// \return The solution vector.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// This function returns the solution of the linear system of equations \f$ Ax = b \f$ for a
+// sparse lower or upper triangular matrix \a A:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> b;
+   // ... Resizing and initialization
+
+   const blaze::DynamicVector<double> x( solve( L, b ) );
+   \endcode
+
+// Note that this function performs a serial substitution in the same way as the solve()
+// function without level schedule.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT >  // Type of the right-hand side vector
+DynamicVector< ElementType_<VT> > solve( const SparseMatrix<MT,SO>& A, const DenseVector<VT,false>& b )
+{
+   DynamicVector< ElementType_<VT> > x;
+   solve( ~A, x, ~b );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse triangular system \f$ AX = B \f$ with multiple right-hand sides by
+//        means of the given level schedule.
+// \ingroup solvers
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param X The resulting solutions (one per column).
+// \param B The right-hand sides (one per column).
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Level schedule does not match the system matrix.
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// This function solves the linear system of equations \f$ AX = B \f$ for a sparse lower or upper
+// triangular matrix \a A and all columns of \a B at once. Each row of the system is substituted
+// for all right-hand sides at once by means of vectorized operations, i.e. every element of \a A
+// is loaded only once per solve. In case \a X is a row-major dense matrix with direct access to
+// its elements, the substitution is performed in-place. Otherwise it is performed on a temporary
+// row-major copy of \a B. The level schedule is used in the same way as for a single right-hand
+// side (see the solve() function for vectors).
+*/
+template< typename MT1   // Type of the system matrix
+        , bool SO1       // Storage order of the system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B, const LevelSchedule& schedule )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
+
+   if( (~A).rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !schedule.matches( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Level schedule does not match the system matrix" );
+   }
+
+   sptrsmAssign( ~A, ~X, ~B, &schedule );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the sparse triangular system \f$ AX = B \f$ with multiple right-hand sides.
+// \ingroup solvers
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param X The resulting solutions (one per column).
+// \param B The right-hand sides (one per column).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Singular triangular matrix detected.
+//
+// This function solves the linear system of equations \f$ AX = B \f$ for a sparse lower or upper
+// triangular matrix \a A and all columns of \a B at once:
+
+   \code
+   blaze::UniLowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicMatrix<double,blaze::rowMajor> X, B;
+   // ... Resizing and initialization
+
+   solve( L, X, B );
+   \endcode
+
+// As for a single right-hand side, this function performs a serial substitution. In order to
+// solve the system in parallel, a LevelSchedule has to be computed and the solve() function
+// with level schedule has to be used.
+*/
+template< typename MT1   // Type of the system matrix
+        , bool SO1       // Storage order of the system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
+
+   if( (~A).rows() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   sptrsmAssign( ~A, ~X, ~B, nullptr );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1396 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DynamicSparseMatrix.h
+//  \brief Implementation of a sparse matrix with per-row/column storage for incremental updates
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/BandTrait.h>
+#include <blaze/math/traits/ColumnsTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowsTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dynamic_sparse_matrix DynamicSparseMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sparse matrix with independent storage per row/column for incremental updates.
+// \ingroup dynamic_sparse_matrix
+//
+// The DynamicSparseMatrix class template is a sparse matrix that is designed for frequent
+// insertions and erasures of non-zero elements in arbitrary order, as for instance during the
+// adaptive refinement of a mesh. The type of the elements and the storage order of the matrix
+// can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class DynamicSparseMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. DynamicSparseMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// In contrast to the CompressedMatrix, which stores all non-zero elements in a single array,
+// each row (in case of a row-major matrix) or column (in case of a column-major matrix) of a
+// DynamicSparseMatrix owns a separate, geometrically growing array of value/index pairs. An
+// insertion or erasure therefore only moves the subsequent elements of the same row/column
+// and never triggers the reallocation of the complete matrix. In case the rows/columns are
+// short (as is typically the case for finite element or finite volume matrices), this results
+// in amortized constant time per insertion, independent of the order of the insertions. The
+// initial capacity (slack) of each row/column can be specified on construction or via the
+// reserve() function:
+
+   \code
+   using blaze::DynamicSparseMatrix;
+   using blaze::CompressedMatrix;
+
+   DynamicSparseMatrix<double> D( N, N, 27UL );  // Slack of 27 elements per row
+
+   // Incremental assembly and refinement in arbitrary order
+   D.add( 3, 7, 1.5 );  // Adding 1.5 to the element (3,7)
+   D.set( 0, 4, 2.0 );  // Setting the element (0,4) to 2.0
+   D.erase( 3, 7 );     // Erasing the element (3,7)
+
+   // Conversion to a compressed matrix for the compute-heavy phase
+   const CompressedMatrix<double> A( D.finalize() );
+   \endcode
+
+// A DynamicSparseMatrix provides the read-only interface of a sparse matrix and can therefore
+// be used as operand in all arithmetic operations and views:
+
+   \code
+   DynamicVector<double> y( D * x );
+   const auto r = row( D, 3UL );
+   \endcode
+
+// However, it cannot be the target of an assignment. All modifications have to be performed
+// via the set(), insert(), add() and erase() member functions.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class DynamicSparseMatrix
+   : public SparseMatrix< DynamicSparseMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Element = ValueIndexPair<Type>;  //!< Type of the stored value/index pairs.
+   using Line    = std::vector<Element>;  //!< Storage of a single row/column.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = DynamicSparseMatrix<Type,SO>;  //!< Type of this DynamicSparseMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;         //!< Base type of this DynamicSparseMatrix instance.
+   using ResultType     = CompressedMatrix<Type,SO>;     //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO>;    //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                          //!< Type of the matrix elements.
+   using ReturnType     = const Type&;                   //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                   //!< Data type for composite expression templates.
+   using Reference      = const Type&;                   //!< Reference to a matrix value.
+   using ConstReference = const Type&;                   //!< Reference to a constant matrix value.
+   using Iterator       = const Element*;                //!< Iterator over the elements.
+   using ConstIterator  = const Element*;                //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DynamicSparseMatrix() noexcept;
+   explicit inline DynamicSparseMatrix( size_t m, size_t n );
+   explicit inline DynamicSparseMatrix( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO2 >
+   explicit inline DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm );
+
+   DynamicSparseMatrix( const DynamicSparseMatrix& ) = default;
+   DynamicSparseMatrix( DynamicSparseMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   DynamicSparseMatrix& operator=( const DynamicSparseMatrix& ) = default;
+   DynamicSparseMatrix& operator=( DynamicSparseMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t i, size_t nonzeros );
+   inline void   shrinkToFit();
+   inline void   swap( DynamicSparseMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j, const Type& value );
+   inline Iterator insert( size_t i, size_t j, const Type& value );
+   inline Iterator add   ( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline bool erase( size_t i, size_t j );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Finalization functions**********************************************************************
+   /*!\name Finalization functions */
+   //@{
+   inline ResultType finalize() const;
+          void       finalize( ResultType& sm ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline typename Line::iterator position( size_t i, size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                  //!< The current number of rows of the matrix.
+   size_t n_;                  //!< The current number of columns of the matrix.
+   size_t nonZeros_;           //!< The total number of non-zero elements of the matrix.
+   std::vector<Line> lines_;  //!< The non-zero elements of all rows/columns.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type DynamicSparseMatrix<Type,SO>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DynamicSparseMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix() noexcept
+   : m_       ( 0UL )  // The current number of rows of the matrix
+   , n_       ( 0UL )  // The current number of columns of the matrix
+   , nonZeros_( 0UL )  // The total number of non-zero elements of the matrix
+   , lines_   ()       // The non-zero elements of all rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( size_t m, size_t n )
+   : m_       ( m )           // The current number of rows of the matrix
+   , n_       ( n )           // The current number of columns of the matrix
+   , nonZeros_( 0UL )         // The total number of non-zero elements of the matrix
+   , lines_   ( SO ? n : m )  // The non-zero elements of all rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix of size \f$ m \times n \f$ with initial slack.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The initial capacity of each row (row-major) or column (column-major).
+//
+// Note that in contrast to the CompressedMatrix the capacity is specified per row/column and
+// not for the complete matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( size_t m, size_t n, size_t nonzeros )
+   : DynamicSparseMatrix( m, n )
+{
+   for( Line& line : lines_ ) {
+      line.reserve( nonzeros );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied into the dynamic sparse matrix.
+//
+// This constructor initializes the dynamic sparse matrix as a copy of the given sparse matrix.
+// Matrices of the opposite storage order and all sparse matrix expressions are evaluated first.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline DynamicSparseMatrix<Type,SO>::DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm )
+   : DynamicSparseMatrix( (~sm).rows(), (~sm).columns() )
+{
+   const ResultType tmp( ~sm );
+
+   for( size_t i=0UL; i<lines_.size(); ++i ) {
+      lines_[i].assign( tmp.begin(i), tmp.end(i) );
+   }
+
+   nonZeros_ = tmp.nonZeros();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstReference
+   DynamicSparseMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstReference
+   DynamicSparseMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+   return lines_[i].data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+   return lines_[i].data() + lines_[i].size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total capacity of all rows/columns of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::capacity() const noexcept
+{
+   size_t capacity( 0UL );
+   for( const Line& line : lines_ ) {
+      capacity += line.capacity();
+   }
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+   return lines_[i].capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicSparseMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+   return lines_[i].size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements, but keeps the size and the capacity of all
+// rows/columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reset()
+{
+   for( Line& line : lines_ ) {
+      line.clear();
+   }
+   nonZeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be reset.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+
+   nonZeros_ -= lines_[i].size();
+   lines_[i].clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   nonZeros_ = 0UL;
+   lines_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. In case the
+// \a preserve flag is set to \a true, all elements within the new bounds are preserved and
+// the elements of the remaining rows/columns are untouched. Otherwise all elements are removed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void DynamicSparseMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   if( !preserve ) {
+      reset();
+   }
+
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   for( size_t i=major; i<lines_.size(); ++i ) {
+      nonZeros_ -= lines_[i].size();
+   }
+   lines_.resize( major );
+
+   if( minor < ( SO ? m_ : n_ ) ) {
+      for( Line& line : lines_ ) {
+         const auto pos( std::lower_bound( line.begin(), line.end(), minor,
+                                           []( const Element& element, size_t idx )
+                                           {
+                                              return element.index() < idx;
+                                           } ) );
+         nonZeros_ -= static_cast<size_t>( line.end() - pos );
+         line.erase( pos, line.end() );
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// In contrast to the CompressedMatrix, reserving capacity in a single row/column does not
+// affect the storage of any other row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lines_.size(), "Invalid dynamic sparse matrix row/column access index" );
+   lines_[i].reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity in all rows/columns.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::shrinkToFit()
+{
+   for( Line& line : lines_ ) {
+      line.shrink_to_fit();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dynamic sparse matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicSparseMatrix<Type,SO>::swap( DynamicSparseMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   lines_.swap( sm.lines_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first element not less than the given element.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Position within the according row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Line::iterator
+   DynamicSparseMatrix<Type,SO>::position( size_t i, size_t j )
+{
+   Line& line( lines_[SO ? j : i] );
+
+   return std::lower_bound( line.begin(), line.end(), SO ? i : j,
+                            []( const Element& element, size_t idx )
+                            {
+                               return element.index() < idx;
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the dynamic sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the matrix. In case the element is already
+// contained in the matrix its value is modified, else a new element with the given value is
+// inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   auto pos( position( i, j ) );
+
+   if( pos != line.end() && pos->index() == ( SO ? i : j ) ) {
+      pos->value() = value;
+   }
+   else {
+      pos = line.insert( pos, Element( value, SO ? i : j ) );
+      ++nonZeros_;
+   }
+
+   return line.data() + ( pos - line.begin() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the dynamic sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the matrix. However, duplicate elements are not
+// allowed. In case the matrix already contains an element with row index \a i and column
+// index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   auto pos( position( i, j ) );
+
+   if( pos != line.end() && pos->index() == ( SO ? i : j ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   pos = line.insert( pos, Element( value, SO ? i : j ) );
+   ++nonZeros_;
+
+   return line.data() + ( pos - line.begin() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a value to an element of the dynamic sparse matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value to be added to the element.
+// \return Iterator to the modified element.
+//
+// This function adds the given value to an element of the matrix. In case the element is not
+// yet contained in the matrix, a new element with the given value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::Iterator
+   DynamicSparseMatrix<Type,SO>::add( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   auto pos( position( i, j ) );
+
+   if( pos != line.end() && pos->index() == ( SO ? i : j ) ) {
+      pos->value() += value;
+   }
+   else {
+      pos = line.insert( pos, Element( value, SO ? i : j ) );
+      ++nonZeros_;
+   }
+
+   return line.data() + ( pos - line.begin() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the dynamic sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return \a true in case the element has been erased, \a false if it was not contained.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool DynamicSparseMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   Line& line( lines_[SO ? j : i] );
+   const auto pos( position( i, j ) );
+
+   if( pos == line.end() || pos->index() != ( SO ? i : j ) )
+      return false;
+
+   line.erase( pos );
+   --nonZeros_;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the dynamic sparse matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases all elements of the matrix for which the given unary predicate, which
+// is called with the value of the element, returns \a true, as for instance all elements that
+// have become (numerically) zero:
+
+   \code
+   D.erase( []( double value ){ return std::abs( value ) < 1E-8; } );
+   \endcode
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO >        // Storage order
+template< typename Pred >  // Type of the unary predicate
+inline void DynamicSparseMatrix<Type,SO>::erase( Pred predicate )
+{
+   for( Line& line : lines_ ) {
+      const auto pos( std::remove_if( line.begin(), line.end(),
+                                      [&predicate]( const Element& element )
+                                      {
+                                         return predicate( element.value() );
+                                      } ) );
+      nonZeros_ -= static_cast<size_t>( line.end() - pos );
+      line.erase( pos, line.end() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? i : j );
+
+   return std::lower_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                            []( const Element& element, size_t idx )
+                            {
+                               return element.index() < idx;
+                            } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ConstIterator
+   DynamicSparseMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? i : j );
+
+   return std::upper_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                            []( size_t idx, const Element& element )
+                            {
+                               return idx < element.index();
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FINALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the dynamic sparse matrix into a compressed matrix.
+//
+// \return The compressed matrix.
+//
+// This function converts the dynamic sparse matrix into a compressed matrix with the same
+// element type and storage order (see the finalize(ResultType&) function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DynamicSparseMatrix<Type,SO>::ResultType
+   DynamicSparseMatrix<Type,SO>::finalize() const
+{
+   ResultType sm;
+   finalize( sm );
+   return sm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of the dynamic sparse matrix into the given compressed matrix.
+//
+// \param sm The target compressed matrix.
+// \return void
+//
+// This function resizes the given compressed matrix to the size of the dynamic sparse matrix
+// and copies all non-zero elements in a single pass. The capacity of the compressed matrix is
+// set to exactly the number of non-zero elements via a single reserve() call, i.e. the
+// resulting compressed matrix does not require any further reallocation. The dynamic sparse
+// matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void DynamicSparseMatrix<Type,SO>::finalize( ResultType& sm ) const
+{
+   sm.reset();
+   sm.resize( m_, n_, false );
+   sm.reserve( nonZeros_ );
+
+   for( size_t i=0UL; i<lines_.size(); ++i ) {
+      for( const Element& element : lines_[i] ) {
+         sm.append( SO ? element.index() : i, SO ? i : element.index(), element.value() );
+      }
+      sm.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool DynamicSparseMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DYNAMICSPARSEMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DynamicSparseMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( DynamicSparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( DynamicSparseMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( DynamicSparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( DynamicSparseMatrix<Type,SO>& a, DynamicSparseMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( DynamicSparseMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( DynamicSparseMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given dynamic sparse matrix.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( DynamicSparseMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dynamic sparse matrices.
+// \ingroup dynamic_sparse_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( DynamicSparseMatrix<Type,SO>& a, DynamicSparseMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CSAs >
+struct SubmatrixTrait< DynamicSparseMatrix<T,SO>, CSAs... >
+   : public SubmatrixTrait< CompressedMatrix<T,SO>, CSAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowTrait< DynamicSparseMatrix<T,SO>, CRAs... >
+   : public RowTrait< CompressedMatrix<T,SO>, CRAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowsTrait< DynamicSparseMatrix<T,SO>, CRAs... >
+   : public RowsTrait< CompressedMatrix<T,SO>, CRAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnTrait< DynamicSparseMatrix<T,SO>, CCAs... >
+   : public ColumnTrait< CompressedMatrix<T,SO>, CCAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnsTrait< DynamicSparseMatrix<T,SO>, CCAs... >
+   : public ColumnsTrait< CompressedMatrix<T,SO>, CCAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, ptrdiff_t... CBAs >
+struct BandTrait< DynamicSparseMatrix<T,SO>, CBAs... >
+   : public BandTrait< CompressedMatrix<T,SO>, CBAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
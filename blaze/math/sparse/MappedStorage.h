@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedStorage.h
+//  \brief Header file for the memory-mapped storage of compressed matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDSTORAGE_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDSTORAGE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <string>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MAPPED STORAGE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Mapped storage functions for compressed matrices */
+//@{
+template< typename MT, bool SO >
+void saveMapped( const std::string& path, const SparseMatrix<MT,SO>& sm );
+
+template< typename Type, bool SO >
+void loadMapped( const std::string& path, CompressedMatrix<Type,SO>& sm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the byte offsets of the arrays of a mapped compressed matrix.
+// \ingroup compressed_matrix
+//
+// \param major The number of rows (row-major) or columns (column-major) of the matrix.
+// \param nonzeros The number of non-zero elements of the matrix.
+// \param indices The byte offset of the index array.
+// \param values The byte offset of the value array.
+// \return The total size of the file in bytes.
+// \exception std::invalid_argument Invalid size of mapped file.
+//
+// The file of a mapped compressed matrix consists of the header, the \a major+1 start offsets
+// of the rows/columns, the indices of the non-zero elements, and the values of the non-zero
+// elements. Each array starts at a cache line boundary. In case the total size of the file
+// cannot be represented by \c size_t, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+size_t mappedCompressedLayout( size_t major, size_t nonzeros, size_t& indices, size_t& values )
+{
+   const size_t limit( std::numeric_limits<size_t>::max() - 63UL );
+
+   if( major >= ( limit - sizeof( MappedHeader ) ) / sizeof( uint64_t ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   indices = nextMultiple<size_t>( sizeof( MappedHeader ) + ( major+1UL )*sizeof( uint64_t ), 64UL );
+
+   if( nonzeros > ( limit - indices ) / sizeof( uint64_t ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   values = nextMultiple<size_t>( indices + nonzeros*sizeof( uint64_t ), 64UL );
+
+   if( nonzeros > ( std::numeric_limits<size_t>::max() - values ) / sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   return values + nonzeros*sizeof( Type );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given sparse matrix in a file in the memory-mapped compressed format.
+// \ingroup compressed_matrix
+//
+// \param path The path of the file to be created.
+// \param sm The sparse matrix to be stored.
+// \return void
+// \exception std::runtime_error The file could not be created or mapped.
+//
+// This function stores the given sparse matrix in the compressed row (in case of a row-major
+// matrix) or compressed column (in case of a column-major matrix) format in the given file. In
+// contrast to the serialization via an Archive, the arrays of the matrix are stored in native
+// format and can be loaded via loadMapped() without any parsing:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::saveMapped( "A.bin", A );
+
+   blaze::CompressedMatrix<double> B;
+   blaze::loadMapped( "A.bin", B );
+   \endcode
+
+// In case the file already exists, it is overwritten.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void saveMapped( const std::string& path, const SparseMatrix<MT,SO>& sm )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t major   ( SO ? A.columns() : A.rows() );
+   const size_t nonzeros( A.nonZeros() );
+
+   size_t indexOffset, valueOffset;
+   MappedFile file( path, mappedCompressedLayout<ET>( major, nonzeros, indexOffset, valueOffset ) );
+
+   writeMappedHeader<ET>( file, MappedHeader::compressedMatrix, SO, A.rows(), A.columns(), 0UL, nonzeros );
+
+   uint64_t* offsets( reinterpret_cast<uint64_t*>( file.data() + sizeof( MappedHeader ) ) );
+   uint64_t* indices( reinterpret_cast<uint64_t*>( file.data() + indexOffset ) );
+   ET*       values ( reinterpret_cast<ET*>( file.data() + valueOffset ) );
+
+   size_t k( 0UL );
+   offsets[0] = 0UL;
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element, ++k ) {
+         indices[k] = element->index();
+         values [k] = element->value();
+      }
+      offsets[i+1UL] = k;
+   }
+
+   BLAZE_INTERNAL_ASSERT( k == nonzeros, "Invalid number of non-zero elements detected" );
+
+   file.sync();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a compressed matrix from a file in the memory-mapped compressed format.
+// \ingroup compressed_matrix
+//
+// \param path The path of the file to be loaded.
+// \param sm The target compressed matrix.
+// \return void
+// \exception std::invalid_argument Invalid or incompatible mapped file.
+// \exception std::runtime_error The file could not be opened or mapped.
+//
+// This function loads a compressed matrix that has previously been stored via saveMapped().
+// The file is mapped read-only and the arrays of the matrix are appended to the target matrix
+// in a single sequential pass. The element type and storage order of the target matrix must
+// match the stored matrix. In case of an error, the target matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void loadMapped( const std::string& path, CompressedMatrix<Type,SO>& sm )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const MappedFile file( path, readOnly );
+   const MappedHeader header( readMappedHeader<Type>( file, MappedHeader::compressedMatrix, SO ) );
+
+   const size_t m       ( header.rows     );
+   const size_t n       ( header.columns  );
+   const size_t nonzeros( header.nonZeros );
+   const size_t major   ( SO ? n : m );
+   const size_t minor   ( SO ? m : n );
+
+   size_t indexOffset, valueOffset;
+
+   if( file.size() < mappedCompressedLayout<Type>( major, nonzeros, indexOffset, valueOffset ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of mapped file" );
+   }
+
+   file.advise( sequentialAccess );
+
+   const uint64_t* offsets( reinterpret_cast<const uint64_t*>( file.data() + sizeof( MappedHeader ) ) );
+   const uint64_t* indices( reinterpret_cast<const uint64_t*>( file.data() + indexOffset ) );
+   const Type*     values ( reinterpret_cast<const Type*>( file.data() + valueOffset ) );
+
+   if( offsets[0] != 0UL || offsets[major] != nonzeros ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+   }
+
+   CompressedMatrix<Type,SO> tmp( m, n, nonzeros );
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      const size_t begin( offsets[i]     );
+      const size_t end  ( offsets[i+1UL] );
+
+      if( end < begin || end > nonzeros ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+      }
+
+      for( size_t k=begin; k<end; ++k )
+      {
+         if( indices[k] >= minor || ( k > begin && indices[k] <= indices[k-1UL] ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapped file" );
+         }
+
+         if( SO ) tmp.append( indices[k], i, values[k] );
+         else     tmp.append( i, indices[k], values[k] );
+      }
+
+      tmp.finalize( i );
+   }
+
+   sm.swap( tmp );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
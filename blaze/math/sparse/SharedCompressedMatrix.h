@@ -0,0 +1,1026 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SharedCompressedMatrix.h
+//  \brief Header file for the implementation of a read-only compressed matrix in shared memory
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SHAREDCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SHAREDCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <new>
+#include <string>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/MappedHeader.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/BandTrait.h>
+#include <blaze/math/traits/ColumnsTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowsTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/SharedMemory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup shared_compressed_matrix SharedCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only compressed matrix in a POSIX shared memory segment.
+// \ingroup shared_compressed_matrix
+//
+// The SharedCompressedMatrix class template is an immutable sparse matrix whose non-zero
+// elements are stored in a shared memory segment (see the SharedMemory class). Thus several
+// processes can use the same sparse matrix without copying it. The type of the elements and the
+// storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class SharedCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SharedCompressedMatrix can be used with
+//          any non-cv-qualified numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The segment starts with the same 64-byte header as the files of a MappedMatrix, followed by
+// the start offsets of all rows (in case of a row-major matrix) or columns (in case of a column-
+// major matrix) and the value/index pairs of all non-zero elements. Since the non-zero elements
+// are stored in the same format as the elements of a CompressedMatrix, a SharedCompressedMatrix
+// can be used in all sparse kernels without any conversion:
+
+   \code
+   using blaze::SharedCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   // Process 1: Placing the matrix A in the shared memory segment "/graph"
+   CompressedMatrix<float> A;
+   // ... Resizing and initialization
+   const SharedCompressedMatrix<float> G( "/graph", A );
+
+   // Processes 2-16: Attaching to the segment
+   const SharedCompressedMatrix<float> H( "/graph" );
+   DynamicVector<float> y( H * x );
+   \endcode
+
+// The segment is removed from the system as soon as the last SharedCompressedMatrix instance of
+// all processes has been destroyed. A SharedCompressedMatrix is neither copyable nor assignable.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class SharedCompressedMatrix
+   : public SparseMatrix< SharedCompressedMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Element = ValueIndexPair<Type>;  //!< Type of the stored value/index pairs.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SharedCompressedMatrix<Type,SO>;  //!< Type of this SharedCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;            //!< Base type of this SharedCompressedMatrix instance.
+   using ResultType     = CompressedMatrix<Type,SO>;        //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO>;       //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO>;       //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                             //!< Type of the matrix elements.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = const Type&;                      //!< Reference to a matrix value.
+   using ConstReference = const Type&;                      //!< Reference to a constant matrix value.
+   using Iterator       = const Element*;                   //!< Iterator over the elements.
+   using ConstIterator  = const Element*;                   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO2 >
+   explicit inline SharedCompressedMatrix( const std::string& name, const SparseMatrix<MT,SO2>& sm,
+                                           SharedPages pages = normalPages );
+
+   explicit inline SharedCompressedMatrix( const std::string& name );
+   explicit inline SharedCompressedMatrix( int fd );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t             rows() const noexcept;
+   inline size_t             columns() const noexcept;
+   inline size_t             capacity() const noexcept;
+   inline size_t             capacity( size_t i ) const noexcept;
+   inline size_t             nonZeros() const noexcept;
+   inline size_t             nonZeros( size_t i ) const noexcept;
+   inline const std::string& name() const noexcept;
+   inline int                fd() const noexcept;
+   inline size_t             references() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SharedCompressedMatrix( const std::string& name, const ResultType& sm,
+                                           SharedPages pages, const Element* );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t elementOffset( size_t major ) noexcept;
+
+   static inline const ResultType& evaluate( const ResultType& sm ) noexcept;
+
+   template< typename MT, bool SO2 >
+   static inline ResultType evaluate( const SparseMatrix<MT,SO2>& sm );
+
+   inline void attach();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SharedMemory segment_;     //!< The shared memory segment.
+   size_t m_;                 //!< The current number of rows of the matrix.
+   size_t n_;                 //!< The current number of columns of the matrix.
+   const uint64_t* offsets_;  //!< The start offsets of all rows/columns.
+   const Element* elements_;  //!< The non-zero elements of the matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type SharedCompressedMatrix<Type,SO>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Places the given sparse matrix in a new shared memory segment.
+//
+// \param name The name of the segment (e.g. "/graph") or an empty string.
+// \param sm The sparse matrix to be placed in the segment.
+// \param pages The page size flag of the segment (\a normalPages or \a hugePages).
+// \exception std::runtime_error The segment could not be created or mapped.
+//
+// This constructor creates a new shared memory segment and copies the non-zero elements of the
+// given sparse matrix into the segment. In case the given matrix is a CompressedMatrix of the
+// same element type and storage order, it is copied directly, all other matrices are evaluated
+// first. In case the name is empty, an anonymous segment is created, which can be attached by
+// other processes via its file descriptor (see the fd() function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline SharedCompressedMatrix<Type,SO>::SharedCompressedMatrix( const std::string& name,
+                                                                const SparseMatrix<MT,SO2>& sm,
+                                                                SharedPages pages )
+   : SharedCompressedMatrix( name, evaluate( ~sm ), pages, nullptr )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the existing shared memory segment of the given name.
+//
+// \param name The name of the segment.
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+// \exception std::runtime_error The segment could not be opened or mapped.
+//
+// This constructor attaches read-only to a segment that has previously been created by a
+// SharedCompressedMatrix with the same element type and storage order. The start offsets of
+// the rows/columns and the indices of the non-zero elements are validated, the values of the
+// non-zero elements are used as they are.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedCompressedMatrix<Type,SO>::SharedCompressedMatrix( const std::string& name )
+   : segment_ ( name, readOnly )  // The shared memory segment
+   , m_       ( 0UL )             // The current number of rows of the matrix
+   , n_       ( 0UL )             // The current number of columns of the matrix
+   , offsets_ ( nullptr )         // The start offsets of all rows/columns
+   , elements_( nullptr )         // The non-zero elements of the matrix
+{
+   attach();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the shared memory segment of the given file descriptor.
+//
+// \param fd The file descriptor of the segment.
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+// \exception std::runtime_error The segment could not be mapped.
+//
+// This constructor attaches read-only to a (named or anonymous) segment via a file descriptor,
+// which has for instance been inherited from the parent process. The given descriptor remains
+// open.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedCompressedMatrix<Type,SO>::SharedCompressedMatrix( int fd )
+   : segment_ ( fd, readOnly )  // The shared memory segment
+   , m_       ( 0UL )           // The current number of rows of the matrix
+   , n_       ( 0UL )           // The current number of columns of the matrix
+   , offsets_ ( nullptr )       // The start offsets of all rows/columns
+   , elements_( nullptr )       // The non-zero elements of the matrix
+{
+   attach();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Places the given compressed matrix in a new shared memory segment.
+//
+// \param name The name of the segment or an empty string.
+// \param sm The compressed matrix to be placed in the segment.
+// \param pages The page size flag of the segment.
+// \exception std::runtime_error The segment could not be created or mapped.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline SharedCompressedMatrix<Type,SO>::SharedCompressedMatrix( const std::string& name,
+                                                                const ResultType& sm,
+                                                                SharedPages pages, const Element* )
+   : segment_ ( name, elementOffset( SO ? sm.columns() : sm.rows() ) +   // The shared memory segment
+                      sm.nonZeros()*sizeof( Element ), pages )
+   , m_       ( sm.rows() )     // The current number of rows of the matrix
+   , n_       ( sm.columns() )  // The current number of columns of the matrix
+   , offsets_ ( nullptr )       // The start offsets of all rows/columns
+   , elements_( nullptr )       // The non-zero elements of the matrix
+{
+   const size_t major   ( SO ? n_ : m_ );
+   const size_t nonzeros( sm.nonZeros() );
+
+   writeMappedHeader<Type>( segment_, MappedHeader::compressedPairs, SO, m_, n_, 0UL, nonzeros );
+
+   uint64_t* offsets ( reinterpret_cast<uint64_t*>( segment_.data() + sizeof( MappedHeader ) ) );
+   Element*  elements( reinterpret_cast<Element*>( segment_.data() + elementOffset( major ) ) );
+
+   size_t k( 0UL );
+   offsets[0] = 0UL;
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( auto element=sm.begin(i); element!=sm.end(i); ++element, ++k ) {
+         ::new ( elements + k ) Element( element->value(), element->index() );
+      }
+      offsets[i+1UL] = k;
+   }
+
+   BLAZE_INTERNAL_ASSERT( k == nonzeros, "Invalid number of non-zero elements detected" );
+
+   offsets_  = offsets;
+   elements_ = elements;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstReference
+   SharedCompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstReference
+   SharedCompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed matrix row/column access index" );
+   return elements_ + offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed matrix row/column access index" );
+   return elements_ + offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix (i.e. the total number of non-zero elements).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::nonZeros() const noexcept
+{
+   return ( offsets_ != nullptr )?( offsets_[SO ? n_ : m_] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed matrix row/column access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the shared memory segment.
+//
+// \return The name of the segment (an empty string for anonymous and inherited segments).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const std::string& SharedCompressedMatrix<Type,SO>::name() const noexcept
+{
+   return segment_.name();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the file descriptor of the shared memory segment.
+//
+// \return The file descriptor of the segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline int SharedCompressedMatrix<Type,SO>::fd() const noexcept
+{
+   return segment_.fd();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of attached instances of all processes.
+//
+// \return The current number of instances attached to the shared memory segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::references() const noexcept
+{
+   return segment_.references();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the byte offset of the non-zero elements within the shared memory segment.
+//
+// \param major The number of rows (row-major) or columns (column-major) of the matrix.
+// \return The byte offset of the value/index pairs.
+//
+// The non-zero elements follow the header and the \f$ major+1 \f$ row/column offsets and are
+// aligned to a cache line boundary.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t SharedCompressedMatrix<Type,SO>::elementOffset( size_t major ) noexcept
+{
+   return nextMultiple<size_t>( sizeof( MappedHeader ) + ( major+1UL )*sizeof( uint64_t ), 64UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given compressed matrix as it is.
+//
+// \param sm The compressed matrix.
+// \return Reference to the given compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const typename SharedCompressedMatrix<Type,SO>::ResultType&
+   SharedCompressedMatrix<Type,SO>::evaluate( const ResultType& sm ) noexcept
+{
+   return sm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the given sparse matrix into a compressed matrix.
+//
+// \param sm The sparse matrix to be evaluated.
+// \return The evaluated compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline typename SharedCompressedMatrix<Type,SO>::ResultType
+   SharedCompressedMatrix<Type,SO>::evaluate( const SparseMatrix<MT,SO2>& sm )
+{
+   return ResultType( ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Validates the header and the non-zero elements of an attached segment.
+//
+// \return void
+// \exception std::invalid_argument Invalid or incompatible shared memory segment.
+//
+// This function checks that the start offsets of the rows/columns are sorted and that the
+// indices of the non-zero elements of each row/column are strictly increasing and within the
+// bounds of the matrix. The check requires a single sweep over the indices of the segment.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void SharedCompressedMatrix<Type,SO>::attach()
+{
+   const MappedHeader header( readMappedHeader<Type>( segment_, MappedHeader::compressedPairs, SO ) );
+
+   const size_t major   ( SO ? header.columns : header.rows );
+   const size_t minor   ( SO ? header.rows : header.columns );
+   const size_t nonzeros( header.nonZeros );
+
+   if( major >= segment_.size() / sizeof( uint64_t ) ||
+       nonzeros > segment_.size() / sizeof( Element ) ||
+       segment_.size() < elementOffset( major ) + nonzeros*sizeof( Element ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of shared memory segment" );
+   }
+
+   const uint64_t* offsets( reinterpret_cast<const uint64_t*>( segment_.data() + sizeof( MappedHeader ) ) );
+
+   if( offsets[0] != 0UL || offsets[major] != nonzeros ||
+       !std::is_sorted( offsets, offsets + major + 1UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid shared memory segment" );
+   }
+
+   const Element* elements( reinterpret_cast<const Element*>( segment_.data() + elementOffset( major ) ) );
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      const size_t begin( offsets[i]     );
+      const size_t end  ( offsets[i+1UL] );
+
+      for( size_t k=begin; k<end; ++k ) {
+         if( elements[k].index() >= minor ||
+             ( k > begin && elements[k].index() <= elements[k-1UL].index() ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid shared memory segment" );
+         }
+      }
+   }
+
+   m_        = header.rows;
+   n_        = header.columns;
+   offsets_  = offsets;
+   elements_ = elements;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? i : j );
+
+   return std::lower_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                            []( const Element& element, size_t idx )
+                            {
+                               return element.index() < idx;
+                            } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename SharedCompressedMatrix<Type,SO>::ConstIterator
+   SharedCompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   const size_t index( SO ? i : j );
+
+   return std::upper_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                            []( size_t idx, const Element& element )
+                            {
+                               return idx < element.index();
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool SharedCompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool SharedCompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool SharedCompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CSAs >
+struct SubmatrixTrait< SharedCompressedMatrix<T,SO>, CSAs... >
+   : public SubmatrixTrait< CompressedMatrix<T,SO>, CSAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowTrait< SharedCompressedMatrix<T,SO>, CRAs... >
+   : public RowTrait< CompressedMatrix<T,SO>, CRAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowsTrait< SharedCompressedMatrix<T,SO>, CRAs... >
+   : public RowsTrait< CompressedMatrix<T,SO>, CRAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnTrait< SharedCompressedMatrix<T,SO>, CCAs... >
+   : public ColumnTrait< CompressedMatrix<T,SO>, CCAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnsTrait< SharedCompressedMatrix<T,SO>, CCAs... >
+   : public ColumnsTrait< CompressedMatrix<T,SO>, CCAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, ptrdiff_t... CBAs >
+struct BandTrait< SharedCompressedMatrix<T,SO>, CBAs... >
+   : public BandTrait< CompressedMatrix<T,SO>, CBAs... >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,649 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletBuilder.h
+//  \brief Header file for the TripletBuilder class template
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETBUILDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup triplet_builder TripletBuilder
+// \ingroup sparse_matrix
+*/
+/*!\brief Bulk construction of compressed matrices from (row, column, value) triplets.
+// \ingroup triplet_builder
+//
+// The TripletBuilder class template collects the non-zero elements of a CompressedMatrix in
+// coordinate (COO) format, i.e. as (row, column, value) triplets in arbitrary order, and builds
+// the compressed matrix from all triplets at once. In contrast to the insert() and set()
+// functions of the CompressedMatrix, which shift all subsequent elements of a row/column, the
+// construction requires linear time in the number of triplets. The type of the elements and the
+// storage order of the resulting matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class TripletBuilder;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The triplets are stored in a configurable number of independent buffers. Different threads
+// can add triplets to different buffers concurrently without any synchronization, as for
+// instance during the assembly of a finite element system matrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::TripletBuilder;
+
+   TripletBuilder<double> builder( N, N, threads );
+
+   #pragma omp parallel for
+   for( size_t e=0UL; e<elements; ++e ) {
+      const size_t t( omp_get_thread_num() );
+      // ... Computation of the element matrix
+      for( ... )
+         builder.add( t, i, j, value );  // Adding a triplet to the buffer of thread t
+   }
+
+   CompressedMatrix<double> A;
+   builder.build( A );  // Summing up duplicate entries
+   \endcode
+
+// The build() function sorts all triplets by a parallel, stable two-pass radix sort (first by
+// column, then by row for row-major matrices and vice versa for column-major matrices), combines
+// all triplets with the same row and column index via the given binary operation (by default
+// the sum), and moves the result into the compressed matrix with exactly one reserve() call.
+// Duplicate entries are combined in the order of the buffers and, within each buffer, in the
+// order in which they have been added. The triplets are preserved, i.e. it is possible to build
+// several matrices from the same set of triplets.
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class TripletBuilder
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                      //!< Type of the matrix elements.
+   using MatrixType  = CompressedMatrix<Type,SO>;  //!< Type of the resulting compressed matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit TripletBuilder( size_t m, size_t n, size_t buffers = 1UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows   () const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t buffers() const noexcept;
+   inline size_t size   () const noexcept;
+   inline size_t size   ( size_t buffer ) const noexcept;
+   inline void   reserve( size_t buffer, size_t capacity );
+   inline void   add    ( size_t i, size_t j, const Type& value );
+   inline void   add    ( size_t buffer, size_t i, size_t j, const Type& value );
+   inline void   clear  ();
+
+   template< typename OP = Add >
+   void build( MatrixType& A, OP op = OP() ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Single non-zero element in coordinate format.
+   struct Triplet {
+      size_t row;     //!< The row index of the element.
+      size_t column;  //!< The column index of the element.
+      Type   value;   //!< The value of the element.
+   };
+
+   //! Cache line aligned buffer of triplets.
+   struct alignas( 64 ) Buffer {
+      std::vector<Triplet> triplets;  //!< The triplets added to the buffer.
+   };
+
+   //! Contiguous sequence of triplets.
+   using Segment = std::pair<const Triplet*,size_t>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Build functions*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename Func >
+   static void visit( const std::vector<Segment>& segments, size_t begin, size_t end, Func func );
+
+   template< typename Key >
+   static void radixPass( const std::vector<Segment>& segments, size_t total, Triplet* target,
+                          size_t keys, Key key, size_t partitions, size_t* offsets );
+
+   template< typename Func >
+   static void forEach( size_t partitions, Func func );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;  //!< The number of rows of the matrix.
+   size_t n_;  //!< The number of columns of the matrix.
+   std::vector< Buffer, AlignedAllocator<Buffer> > buffers_;  //!< The buffers of triplets.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for TripletBuilder.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param buffers The number of independent buffers (typically the number of threads).
+// \exception std::invalid_argument Invalid number of buffers.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+TripletBuilder<Type,SO>::TripletBuilder( size_t m, size_t n, size_t buffers )
+   : m_      ( m )        // The number of rows of the matrix
+   , n_      ( n )        // The number of columns of the matrix
+   , buffers_( buffers )  // The buffers of triplets
+{
+   if( buffers == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of buffers" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t TripletBuilder<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t TripletBuilder<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of independent buffers.
+//
+// \return The number of buffers.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t TripletBuilder<Type,SO>::buffers() const noexcept
+{
+   return buffers_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of triplets in all buffers.
+//
+// \return The total number of triplets.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t TripletBuilder<Type,SO>::size() const noexcept
+{
+   size_t total( 0UL );
+   for( const Buffer& buffer : buffers_ ) {
+      total += buffer.triplets.size();
+   }
+   return total;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of triplets in the specified buffer.
+//
+// \param buffer The index of the buffer \f$[0..buffers())\f$.
+// \return The number of triplets in the buffer.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t TripletBuilder<Type,SO>::size( size_t buffer ) const noexcept
+{
+   BLAZE_USER_ASSERT( buffer < buffers(), "Invalid buffer access index" );
+
+   return buffers_[buffer].triplets.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the specified buffer.
+//
+// \param buffer The index of the buffer \f$[0..buffers())\f$.
+// \param capacity The new minimum capacity of the buffer.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void TripletBuilder<Type,SO>::reserve( size_t buffer, size_t capacity )
+{
+   BLAZE_USER_ASSERT( buffer < buffers(), "Invalid buffer access index" );
+
+   buffers_[buffer].triplets.reserve( capacity );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a triplet to the first buffer.
+//
+// \param i The row index of the element \f$[0..M-1]\f$.
+// \param j The column index of the element \f$[0..N-1]\f$.
+// \param value The value of the element.
+// \return void
+// \exception std::out_of_range Invalid row or column access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void TripletBuilder<Type,SO>::add( size_t i, size_t j, const Type& value )
+{
+   add( 0UL, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a triplet to the specified buffer.
+//
+// \param buffer The index of the buffer \f$[0..buffers())\f$.
+// \param i The row index of the element \f$[0..M-1]\f$.
+// \param j The column index of the element \f$[0..N-1]\f$.
+// \param value The value of the element.
+// \return void
+// \exception std::out_of_range Invalid row or column access index.
+//
+// This function adds the triplet \f$ (i,j,value) \f$ to the given buffer. Different threads may
+// concurrently add triplets to different buffers. Triplets with the same row and column index
+// are allowed and are combined by the build() function. In case the row or column index is out
+// of range, a \a std::out_of_range exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void TripletBuilder<Type,SO>::add( size_t buffer, size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( buffer < buffers(), "Invalid buffer access index" );
+
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+
+   buffers_[buffer].triplets.push_back( Triplet{ i, j, value } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all triplets from all buffers.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void TripletBuilder<Type,SO>::clear()
+{
+   for( Buffer& buffer : buffers_ ) {
+      buffer.triplets.clear();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Building a compressed matrix from all triplets.
+//
+// \param A The target compressed matrix.
+// \param op The binary operation to combine duplicate elements (by default the sum).
+// \return void
+//
+// This function resizes the given compressed matrix to \f$ M \times N \f$ and sets its elements
+// to the given triplets. Triplets with the same row and column index are combined into a single
+// element via \f$ v = op( v, w ) \f$, in the order of the buffers and, within each buffer, in
+// the order in which they have been added. Note that the resulting matrix explicitly stores all
+// combined elements, even if their value is zero. In case the number of triplets exceeds the
+// SMP_DVECASSIGN_THRESHOLD, the sorting and combining of the triplets is parallelized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename OP >  // Type of the binary operation
+void TripletBuilder<Type,SO>::build( MatrixType& A, OP op ) const
+{
+   const size_t total( size() );
+   const size_t major( SO ? n_ : m_ );
+   const size_t minor( SO ? m_ : n_ );
+
+   const bool parallel( total >= SMP_DVECASSIGN_THRESHOLD &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+   const size_t partitions( parallel ? max( min( getNumThreads(), major ), 1UL ) : 1UL );
+
+   auto majorIndex = []( const Triplet& t ) { return SO ? t.column : t.row; };
+   auto minorIndex = []( const Triplet& t ) { return SO ? t.row : t.column; };
+
+   std::vector<Segment> segments;
+   for( const Buffer& buffer : buffers_ ) {
+      if( !buffer.triplets.empty() )
+         segments.emplace_back( buffer.triplets.data(), buffer.triplets.size() );
+   }
+
+   // Stable radix sort by the minor and the major index
+   std::vector<Triplet> tmp( total );
+   radixPass( segments, total, tmp.data(), minor, minorIndex, partitions, nullptr );
+
+   std::vector<Triplet> sorted( total );
+   std::vector<size_t> offsets( major+1UL );
+   radixPass( std::vector<Segment>( 1UL, Segment( tmp.data(), total ) ), total,
+              sorted.data(), major, majorIndex, partitions, offsets.data() );
+
+   // Combining all duplicate elements within each row/column
+   std::vector<size_t> nonzeros( major, 0UL );
+   const size_t block( ( major + partitions - 1UL ) / partitions );
+
+   forEach( partitions, [&]( size_t p )
+   {
+      const size_t jend( min( ( p+1UL ) * block, major ) );
+
+      for( size_t j=p*block; j<jend; ++j )
+      {
+         const size_t begin( offsets[j] );
+         const size_t end  ( offsets[j+1UL] );
+
+         if( begin == end ) continue;
+
+         size_t last( begin );
+         for( size_t k=begin+1UL; k<end; ++k ) {
+            if( minorIndex( sorted[k] ) == minorIndex( sorted[last] ) ) {
+               sorted[last].value = op( sorted[last].value, sorted[k].value );
+            }
+            else if( ++last != k ) {
+               sorted[last] = std::move( sorted[k] );
+            }
+         }
+
+         nonzeros[j] = last - begin + 1UL;
+      }
+   } );
+
+   size_t capacity( 0UL );
+   for( size_t j=0UL; j<major; ++j ) {
+      capacity += nonzeros[j];
+   }
+
+   // Moving the elements into the compressed matrix
+   A.reset();
+   A.resize( m_, n_, false );
+   A.reserve( capacity );
+
+   for( size_t j=0UL; j<major; ++j ) {
+      const size_t end( offsets[j] + nonzeros[j] );
+      for( size_t k=offsets[j]; k<end; ++k ) {
+         A.append( sorted[k].row, sorted[k].column, std::move( sorted[k].value ) );
+      }
+      A.finalize( j );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUILD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Visiting the triplets \f$[begin..end)\f$ of a sequence of segments.
+//
+// \param segments The sequence of segments.
+// \param begin The global index of the first triplet.
+// \param end The global index one past the last triplet.
+// \param func The function to be called for each triplet.
+// \return void
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO >        // Storage order
+template< typename Func >  // Type of the function
+void TripletBuilder<Type,SO>::visit( const std::vector<Segment>& segments,
+                                     size_t begin, size_t end, Func func )
+{
+   size_t offset( 0UL );
+
+   for( const Segment& segment : segments )
+   {
+      if( offset >= end ) break;
+
+      const size_t kbegin( begin > offset ? begin - offset : 0UL );
+      const size_t kend  ( min( end - offset, segment.second ) );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         func( segment.first[k] );
+      }
+
+      offset += segment.second;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single pass of the stable, parallel radix sort of the triplets.
+//
+// \param segments The sequence of segments to be sorted.
+// \param total The total number of triplets in all segments.
+// \param target The target array for the sorted triplets.
+// \param keys The number of distinct keys.
+// \param key The key of a triplet \f$[0..keys)\f$.
+// \param partitions The maximum number of partitions.
+// \param offsets The start offsets of all keys (may be \a nullptr).
+// \return void
+//
+// This function performs a counting sort of the given triplets. Each partition counts the keys
+// of a contiguous range of triplets, the exclusive prefix sum over all keys and partitions (in
+// this order) yields the target position of the first triplet of each key per partition, and
+// finally all partitions scatter their triplets to the target array. Since both the ranges and
+// the prefix sum follow the original order of the triplets, the sort is stable. Since every
+// partition requires a counter per key, the number of partitions is limited such that each
+// partition covers at least as many triplets as there are keys.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO >       // Storage order
+template< typename Key >  // Type of the key function
+void TripletBuilder<Type,SO>::radixPass( const std::vector<Segment>& segments, size_t total,
+                                         Triplet* target, size_t keys, Key key,
+                                         size_t partitions, size_t* offsets )
+{
+   partitions = max( min( partitions, total / max( keys, 1UL ) ), 1UL );
+
+   const size_t block( ( total + partitions - 1UL ) / partitions );
+
+   std::vector<size_t> counts( partitions*keys, 0UL );
+
+   forEach( partitions, [&]( size_t p ) {
+      size_t* count( counts.data() + p*keys );
+      visit( segments, p*block, min( ( p+1UL ) * block, total ),
+             [count,&key]( const Triplet& t ) { ++count[key(t)]; } );
+   } );
+
+   size_t sum( 0UL );
+   for( size_t k=0UL; k<keys; ++k ) {
+      if( offsets != nullptr )
+         offsets[k] = sum;
+      for( size_t p=0UL; p<partitions; ++p ) {
+         const size_t count( counts[p*keys+k] );
+         counts[p*keys+k] = sum;
+         sum += count;
+      }
+   }
+   if( offsets != nullptr )
+      offsets[keys] = sum;
+
+   BLAZE_INTERNAL_ASSERT( sum == total, "Invalid number of triplets detected" );
+
+   forEach( partitions, [&]( size_t p ) {
+      size_t* position( counts.data() + p*keys );
+      visit( segments, p*block, min( ( p+1UL ) * block, total ),
+             [position,target,&key]( const Triplet& t ) { target[position[key(t)]++] = t; } );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executing the given function for all partitions.
+//
+// \param partitions The number of partitions.
+// \param func The function to be called for each partition index.
+// \return void
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO >        // Storage order
+template< typename Func >  // Type of the function
+void TripletBuilder<Type,SO>::forEach( size_t partitions, Func func )
+{
+   smpForRange( partitions, 2UL, [&func]( size_t begin, size_t end ) {
+      for( size_t p=begin; p<end; ++p ) {
+         func( p );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -71,7 +71,7 @@ struct HasSIMDExpHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_SVML_MODE
+#if BLAZE_SVML_MODE || BLAZE_SIMD_APPROXIMATION_MODE
 template< typename T >
 struct HasSIMDExpHelper< T, EnableIf_< Or< IsFloat<T>, IsDouble<T> > > >
 {
@@ -89,13 +89,14 @@ struct HasSIMDExpHelper< T, EnableIf_< Or< IsFloat<T>, IsDouble<T> > > >
 /*!\brief Availability of a SIMD \c exp() operation for the given data type.
 // \ingroup math_type_traits
 //
-// Depending on the available instruction set (SSE, SSE2, SSE3, SSE4, AVX, AVX2, MIC, ...) and
-// the used compiler, this type trait provides the information whether a SIMD \c exp() operation
-// exists for the given data type \a T (ignoring the cv-qualifiers). In case the SIMD operation
-// is available, the \a value member constant is set to \a true, the nested type definition
-// \a Type is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set
-// to \a false, \a Type is \a FalseType, and the class derives from \a FalseType. The following
-// example assumes that the Intel SVML is available:
+// Depending on the available instruction set (SSE, SSE2, SSE3, SSE4, AVX, AVX2, MIC, ...) and the
+// used compiler, this type trait provides the information whether a SIMD \c exp() operation
+// exists for the given data type \a T (ignoring the cv-qualifiers). In case the SIMD operation is
+// available, the \a value member constant is set to \a true, the nested type definition \a Type
+// is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to \a false,
+// \a Type is \a FalseType, and the class derives from \a FalseType. The following example assumes
+// that the Intel SVML is available or that the built-in SIMD approximation is active (see the \c
+// BLAZE_SIMD_APPROXIMATION_MODE switch):
 
    \code
    blaze::HasSIMDExp< float >::value         // Evaluates to 1
@@ -0,0 +1,88 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsDispatchable.h
+//  \brief Header file for the IsDispatchable type trait
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISDISPATCHABLE_H_
+#define _BLAZE_MATH_TYPETRAITS_ISDISPATCHABLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for data types supported by the runtime dispatched kernels.
+// \ingroup math_type_traits
+//
+// This type trait tests whether or not the given template parameter is a data type that is
+// supported by the compute kernels that are selected at runtime according to the instruction
+// set of the executing CPU (see the \c BLAZE_USE_RUNTIME_DISPATCH switch). The dispatched
+// kernels support \c float and \c double values. If the runtime dispatch is active and the
+// type is supported, the \a value member constant is set to \a true, the nested type definition
+// \a Type is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to
+// \a false, \a Type is \a FalseType, and the class derives from \a FalseType.
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+
+   blaze::IsDispatchable< float >::value         // Evaluates to 1
+   blaze::IsDispatchable< double >::Type         // Results in TrueType
+   blaze::IsDispatchable< int >::value           // Evaluates to 0
+   blaze::IsDispatchable< complex<double> >      // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsDispatchable
+   : public And< BoolConstant< BLAZE_RUNTIME_DISPATCH_MODE != 0 >, Or< IsFloat<T>, IsDouble<T> > >
+{};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
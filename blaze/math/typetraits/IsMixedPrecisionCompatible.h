@@ -0,0 +1,167 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsMixedPrecisionCompatible.h
+//  \brief Header file for the IsMixedPrecisionCompatible type trait
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISMIXEDPRECISIONCOMPATIBLE_H_
+#define _BLAZE_MATH_TYPETRAITS_ISMIXEDPRECISIONCOMPATIBLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDConversion.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsBFloat16.h>
+#include <blaze/util/typetraits/IsFloat16.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1        // Element type of the target matrix
+        , typename T2        // Element type of the left-hand side matrix operand
+        , typename T3        // Element type of the right-hand side matrix operand
+        , typename = void >  // Restricting condition
+struct IsMixedPrecisionCompatibleHelper
+{
+   enum : bool { value = false };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsMixedPrecisionFloatOperand
+{
+   enum : bool { value = IsSame<T,float>::value ||
+                         ( ( IsBFloat16<T>::value || IsFloat16<T>::value ) &&
+                           HasSIMDConversion<T,float>::value ) };
+};
+
+template< typename T2, typename T3 >
+struct IsMixedPrecisionCompatibleHelper< float, T2, T3 >
+{
+   enum : bool { value = IsMixedPrecisionFloatOperand<T2>::value &&
+                         IsMixedPrecisionFloatOperand<T3>::value &&
+                         !( IsSame<T2,float>::value && IsSame<T3,float>::value ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsMixedPrecisionIntegralOperand
+{
+   enum : bool { value = IsSame<T,int8_t>::value ||
+                         IsSame<T,uint8_t>::value ||
+                         IsSame<T,int16_t>::value };
+};
+
+template< typename T2, typename T3 >
+struct IsMixedPrecisionCompatibleHelper< int32_t, T2, T3 >
+{
+   enum : bool { value = IsMixedPrecisionIntegralOperand<T2>::value &&
+                         IsMixedPrecisionIntegralOperand<T3>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compile time check for mixed precision dense matrix multiplications.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the dense matrix multiplication \f$ C = A * B \f$ with the
+// target matrix type \a MT1 and the operand types \a MT2 and \a MT3 can be computed by means
+// of the mixed precision kernels. This is the case if both operands provide low-level data
+// access, neither operand is diagonal, and either the target matrix has single precision
+// elements and at least one operand stores \c bfloat16 or \c float16 elements (that can be
+// converted via SIMD operations) while the other stores \c float, \c bfloat16 or \c float16
+// elements, or the target matrix has 32-bit integral elements and both operands store 8-bit
+// or 16-bit signed integral elements or 8-bit unsigned integral elements. In this case the
+// \a value member constant is set to \a true, the nested type definition \a Type is
+// \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to \a false,
+// \a Type is \a FalseType, and the class derives from \a FalseType. The following example
+// assumes that AVX is available:
+
+   \code
+   using blaze::DynamicMatrix;
+
+   blaze::IsMixedPrecisionCompatible< DynamicMatrix<float>
+                                    , DynamicMatrix<bfloat16>
+                                    , DynamicMatrix<float> >::value     // Evaluates to 1
+   blaze::IsMixedPrecisionCompatible< DynamicMatrix<int32_t>
+                                    , DynamicMatrix<int8_t>
+                                    , DynamicMatrix<uint8_t> >::Type    // Results in TrueType
+   blaze::IsMixedPrecisionCompatible< DynamicMatrix<float>
+                                    , DynamicMatrix<float>
+                                    , DynamicMatrix<float> >            // Is derived from FalseType
+   blaze::IsMixedPrecisionCompatible< DynamicMatrix<double>
+                                    , DynamicMatrix<float16>
+                                    , DynamicMatrix<float16> >::value   // Evaluates to 0
+   \endcode
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+struct IsMixedPrecisionCompatible
+   : public BoolConstant< HasConstDataAccess<MT2>::value &&
+                          HasConstDataAccess<MT3>::value &&
+                          !IsDiagonal<MT2>::value && !IsDiagonal<MT3>::value &&
+                          IsMixedPrecisionCompatibleHelper< Decay_< ElementType_<MT1> >
+                                                          , Decay_< ElementType_<MT2> >
+                                                          , Decay_< ElementType_<MT3> > >::value >
+{};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
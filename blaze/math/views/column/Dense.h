@@ -1445,7 +1445,7 @@ template< typename MT2       // Data type of the foreign dense column
 inline bool
    Column<MT,true,true,SF,CCAs...>::canAlias( const Column<MT2,SO2,true,SF2,CCAs2...>* alias ) const noexcept
 {
-   return matrix_.isAliased( alias->matrix_ ) && ( column() == alias->column() );
+   return matrix_.isAliased( &alias->matrix_ ) && ( column() == alias->column() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5477,7 +5477,7 @@ template< typename MT2       // Data type of the foreign dense column
 inline bool
    Column<MT,false,true,true,CCAs...>::canAlias( const Column<MT2,SO2,true,SF2,CCAs2...>* alias ) const noexcept
 {
-   return matrix_.isAliased( alias->matrix_ ) && ( column() == alias->column() );
+   return matrix_.isAliased( &alias->matrix_ ) && ( column() == alias->column() );
 }
 /*! \endcond */
 //*************************************************************************************************
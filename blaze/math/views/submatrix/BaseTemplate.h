@@ -65,6 +65,22 @@ class Submatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary tag for the overlap analysis of dense submatrix assignments.
+// \ingroup submatrix
+//
+// A pointer to a SubmatrixOperand refers to the underlying matrix of an assigned submatrix. It
+// is passed to the canAlias() function of the right-hand side operand in order to detect all
+// references to the underlying matrix that are not submatrices themselves. The class template
+// is intentionally never defined, since it is only used as pointer type.
+*/
+template< typename MT >  // Type of the underlying matrix
+struct SubmatrixOperand;
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
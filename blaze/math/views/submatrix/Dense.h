@@ -54,6 +54,7 @@
 #include <blaze/math/constraints/TransExpr.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/dense/InitializerMatrix.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/View.h>
@@ -68,9 +69,12 @@
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -113,6 +117,7 @@
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsReference.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/Unused.h>
 
 
@@ -701,6 +706,16 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value && HasConstDataAccess<MT2>::value &&
+                            HasSIMDTranspose< ElementType_<MT2>, ElementType >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -757,6 +772,9 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
    template< typename MT2, AlignmentFlag AF2, bool SO2, size_t... CSAs2 >
    inline bool isAliased( const Submatrix<MT2,AF2,SO2,true,CSAs2...>* alias ) const noexcept;
 
+   inline bool canAlias ( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+   inline bool isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
@@ -775,7 +793,12 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -816,6 +839,9 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
    /*!\name Utility functions */
    //@{
    inline bool hasOverlap() const noexcept;
+
+   template< typename MT2 >
+   inline bool canOverlap( const MT2& rhs ) const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -1371,7 +1397,7 @@ inline Submatrix<MT,unaligned,false,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( rhs.canAlias( &matrix_ ) ) {
+   if( canOverlap( rhs ) ) {
       const ResultType tmp( rhs );
       smpAssign( left, tmp );
    }
@@ -1428,7 +1454,7 @@ inline Submatrix<MT,unaligned,false,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( IsReference<Right>::value && right.canAlias( &matrix_ ) ) {
+   if( IsReference<Right>::value && canOverlap( right ) ) {
       const ResultType_<MT2> tmp( right );
       smpAssign( left, tmp );
    }
@@ -1485,7 +1511,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const AddType tmp( *this + (~rhs) );
       smpAssign( left, tmp );
    }
@@ -1594,7 +1620,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SubType tmp( *this - (~rhs ) );
       smpAssign( left, tmp );
    }
@@ -1702,7 +1728,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SchurType tmp( *this % (~rhs) );
       if( IsSparseMatrix<SchurType>::value )
          reset();
@@ -2074,6 +2100,37 @@ inline bool Submatrix<MT,unaligned,false,true,CSAs...>::hasOverlap() const noexc
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given right-hand side operand can overlap with the submatrix.
+//
+// \param rhs The right-hand side operand of an assignment to the submatrix.
+// \return \a true in case the operand can overlap with the submatrix, \a false if not.
+//
+// In contrast to a plain alias check with the underlying matrix, this function considers a
+// submatrix on the underlying matrix within the right-hand side operand as overlapping only
+// in case its region intersects with the region of this submatrix. All other references to
+// the underlying matrix are conservatively treated as overlapping. In case the underlying
+// matrix is symmetric or Hermitian, any two regions may alias via the mirrored elements and
+// therefore the plain alias check is used.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side operand
+inline bool Submatrix<MT,unaligned,false,true,CSAs...>::canOverlap( const MT2& rhs ) const noexcept
+{
+   using OperandAlias = SubmatrixOperand< RemoveCV_<MT> >;
+
+   if( IsSymmetric<MT>::value || IsHermitian<MT>::value )
+      return rhs.canAlias( &matrix_ );
+
+   return ( rhs.canAlias( reinterpret_cast<const OperandAlias*>( &matrix_ ) ) ||
+            rhs.canAlias( this ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2322,6 +2379,54 @@ inline bool
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix can alias with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it does not alias with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,unaligned,false,true,CSAs...>::canAlias( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix is aliased with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it is not aliased with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,unaligned,false,true,CSAs...>::isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns whether the submatrix is properly aligned in memory.
@@ -2724,7 +2829,8 @@ inline EnableIf_< typename Submatrix<MT,unaligned,false,true,CSAs...>::BLAZE_TEM
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+inline DisableIf_< typename Submatrix<MT,unaligned,false,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -2749,6 +2855,35 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,unaligned,false,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), data(), spacing(), columns(), rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -4012,6 +4147,16 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value && HasConstDataAccess<MT2>::value &&
+                            HasSIMDTranspose< ElementType_<MT2>, ElementType >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -4068,6 +4213,9 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
    template< typename MT2, AlignmentFlag AF2, bool SO2, size_t... CSAs2 >
    inline bool isAliased( const Submatrix<MT2,AF2,SO2,true,CSAs2...>* alias ) const noexcept;
 
+   inline bool canAlias ( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+   inline bool isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
@@ -4086,7 +4234,12 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -4127,6 +4280,9 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
    /*!\name Utility functions */
    //@{
    inline bool hasOverlap() const noexcept;
+
+   template< typename MT2 >
+   inline bool canOverlap( const MT2& rhs ) const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -4661,7 +4817,7 @@ inline Submatrix<MT,unaligned,true,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( rhs.canAlias( &matrix_ ) ) {
+   if( canOverlap( rhs ) ) {
       const ResultType tmp( rhs );
       smpAssign( left, tmp );
    }
@@ -4718,7 +4874,7 @@ inline Submatrix<MT,unaligned,true,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( IsReference<Right>::value && right.canAlias( &matrix_ ) ) {
+   if( IsReference<Right>::value && canOverlap( right ) ) {
       const ResultType_<MT2> tmp( right );
       smpAssign( left, tmp );
    }
@@ -4775,7 +4931,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const AddType tmp( *this + (~rhs) );
       smpAssign( left, tmp );
    }
@@ -4884,7 +5040,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SubType tmp( *this - (~rhs ) );
       smpAssign( left, tmp );
    }
@@ -4992,7 +5148,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SchurType tmp( *this % (~rhs) );
       if( IsSparseMatrix<SchurType>::value )
          reset();
@@ -5347,6 +5503,37 @@ inline bool Submatrix<MT,unaligned,true,true,CSAs...>::hasOverlap() const noexce
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given right-hand side operand can overlap with the submatrix.
+//
+// \param rhs The right-hand side operand of an assignment to the submatrix.
+// \return \a true in case the operand can overlap with the submatrix, \a false if not.
+//
+// In contrast to a plain alias check with the underlying matrix, this function considers a
+// submatrix on the underlying matrix within the right-hand side operand as overlapping only
+// in case its region intersects with the region of this submatrix. All other references to
+// the underlying matrix are conservatively treated as overlapping. In case the underlying
+// matrix is symmetric or Hermitian, any two regions may alias via the mirrored elements and
+// therefore the plain alias check is used.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side operand
+inline bool Submatrix<MT,unaligned,true,true,CSAs...>::canOverlap( const MT2& rhs ) const noexcept
+{
+   using OperandAlias = SubmatrixOperand< RemoveCV_<MT> >;
+
+   if( IsSymmetric<MT>::value || IsHermitian<MT>::value )
+      return rhs.canAlias( &matrix_ );
+
+   return ( rhs.canAlias( reinterpret_cast<const OperandAlias*>( &matrix_ ) ) ||
+            rhs.canAlias( this ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -5595,6 +5782,54 @@ inline bool
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix can alias with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it does not alias with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,unaligned,true,true,CSAs...>::canAlias( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix is aliased with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it is not aliased with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,unaligned,true,true,CSAs...>::isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns whether the submatrix is properly aligned in memory.
@@ -5991,7 +6226,8 @@ inline EnableIf_< typename Submatrix<MT,unaligned,true,true,CSAs...>::BLAZE_TEMP
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline DisableIf_< typename Submatrix<MT,unaligned,true,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -6016,6 +6252,35 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,unaligned,true,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), data(), spacing(), rows(), columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -6878,6 +7143,16 @@ class Submatrix<MT,aligned,false,true,CSAs...>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value && HasConstDataAccess<MT2>::value &&
+                            HasSIMDTranspose< ElementType_<MT2>, ElementType >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -6934,6 +7209,9 @@ class Submatrix<MT,aligned,false,true,CSAs...>
    template< typename MT2, AlignmentFlag AF2, bool SO2, size_t... CSAs2 >
    inline bool isAliased( const Submatrix<MT2,AF2,SO2,true,CSAs2...>* alias ) const noexcept;
 
+   inline bool canAlias ( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+   inline bool isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
@@ -6952,7 +7230,12 @@ class Submatrix<MT,aligned,false,true,CSAs...>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -6993,6 +7276,9 @@ class Submatrix<MT,aligned,false,true,CSAs...>
    /*!\name Utility functions */
    //@{
    inline bool hasOverlap() const noexcept;
+
+   template< typename MT2 >
+   inline bool canOverlap( const MT2& rhs ) const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -7546,7 +7832,7 @@ inline Submatrix<MT,aligned,false,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( rhs.canAlias( &matrix_ ) ) {
+   if( canOverlap( rhs ) ) {
       const ResultType tmp( rhs );
       smpAssign( left, tmp );
    }
@@ -7603,7 +7889,7 @@ inline Submatrix<MT,aligned,false,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( IsReference<Right>::value && right.canAlias( &matrix_ ) ) {
+   if( IsReference<Right>::value && canOverlap( right ) ) {
       const ResultType_<MT2> tmp( right );
       smpAssign( left, tmp );
    }
@@ -7660,7 +7946,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const AddType tmp( *this + (~rhs) );
       smpAssign( left, tmp );
    }
@@ -7769,7 +8055,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SubType tmp( *this - (~rhs ) );
       smpAssign( left, tmp );
    }
@@ -7877,7 +8163,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SchurType tmp( *this % (~rhs) );
       if( IsSparseMatrix<SchurType>::value )
          reset();
@@ -8249,6 +8535,37 @@ inline bool Submatrix<MT,aligned,false,true,CSAs...>::hasOverlap() const noexcep
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given right-hand side operand can overlap with the submatrix.
+//
+// \param rhs The right-hand side operand of an assignment to the submatrix.
+// \return \a true in case the operand can overlap with the submatrix, \a false if not.
+//
+// In contrast to a plain alias check with the underlying matrix, this function considers a
+// submatrix on the underlying matrix within the right-hand side operand as overlapping only
+// in case its region intersects with the region of this submatrix. All other references to
+// the underlying matrix are conservatively treated as overlapping. In case the underlying
+// matrix is symmetric or Hermitian, any two regions may alias via the mirrored elements and
+// therefore the plain alias check is used.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side operand
+inline bool Submatrix<MT,aligned,false,true,CSAs...>::canOverlap( const MT2& rhs ) const noexcept
+{
+   using OperandAlias = SubmatrixOperand< RemoveCV_<MT> >;
+
+   if( IsSymmetric<MT>::value || IsHermitian<MT>::value )
+      return rhs.canAlias( &matrix_ );
+
+   return ( rhs.canAlias( reinterpret_cast<const OperandAlias*>( &matrix_ ) ) ||
+            rhs.canAlias( this ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -8497,6 +8814,54 @@ inline bool
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix can alias with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it does not alias with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,aligned,false,true,CSAs...>::canAlias( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix is aliased with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it is not aliased with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,aligned,false,true,CSAs...>::isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns whether the submatrix is properly aligned in memory.
@@ -8891,7 +9256,8 @@ inline EnableIf_< typename Submatrix<MT,aligned,false,true,CSAs...>::BLAZE_TEMPL
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+inline DisableIf_< typename Submatrix<MT,aligned,false,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8916,6 +9282,35 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,aligned,false,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), data(), spacing(), columns(), rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -9777,6 +10172,16 @@ class Submatrix<MT,aligned,true,true,CSAs...>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct TransposeAssign {
+      enum : bool { value = useOptimizedKernels &&
+                            HasMutableDataAccess<MT>::value && HasConstDataAccess<MT2>::value &&
+                            HasSIMDTranspose< ElementType_<MT2>, ElementType >::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper structure for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -9833,6 +10238,9 @@ class Submatrix<MT,aligned,true,true,CSAs...>
    template< typename MT2, AlignmentFlag AF2, bool SO2, size_t... CSAs2 >
    inline bool isAliased( const Submatrix<MT2,AF2,SO2,true,CSAs2...>* alias ) const noexcept;
 
+   inline bool canAlias ( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+   inline bool isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept;
+
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
@@ -9851,7 +10259,12 @@ class Submatrix<MT,aligned,true,true,CSAs...>
    template< typename MT2 >
    inline EnableIf_< VectorizedAssign<MT2> > assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline DisableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline EnableIf_< TransposeAssign<MT2> > assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -9892,6 +10305,9 @@ class Submatrix<MT,aligned,true,true,CSAs...>
    /*!\name Utility functions */
    //@{
    inline bool hasOverlap() const noexcept;
+
+   template< typename MT2 >
+   inline bool canOverlap( const MT2& rhs ) const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -10426,7 +10842,7 @@ inline Submatrix<MT,aligned,true,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( rhs.canAlias( &matrix_ ) ) {
+   if( canOverlap( rhs ) ) {
       const ResultType tmp( rhs );
       smpAssign( left, tmp );
    }
@@ -10482,7 +10898,7 @@ inline Submatrix<MT,aligned,true,true,CSAs...>&
 
    decltype(auto) left( derestrict( *this ) );
 
-   if( IsReference<Right>::value && right.canAlias( &matrix_ ) ) {
+   if( IsReference<Right>::value && canOverlap( right ) ) {
       const ResultType_<MT2> tmp( right );
       smpAssign( left, tmp );
    }
@@ -10539,7 +10955,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const AddType tmp( *this + (~rhs) );
       smpAssign( left, tmp );
    }
@@ -10648,7 +11064,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SubType tmp( *this - (~rhs ) );
       smpAssign( left, tmp );
    }
@@ -10756,7 +11172,7 @@ inline DisableIf_< And< IsRestricted<MT>, RequiresEvaluation<MT2> >, Submatrix<M
    decltype(auto) left( derestrict( *this ) );
 
    if( ( ( IsSymmetric<MT>::value || IsHermitian<MT>::value ) && hasOverlap() ) ||
-       (~rhs).canAlias( &matrix_ ) ) {
+       canOverlap( ~rhs ) ) {
       const SchurType tmp( *this % (~rhs) );
       if( IsSparseMatrix<SchurType>::value )
          reset();
@@ -11111,6 +11527,37 @@ inline bool Submatrix<MT,aligned,true,true,CSAs...>::hasOverlap() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given right-hand side operand can overlap with the submatrix.
+//
+// \param rhs The right-hand side operand of an assignment to the submatrix.
+// \return \a true in case the operand can overlap with the submatrix, \a false if not.
+//
+// In contrast to a plain alias check with the underlying matrix, this function considers a
+// submatrix on the underlying matrix within the right-hand side operand as overlapping only
+// in case its region intersects with the region of this submatrix. All other references to
+// the underlying matrix are conservatively treated as overlapping. In case the underlying
+// matrix is symmetric or Hermitian, any two regions may alias via the mirrored elements and
+// therefore the plain alias check is used.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side operand
+inline bool Submatrix<MT,aligned,true,true,CSAs...>::canOverlap( const MT2& rhs ) const noexcept
+{
+   using OperandAlias = SubmatrixOperand< RemoveCV_<MT> >;
+
+   if( IsSymmetric<MT>::value || IsHermitian<MT>::value )
+      return rhs.canAlias( &matrix_ );
+
+   return ( rhs.canAlias( reinterpret_cast<const OperandAlias*>( &matrix_ ) ) ||
+            rhs.canAlias( this ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -11359,6 +11806,54 @@ inline bool
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix can alias with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it does not alias with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,aligned,true,true,CSAs...>::canAlias( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the submatrix is aliased with the given underlying matrix \a alias.
+//
+// \param alias The underlying matrix of the assigned submatrix.
+// \return \a false.
+//
+// This function is used by the overlap analysis of submatrix assignments (see canOverlap()).
+// Since the overlap of two submatrices on the same matrix is checked via their regions, the
+// submatrix reports that it is not aliased with the underlying matrix itself.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+inline bool
+   Submatrix<MT,aligned,true,true,CSAs...>::isAliased( const SubmatrixOperand< RemoveCV_<MT> >* alias ) const noexcept
+{
+   UNUSED_PARAMETER( alias );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns whether the submatrix is properly aligned in memory.
@@ -11746,7 +12241,8 @@ inline EnableIf_< typename Submatrix<MT,aligned,true,true,CSAs...>::BLAZE_TEMPLA
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline DisableIf_< typename Submatrix<MT,aligned,true,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -11771,6 +12267,35 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline EnableIf_< typename Submatrix<MT,aligned,true,true,CSAs...>::BLAZE_TEMPLATE TransposeAssign<MT2> >
+   Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeKernel( (~rhs).data(), (~rhs).spacing(), data(), spacing(), rows(), columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -149,4 +149,26 @@
 #endif
 //*************************************************************************************************
 
+
+//=================================================================================================
+//
+//  NUMA FIRST TOUCH CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first touch initialization.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallel first touch initialization of large
+// dense vectors and matrices. It is set to 1 in case the \c BLAZE_USE_NUMA_FIRST_TOUCH switch
+// is activated and any of the shared-memory parallelizations is enabled.
+*/
+#if BLAZE_USE_NUMA_FIRST_TOUCH && ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_HPX_PARALLEL_MODE )
+#define BLAZE_NUMA_FIRST_TOUCH_MODE 1
+#else
+#define BLAZE_NUMA_FIRST_TOUCH_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -284,6 +284,42 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX512VNNI mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX512VNNI mode. In case the AVX512VNNI mode is
+// enabled (i.e. in case AVX512VNNI functionality is available) the Blaze library attempts to
+// accelerate the accumulation of low precision integral products by means of the AVX512VNNI
+// dot product intrinsics. In case the AVX512VNNI mode is disabled, the Blaze library chooses
+// the according AVX512BW functionality instead.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512VNNI__)
+#  define BLAZE_AVX512VNNI_MODE 1
+#else
+#  define BLAZE_AVX512VNNI_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVXVNNI mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVXVNNI mode. In case the AVXVNNI mode is
+// enabled (i.e. in case AVXVNNI functionality is available) the Blaze library attempts to
+// accelerate the accumulation of low precision integral products by means of the VEX encoded
+// dot product intrinsics. In case the AVXVNNI mode is disabled, the Blaze library chooses the
+// according AVX2 functionality instead.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVXVNNI__)
+#  define BLAZE_AVXVNNI_MODE 1
+#else
+#  define BLAZE_AVXVNNI_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -328,6 +364,32 @@
 
 
 
+//=================================================================================================
+//
+//  F16C MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the F16C mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the F16C mode. In case the F16C mode is enabled
+// (i.e. in case the F16C instructions are available in combination with AVX) the Blaze library
+// converts between IEEE 754 half precision values (see the float16 class) and single precision
+// values by means of F16C intrinsics. In case the F16C mode is disabled, the Blaze library
+// chooses a (scalar) software conversion.
+*/
+#if BLAZE_AVX_MODE && defined(__F16C__)
+#  define BLAZE_F16C_MODE 1
+#else
+#  define BLAZE_F16C_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  SVML MODE CONFIGURATION
@@ -351,6 +413,97 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the SIMD approximation mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the SIMD approximation mode. In case the SIMD
+// approximation mode is enabled (i.e. in case it is requested via the
+// \c BLAZE_USE_SIMD_APPROXIMATION switch and the SVML is not available, but SSE2, AVX, or
+// AVX-512 functionality is available) the Blaze library vectorizes the exponential, logarithm,
+// power, sine, cosine, hyperbolic tangent, and error function by means of built-in polynomial
+// approximations. In case the SIMD approximation mode is disabled, these operations are either
+// vectorized via the SVML or the Blaze library chooses default, non-vectorized functionality.
+*/
+#if BLAZE_USE_SIMD_APPROXIMATION && BLAZE_SSE2_MODE && !BLAZE_SVML_MODE && !BLAZE_MIC_MODE
+#  define BLAZE_SIMD_APPROXIMATION_MODE 1
+#else
+#  define BLAZE_SIMD_APPROXIMATION_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case it is requested via the \c BLAZE_USE_RUNTIME_DISPATCH
+// switch and a GNU or Clang compatible compiler is used for an x86 platform), the performance
+// critical compute kernels of the Blaze library are additionally compiled for the SSE4, AVX2,
+// and AVX-512 instruction sets and the best variant for the executing CPU is selected at
+// runtime. In case the runtime dispatch mode is disabled, the Blaze library exclusively uses
+// the instruction set selected at compile time.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && !BLAZE_MIC_MODE && \
+    defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary macro for the emission of a pragma directive with macro arguments.
+// \ingroup system
+*/
+#define BLAZE_PRAGMA( DIRECTIVE ) _Pragma( #DIRECTIVE )
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\def BLAZE_TARGET_REGION_BEGIN
+// \brief Begin of a code region that is compiled for the given instruction set.
+// \ingroup system
+//
+// All functions that are defined between BLAZE_TARGET_REGION_BEGIN and BLAZE_TARGET_REGION_END
+// are compiled for the given target instruction set (as for instance "avx2,fma"), independent
+// of the instruction set selected on the command line. Note that the functions within such a
+// region must only be called after checking that the executing CPU supports the instruction set.
+*/
+/*!\def BLAZE_TARGET_REGION_END
+// \brief End of a code region that is compiled for a particular instruction set.
+// \ingroup system
+*/
+#if BLAZE_RUNTIME_DISPATCH_MODE && defined(__clang__)
+#  define BLAZE_TARGET_REGION_BEGIN( TARGET ) \
+      BLAZE_PRAGMA( clang attribute push( __attribute__((target(TARGET))), apply_to = function ) )
+#  define BLAZE_TARGET_REGION_END \
+      BLAZE_PRAGMA( clang attribute pop )
+#elif BLAZE_RUNTIME_DISPATCH_MODE
+#  define BLAZE_TARGET_REGION_BEGIN( TARGET ) \
+      BLAZE_PRAGMA( GCC push_options ) \
+      BLAZE_PRAGMA( GCC target( TARGET ) )
+#  define BLAZE_TARGET_REGION_END \
+      BLAZE_PRAGMA( GCC pop_options )
+#else
+#  define BLAZE_TARGET_REGION_BEGIN( TARGET )
+#  define BLAZE_TARGET_REGION_END
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -386,7 +539,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
 //
 //=================================================================================================
 
-#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE || BLAZE_RUNTIME_DISPATCH_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
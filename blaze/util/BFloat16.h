@@ -0,0 +1,293 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/BFloat16.h
+//  \brief Header file for the bfloat16 class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_BFLOAT16_H_
+#define _BLAZE_UTIL_BFLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Brain floating point data type (bfloat16).
+// \ingroup util
+//
+// The bfloat16 class represents a 16-bit floating point value with 1 sign bit, 8 exponent bits,
+// and 7 mantissa bits, i.e. the upper half of an IEEE 754 single precision value. It has the
+// same range as \c float, but only about three significant decimal digits. The bfloat16 class
+// is a pure storage type: it can be used as element type of vectors and matrices in order to
+// halve the memory footprint and bandwidth in comparison to \c float, whereas all arithmetic
+// operations are performed in single precision:
+
+   \code
+   blaze::DynamicMatrix<blaze::bfloat16> A( 1000UL, 1000UL );  // Weights in bfloat16 format
+   blaze::DynamicVector<float> x( 1000UL ), y;
+   // ... Initialization
+
+   y = A * x;  // Accumulation in single precision
+   \endcode
+
+// The conversion from \c float rounds to the nearest bfloat16 value (ties to even). NaN values
+// are preserved, infinities and zeros keep their sign, and subnormal values are rounded like
+// normal values.
+*/
+class bfloat16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline bfloat16() noexcept;
+   inline bfloat16( float value ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline bfloat16& operator+=( float rhs ) noexcept;
+   inline bfloat16& operator-=( float rhs ) noexcept;
+   inline bfloat16& operator*=( float rhs ) noexcept;
+   inline bfloat16& operator/=( float rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline bfloat16 fromBits( uint16_t bits ) noexcept;
+          inline uint16_t bits() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The bit pattern of the bfloat16 value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for bfloat16.
+//
+// The bfloat16 value is initialized to positive zero.
+*/
+inline bfloat16::bfloat16() noexcept
+   : bits_( 0U )  // The bit pattern of the bfloat16 value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest bfloat16 value (ties to even). NaN values are
+// converted to quiet NaN values.
+*/
+inline bfloat16::bfloat16( float value ) noexcept
+   : bits_()  // The bit pattern of the bfloat16 value
+{
+   uint32_t tmp;
+   std::memcpy( &tmp, &value, sizeof( tmp ) );
+
+   if( ( tmp & 0x7FFFFFFFU ) > 0x7F800000U ) {
+      bits_ = static_cast<uint16_t>( ( tmp >> 16 ) | 0x0040U );
+   }
+   else {
+      bits_ = static_cast<uint16_t>( ( tmp + 0x7FFFU + ( ( tmp >> 16 ) & 1U ) ) >> 16 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to a single precision value.
+//
+// \return The exact single precision representation of the bfloat16 value.
+*/
+inline bfloat16::operator float() const noexcept
+{
+   const uint32_t tmp( static_cast<uint32_t>( bits_ ) << 16 );
+   float value;
+   std::memcpy( &value, &tmp, sizeof( value ) );
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator+=( float rhs ) noexcept
+{
+   return *this = bfloat16( float( *this ) + rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator-=( float rhs ) noexcept
+{
+   return *this = bfloat16( float( *this ) - rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator*=( float rhs ) noexcept
+{
+   return *this = bfloat16( float( *this ) * rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator/=( float rhs ) noexcept
+{
+   return *this = bfloat16( float( *this ) / rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a bfloat16 value from the given bit pattern.
+//
+// \param bits The bit pattern of the bfloat16 value.
+// \return The bfloat16 value with the given bit pattern.
+*/
+inline bfloat16 bfloat16::fromBits( uint16_t bits ) noexcept
+{
+   bfloat16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the bit pattern of the bfloat16 value.
+//
+// \return The bit pattern of the bfloat16 value.
+*/
+inline uint16_t bfloat16::bits() const noexcept
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
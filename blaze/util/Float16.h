@@ -0,0 +1,330 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Float16.h
+//  \brief Header file for the float16 class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_FLOAT16_H_
+#define _BLAZE_UTIL_FLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief IEEE 754 half precision floating point data type (float16).
+// \ingroup util
+//
+// The float16 class represents a 16-bit IEEE 754 floating point value with 1 sign bit, 5 exponent
+// bits, and 10 mantissa bits. The largest finite float16 value is 65504, the smallest positive
+// normal value is \f$ 2^{-14} \f$. The float16 class is a pure storage type: it can be used as
+// element type of vectors and matrices in order to halve the memory footprint and bandwidth in
+// comparison to \c float, whereas all arithmetic operations are performed in single precision:
+
+   \code
+   blaze::DynamicMatrix<blaze::float16> A( 1000UL, 1000UL );  // Weights in half precision
+   blaze::DynamicVector<float> x( 1000UL ), y;
+   // ... Initialization
+
+   y = A * x;  // Accumulation in single precision
+   \endcode
+
+// The conversion from \c float rounds to the nearest float16 value (ties to even), including
+// the correct rounding to subnormal values. Values beyond the float16 range are converted to
+// infinity. In case the F16C mode is active (see the \c BLAZE_F16C_MODE switch), the conversion
+// is performed by means of the F16C instructions.
+*/
+class float16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline float16() noexcept;
+   inline float16( float value ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline float16& operator+=( float rhs ) noexcept;
+   inline float16& operator-=( float rhs ) noexcept;
+   inline float16& operator*=( float rhs ) noexcept;
+   inline float16& operator/=( float rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline float16  fromBits( uint16_t bits ) noexcept;
+          inline uint16_t bits() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The bit pattern of the float16 value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for float16.
+//
+// The float16 value is initialized to positive zero.
+*/
+inline float16::float16() noexcept
+   : bits_( 0U )  // The bit pattern of the float16 value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest float16 value (ties to even). Values beyond the
+// float16 range are converted to infinity, NaN values are converted to quiet NaN values.
+*/
+inline float16::float16( float value ) noexcept
+   : bits_()  // The bit pattern of the float16 value
+{
+#if BLAZE_F16C_MODE
+   bits_ = static_cast<uint16_t>( _cvtss_sh( value, 0 ) );
+#else
+   uint32_t tmp;
+   std::memcpy( &tmp, &value, sizeof( tmp ) );
+
+   const uint32_t sign( ( tmp >> 16 ) & 0x8000U );
+   tmp &= 0x7FFFFFFFU;
+
+   if( tmp >= 0x47800000U ) {  // Overflow, infinity, and NaN
+      bits_ = static_cast<uint16_t>( sign | ( ( tmp > 0x7F800000U )?( 0x7E00U ):( 0x7C00U ) ) );
+   }
+   else if( tmp < 0x38800000U ) {  // Subnormal values and zero
+      float abs;
+      std::memcpy( &abs, &tmp, sizeof( abs ) );
+      abs += 0.5F;  // Rounding by means of the floating point addition
+      std::memcpy( &tmp, &abs, sizeof( tmp ) );
+      bits_ = static_cast<uint16_t>( sign | ( tmp - 0x3F000000U ) );
+   }
+   else {  // Normal values
+      tmp += 0xC8000FFFU + ( ( tmp >> 13 ) & 1U );
+      bits_ = static_cast<uint16_t>( sign | ( tmp >> 13 ) );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to a single precision value.
+//
+// \return The exact single precision representation of the float16 value.
+*/
+inline float16::operator float() const noexcept
+{
+#if BLAZE_F16C_MODE
+   return _cvtsh_ss( bits_ );
+#else
+   uint32_t tmp( static_cast<uint32_t>( bits_ & 0x7FFFU ) << 13 );
+   const uint32_t exponent( tmp & 0x0F800000U );
+
+   tmp += 0x38000000U;  // Adjustment of the exponent bias
+
+   if( exponent == 0x0F800000U ) {  // Infinity and NaN
+      tmp += 0x38000000U;
+   }
+   else if( exponent == 0U ) {  // Subnormal values and zero
+      tmp += 0x00800000U;
+      float value;
+      std::memcpy( &value, &tmp, sizeof( value ) );
+      value -= 6.103515625E-5F;  // Renormalization by subtracting 2^-14
+      std::memcpy( &tmp, &value, sizeof( tmp ) );
+   }
+
+   tmp |= static_cast<uint32_t>( bits_ & 0x8000U ) << 16;
+
+   float value;
+   std::memcpy( &value, &tmp, sizeof( value ) );
+   return value;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator+=( float rhs ) noexcept
+{
+   return *this = float16( float( *this ) + rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator-=( float rhs ) noexcept
+{
+   return *this = float16( float( *this ) - rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator*=( float rhs ) noexcept
+{
+   return *this = float16( float( *this ) * rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator/=( float rhs ) noexcept
+{
+   return *this = float16( float( *this ) / rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a float16 value from the given bit pattern.
+//
+// \param bits The bit pattern of the float16 value.
+// \return The float16 value with the given bit pattern.
+*/
+inline float16 float16::fromBits( uint16_t bits ) noexcept
+{
+   float16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the bit pattern of the float16 value.
+//
+// \return The bit pattern of the float16 value.
+*/
+inline uint16_t float16::bits() const noexcept
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,558 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MAPPEDFILE_H_
+#define _BLAZE_UTIL_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MAPPING MODES AND ACCESS ADVICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access modes of memory-mapped files.
+// \ingroup util
+//
+// In case of \a readOnly the mapped memory cannot be modified. In case of \a readWrite all
+// modifications of the mapped memory are written back to the file. In case of \a copyOnWrite
+// the mapped memory can be modified, but all modifications are private to the mapping and
+// the file remains unchanged.
+*/
+enum MappingMode {
+   readOnly    = 0,  //!< Flag for read-only mappings.
+   readWrite   = 1,  //!< Flag for shared, writable mappings.
+   copyOnWrite = 2   //!< Flag for private, copy-on-write mappings.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access pattern advices for memory-mapped files.
+// \ingroup util
+//
+// The advices are passed to the operating system (via \c madvise()) as hints for the read-ahead
+// and the caching of the mapped pages. They do not change the semantics of the mapping.
+*/
+enum MappingAdvice {
+   normalAccess     = 0,  //!< No special treatment of the mapped pages.
+   sequentialAccess = 1,  //!< The pages are expected to be accessed in sequential order.
+   randomAccess     = 2,  //!< The pages are expected to be accessed in random order.
+   willNeed         = 3,  //!< The pages are expected to be accessed in the near future.
+   dontNeed         = 4   //!< The pages are not expected to be accessed in the near future.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory-mapped file.
+// \ingroup util
+//
+// The MappedFile class represents a file that is mapped into the address space of the process.
+// The file is opened and mapped during construction and unmapped and closed during destruction.
+// The following example demonstrates how to create a new file and how to map an existing file:
+
+   \code
+   blaze::MappedFile out( "data.bin", 4096UL );  // Creating a new file of 4096 bytes
+   out.data()[0] = 42U;
+   out.sync();
+
+   blaze::MappedFile in( "data.bin", blaze::readOnly );  // Mapping the existing file
+   in.advise( blaze::sequentialAccess );
+   \endcode
+
+// The mapping always starts at a page boundary, i.e. the mapped memory is aligned for all SIMD
+// instruction sets. Note that memory-mapped files are currently only supported on POSIX systems.
+// On all other platforms, the construction of a MappedFile results in a \a std::runtime_error
+// exception.
+*/
+class MappedFile
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedFile( const std::string& path, MappingMode mode = readOnly );
+   explicit inline MappedFile( const std::string& path, size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline byte_t*       data() noexcept;
+   inline const byte_t* data() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& path() const noexcept;
+   inline size_t             size() const noexcept;
+   inline MappingMode        mode() const noexcept;
+   inline void               resize( size_t size );
+   inline void               advise( MappingAdvice advice ) const noexcept;
+   inline void               advise( size_t offset, size_t length, MappingAdvice advice ) const noexcept;
+   inline void               sync() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map();
+   inline void unmap() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string path_;  //!< The path of the mapped file.
+   int fd_;            //!< The file descriptor of the mapped file.
+   byte_t* data_;      //!< The first byte of the mapped memory.
+   size_t size_;       //!< The size of the mapped file in bytes.
+   MappingMode mode_;  //!< The access mode of the mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the existing file at the given path.
+//
+// \param path The path of the file to be mapped.
+// \param mode The access mode of the mapping (\a readOnly, \a readWrite, or \a copyOnWrite).
+// \exception std::runtime_error The file could not be opened or mapped.
+*/
+inline MappedFile::MappedFile( const std::string& path, MappingMode mode )
+   : path_( path )     // The path of the mapped file
+   , fd_  ( -1 )       // The file descriptor of the mapped file
+   , data_( nullptr )  // The first byte of the mapped memory
+   , size_( 0UL )      // The size of the mapped file in bytes
+   , mode_( mode )     // The access mode of the mapping
+{
+#if defined(__unix__) || defined(__APPLE__)
+   fd_ = ::open( path_.c_str(), ( mode_ == readWrite )?( O_RDWR ):( O_RDONLY ) );
+
+   if( fd_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open file" );
+   }
+
+   struct stat info;
+
+   if( ::fstat( fd_, &info ) != 0 ) {
+      ::close( fd_ );
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to determine file size" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+
+   try {
+      map();
+   }
+   catch( ... ) {
+      ::close( fd_ );
+      throw;
+   }
+#else
+   BLAZE_THROW_RUNTIME_ERROR( "Memory-mapped files are not supported on this platform" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new file of the given size and maps it for reading and writing.
+//
+// \param path The path of the file to be created.
+// \param size The size of the file in bytes.
+// \exception std::runtime_error The file could not be created or mapped.
+//
+// In case the file already exists, it is truncated. The content of the new file is initialized
+// to zero.
+*/
+inline MappedFile::MappedFile( const std::string& path, size_t size )
+   : path_( path )       // The path of the mapped file
+   , fd_  ( -1 )         // The file descriptor of the mapped file
+   , data_( nullptr )    // The first byte of the mapped memory
+   , size_( size )       // The size of the mapped file in bytes
+   , mode_( readWrite )  // The access mode of the mapping
+{
+#if defined(__unix__) || defined(__APPLE__)
+   fd_ = ::open( path_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+
+   if( fd_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to create file" );
+   }
+
+   if( ::ftruncate( fd_, static_cast<off_t>( size_ ) ) != 0 ) {
+      ::close( fd_ );
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to resize file" );
+   }
+
+   try {
+      map();
+   }
+   catch( ... ) {
+      ::close( fd_ );
+      throw;
+   }
+#else
+   BLAZE_THROW_RUNTIME_ERROR( "Memory-mapped files are not supported on this platform" );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MappedFile.
+//
+// The destructor unmaps and closes the file. Note that in case of a \a readWrite mapping the
+// modifications are written back to the file by the operating system, but that the destructor
+// does not wait for the write-back. Call sync() to enforce the write-back.
+*/
+inline MappedFile::~MappedFile()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   unmap();
+   ::close( fd_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped memory.
+//
+// \return Pointer to the mapped memory (\c nullptr in case of an empty file).
+//
+// Note that the pointer is invalidated by a call to resize().
+*/
+inline byte_t* MappedFile::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped memory.
+//
+// \return Pointer to the mapped memory (\c nullptr in case of an empty file).
+//
+// Note that the pointer is invalidated by a call to resize().
+*/
+inline const byte_t* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the path of the mapped file.
+//
+// \return The path of the mapped file.
+*/
+inline const std::string& MappedFile::path() const noexcept
+{
+   return path_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MappingMode MappedFile::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the mapped file.
+//
+// \param size The new size of the file in bytes.
+// \return void
+// \exception std::logic_error Invalid resize of a read-only or copy-on-write mapping.
+// \exception std::runtime_error The file could not be resized or remapped.
+//
+// This function changes the size of the file and remaps it. The content of the file is preserved
+// up to the smaller of the old and the new size, additional bytes are initialized to zero. Note
+// that the mapping may be moved to a different address, i.e. all pointers into the previously
+// mapped memory are invalidated. Only \a readWrite mappings can be resized.
+*/
+inline void MappedFile::resize( size_t size )
+{
+   if( mode_ != readWrite ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid resize of a read-only mapping" );
+   }
+
+   if( size == size_ )
+      return;
+
+#if defined(__unix__) || defined(__APPLE__)
+   unmap();
+
+   if( ::ftruncate( fd_, static_cast<off_t>( size ) ) != 0 ) {
+      map();
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to resize file" );
+   }
+
+   size_ = size;
+   map();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advises the operating system about the access pattern of the entire mapping.
+//
+// \param advice The expected access pattern.
+// \return void
+*/
+inline void MappedFile::advise( MappingAdvice advice ) const noexcept
+{
+   advise( 0UL, size_, advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advises the operating system about the access pattern of a part of the mapping.
+//
+// \param offset The offset of the first byte of the range.
+// \param length The number of bytes of the range.
+// \param advice The expected access pattern.
+// \return void
+//
+// This function passes the given access advice for the byte range \f$ [offset..offset+length) \f$
+// to the operating system. The range is extended to page boundaries and limited to the size of
+// the file. Since the advice is only a hint, failures are silently ignored. Note that in case of
+// a \a copyOnWrite mapping the \a dontNeed advice is ignored, since it would discard all private
+// modifications of the affected pages.
+*/
+inline void MappedFile::advise( size_t offset, size_t length, MappingAdvice advice ) const noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( data_ == nullptr || offset >= size_ || length == 0UL )
+      return;
+
+   if( advice == dontNeed && mode_ == copyOnWrite )
+      return;
+
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( offset - offset % pagesize );
+   const size_t last ( ( length < size_ - offset )?( offset + length ):( size_ ) );
+
+   int flag( MADV_NORMAL );
+
+   switch( advice ) {
+      case sequentialAccess: flag = MADV_SEQUENTIAL; break;
+      case randomAccess    : flag = MADV_RANDOM    ; break;
+      case willNeed        : flag = MADV_WILLNEED  ; break;
+      case dontNeed        : flag = MADV_DONTNEED  ; break;
+      default              : flag = MADV_NORMAL    ; break;
+   }
+
+   ::madvise( data_ + first, last - first, flag );
+#else
+   UNUSED_PARAMETER( offset, length, advice );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the mapped memory back to the file.
+//
+// \return void
+// \exception std::runtime_error The file could not be synchronized.
+//
+// This function blocks until all modifications of a \a readWrite mapping have been written to
+// the file. In case of a \a readOnly or \a copyOnWrite mapping, the function has no effect.
+*/
+inline void MappedFile::sync() const
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( mode_ != readWrite || data_ == nullptr )
+      return;
+
+   if( ::msync( data_, size_, MS_SYNC ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to synchronize file" );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the opened file into the address space of the process.
+//
+// \return void
+// \exception std::runtime_error The file could not be mapped.
+*/
+inline void MappedFile::map()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( size_ == 0UL ) {
+      data_ = nullptr;
+      return;
+   }
+
+   const int protection( ( mode_ == readOnly )?( PROT_READ ):( PROT_READ | PROT_WRITE ) );
+   const int flags     ( ( mode_ == copyOnWrite )?( MAP_PRIVATE ):( MAP_SHARED ) );
+
+   void* ptr( ::mmap( nullptr, size_, protection, flags, fd_, 0 ) );
+
+   if( ptr == MAP_FAILED ) {
+      data_ = nullptr;
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to map file" );
+   }
+
+   data_ = static_cast<byte_t*>( ptr );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unmaps the file from the address space of the process.
+//
+// \return void
+*/
+inline void MappedFile::unmap() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( data_ != nullptr ) {
+      ::munmap( data_, size_ );
+      data_ = nullptr;
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,719 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/SharedMemory.h
+//  \brief Header file for the SharedMemory class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SHAREDMEMORY_H_
+#define _BLAZE_UTIL_SHAREDMEMORY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PAGE SIZES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Page sizes of shared memory segments.
+// \ingroup util
+//
+// In case of \a hugePages the size of a shared memory segment is rounded up to a multiple of
+// 2 MiB and the operating system is advised to back the segment by transparent huge pages (via
+// \c madvise()). This reduces the number of TLB misses for large segments. Since the advice
+// is only a hint, the segment silently falls back to normal pages in case huge pages are not
+// available (e.g. on Linux in case \c /sys/kernel/mm/transparent_hugepage/shmem_enabled is set
+// to \c never).
+*/
+enum SharedPages {
+   normalPages = 0,  //!< Flag for shared memory segments backed by normal pages.
+   hugePages   = 1   //!< Flag for shared memory segments backed by transparent huge pages.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reference counted POSIX shared memory segment.
+// \ingroup util
+//
+// The SharedMemory class represents a shared memory segment that is mapped into the address
+// space of several processes. A segment is either created or attached during construction and
+// detached during destruction:
+
+   \code
+   // Process 1: Creating the named segment "/weights" of 4096 bytes
+   blaze::SharedMemory segment( "/weights", 4096UL );
+   segment.data()[0] = 42U;
+
+   // Process 2: Attaching to the existing segment read-only
+   const blaze::SharedMemory weights( "/weights", blaze::readOnly );
+   \endcode
+
+// Named segments are created via \c shm_open(). In case the name is empty, an anonymous segment
+// is created via \c memfd_create() (Linux only), which can be attached via its file descriptor
+// (see the fd() function) by child processes or by processes that receive the descriptor via a
+// UNIX domain socket.
+//
+// All attached SharedMemory instances of all processes are counted within the segment. When the
+// last instance detaches, a named segment is removed from the system. Note that the counter is
+// not decremented by processes that terminate abnormally. Therefore the remove() function can be
+// used to remove leftover segments.
+//
+// The memory of the segment starts at a page boundary, i.e. it is aligned for all SIMD
+// instruction sets. Note that shared memory segments are currently only supported on POSIX
+// systems. On all other platforms, the construction of a SharedMemory results in a
+// \a std::runtime_error exception.
+*/
+class SharedMemory
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Control block at the beginning of each shared memory segment. */
+   struct ControlBlock
+   {
+      char                  magic[8];    //!< The magic number of the segment ("BLAZESHM").
+      uint32_t              version;     //!< The version of the control block.
+      uint32_t              pages;       //!< The page size flag of the segment.
+      uint64_t              offset;      //!< The offset of the user memory in bytes.
+      uint64_t              size;        //!< The size of the user memory in bytes.
+      std::atomic<uint64_t> references;  //!< The number of attached instances.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SharedMemory( const std::string& name, size_t size, SharedPages pages = normalPages );
+   explicit inline SharedMemory( const std::string& name, MappingMode mode = readOnly );
+   explicit inline SharedMemory( int fd, MappingMode mode = readOnly );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SharedMemory();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline byte_t*       data() noexcept;
+   inline const byte_t* data() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& name() const noexcept;
+   inline int                fd() const noexcept;
+   inline size_t             size() const noexcept;
+   inline MappingMode        mode() const noexcept;
+   inline SharedPages        pages() const noexcept;
+   inline size_t             references() const noexcept;
+
+   static inline void remove( const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( size_t bytes );
+   inline void attach();
+   inline void release() noexcept;
+
+   inline ControlBlock&       control() noexcept;
+   inline const ControlBlock& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string name_;   //!< The name of the segment (empty for anonymous segments).
+   int fd_;             //!< The file descriptor of the segment.
+   byte_t* base_;       //!< The first byte of the mapped segment (i.e. the control block).
+   size_t bytes_;       //!< The total size of the mapped segment in bytes.
+   size_t offset_;      //!< The offset of the user memory in bytes.
+   size_t size_;        //!< The size of the user memory in bytes.
+   MappingMode mode_;   //!< The access mode of the mapping.
+   SharedPages pages_;  //!< The page size flag of the segment.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( ATOMIC_LLONG_LOCK_FREE == 2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new shared memory segment of the given size.
+//
+// \param name The name of the segment (e.g. "/weights") or an empty string.
+// \param size The size of the segment in bytes.
+// \param pages The page size flag of the segment (\a normalPages or \a hugePages).
+// \exception std::runtime_error The segment could not be created or mapped.
+//
+// This constructor creates a new shared memory segment and maps it for reading and writing. The
+// content of the segment is initialized to zero. In case a segment of the given name already
+// exists, a \a std::runtime_error exception is thrown. In case the name is empty, an anonymous
+// segment is created, which can only be attached via its file descriptor.
+*/
+inline SharedMemory::SharedMemory( const std::string& name, size_t size, SharedPages pages )
+   : name_  ( name )       // The name of the segment
+   , fd_    ( -1 )         // The file descriptor of the segment
+   , base_  ( nullptr )    // The first byte of the mapped segment
+   , bytes_ ( 0UL )        // The total size of the mapped segment in bytes
+   , offset_( 0UL )        // The offset of the user memory in bytes
+   , size_  ( size )       // The size of the user memory in bytes
+   , mode_  ( readWrite )  // The access mode of the mapping
+   , pages_ ( pages )      // The page size flag of the segment
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( name_.empty() ) {
+#  if defined(__linux__)
+      fd_ = ::memfd_create( "blaze", MFD_CLOEXEC );
+#  endif
+   }
+   else {
+      fd_ = ::shm_open( name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600 );
+   }
+
+   if( fd_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to create shared memory segment" );
+   }
+
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t hugesize( 2UL*1024UL*1024UL );
+
+   offset_ = ( pagesize < sizeof( ControlBlock ) )?( sizeof( ControlBlock ) ):( pagesize );
+   bytes_  = offset_ + size_;
+
+   if( pages_ == hugePages ) {
+      bytes_ = ( ( bytes_ + hugesize - 1UL ) / hugesize ) * hugesize;
+   }
+
+   try {
+      if( ::ftruncate( fd_, static_cast<off_t>( bytes_ ) ) != 0 ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Unable to resize shared memory segment" );
+      }
+
+      map( bytes_ );
+   }
+   catch( ... ) {
+      if( !name_.empty() )
+         ::shm_unlink( name_.c_str() );
+      ::close( fd_ );
+      throw;
+   }
+
+#  if defined(MADV_HUGEPAGE)
+   if( pages_ == hugePages ) {
+      ::madvise( base_, bytes_, MADV_HUGEPAGE );
+   }
+#  endif
+
+   ControlBlock* block( new ( base_ ) ControlBlock );
+   block->version = 1U;
+   block->pages   = static_cast<uint32_t>( pages_ );
+   block->offset  = offset_;
+   block->size    = size_;
+   block->references.store( 1UL, std::memory_order_relaxed );
+
+   // The magic number is written last, such that attaching processes never see a partially
+   // initialized control block
+   std::atomic_thread_fence( std::memory_order_release );
+   std::memcpy( block->magic, "BLAZESHM", 8UL );
+#else
+   UNUSED_PARAMETER( size, pages );
+   BLAZE_THROW_RUNTIME_ERROR( "Shared memory segments are not supported on this platform" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the existing shared memory segment of the given name.
+//
+// \param name The name of the segment (e.g. "/weights").
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::invalid_argument Invalid mapping mode.
+// \exception std::invalid_argument Invalid shared memory segment.
+// \exception std::runtime_error The segment could not be opened or mapped.
+//
+// Note that \a copyOnWrite mappings of shared memory segments are not supported. In case of a
+// \a readOnly mapping, the memory of the segment cannot be modified. However, the segment has
+// to be opened for reading and writing in order to update the reference counter.
+*/
+inline SharedMemory::SharedMemory( const std::string& name, MappingMode mode )
+   : name_  ( name )         // The name of the segment
+   , fd_    ( -1 )           // The file descriptor of the segment
+   , base_  ( nullptr )      // The first byte of the mapped segment
+   , bytes_ ( 0UL )          // The total size of the mapped segment in bytes
+   , offset_( 0UL )          // The offset of the user memory in bytes
+   , size_  ( 0UL )          // The size of the user memory in bytes
+   , mode_  ( mode )         // The access mode of the mapping
+   , pages_ ( normalPages )  // The page size flag of the segment
+{
+   if( mode_ == copyOnWrite ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid copy-on-write mapping of shared memory" );
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   fd_ = ::shm_open( name_.c_str(), O_RDWR, 0 );
+
+   if( fd_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open shared memory segment" );
+   }
+
+   try {
+      attach();
+   }
+   catch( ... ) {
+      ::close( fd_ );
+      throw;
+   }
+#else
+   BLAZE_THROW_RUNTIME_ERROR( "Shared memory segments are not supported on this platform" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaches to the shared memory segment of the given file descriptor.
+//
+// \param fd The file descriptor of the segment.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::invalid_argument Invalid mapping mode.
+// \exception std::invalid_argument Invalid shared memory segment.
+// \exception std::runtime_error The segment could not be mapped.
+//
+// This constructor attaches to a (named or anonymous) segment via a file descriptor, which has
+// for instance been inherited from the parent process or has been received via a UNIX domain
+// socket. The given descriptor is duplicated, i.e. it remains open after the destruction of
+// the SharedMemory instance.
+*/
+inline SharedMemory::SharedMemory( int fd, MappingMode mode )
+   : name_  ()               // The name of the segment
+   , fd_    ( -1 )           // The file descriptor of the segment
+   , base_  ( nullptr )      // The first byte of the mapped segment
+   , bytes_ ( 0UL )          // The total size of the mapped segment in bytes
+   , offset_( 0UL )          // The offset of the user memory in bytes
+   , size_  ( 0UL )          // The size of the user memory in bytes
+   , mode_  ( mode )         // The access mode of the mapping
+   , pages_ ( normalPages )  // The page size flag of the segment
+{
+   if( mode_ == copyOnWrite ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid copy-on-write mapping of shared memory" );
+   }
+
+#if defined(__unix__) || defined(__APPLE__)
+   fd_ = ::dup( fd );
+
+   if( fd_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open shared memory segment" );
+   }
+
+   try {
+      attach();
+   }
+   catch( ... ) {
+      ::close( fd_ );
+      throw;
+   }
+#else
+   UNUSED_PARAMETER( fd );
+   BLAZE_THROW_RUNTIME_ERROR( "Shared memory segments are not supported on this platform" );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SharedMemory.
+//
+// The destructor detaches from the segment. In case this was the last attached instance and the
+// segment has been created or attached by name, the segment is removed from the system. Anonymous segments are released by the operating
+// system as soon as all file descriptors are closed.
+*/
+inline SharedMemory::~SharedMemory()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   release();
+   ::close( fd_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the shared memory.
+//
+// \return Pointer to the shared memory.
+*/
+inline byte_t* SharedMemory::data() noexcept
+{
+   return base_ + offset_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the shared memory.
+//
+// \return Pointer to the shared memory.
+*/
+inline const byte_t* SharedMemory::data() const noexcept
+{
+   return base_ + offset_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the name of the segment.
+//
+// \return The name of the segment (an empty string for anonymous and inherited segments).
+*/
+inline const std::string& SharedMemory::name() const noexcept
+{
+   return name_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the file descriptor of the segment.
+//
+// \return The file descriptor of the segment.
+//
+// The file descriptor can be passed to other processes, which can attach to the segment via
+// the according constructor.
+*/
+inline int SharedMemory::fd() const noexcept
+{
+   return fd_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the shared memory.
+//
+// \return The size of the shared memory in bytes.
+*/
+inline size_t SharedMemory::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MappingMode SharedMemory::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the page size flag of the segment.
+//
+// \return The page size flag of the segment.
+*/
+inline SharedPages SharedMemory::pages() const noexcept
+{
+   return pages_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of attached instances of all processes.
+//
+// \return The current number of attached SharedMemory instances.
+*/
+inline size_t SharedMemory::references() const noexcept
+{
+   return control().references.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the shared memory segment of the given name.
+//
+// \param name The name of the segment.
+// \return void
+// \exception std::runtime_error The segment could not be removed.
+//
+// This function removes the name of the segment from the system. Processes that are already
+// attached to the segment can continue to use it; the memory is released as soon as the last
+// process detaches. In case no segment of the given name exists, the function has no effect.
+*/
+inline void SharedMemory::remove( const std::string& name )
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( ::shm_unlink( name.c_str() ) != 0 && errno != ENOENT ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to remove shared memory segment" );
+   }
+#else
+   UNUSED_PARAMETER( name );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the opened segment into the address space of the process.
+//
+// \param bytes The total size of the segment in bytes.
+// \return void
+// \exception std::runtime_error The segment could not be mapped.
+*/
+inline void SharedMemory::map( size_t bytes )
+{
+#if defined(__unix__) || defined(__APPLE__)
+   void* ptr( ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0 ) );
+
+   if( ptr == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to map shared memory segment" );
+   }
+
+   base_  = static_cast<byte_t*>( ptr );
+   bytes_ = bytes;
+#else
+   UNUSED_PARAMETER( bytes );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps and validates an existing segment and increments its reference counter.
+//
+// \return void
+// \exception std::invalid_argument Invalid shared memory segment.
+// \exception std::runtime_error The segment could not be mapped.
+//
+// In case the reference counter of the segment has already dropped to zero (i.e. the segment
+// is just being removed), a \a std::runtime_error exception is thrown.
+*/
+inline void SharedMemory::attach()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   struct stat info;
+
+   if( ::fstat( fd_, &info ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to determine size of shared memory segment" );
+   }
+
+   const size_t bytes( static_cast<size_t>( info.st_size ) );
+
+   if( bytes < sizeof( ControlBlock ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid shared memory segment" );
+   }
+
+   map( bytes );
+
+   ControlBlock& block( control() );
+
+   if( std::memcmp( block.magic, "BLAZESHM", 8UL ) != 0 || block.version != 1U ||
+       block.offset < sizeof( ControlBlock ) || block.offset > bytes || block.size > bytes - block.offset ) {
+      ::munmap( base_, bytes_ );
+      base_ = nullptr;
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid shared memory segment" );
+   }
+
+   std::atomic_thread_fence( std::memory_order_acquire );
+
+   uint64_t references( block.references.load( std::memory_order_relaxed ) );
+
+   do {
+      if( references == 0UL ) {
+         ::munmap( base_, bytes_ );
+         base_ = nullptr;
+         BLAZE_THROW_RUNTIME_ERROR( "Shared memory segment is being removed" );
+      }
+   } while( !block.references.compare_exchange_weak( references, references+1UL, std::memory_order_acq_rel ) );
+
+   offset_ = block.offset;
+   size_   = block.size;
+   pages_  = static_cast<SharedPages>( block.pages );
+
+#  if defined(MADV_HUGEPAGE)
+   if( pages_ == hugePages ) {
+      ::madvise( base_, bytes_, MADV_HUGEPAGE );
+   }
+#  endif
+
+   if( mode_ == readOnly && bytes_ > offset_ ) {
+      ::mprotect( base_ + offset_, bytes_ - offset_, PROT_READ );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decrements the reference counter and unmaps the segment.
+//
+// \return void
+//
+// In case the reference counter drops to zero, a named segment is removed from the system.
+*/
+inline void SharedMemory::release() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( base_ == nullptr )
+      return;
+
+   if( control().references.fetch_sub( 1UL, std::memory_order_acq_rel ) == 1UL && !name_.empty() ) {
+      ::shm_unlink( name_.c_str() );
+   }
+
+   ::munmap( base_, bytes_ );
+   base_ = nullptr;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the control block of the segment.
+//
+// \return Reference to the control block.
+*/
+inline SharedMemory::ControlBlock& SharedMemory::control() noexcept
+{
+   return *reinterpret_cast<ControlBlock*>( base_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the control block of the segment.
+//
+// \return Reference to the control block.
+*/
+inline const SharedMemory::ControlBlock& SharedMemory::control() const noexcept
+{
+   return *reinterpret_cast<const ControlBlock*>( base_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
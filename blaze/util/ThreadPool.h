@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -48,6 +50,8 @@
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Spin.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
@@ -193,11 +197,62 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_affinity Thread affinity
+//
+// In addition to the schedule() function, which assigns a task to the next idle thread, the
+// scheduleOn() function assigns a task to a specific thread of the pool. Within the pool, all
+// threads are identified by the indices \f$[0..size()-1]\f$, which remain stable over time.
+// Furthermore, the threads of a pool can be pinned to a list of CPUs, either via the second
+// constructor argument or via the setAffinity() function. The thread with index \a i is pinned
+// to the CPU \f$ cpus[i \% cpus.size()] \f$ before executing its next task. In combination,
+// both features allow to repeatedly execute the same part of an operation on the same CPU:
+
+   \code
+   // Creating a thread pool with four threads pinned according to the compact policy
+   StdThreadPool threadpool( 4, blaze::threadpool::affinityCPUs( blaze::compactAffinity ) );
+
+   // Scheduling the same tasks to the same threads (and therefore CPUs) as before
+   for( size_t i=0UL; i<4UL; ++i )
+      threadpool.scheduleOn( i, Functor2(), i, 4 );
+   threadpool.wait();
+   \endcode
+
+// Note that thread pinning is currently only supported on Linux.
+//
+//
+// \section threadpool_spinning Fork-join latency
+//
+// By default, idle threads immediately go to sleep on a condition variable and the wait()
+// function puts the calling thread to sleep until all tasks have been completed. Waking up a
+// sleeping thread takes several microseconds, which dominates the runtime of short parallel
+// operations. Therefore it is possible to specify a spin time, either via the third constructor
+// argument or via the setSpinTime() function. In case the spin time is larger than 0, idle
+// threads busily wait for the given number of microseconds for new tasks before they go to
+// sleep and the wait() function busily waits for the completion of all tasks before putting
+// the calling thread to sleep:
+
+   \code
+   // Creating a thread pool with four unpinned threads spinning for 100 microseconds
+   StdThreadPool threadpool( 4, std::vector<size_t>(), 100UL );
+
+   // Scheduling a short task to each thread and waiting for their completion
+   for( size_t i=0UL; i<4UL; ++i )
+      threadpool.scheduleOn( i, Functor2(), i, 4 );
+   threadpool.wait();
+   \endcode
+
+// Note that spinning threads occupy their CPU. Thus a spin time should only be specified in
+// case the threads of the pool have the CPUs of the system to themselves.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
-// situation and has to throw an exception. However, exceptions thrown in the usual way
-// cannot be caught by a try-catch-block in the main thread of execution:
+// situation and has to throw an exception. An exception escaping a task does not terminate
+// the executing thread. Instead, the task is considered completed, the exception is captured
+// via \c std::current_exception() (see [1] or [2] for a detailed explanation how to portably
+// transport exceptions between threads) and is rethrown by the next call to the wait()
+// function:
 
    \code
    // Definition of a function throwing a std::runtime_error during its execution
@@ -208,71 +263,25 @@ namespace blaze {
       ...
    }
 
-   // Creating a thread pool executing the throwing function. Although the setup, the scheduling
-   // of the task, the wait() function and the destruction of the thread pool are encapsuled
-   // inside a try-catch-block, the exception cannot be caught and results in an abortion of the
-   // program.
+   // Creating a thread pool executing the throwing function. The exception thrown by the task
+   // is rethrown by the wait() function and can be caught in the main thread of execution.
    try {
-      StdThreadpool threadpool( 2 );
-      thread.schedule( task );
+      StdThreadPool threadpool( 2 );
+      threadpool.schedule( task );
       threadpool.wait();
    }
-   catch( ... )
-   {
-      ...
-   }
-   \endcode
-
-// For a detailed explanation how to portably transport exceptions between threads, see [1] or
-// [2]. In case of the Boost library, the according Boost functionality as demonstrated in the
-// following example has to be used. Note that any function/functor scheduled for execution is
-// responsible to handle exceptions in this way!
-
-   \code
-   #include <boost/bind.hpp>
-   #include <boost/exception_ptr.hpp>
-
-   // Definition of a function that happens to throw an exception. In order to throw the
-   // exception, boost::enable_current_exception() is used in combination with throw.
-   void throwException()
+   catch( std::runtime_error& ex )
    {
       ...
-      throw boost::enable_current_exception( std::runtime_error( ... ) );
-      ...
-   }
-
-   // Definition of a thread function. The try-catch-block catches the exception and uses the
-   // boost::current_exception() function to get a boost::exception_ptr object.
-   void task( boost::exception_ptr& error )
-   {
-      try {
-         throwException();
-         error = boost::exception_ptr();
-      }
-      catch( ... ) {
-         error = boost::current_exception();
-      }
-   }
-
-   // The function that start a thread of execution can pass along a boost::exception_ptr object
-   // that is set in case of an exception. Note that boost::current_exception() captures the
-   // original type of the exception object. The exception can be thrown again using the
-   // boost::rethrow_exception() function.
-   void work()
-   {
-      boost::exception_ptr error;
-
-      StdThreadPool threadpool( 2 );
-      threadpool.schedule( boost::bind( task, boost::ref(error) ) );
-      threadpool.wait();
-
-      if( error ) {
-         std::cerr << " Exception during thread execution!\n\n";
-         boost::rethrow_exception( error );
-      }
    }
    \endcode
 
+// In case several tasks throw an exception before wait() is called, only the first exception
+// is rethrown and all further exceptions are discarded. Note that all other scheduled tasks
+// are executed regardless of the exception, i.e. wait() only rethrows the exception after all
+// tasks have been completed.
+//
+//
 // \section threadpool_known_issues Known issues
 //
 // There is a known issue in Visual Studio 2012 and 2013 that may cause C++11 threads to hang
@@ -329,7 +338,8 @@ class ThreadPool
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, const std::vector<size_t>& cpus = std::vector<size_t>(),
+                        size_t spin = 0UL );
    //@}
    //**********************************************************************************************
 
@@ -343,10 +353,12 @@ class ThreadPool
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline bool   isEmpty() const;
-   inline size_t size()    const;
-   inline size_t active()  const;
-   inline size_t ready()   const;
+   inline bool                isEmpty()  const;
+   inline size_t              size()     const;
+   inline size_t              active()   const;
+   inline size_t              ready()    const;
+   inline std::vector<size_t> affinity() const;
+   inline size_t              spinTime() const;
    //@}
    //**********************************************************************************************
 
@@ -355,6 +367,9 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void scheduleOn( size_t index, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -364,6 +379,8 @@ class ThreadPool
    void resize( size_t n, bool block=false );
    void wait();
    void clear();
+   void setAffinity( const std::vector<size_t>& cpus );
+   void setSpinTime( size_t spin );
    //@}
    //**********************************************************************************************
 
@@ -371,8 +388,8 @@ class ThreadPool
    //**Thread functions****************************************************************************
    /*!\name Thread functions */
    //@{
-   void createThread();
-   bool executeTask();
+   void createThread( size_t index );
+   bool executeTask( size_t index );
    //@}
    //**********************************************************************************************
 
@@ -384,8 +401,23 @@ class ThreadPool
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
+   volatile size_t pending_;   //!< Number of tasks scheduled for specific threads.
    Threads threads_;           //!< The threads contained in the thread pool.
    TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+   std::vector<TaskQueue> queues_;    //!< Task queues for the tasks of specific threads.
+   std::vector<bool>      occupied_;  //!< Flags for the thread indices in use.
+   std::vector<size_t>    pinned_;    //!< The affinity version each thread is pinned to.
+   std::vector<size_t>    cpus_;      //!< The CPUs the threads are pinned to.
+   size_t                 version_;   //!< The current version of the thread affinity.
+   std::atomic<size_t>    epoch_;       //!< Counter for the state changes of the thread pool.
+                                        /*!< The counter is increased with every scheduled
+                                             task and every resize and is polled by the
+                                             spinning idle threads. */
+   std::atomic<size_t>    unfinished_;  //!< Number of scheduled, but not yet completed tasks.
+   std::atomic<size_t>    spin_;        //!< Spin time of idle threads in microseconds.
+   std::exception_ptr     error_;       //!< The first exception thrown by a task.
+                                        /*!< The exception is rethrown and reset by the
+                                             next call to the wait() function. */
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
@@ -413,20 +445,33 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param cpus The CPUs the threads are pinned to (empty for unpinned threads).
+// \param spin The spin time of idle threads in microseconds (0 for no spinning).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case \a cpus is not empty, the thread with
+// index \a i is pinned to the CPU \f$ cpus[i \% cpus.size()] \f$.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, const std::vector<size_t>& cpus, size_t spin )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
+   , pending_ ( 0UL )  // Number of tasks scheduled for specific threads
    , threads_      ()  // The threads contained in the thread pool
    , taskqueue_    ()  // Task queue for the scheduled tasks
+   , queues_       ()  // Task queues for the tasks of specific threads
+   , occupied_     ()  // Flags for the thread indices in use
+   , pinned_       ()  // The affinity version each thread is pinned to
+   , cpus_     ( cpus )  // The CPUs the threads are pinned to
+   , version_  ( 1UL  )  // The current version of the thread affinity
+   , epoch_     ( 0UL  )  // Counter for the state changes of the thread pool
+   , unfinished_( 0UL  )  // Number of scheduled, but not yet completed tasks
+   , spin_      ( spin )  // Spin time of idle threads in microseconds
+   , error_     ()        // The first exception thrown by a task
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
@@ -460,9 +505,14 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 
    // Removing all currently queued tasks
    taskqueue_.clear();
+   for( TaskQueue& queue : queues_ ) {
+      queue.clear();
+   }
+   pending_ = 0UL;
 
    // Setting the expected number of threads
    expected_ = 0UL;
+   ++epoch_;
 
    // Notifying all idle threads
    waitForTask_.notify_all();
@@ -503,7 +553,7 @@ template< typename TT    // Type of the encapsulated thread
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
    Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return taskqueue_.isEmpty() && pending_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -559,6 +609,39 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the CPUs the threads of the thread pool are pinned to.
+//
+// \return The list of CPUs (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadPool<TT,MT,LT,CT>::affinity() const
+{
+   Lock lock( mutex_ );
+   return cpus_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spin time of idle threads.
+//
+// \return The spin time in microseconds (0 in case idle threads don't spin).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::spinTime() const
+{
+   return spin_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -588,11 +671,52 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
    Lock lock( mutex_ );
    taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++unfinished_;
+   ++epoch_;
    waitForTask_.notify_one();
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution by a specific thread.
+//
+// \param index The index of the executing thread \f$[0..size()-1]\f$.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+// \exception std::invalid_argument Invalid thread index.
+//
+// This function schedules the given function/functor for execution by the thread with the
+// given index. In contrast to the schedule() function the task is not executed by the next
+// idle thread, but is guaranteed to be executed by the specified thread (and therefore on the
+// CPU this thread is pinned to). In case \a index is not a valid thread index, a
+// \a std::invalid_argument exception is thrown. The given function/functor must be copyable,
+// must be callable with the given type and number of arguments and must return \c void.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::scheduleOn( size_t index, Callable func, Args&&... args )
+{
+   Lock lock( mutex_ );
+
+   if( index >= expected_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread index" );
+   }
+
+   queues_[index].push( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++pending_;
+   ++unfinished_;
+   ++epoch_;
+   waitForTask_.notify_all();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -658,15 +782,19 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
    {
       Lock lock( mutex_ );
 
-      // Adding new threads to the thread pool
+      // Adding new threads to the thread pool (threads that are about to be removed are kept)
       if( n > expected_ ) {
-         for( size_t i=expected_; i<n; ++i )
-            createThread();
+         for( size_t i=expected_; i<n; ++i ) {
+            if( i >= occupied_.size() || !occupied_[i] )
+               createThread( i );
+         }
+         expected_ = n;
       }
 
       // Removing threads from the pool
       else {
          expected_ = n;
+         ++epoch_;
          waitForTask_.notify_all();
 
          while( block && total_ != expected_ ) {
@@ -692,7 +820,11 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. In case a spin time has
+// been specified, the calling thread busily waits for the completion of the tasks for at most
+// the given time before it goes to sleep. In case any task has thrown an exception since the
+// last call to wait(), the first of these exceptions is rethrown after all tasks have been
+// completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -700,11 +832,20 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
+   threadpool::spinWait( [this]() { return unfinished_ == 0UL; }, spin_ );
+
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   while( unfinished_ != 0UL ) {
       waitForThread_.wait( lock );
    }
+
+   if( error_ ) {
+      const std::exception_ptr error( error_ );
+      error_ = nullptr;
+      lock.unlock();
+      std::rethrow_exception( error );
+   }
 }
 //*************************************************************************************************
 
@@ -724,7 +865,58 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
+   unfinished_ -= taskqueue_.size() + pending_;
    taskqueue_.clear();
+   for( TaskQueue& queue : queues_ ) {
+      queue.clear();
+   }
+   pending_ = 0UL;
+   waitForThread_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the CPUs the threads of the thread pool are pinned to.
+//
+// \param cpus The new list of CPUs (empty for unpinned threads).
+// \return void
+//
+// This function changes the thread affinity of the thread pool. The thread with index \a i is
+// pinned to the CPU \f$ cpus[i \% cpus.size()] \f$. In case the given list is empty, all threads
+// are unpinned, i.e. are allowed to run on all CPUs available to the process. The threads apply
+// the new affinity before executing their next task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   Lock lock( mutex_ );
+   cpus_ = cpus;
+   ++version_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the spin time of idle threads.
+//
+// \param spin The new spin time in microseconds (0 for no spinning).
+// \return void
+//
+// This function changes the time idle threads busily wait for new tasks before they go to
+// sleep. The same time is used by the wait() function to busily wait for the completion of
+// all scheduled tasks. A spin time of 0 disables the busy waiting.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setSpinTime( size_t spin )
+{
+   spin_ = spin;
 }
 //*************************************************************************************************
 
@@ -740,17 +932,26 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 //*************************************************************************************************
 /*!\brief Adding a new thread to the thread pool.
 //
+// \param index The index of the new thread.
 // \return void
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-void ThreadPool<TT,MT,LT,CT>::createThread()
+void ThreadPool<TT,MT,LT,CT>::createThread( size_t index )
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   if( index >= occupied_.size() ) {
+      queues_.resize( index+1UL );
+      occupied_.resize( index+1UL, false );
+      pinned_.resize( index+1UL, 0UL );
+   }
+
+   occupied_[index] = true;
+   pinned_[index] = 0UL;
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, index ) ) );
    ++total_;
-   ++expected_;
    ++active_;
 }
 //*************************************************************************************************
@@ -759,44 +960,101 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
+// \param index The index of the executing thread.
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// Tasks scheduled for the specific thread are preferred over the tasks in the shared task
+// queue. In case there is no task available, the thread busily waits for the specified spin
+// time for a change of the thread pool state (without holding the lock). In case no change
+// happens during this time, the thread blocks and waits for a new task to be scheduled. In
+// case the thread affinity of the pool has changed since the last task, the
+// thread is pinned according to the new affinity before executing the task. In case the task
+// throws an exception, the task is still counted as completed and the exception is stored in
+// order to be rethrown by the next call to the wait() function.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t index )
 {
    threadpool::Task task;
+   std::vector<size_t> cpus;
+   bool repin( false );
 
    // Acquiring a scheduled task
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      while( taskqueue_.isEmpty() && queues_[index].isEmpty() )
       {
          --active_;
          waitForThread_.notify_all();
 
-         if( total_ > expected_ ) {
+         if( index >= expected_ ) {
             --total_;
+            occupied_[index] = false;
             return false;
          }
 
-         waitForTask_.wait( lock );
+         const size_t epoch( epoch_ );
+
+         if( spin_ > 0UL ) {
+            lock.unlock();
+            threadpool::spinWait( [this,epoch]() { return epoch_ != epoch; }, spin_ );
+            lock.lock();
+         }
+
+         // Since the epoch is only changed while holding the lock, the thread is guaranteed
+         // to be notified about any change happening after this check
+         if( epoch_ == epoch ) {
+            waitForTask_.wait( lock );
+         }
+
          ++active_;
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      if( !queues_[index].isEmpty() ) {
+         task = queues_[index].pop();
+         --pending_;
+      }
+      else {
+         task = taskqueue_.pop();
+      }
+
+      if( pinned_[index] != version_ ) {
+         pinned_[index] = version_;
+         cpus  = cpus_;
+         repin = true;
+      }
+   }
+
+   // Adapting the thread affinity
+   if( repin ) {
+      threadpool::pinThread( cpus, index );
+   }
+
+   // Notifying the waiting threads about the completion of all tasks
+   const auto complete = [this]() {
+      if( --unfinished_ == 0UL ) {
+         Lock lock( mutex_ );
+         waitForThread_.notify_all();
+      }
+   };
+
+   // Executing the task (the task is considered completed even if it throws)
+   try {
+      task();
+   }
+   catch( ... ) {
+      Lock lock( mutex_ );
+      if( !error_ ) {
+         error_ = std::current_exception();
+      }
    }
 
-   // Executing the task
-   task();
+   complete();
 
    return true;
 }
@@ -59,6 +59,7 @@
 #include <blaze/util/typetraits/IsArray.h>
 #include <blaze/util/typetraits/IsAssignable.h>
 #include <blaze/util/typetraits/IsBaseOf.h>
+#include <blaze/util/typetraits/IsBFloat16.h>
 #include <blaze/util/typetraits/IsBoolean.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsCharacter.h>
@@ -74,6 +75,7 @@
 #include <blaze/util/typetraits/IsEmpty.h>
 #include <blaze/util/typetraits/IsEnum.h>
 #include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsFloat16.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsInteger.h>
 #include <blaze/util/typetraits/IsIntegral.h>
@@ -0,0 +1,347 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Thread affinity functionality for the thread pool
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AFFINITY POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread affinity policies of the thread pool.
+// \ingroup threads
+//
+// The affinity policy determines how the threads of a thread pool are pinned to the available
+// CPUs. In case of \a compactAffinity, consecutive threads are pinned to neighboring CPUs (i.e.
+// the hardware threads of a core, the cores of a socket, and the sockets are filled one after
+// another). In case of \a scatterAffinity, consecutive threads are distributed as evenly as
+// possible among all sockets and cores. In case of \a noAffinity the threads are not pinned
+// and may be migrated by the operating system. Note that thread pinning is currently only
+// supported on Linux; on all other platforms all policies are equivalent to \a noAffinity.
+*/
+enum AffinityPolicy {
+   noAffinity      = 0,  //!< Flag for unpinned threads.
+   compactAffinity = 1,  //!< Flag for the compact placement of the threads.
+   scatterAffinity = 2   //!< Flag for the scattered placement of the threads.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+namespace threadpool {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a single CPU topology attribute from the Linux sysfs.
+// \ingroup threads
+//
+// \param cpu The index of the CPU.
+// \param name The name of the topology attribute.
+// \return The value of the attribute, 0 in case the attribute is not available.
+*/
+inline size_t readTopology( size_t cpu, const char* name )
+{
+   std::ifstream in( "/sys/devices/system/cpu/cpu" + std::to_string( cpu ) + "/topology/" + name );
+   size_t value( 0UL );
+   if( !( in >> value ) ) value = 0UL;
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs available to the process.
+// \ingroup threads
+//
+// \return The sorted list of available CPUs (empty in case thread pinning is not supported).
+//
+// This function returns the CPUs contained in the affinity mask of the process. The mask is
+// queried once during the first call of the function, which happens during the initialization
+// of the thread backend (i.e. before any thread has been pinned).
+*/
+inline const std::vector<size_t>& availableCPUs()
+{
+   static const std::vector<size_t> cpus( []() {
+      std::vector<size_t> tmp;
+#if defined(__linux__)
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+         for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+            if( CPU_ISSET( cpu, &set ) )
+               tmp.push_back( cpu );
+         }
+      }
+#endif
+      return tmp;
+   }() );
+
+   return cpus;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the ordered list of CPUs for the given affinity policy.
+// \ingroup threads
+//
+// \param policy The affinity policy.
+// \return The CPUs in the order in which the threads of the pool are pinned to them.
+//
+// This function orders the available CPUs according to the given affinity policy based on the
+// socket (\c physical_package_id) and core (\c core_id) topology information of the system.
+// In case of \a noAffinity or in case thread pinning is not supported, an empty list is
+// returned.
+*/
+inline std::vector<size_t> affinityCPUs( AffinityPolicy policy )
+{
+   struct Location {
+      size_t cpu, package, core, smt, rank;
+   };
+
+   const std::vector<size_t>& cpus( availableCPUs() );
+
+   if( policy == noAffinity || cpus.empty() )
+      return std::vector<size_t>();
+
+   std::vector<Location> locations;
+   locations.reserve( cpus.size() );
+
+   for( size_t cpu : cpus ) {
+      locations.push_back( Location{ cpu, readTopology( cpu, "physical_package_id" )
+                                        , readTopology( cpu, "core_id" ), 0UL, 0UL } );
+   }
+
+   // Determining the hardware thread index within each core
+   for( size_t i=0UL; i<locations.size(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( locations[j].package == locations[i].package && locations[j].core == locations[i].core )
+            ++locations[i].smt;
+      }
+   }
+
+   // Determining the rank of each core within its socket
+   for( size_t i=0UL; i<locations.size(); ++i ) {
+      for( size_t j=0UL; j<locations.size(); ++j ) {
+         if( locations[j].package == locations[i].package && locations[j].smt == 0UL &&
+             locations[j].core < locations[i].core )
+            ++locations[i].rank;
+      }
+   }
+
+   if( policy == compactAffinity ) {
+      std::stable_sort( locations.begin(), locations.end(), []( const Location& a, const Location& b ) {
+         return ( a.package != b.package )?( a.package < b.package ):
+                ( a.rank    != b.rank    )?( a.rank    < b.rank    ):( a.smt < b.smt );
+      } );
+   }
+   else {
+      std::stable_sort( locations.begin(), locations.end(), []( const Location& a, const Location& b ) {
+         return ( a.smt  != b.smt  )?( a.smt  < b.smt  ):
+                ( a.rank != b.rank )?( a.rank < b.rank ):( a.package < b.package );
+      } );
+   }
+
+   std::vector<size_t> result;
+   result.reserve( locations.size() );
+   for( const Location& location : locations ) {
+      result.push_back( location.cpu );
+   }
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the affinity specification given via the \c BLAZE_THREAD_AFFINITY variable.
+// \ingroup threads
+//
+// \param spec The affinity specification.
+// \return The CPUs in the order in which the threads of the pool are pinned to them.
+//
+// This function parses an affinity specification, which is either one of the policy names
+// \c none, \c compact, and \c scatter, or an explicit, comma-separated list of CPU indices
+// and CPU ranges (as for instance \c "0,2,4-7"). All given CPUs must be available to the
+// process (see the availableCPUs() function). In case the specification is invalid or refers
+// to an unavailable CPU, an empty list (i.e. no affinity) is returned.
+*/
+inline std::vector<size_t> parseAffinity( const std::string& spec )
+{
+   if( spec == "compact" ) return affinityCPUs( compactAffinity );
+   if( spec == "scatter" ) return affinityCPUs( scatterAffinity );
+
+   const std::vector<size_t>& available( availableCPUs() );
+
+   std::vector<size_t> cpus;
+   size_t pos( 0UL );
+
+   while( pos < spec.size() )
+   {
+      if( !std::isdigit( static_cast<unsigned char>( spec[pos] ) ) )
+         return std::vector<size_t>();
+
+      char* end( nullptr );
+      const size_t first( std::strtoul( spec.c_str()+pos, &end, 10 ) );
+      size_t last( first );
+      pos = end - spec.c_str();
+
+      if( pos < spec.size() && spec[pos] == '-' ) {
+         ++pos;
+         if( pos == spec.size() || !std::isdigit( static_cast<unsigned char>( spec[pos] ) ) )
+            return std::vector<size_t>();
+         last = std::strtoul( spec.c_str()+pos, &end, 10 );
+         pos = end - spec.c_str();
+      }
+
+      if( last < first || ( pos < spec.size() && spec[pos] != ',' ) )
+         return std::vector<size_t>();
+
+      if( available.empty() || last > available.back() )
+         return std::vector<size_t>();
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         if( !std::binary_search( available.begin(), available.end(), cpu ) )
+            return std::vector<size_t>();
+         cpus.push_back( cpu );
+      }
+
+      if( pos < spec.size() ) ++pos;
+   }
+
+   return cpus;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling thread to the given CPU.
+// \ingroup threads
+//
+// \param cpus The list of CPUs of the thread pool.
+// \param index The index of the calling thread within the thread pool.
+// \return \a true in case the affinity has been applied, \a false if not.
+//
+// This function pins the calling thread to the CPU \f$ cpus[index \% cpus.size()] \f$. In case
+// the given list is empty, the affinity of the calling thread is reset to all CPUs available
+// to the process. In case the thread cannot be pinned to the given CPU (for instance because
+// the CPU is not part of the CPU set of the process), the thread falls back to no pinning and
+// the function returns \a false. On platforms without support for thread pinning the function
+// has no effect and returns \a false.
+*/
+inline bool pinThread( const std::vector<size_t>& cpus, size_t index )
+{
+#if defined(__linux__)
+   const auto apply = []( const cpu_set_t& set ) {
+      return CPU_COUNT( &set ) > 0 &&
+             pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) == 0;
+   };
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   for( size_t cpu : availableCPUs() ) {
+      CPU_SET( cpu, &set );
+   }
+
+   if( !cpus.empty() )
+   {
+      const size_t cpu( cpus[index % cpus.size()] );
+
+      if( cpu < CPU_SETSIZE ) {
+         cpu_set_t single;
+         CPU_ZERO( &single );
+         CPU_SET( cpu, &single );
+
+         if( apply( single ) )
+            return true;
+      }
+
+      apply( set );
+      return false;
+   }
+
+   return apply( set );
+#else
+   UNUSED_PARAMETER( cpus, index );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,97 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Spin.h
+//  \brief Spin waiting functionality for the thread pool
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_UTIL_THREADPOOL_SPIN_H_
+#define _BLAZE_UTIL_THREADPOOL_SPIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <thread>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  SPIN FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Busy waiting for the given condition for at most the given time.
+// \ingroup threads
+//
+// \param pred The condition to wait for.
+// \param time The maximum spin time in microseconds.
+// \return \a true in case the condition is fulfilled, \a false in case the time ran out.
+//
+// This function repeatedly evaluates the given condition until it is fulfilled or until the
+// given time has elapsed. In contrast to a condition variable the calling thread is not put
+// to sleep and therefore reacts to the condition within fractions of a microsecond. Between
+// two evaluations the calling thread yields its time slice, such that waiting threads don't
+// starve other threads in case there are more threads than CPUs. In case the given time is
+// 0, the condition is evaluated exactly once.
+*/
+template< typename Predicate >  // Type of the condition
+inline bool spinWait( Predicate pred, size_t time )
+{
+   if( time == 0UL ) {
+      return pred();
+   }
+
+   const auto end( std::chrono::steady_clock::now() + std::chrono::microseconds( time ) );
+
+   while( !pred() ) {
+      if( std::chrono::steady_clock::now() >= end )
+         return pred();
+      std::this_thread::yield();
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,127 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/typetraits/IsBFloat16.h
+//  \brief Header file for the IsBFloat16 type trait
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TYPETRAITS_ISBFLOAT16_H_
+#define _BLAZE_UTIL_TYPETRAITS_ISBFLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for brain floating point types.
+// \ingroup type_traits
+//
+// This type trait tests whether or not the given template parameter is of bfloat16 type. In
+// case the type is bfloat16 (ignoring the cv-qualifiers), the \a value member constant is set
+// to \a true, the nested type definition \a Type is \a TrueType, and the class derives from
+// \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the class
+// derives from \a FalseType.
+
+   \code
+   blaze::IsBFloat16<blaze::bfloat16>::value          // Evaluates to 'true'
+   blaze::IsBFloat16<const blaze::bfloat16>::Type     // Results in TrueType
+   blaze::IsBFloat16<const volatile blaze::bfloat16>  // Is derived from TrueType
+   blaze::IsBFloat16<float>::value                    // Evaluates to 'false'
+   blaze::IsBFloat16<const double>::Type              // Results in FalseType
+   blaze::IsBFloat16<volatile short>                  // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsBFloat16
+   : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsBFloat16 type trait for the plain 'bfloat16' type.
+template<>
+struct IsBFloat16<bfloat16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsBFloat16 type trait for 'const bfloat16'.
+template<>
+struct IsBFloat16<const bfloat16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsBFloat16 type trait for 'volatile bfloat16'.
+template<>
+struct IsBFloat16<volatile bfloat16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsBFloat16 type trait for 'const volatile bfloat16'.
+template<>
+struct IsBFloat16<const volatile bfloat16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 #include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/CG.h>
 #include <blazemark/blaze/init/DynamicVector.h>
@@ -66,7 +67,8 @@ namespace blaze {
 // \return Minimum runtime of the kernel function.
 //
 // This kernel function implements the conjugate gradient method by means of the Blaze
-// functionality.
+// conjugate gradient solver, which is based on fused matrix/vector multiplication, axpy, and
+// dot product kernels.
 */
 double cg( size_t N, size_t steps, size_t iterations )
 {
@@ -87,10 +89,13 @@ double cg( size_t N, size_t steps, size_t iterations )
    }
 
    ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
-   ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
-   element_t alpha, beta, delta;
+   ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), start( NN );
+   ::blaze::SolverSettings settings;
    ::blaze::timing::WcTimer timer;
 
+   settings.maxIterations = iterations;
+   settings.tolerance     = 0.0;
+
    for( size_t i=0UL; i<N; ++i ) {
       for( size_t j=0UL; j<N; ++j ) {
          if( i > 0UL   ) A.append( i*N+j, (i-1UL)*N+j, -1.0 );  // Top neighbor
@@ -101,7 +106,7 @@ double cg( size_t N, size_t steps, size_t iterations )
       }
    }
 
-   reset( b );
+   init( b );
    init( start );
 
    for( size_t rep=0UL; rep<reps; ++rep )
@@ -110,20 +115,7 @@ double cg( size_t N, size_t steps, size_t iterations )
       for( size_t step=0UL; step<steps; ++step )
       {
          x = start;
-         r = A * x - b;
-         delta = trans(r) * r;
-         d = -r;
-
-         for( size_t iteration=0UL; iteration<iterations; ++iteration )
-         {
-            h = A * d;
-            alpha = delta / ( trans(d) * h );
-            x += alpha * d;
-            r += alpha * h;
-            beta = trans(r) * r;
-            d = ( beta / delta ) * d - r;
-            delta = beta;
-         }
+         ::blaze::cg( A, x, b, settings );
       }
       timer.end();
 
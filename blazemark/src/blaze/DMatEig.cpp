@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/DMatEig.cpp
+//  \brief Source file for the Blaze dense matrix eigenvalue kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/DMatEig.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix eigenvalue kernel for a given eigensolver.
+//
+// \param N The number of rows and columns of the matrix.
+// \param steps The number of iteration steps to perform.
+// \param name The name of the kernel.
+// \param solver The eigensolver to be benchmarked.
+// \return Minimum runtime of the kernel function.
+//
+// The eigensolver is called with a random symmetric matrix, the resulting eigenvalue vector
+// and the resulting eigenvector matrix.
+*/
+template< typename Solver >  // Type of the eigensolver
+double dmateig( size_t N, size_t steps, const char* name, Solver solver )
+{
+   using ::blaze::columnMajor;
+   using ::blaze::columnVector;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::DynamicMatrix<double,columnMajor> tmp( N, N );
+   init( tmp );
+
+   const ::blaze::SymmetricMatrix< ::blaze::DynamicMatrix<double,columnMajor> > A( tmp + trans( tmp ) );
+   ::blaze::DynamicVector<double,columnVector> w( N );
+   ::blaze::DynamicMatrix<double,columnMajor> V( N, N );
+   ::blaze::timing::WcTimer timer;
+
+   solver( A, w, V );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         solver( A, w, V );
+      }
+      timer.end();
+
+      if( V.rows() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel '" << name << "': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix eigenvalue kernel based on the LAPACK syevd() function.
+//
+// \param N The number of rows and columns of the matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double lapackDMatEig( size_t N, size_t steps )
+{
+   return dmateig( N, steps, "lapackDMatEig", []( const auto& A, auto& w, auto& V ) {
+      ::blaze::eigen( A, w, V );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix eigenvalue kernel based on the native eigensolver.
+//
+// \param N The number of rows and columns of the matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double nativeDMatEig( size_t N, size_t steps )
+{
+   return dmateig( N, steps, "nativeDMatEig", []( const auto& A, auto& w, auto& V ) {
+      ::blaze::eigh( A, w, V );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix eigenvalue kernel for the smallest 5% of the eigenpairs.
+//
+// \param N The number of rows and columns of the matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double nativeDMatEigSubset( size_t N, size_t steps )
+{
+   return dmateig( N, steps, "nativeDMatEigSubset", []( const auto& A, auto& w, auto& V ) {
+      ::blaze::eigh( A, w, V, ::blaze::max( 1UL, A.rows() / 20UL ) );
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
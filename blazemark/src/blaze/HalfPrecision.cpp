@@ -0,0 +1,271 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/HalfPrecision.cpp
+//  \brief Source file for the Blaze kernels for 16-bit floating point storage types
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/HalfPrecision.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense vector multiplication kernel for a given storage type.
+//
+// \param N The number of rows and columns of the matrix and the size of the vectors.
+// \param steps The number of iteration steps to perform.
+// \param name The name of the kernel.
+// \return Minimum runtime of the kernel function.
+//
+// The elements of the matrix and the vector are stored as \a Type, the result vector is a
+// single precision vector. The operands are initialized in single precision and subsequently
+// converted to the storage type.
+*/
+template< typename Type >  // Storage type of the operands
+double dmatdvecmult( size_t N, size_t steps, const char* name )
+{
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::DynamicMatrix<float,rowMajor> tmpA( N, N );
+   ::blaze::DynamicVector<float,columnVector> tmpa( N );
+
+   init( tmpA );
+   init( tmpa );
+
+   const ::blaze::DynamicMatrix<Type,rowMajor> A( tmpA );
+   const ::blaze::DynamicVector<Type,columnVector> a( tmpa );
+   ::blaze::DynamicVector<float,columnVector> b( N );
+   ::blaze::timing::WcTimer timer;
+
+   b = A * a;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = A * a;
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel '" << name << "': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense matrix multiplication kernel for a given storage type.
+//
+// \param N The number of rows and columns of the matrices.
+// \param steps The number of iteration steps to perform.
+// \param name The name of the kernel.
+// \return Minimum runtime of the kernel function.
+//
+// The elements of the two operands are stored as \a Type, the result matrix is a single
+// precision matrix. The operands are initialized in single precision and subsequently
+// converted to the storage type.
+*/
+template< typename Type >  // Storage type of the operands
+double dmatdmatmult( size_t N, size_t steps, const char* name )
+{
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::DynamicMatrix<float,rowMajor> tmpA( N, N ), tmpB( N, N );
+
+   init( tmpA );
+   init( tmpB );
+
+   const ::blaze::DynamicMatrix<Type,rowMajor> A( tmpA ), B( tmpB );
+   ::blaze::DynamicMatrix<float,rowMajor> C( N, N );
+   ::blaze::timing::WcTimer timer;
+
+   C = A * B;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         C = A * B;
+      }
+      timer.end();
+
+      if( C.rows() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel '" << name << "': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense vector multiplication kernel for single precision operands.
+//
+// \param N The number of rows and columns of the matrix and the size of the vectors.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double float32DMatDVecMult( size_t N, size_t steps )
+{
+   return dmatdvecmult<float>( N, steps, "float32DMatDVecMult" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense vector multiplication kernel for bfloat16 operands.
+//
+// \param N The number of rows and columns of the matrix and the size of the vectors.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double bfloat16DMatDVecMult( size_t N, size_t steps )
+{
+   return dmatdvecmult< ::blaze::bfloat16 >( N, steps, "bfloat16DMatDVecMult" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense vector multiplication kernel for float16 operands.
+//
+// \param N The number of rows and columns of the matrix and the size of the vectors.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double float16DMatDVecMult( size_t N, size_t steps )
+{
+   return dmatdvecmult< ::blaze::float16 >( N, steps, "float16DMatDVecMult" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense matrix multiplication kernel for single precision operands.
+//
+// \param N The number of rows and columns of the matrices.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double float32DMatDMatMult( size_t N, size_t steps )
+{
+   return dmatdmatmult<float>( N, steps, "float32DMatDMatMult" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense matrix multiplication kernel for bfloat16 operands.
+//
+// \param N The number of rows and columns of the matrices.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double bfloat16DMatDMatMult( size_t N, size_t steps )
+{
+   return dmatdmatmult< ::blaze::bfloat16 >( N, steps, "bfloat16DMatDMatMult" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense matrix multiplication kernel for float16 operands.
+//
+// \param N The number of rows and columns of the matrices.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+*/
+double float16DMatDMatMult( size_t N, size_t steps )
+{
+   return dmatdmatmult< ::blaze::float16 >( N, steps, "float16DMatDMatMult" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -0,0 +1,168 @@
+//=================================================================================================
+/*!
+//  \file src/main/FirstTouch.cpp
+//  \brief Source file for the Blaze first touch benchmark
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+#define BLAZE_USE_NUMA_FIRST_TOUCH 1
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/timing/WcTimer.h>
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runs a STREAM-like vector addition on three vectors of the given size.
+//
+// \param N The number of elements of each vector.
+// \param steps The number of repetitions of the vector addition.
+// \param parallel \a true for a parallel first touch of the vectors, \a false for a serial one.
+// \return The minimum runtime of a single vector addition.
+//
+// In case \a parallel is \a false, the three vectors are resized inside a serial section and
+// therefore all memory pages are touched first by the calling thread (which is the default
+// behavior of Blaze). Otherwise the memory pages are touched first by the threads that later
+// perform the vector addition.
+*/
+double streamAdd( std::size_t N, std::size_t steps, bool parallel )
+{
+   blaze::DynamicVector<double> a, b, c;
+   blaze::timing::WcTimer timer;
+
+   if( parallel ) {
+      a.resize( N );
+      b.resize( N );
+      c.resize( N );
+   }
+   else {
+      BLAZE_SERIAL_SECTION {
+         a.resize( N );
+         b.resize( N );
+         c.resize( N );
+      }
+   }
+
+   a = 1.0;
+   b = 2.0;
+
+   for( std::size_t step=0UL; step<steps; ++step ) {
+      timer.start();
+      c = a + b;
+      timer.end();
+   }
+
+   if( c[N-1UL] != 3.0 ) {
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!" << std::endl;
+   }
+
+   return timer.min();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze first touch benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// This benchmark demonstrates the effect of the parallel first touch initialization (see the
+// \c BLAZE_USE_NUMA_FIRST_TOUCH switch) on NUMA systems. It compares the memory bandwidth of a
+// parallel vector addition on vectors that have been touched first by a single thread and on
+// vectors that have been touched first by the threads of the vector addition. The number of
+// threads is specified via the \c BLAZE_NUM_THREADS or \c OMP_NUM_THREADS environment variable.
+// In order to distribute the threads across all sockets, it is recommended to combine this
+// benchmark with the \c BLAZE_THREAD_AFFINITY=scatter or \c OMP_PROC_BIND=spread settings.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 3 ) {
+      std::cerr << " Invalid use of program 'FirstTouch'!\n"
+                << "   Use: ./firsttouch <number_of_megabytes> [<number_of_steps>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t M    ( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t N    ( M * 1000000UL / ( 3UL * sizeof(double) ) );
+   const std::size_t steps( ( argc == 3 )?( static_cast<std::size_t>( atoi( argv[2] ) ) ):( 10UL ) );
+
+   if( N == 0UL || steps == 0UL ) {
+      std::cerr << " Invalid number of megabytes or steps!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n First touch benchmark ( c = a + b, " << M << " MByte, "
+             << blaze::getNumThreads() << " threads )\n";
+
+   const double bytes( 3.0 * N * sizeof(double) );
+
+   const double serial( streamAdd( N, steps, false ) );
+   std::cout << "   Serial first touch  : " << std::setw(8) << std::fixed << std::setprecision(2)
+             << bytes / serial / 1E9 << " GByte/s" << std::endl;
+
+   const double parallel( streamAdd( N, steps, true ) );
+   std::cout << "   Parallel first touch: " << std::setw(8) << std::fixed << std::setprecision(2)
+             << bytes / parallel / 1E9 << " GByte/s" << std::endl;
+
+   std::cout << "   Speedup             : " << std::setw(8) << std::fixed << std::setprecision(2)
+             << serial / parallel << "\n" << std::endl;
+}
+//*************************************************************************************************
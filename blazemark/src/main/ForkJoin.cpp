@@ -0,0 +1,161 @@
+//=================================================================================================
+/*!
+//  \file src/main/ForkJoin.cpp
+//  \brief Source file for the Blaze fork-join latency benchmark
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+#define BLAZE_SMP_DVECDVECADD_THRESHOLD 1000UL
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/timing/WcTimer.h>
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runs a vector addition on three vectors of the given size.
+//
+// \param N The number of elements of each vector.
+// \param steps The number of repetitions of the vector addition.
+// \param parallel \a true for a parallel vector addition, \a false for a serial one.
+// \return The average runtime of a single vector addition.
+*/
+double vecAdd( std::size_t N, std::size_t steps, bool parallel )
+{
+   blaze::DynamicVector<double> a( N, 1.0 ), b( N, 2.0 ), c( N );
+   blaze::timing::WcTimer timer;
+
+   for( std::size_t step=0UL; step<steps; ++step )
+   {
+      if( parallel ) {
+         timer.start();
+         c = a + b;
+         timer.end();
+      }
+      else {
+         BLAZE_SERIAL_SECTION {
+            timer.start();
+            c = a + b;
+            timer.end();
+         }
+      }
+   }
+
+   if( c[N-1UL] != 3.0 ) {
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!" << std::endl;
+   }
+
+   return timer.average();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze fork-join latency benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// This benchmark measures the overhead of short parallel operations. It compares the runtime
+// of a serial vector addition with the runtime of a parallel vector addition with sleeping
+// idle threads and with spinning idle threads (see the blaze::setThreadSpinTime() function).
+// In order to parallelize mid-sized vector additions, the SMP threshold of the vector addition
+// is lowered to 1000 elements. The number of threads is specified via the \c BLAZE_NUM_THREADS
+// environment variable. Note that spinning threads only pay off in case every thread has a
+// CPU to itself.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 4 ) {
+      std::cerr << " Invalid use of program 'ForkJoin'!\n"
+                << "   Use: ./forkjoin <vector_size> [<spin_time> [<number_of_steps>]]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t N    ( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t spin ( ( argc >= 3 )?( static_cast<std::size_t>( atoi( argv[2] ) ) ):( 100UL ) );
+   const std::size_t steps( ( argc == 4 )?( static_cast<std::size_t>( atoi( argv[3] ) ) ):( 10000UL ) );
+
+   if( N == 0UL || steps == 0UL ) {
+      std::cerr << " Invalid vector size or number of steps!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Fork-join latency benchmark ( c = a + b, N=" << N << ", "
+             << blaze::getNumThreads() << " threads )\n";
+
+   const double serial( vecAdd( N, steps, false ) );
+   std::cout << "   Serial                   : " << std::setw(10) << std::fixed << std::setprecision(2)
+             << serial * 1E6 << " us" << std::endl;
+
+   blaze::setThreadSpinTime( 0UL );
+   const double sleeping( vecAdd( N, steps, true ) );
+   std::cout << "   Parallel (sleeping)      : " << std::setw(10) << std::fixed << std::setprecision(2)
+             << sleeping * 1E6 << " us" << std::endl;
+
+   blaze::setThreadSpinTime( spin );
+   const double spinning( vecAdd( N, steps, true ) );
+   std::cout << "   Parallel (spin " << std::setw(6) << spin << " us): " << std::setw(10)
+             << std::fixed << std::setprecision(2) << spinning * 1E6 << " us" << std::endl;
+
+   std::cout << "   Speedup spin vs. sleeping: " << std::setw(10) << std::fixed << std::setprecision(2)
+             << sleeping / spinning << "\n" << std::endl;
+}
+//*************************************************************************************************
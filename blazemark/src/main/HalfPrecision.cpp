@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file src/main/HalfPrecision.cpp
+//  \brief Source file for the benchmark for 16-bit floating point storage types
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/Infinity.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blazemark/blaze/HalfPrecision.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/DynamicDenseRun.h>
+#include <blazemark/util/Parser.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::Benchmarks;
+using blazemark::DynamicDenseRun;
+using blazemark::Parser;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of a benchmark run.
+//
+// This type definition specifies the type of a single benchmark run for the benchmark for
+// 16-bit floating point storage types.
+*/
+using Run = DynamicDenseRun;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of the Blaze kernel functions.
+*/
+using Kernel = double (*)( size_t, size_t );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Estimating the necessary number of steps for each benchmark.
+//
+// \param run The parameters for the benchmark run.
+// \param kernel The single precision kernel of the benchmark.
+// \return void
+//
+// This function estimates the necessary number of steps for the given benchmark based on the
+// performance of the single precision kernel.
+*/
+void estimateSteps( Run& run, Kernel kernel )
+{
+   const size_t N( run.getSize() );
+
+   double wct( 0.0 );
+   size_t steps( 1UL );
+
+   while( true ) {
+      wct = kernel( N, steps );
+      if( wct >= 0.2 ) break;
+      steps *= 2UL;
+   }
+
+   const size_t estimatedSteps( ( blazemark::runtime * steps ) / wct );
+   run.setSteps( blaze::max( 1UL, estimatedSteps ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Benchmark function for a single operation and all three storage types.
+//
+// \param title The title of the operation.
+// \param runs The specified benchmark runs.
+// \param kernels The kernels for float, bfloat16, and float16 operands.
+// \param gemm \a true for a matrix/matrix multiplication, \a false for a matrix/vector one.
+// \return void
+//
+// This function runs the given operation for single precision, bfloat16, and float16 operands
+// and reports the throughput in MFlop/s as well as the runtime relative to the single precision
+// baseline.
+*/
+void benchmark( const char* title, std::vector<Run> runs, const Kernel (&kernels)[3], bool gemm )
+{
+   static const char* names[3] = { "float", "bfloat16", "float16" };
+
+   std::cout << "   " << title << ":\n";
+
+   size_t slowSize( blaze::inf );
+   for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
+   {
+      const size_t N( run->getSize() );
+      run->setFlops( gemm ? ( 2UL*N*N*N - N*N ) : ( 2UL*N*N - N ) );
+
+      if( run->getSteps() == 0UL ) {
+         if( N < slowSize ) {
+            estimateSteps( *run, kernels[0] );
+            if( run->getSteps() == 1UL )
+               slowSize = N;
+         }
+         else run->setSteps( 1UL );
+      }
+   }
+
+   std::vector< std::vector<double> > results( 3UL, std::vector<double>( runs.size() ) );
+
+   for( size_t k=0UL; k<3UL; ++k ) {
+      std::cout << "     " << names[k] << " [MFlop/s]:\n";
+      for( size_t r=0UL; r<runs.size(); ++r ) {
+         const size_t N    ( runs[r].getSize()  );
+         const size_t steps( runs[r].getSteps() );
+         results[k][r] = kernels[k]( N, steps );
+         const double mflops( runs[r].getFlops() * steps / results[k][r] / 1E6 );
+         std::cout << "       " << std::setw(12) << N << mflops << std::endl;
+      }
+   }
+
+   for( size_t r=0UL; r<runs.size(); ++r ) {
+      std::cout << "     N=" << runs[r].getSize() << ", steps=" << runs[r].getSteps() << "\n";
+      for( size_t k=0UL; k<3UL; ++k ) {
+         std::cout << "       " << std::setw(9) << names[k] << "= " << std::setw(8)
+                   << ( results[k][r] / results[0][r] ) << " (" << results[k][r] << ")\n";
+      }
+   }
+
+   std::cout << std::flush;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark function for the 16-bit floating point storage types.
+//
+// \param runs The specified benchmark runs.
+// \param benchmarks The selection of benchmarks.
+// \return void
+*/
+void halfprecision( std::vector<Run>& runs, Benchmarks benchmarks )
+{
+   std::cout << std::left;
+
+   std::sort( runs.begin(), runs.end() );
+
+   if( !benchmarks.runBlaze )
+      return;
+
+   const Kernel dmatdvecmult[3] = { blazemark::blaze::float32DMatDVecMult,
+                                    blazemark::blaze::bfloat16DMatDVecMult,
+                                    blazemark::blaze::float16DMatDVecMult };
+
+   const Kernel dmatdmatmult[3] = { blazemark::blaze::float32DMatDMatMult,
+                                    blazemark::blaze::bfloat16DMatDMatMult,
+                                    blazemark::blaze::float16DMatDMatMult };
+
+   benchmark( "Dense Matrix/Dense Vector Multiplication", runs, dmatdvecmult, false );
+   benchmark( "Dense Matrix/Dense Matrix Multiplication", runs, dmatdmatmult, true  );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the benchmark for 16-bit floating point storage types.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+*/
+int main( int argc, char** argv )
+{
+   std::cout << "\n 16-Bit Floating Point Storage Types:\n";
+
+   Benchmarks benchmarks;
+
+   try {
+      parseCommandLineArguments( argc, argv, benchmarks );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   const std::string installPath( INSTALL_PATH );
+   const std::string parameterFile( installPath + "/params/halfprecision.prm" );
+   Parser<Run> parser;
+   std::vector<Run> runs;
+
+   try {
+      parser.parse( parameterFile.c_str(), runs );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during parameter extraction: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   try {
+      halfprecision( runs, benchmarks );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+}
+//*************************************************************************************************
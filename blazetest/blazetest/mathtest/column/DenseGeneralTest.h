@@ -105,6 +105,7 @@ class DenseGeneralTest
    void testIsDefault   ();
    void testIsSame      ();
    void testSubvector   ();
+   void testCanAlias    ();
 
    template< typename Type >
    void checkSize( const Type& column, size_t expectedSize ) const;
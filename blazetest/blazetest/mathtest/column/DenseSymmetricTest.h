@@ -106,6 +106,7 @@ class DenseSymmetricTest
    void testIsDefault   ();
    void testIsSame      ();
    void testSubvector   ();
+   void testCanAlias    ();
 
    template< typename Type >
    void checkSize( const Type& column, size_t expectedSize ) const;
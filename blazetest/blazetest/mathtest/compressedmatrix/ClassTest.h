@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/TripletBuilder.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blazetest/system/Types.h>
@@ -111,6 +112,7 @@ class ClassTest
    void testSet         ();
    void testInsert      ();
    void testAppend      ();
+   void testBuild       ();
    void testErase       ();
    void testFind        ();
    void testLowerBound  ();
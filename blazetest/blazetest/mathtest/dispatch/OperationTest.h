@@ -0,0 +1,430 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dispatch/OperationTest.h
+//  \brief Header file for the runtime dispatch operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DISPATCH_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_DISPATCH_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Equal.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime dispatched compute kernels.
+//
+// This class represents a test suite for the compute kernels that are selected at runtime
+// according to the instruction set of the executing CPU. All kernels are tested for all
+// instruction sets supported by the CPU. In case the runtime dispatch is not active, only
+// the generic kernels are tested.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~OperationTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+                             void testInstructionSet();
+   template< typename Type > void testDot();
+   template< typename Type > void testAxpy();
+   template< typename Type > void testSpMV();
+   template< typename Type > void testMMM();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type > static Type value( size_t i, size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;               //!< Label of the currently performed test.
+   blaze::InstructionSet initial_;  //!< The initially selected instruction set.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector inner product kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime dispatched dense vector inner product for all
+// instruction sets supported by the CPU. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testDot()
+{
+   test_ = "Dense vector inner product";
+
+   for( size_t n=0UL; n<100UL; n+=7UL )
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> x( n ), y( n );
+
+      Type ref = Type();
+      for( size_t i=0UL; i<n; ++i ) {
+         x[i] = value<Type>( i, 1UL );
+         y[i] = value<Type>( i, 2UL );
+         ref += x[i] * y[i];
+      }
+
+      for( int isa=blaze::isaGeneric; isa<=blaze::detectInstructionSet(); ++isa )
+      {
+         blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+         const Type result( trans( x ) * y );
+
+         if( !blaze::equal( result, ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Instruction set: " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << result << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scaled dense vector addition and subtraction kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime dispatched addition and subtraction assignment
+// of scaled dense vectors for all instruction sets supported by the CPU. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testAxpy()
+{
+   test_ = "Scaled dense vector addition";
+
+   for( size_t n=0UL; n<100UL; n+=7UL )
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> x( n ), y( n ), ref( n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         x[i] = value<Type>( i, 3UL );
+         y[i] = value<Type>( i, 4UL );
+         ref[i] = y[i] + Type(3)*x[i] - Type(2)*x[i];
+      }
+
+      for( int isa=blaze::isaGeneric; isa<=blaze::detectInstructionSet(); ++isa )
+      {
+         blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+         blaze::DynamicVector<Type,blaze::columnVector> result( y );
+         result += Type(3) * x;
+         result -= Type(2) * x;
+
+         if( result != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Scaled addition/subtraction failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Instruction set: " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n"
+                << "   Result:\n" << result << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse matrix/dense vector multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime dispatched sparse matrix/dense vector
+// multiplication for all instruction sets supported by the CPU. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testSpMV()
+{
+   test_ = "Sparse matrix/dense vector multiplication";
+
+   const size_t M( 23UL );
+   const size_t N( 41UL );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( M, N );
+   blaze::DynamicVector<Type,blaze::columnVector> x( N ), ref( M, Type() );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = value<Type>( j, 5UL );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=i%3UL; j<N; j+=i%5UL+1UL ) {
+         A(i,j) = value<Type>( i, j );
+         ref[i] += A(i,j) * x[j];
+      }
+   }
+
+   for( int isa=blaze::isaGeneric; isa<=blaze::detectInstructionSet(); ++isa )
+   {
+      blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+      const blaze::DynamicVector<Type,blaze::columnVector> result( A * x );
+
+      if( result != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Instruction set: " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/dense matrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime dispatched dense matrix/dense matrix
+// multiplication for all instruction sets supported by the CPU and all combinations of
+// storage orders. The matrix sizes are chosen such that both the large kernels and all
+// remainder loops are exercised. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testMMM()
+{
+   test_ = "Dense matrix/dense matrix multiplication";
+
+   const size_t M( 103UL );
+   const size_t N( 131UL );
+   const size_t K( 270UL );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( M, K ), B( K, N ), ref( M, N, Type() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         A(i,k) = value<Type>( i, k );
+      }
+   }
+
+   for( size_t k=0UL; k<K; ++k ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         B(k,j) = value<Type>( k, j+1UL );
+      }
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            ref(i,j) += A(i,k) * B(k,j);
+         }
+      }
+   }
+
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> TA( A ), TB( B );
+
+   for( int isa=blaze::isaGeneric; isa<=blaze::detectInstructionSet(); ++isa )
+   {
+      blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor>    result1( A  * B  );
+      const blaze::DynamicMatrix<Type,blaze::rowMajor>    result2( TA * B  );
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> result3( A  * TB );
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> result4( TA * TB );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> result5( ref );
+      result5 += A * B;
+      result5 -= A * B;
+
+      if( result1 != ref || result2 != ref || result3 != ref || result4 != ref || result5 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Instruction set: " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n"
+             << "   Sizes: M=" << M << ", N=" << N << ", K=" << K << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a small integral test value for the given indices.
+//
+// \param i The first index.
+// \param j The second index.
+// \return The test value in the range \f$[-5..5]\f$.
+//
+// Due to the small integral values all computations are exact, independent of the order
+// of the floating point operations within the different kernels.
+*/
+template< typename Type >
+Type OperationTest::value( size_t i, size_t j )
+{
+   return Type( static_cast<int>( ( i*7UL + j*3UL ) % 11UL ) - 5 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatched compute kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch operation test.
+*/
+#define RUN_DISPATCH_OPERATION_TEST \
+   blazetest::mathtest::dispatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,425 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dynamicsparsematrix/ClassTest.h
+//  \brief Header file for the DynamicSparseMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DYNAMICSPARSEMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_DYNAMICSPARSEMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicSparseMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamicsparsematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the DynamicSparseMatrix class template.
+//
+// This class represents a test suite for the DynamicSparseMatrix class template. It performs
+// a series of runtime tests on random insertions and erasures, on the conversion into a
+// CompressedMatrix, and on the use of the matrix within expressions.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO > void testInsert();
+   template< bool SO > void testErase();
+   template< bool SO > void testResize();
+   template< bool SO > void testFinalize();
+   template< bool SO > void testExpressions();
+                        void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void checkValue( const Type& value, const Type& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the insertion functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a sequence of random set(), add() and insert() operations on a
+// dynamic sparse matrix and compares the result to a dense reference matrix. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testInsert()
+{
+   test_ = "DynamicSparseMatrix insertion";
+
+   blaze::DynamicSparseMatrix<int,SO> A( 13UL, 11UL, 2UL );
+   blaze::DynamicMatrix<int,SO> R( 13UL, 11UL, 0 );
+
+   checkValue( A.nonZeros(), size_t( 0UL ), "Invalid number of non-zero elements" );
+   checkValue( A.capacity( 0UL ), size_t( 2UL ), "Invalid capacity" );
+
+   for( size_t k=0UL; k<500UL; ++k )
+   {
+      const size_t i( blaze::rand<size_t>( 0UL, 12UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, 10UL ) );
+      const int value( blaze::rand<int>( 1, 9 ) );
+
+      switch( k % 3UL ) {
+         case 0UL: A.set( i, j, value ); R(i,j) = value; break;
+         case 1UL: A.add( i, j, value ); R(i,j) += value; break;
+         default:
+            if( R(i,j) == 0 ) {
+               checkValue( A.insert( i, j, value )->value(), value, "Invalid inserted element" );
+               R(i,j) = value;
+            }
+            break;
+      }
+   }
+
+   checkValue( A.nonZeros(), blaze::nonZeros( R ), "Invalid number of non-zero elements" );
+   checkValue( A == R, true, "Invalid matrix after insertions" );
+
+   const blaze::CompressedMatrix<int,SO> C( R );
+
+   for( size_t i=0UL; i<( SO ? 11UL : 13UL ); ++i ) {
+      checkValue( A.nonZeros( i ), C.nonZeros( i ), "Invalid number of non-zero elements in row/column" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the erase functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the erasure of single elements and the predicate-based erasure. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testErase()
+{
+   test_ = "DynamicSparseMatrix erasure";
+
+   blaze::CompressedMatrix<int,SO> C( 9UL, 14UL );
+   blaze::randomize( C, 60UL, 1, 9 );
+
+   blaze::DynamicSparseMatrix<int,SO> A( C );
+   blaze::DynamicMatrix<int,SO> R( C );
+
+   checkValue( A == C, true, "Invalid conversion from compressed matrix" );
+
+   for( size_t k=0UL; k<200UL; ++k )
+   {
+      const size_t i( blaze::rand<size_t>( 0UL, 8UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, 13UL ) );
+
+      checkValue( A.erase( i, j ), R(i,j) != 0, "Invalid erase result" );
+      R(i,j) = 0;
+
+      if( k % 2UL == 0UL ) {
+         A.set( j % 9UL, i, int( k % 7UL ) + 1 );
+         R( j % 9UL, i ) = int( k % 7UL ) + 1;
+      }
+   }
+
+   checkValue( A.nonZeros(), blaze::nonZeros( R ), "Invalid number of non-zero elements" );
+   checkValue( A == R, true, "Invalid matrix after erasures" );
+
+   A.erase( []( int value ){ return value > 4; } );
+   R = blaze::map( R, []( int value ){ return value > 4 ? 0 : value; } );
+
+   checkValue( A.nonZeros(), blaze::nonZeros( R ), "Invalid number of non-zero elements" );
+   checkValue( A == R, true, "Invalid matrix after predicate-based erasure" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() and reset() functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testResize()
+{
+   test_ = "DynamicSparseMatrix resize";
+
+   blaze::CompressedMatrix<int,SO> C( 12UL, 10UL );
+   blaze::randomize( C, 50UL, 1, 9 );
+
+   blaze::DynamicSparseMatrix<int,SO> A( C );
+
+   A.resize( 7UL, 6UL );
+
+   checkValue( A.rows(), size_t( 7UL ), "Invalid number of rows" );
+   checkValue( A.columns(), size_t( 6UL ), "Invalid number of columns" );
+   checkValue( A.nonZeros(), blaze::nonZeros( blaze::submatrix( C, 0UL, 0UL, 7UL, 6UL ) ),
+               "Invalid number of non-zero elements" );
+   checkValue( A == blaze::submatrix( C, 0UL, 0UL, 7UL, 6UL ), true, "Invalid matrix after resize" );
+
+   A.resize( 15UL, 8UL );
+
+   checkValue( A.rows(), size_t( 15UL ), "Invalid number of rows" );
+   checkValue( A.columns(), size_t( 8UL ), "Invalid number of columns" );
+   checkValue( A(14UL,7UL), 0, "Invalid new element" );
+
+   const size_t nonzeros( A.nonZeros() - A.nonZeros( 2UL ) );
+   reset( A, 2UL );
+
+   checkValue( A.nonZeros(), nonzeros, "Invalid number of non-zero elements" );
+   checkValue( A.nonZeros( 2UL ), size_t( 0UL ), "Invalid number of non-zero elements in row/column" );
+
+   reset( A );
+
+   checkValue( A.rows(), size_t( 15UL ), "Invalid number of rows" );
+   checkValue( A.nonZeros(), size_t( 0UL ), "Invalid number of non-zero elements" );
+
+   clear( A );
+
+   checkValue( A.rows(), size_t( 0UL ), "Invalid number of rows" );
+   checkValue( A.columns(), size_t( 0UL ), "Invalid number of columns" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the finalize() functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion of a dynamic sparse matrix into a compressed matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testFinalize()
+{
+   test_ = "DynamicSparseMatrix finalization";
+
+   blaze::DynamicSparseMatrix<int,SO> A( 17UL, 5UL );
+
+   for( size_t k=0UL; k<40UL; ++k ) {
+      A.add( ( k * 7UL ) % 17UL, ( k * 3UL ) % 5UL, int( k ) + 1 );
+   }
+
+   const blaze::CompressedMatrix<int,SO> B( A.finalize() );
+
+   checkValue( B == A, true, "Invalid finalized matrix" );
+   checkValue( B.nonZeros(), A.nonZeros(), "Invalid number of non-zero elements" );
+   checkValue( B.capacity(), A.nonZeros(), "Invalid capacity of the finalized matrix" );
+
+   blaze::CompressedMatrix<int,SO> C( 3UL, 3UL, 2UL );
+   C(1,1) = 5;
+   A.finalize( C );
+
+   checkValue( C == A, true, "Invalid finalized matrix" );
+   checkValue( C.rows(), size_t( 17UL ), "Invalid number of rows" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix class template within expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the DynamicSparseMatrix as operand of arithmetic operations and views.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testExpressions()
+{
+   test_ = "DynamicSparseMatrix expressions";
+
+   blaze::CompressedMatrix<int,SO> C( 8UL, 6UL );
+   blaze::randomize( C, 20UL, -5, 5 );
+
+   const blaze::DynamicSparseMatrix<int,SO> A( C );
+   const blaze::DynamicMatrix<int,SO> R( C );
+
+   blaze::DynamicVector<int> x( 6UL );
+   blaze::randomize( x, -3, 3 );
+
+   checkValue( blaze::DynamicVector<int>( A * x ) == R * x, true, "Invalid matrix/vector multiplication" );
+   checkValue( blaze::DynamicMatrix<int,SO>( trans( A ) * A ) == trans( R ) * R, true,
+               "Invalid matrix/matrix multiplication" );
+   checkValue( blaze::CompressedMatrix<int,SO>( A + C ) == 2 * R, true, "Invalid matrix addition" );
+   checkValue( blaze::CompressedMatrix<int,!SO>( A ) == R, true, "Invalid storage order conversion" );
+   checkValue( blaze::row( A, 3UL ) == blaze::row( R, 3UL ), true, "Invalid row view" );
+   checkValue( blaze::column( A, 2UL ) == blaze::column( R, 2UL ), true, "Invalid column view" );
+   checkValue( blaze::submatrix( A, 2UL, 1UL, 4UL, 3UL ) == blaze::submatrix( R, 2UL, 1UL, 4UL, 3UL ), true,
+               "Invalid submatrix view" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given value.
+//
+// \param value The value to be checked.
+// \param expected The expected value.
+// \param error The error message in case the values differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void ClassTest::checkValue( const Type& value, const Type& expected, const std::string& error ) const
+{
+   if( !( value == expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << value << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the DynamicSparseMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DynamicSparseMatrix class test.
+*/
+#define RUN_DYNAMICSPARSEMATRIX_CLASS_TEST \
+   blazetest::mathtest::dynamicsparsematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dynamicsparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,266 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/eigh/DenseTest.h
+//  \brief Header file for the dense matrix symmetric eigensolver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_EIGH_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_EIGH_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace eigh {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense matrix symmetric eigensolver tests.
+//
+// This class represents a test suite for the native symmetric/Hermitian eigensolver. It tests
+// the computation of all and of a subset of the eigenpairs for random matrices and for matrices
+// with known or strongly clustered spectra.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testRandom( size_t n, size_t k );
+
+   template< typename Type, typename VT >
+   void testEigenpairs( const Type& A, size_t k, const VT& expected );
+
+   void testTridiagonal();
+   void testClustered();
+   void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native eigensolver with a randomly initialized Hermitian matrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param k The number of requested eigenpairs.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native eigensolver for a randomly initialized symmetric or Hermitian
+// \a n-by-\a n matrix of the given type. The \a k smallest eigenvalues computed with eigenvectors
+// are compared to the eigenvalues computed without eigenvectors. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testRandom( size_t n, size_t k )
+{
+   test_ = "Symmetric eigensolver with random matrix";
+
+   typedef blaze::ElementType_<Type>           ET;
+   typedef blaze::UnderlyingBuiltin_<ET>       BT;
+   typedef blaze::DynamicVector<BT,blaze::columnVector>  VT;
+
+   Type A( n, n );
+   randomize( A );
+   A += ctrans( A );
+
+   VT w;
+   blaze::eigh( A, w, k );
+
+   testEigenpairs( A, k, w );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \a k smallest eigenpairs of a Hermitian matrix.
+//
+// \param A The symmetric or Hermitian matrix.
+// \param k The number of requested eigenpairs.
+// \param expected The expected \a k smallest eigenvalues in ascending order.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the \a k smallest eigenpairs of the given matrix and checks that the
+// eigenvalues match the expected eigenvalues, that the eigenvectors are orthonormal and that
+// \f$ A*v=\lambda*v \f$ holds for all eigenpairs. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type, typename VT >
+void DenseTest::testEigenpairs( const Type& A, size_t k, const VT& expected )
+{
+   typedef blaze::ElementType_<Type>  ET;
+
+   const size_t n( A.rows() );
+
+   VT w;
+   blaze::DynamicMatrix<ET,blaze::columnMajor> V;
+   blaze::eigh( A, w, V, k );
+
+   bool sorted( true );
+   for( size_t i=1UL; i<w.size(); ++i ) {
+      if( w[i] < w[i-1UL] ) sorted = false;
+   }
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> VV( ctrans( V ) * V );
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> AV( A * V );
+
+   blaze::DynamicMatrix<ET,blaze::columnMajor> VW( V );
+   for( size_t j=0UL; j<VW.columns(); ++j ) {
+      column( VW, j ) *= w[j];
+   }
+
+   if( w.size() != k || V.rows() != n || V.columns() != k || !sorted || w != expected ||
+       VV != blaze::IdentityMatrix<ET>( k ) || AV != VW ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Eigenvalue computation failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix size: " << n << "x" << n << "\n"
+          << "   Number of requested eigenpairs: " << k << "\n"
+          << "   Sorted eigenvalues: " << sorted << "\n"
+          << "   Orthonormal eigenvectors: " << ( VV == blaze::IdentityMatrix<ET>( k ) ) << "\n"
+          << "   Result eigenvalues:\n" << w << "\n"
+          << "   Expected eigenvalues:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native symmetric/Hermitian eigensolver.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix symmetric eigensolver test.
+*/
+#define RUN_DENSE_EIGH_TEST \
+   blazetest::mathtest::eigh::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace eigh
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
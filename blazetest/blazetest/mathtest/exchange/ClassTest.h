@@ -0,0 +1,384 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/exchange/ClassTest.h
+//  \brief Header file for the data exchange class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_EXCHANGE_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_EXCHANGE_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/NpyMatrix.h>
+#include <blaze/math/NpyVector.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace exchange {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the data exchange formats.
+//
+// This class represents a test suite for the import and export of dense vectors and matrices
+// in the NumPy .npy and .npz formats (including the NpyVector and NpyMatrix class templates)
+// and of sparse matrices in the Matrix Market format.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+                        void testNpyVector();
+   template< bool SO > void testNpyMatrix();
+                        void testNpz();
+   template< bool SO > void testMatrixMarket();
+                        void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void writeFile( const std::string& content ) const;
+   void writeNpyFile( const std::string& shape ) const;
+   void writeNpzFile( size_t offset, size_t length ) const;
+
+   template< typename Type >
+   void checkValue( const Type& value, const Type& expected, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Path of the temporary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the .npy import and export of dense matrices and of the NpyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a dense matrix with the given storage order to a .npy file and reads it
+// back into matrices of both storage orders and of a different element type. Additionally, it
+// tests the zero-copy mapping of the file via NpyMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testNpyMatrix()
+{
+   test_ = "NpyMatrix";
+
+   blaze::DynamicMatrix<double,SO> R( 7UL, 5UL );
+   blaze::randomize( R );
+
+   blaze::writeNpy( file_, R );
+
+   {
+      blaze::DynamicMatrix<double,SO> A;
+      blaze::readNpy( file_, A );
+      checkValue( A == R, true, "Invalid matrix of the same storage order" );
+
+      blaze::DynamicMatrix<double,!SO> B;
+      blaze::readNpy( file_, B );
+      checkValue( B == R, true, "Invalid matrix of the opposite storage order" );
+
+      blaze::DynamicMatrix<float,SO> C;
+      blaze::readNpy( file_, C );
+      checkValue( C == blaze::DynamicMatrix<float,SO>( R ), true, "Invalid converted matrix" );
+   }
+
+   {
+      const blaze::NpyMatrix<const double,SO> A( file_ );
+      checkValue( A.isMapped(), true, "Invalid conversion of a compatible array" );
+      checkValue( A == R, true, "Invalid mapped matrix" );
+
+      const blaze::NpyMatrix<const double,!SO> B( file_ );
+      checkValue( B.isMapped(), false, "Invalid mapping of a transposed array" );
+      checkValue( B == R, true, "Invalid converted matrix" );
+   }
+
+   {
+      blaze::NpyMatrix<double,SO> A( file_ );
+      checkValue( A.isMapped(), true, "Invalid conversion of a compatible array" );
+      A = 0.0;
+   }
+
+   {
+      blaze::NpyMatrix<double,SO> A( file_, blaze::readWrite );
+      checkValue( A == R, true, "Copy-on-write mapping modified the file" );
+      A(2,3) = 42.0;
+      A.sync();
+   }
+
+   R(2,3) = 42.0;
+
+   {
+      blaze::DynamicMatrix<double,SO> A;
+      blaze::readNpy( file_, A );
+      checkValue( A == R, true, "Invalid persistent modification" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Matrix Market import and export of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a compressed matrix with the given storage order to a Matrix Market file
+// and reads it back. Additionally, it reads hand-written files of all supported symmetry types
+// and fields. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testMatrixMarket()
+{
+   test_ = "Matrix Market";
+
+   {
+      blaze::CompressedMatrix<double,SO> A( 37UL, 23UL );
+      blaze::randomize( A, 200UL );
+
+      blaze::writeMatrixMarket( file_, A );
+
+      blaze::CompressedMatrix<double,SO> B;
+      blaze::readMatrixMarket( file_, B );
+      checkValue( B.nonZeros(), A.nonZeros(), "Invalid number of non-zero elements" );
+      checkValue( B == A, true, "Invalid matrix of the same storage order" );
+
+      blaze::CompressedMatrix<double,!SO> C;
+      blaze::readMatrixMarket( file_, C );
+      checkValue( C == A, true, "Invalid matrix of the opposite storage order" );
+   }
+
+   {
+      blaze::CompressedMatrix<double,SO> A( 1000UL, 2000UL );
+      blaze::randomize( A, 2UL*blaze::SMP_DVECASSIGN_THRESHOLD );
+
+      blaze::writeMatrixMarket( file_, A );
+
+      blaze::CompressedMatrix<double,SO> B;
+      blaze::readMatrixMarket( file_, B );
+      checkValue( B == A, true, "Invalid large matrix of the same storage order" );
+
+      blaze::CompressedMatrix<double,!SO> C;
+      blaze::readMatrixMarket( file_, C );
+      checkValue( C == A, true, "Invalid large matrix of the opposite storage order" );
+   }
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate integer symmetric\n"
+                 "% Comment line\n"
+                 "\n"
+                 "3 3 4\n"
+                 "1 1 2\n"
+                 "2 1 3\n"
+                 "3 2 -1\n"
+                 "2 1 1\n" );
+
+      blaze::CompressedMatrix<int,SO> A;
+      blaze::readMatrixMarket( file_, A );
+
+      const blaze::DynamicMatrix<int,SO> R{ { 2, 4,  0 }, { 4, 0, -1 }, { 0, -1, 0 } };
+      checkValue( A.nonZeros(), 5UL, "Invalid number of non-zero elements" );
+      checkValue( A == R, true, "Invalid symmetric matrix" );
+   }
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+                 "2 2 1\n"
+                 "2 1 1.5\n" );
+
+      blaze::CompressedMatrix<double,SO> A;
+      blaze::readMatrixMarket( file_, A );
+
+      const blaze::DynamicMatrix<double,SO> R{ { 0.0, -1.5 }, { 1.5, 0.0 } };
+      checkValue( A == R, true, "Invalid skew-symmetric matrix" );
+   }
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate complex hermitian\n"
+                 "2 2 2\n"
+                 "1 1 1.0 0.0\n"
+                 "2 1 1.0 2.0\n" );
+
+      using cplx = blaze::complex<double>;
+
+      blaze::CompressedMatrix<cplx,SO> A;
+      blaze::readMatrixMarket( file_, A );
+
+      const blaze::DynamicMatrix<cplx,SO> R{ { cplx( 1.0, 0.0 ), cplx( 1.0, -2.0 ) },
+                                             { cplx( 1.0, 2.0 ), cplx( 0.0,  0.0 ) } };
+      checkValue( A == R, true, "Invalid Hermitian matrix" );
+
+      blaze::writeMatrixMarket( file_, A );
+
+      blaze::CompressedMatrix<cplx,SO> B;
+      blaze::readMatrixMarket( file_, B );
+      checkValue( B == R, true, "Invalid complex matrix" );
+   }
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate pattern general\n"
+                 "2 3 2\n"
+                 "1 3\n"
+                 "2 1\n" );
+
+      blaze::CompressedMatrix<float,SO> A;
+      blaze::readMatrixMarket( file_, A );
+
+      const blaze::DynamicMatrix<float,SO> R{ { 0.0F, 0.0F, 1.0F }, { 1.0F, 0.0F, 0.0F } };
+      checkValue( A == R, true, "Invalid pattern matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given value.
+//
+// \param value The value to be checked.
+// \param expected The expected value.
+// \param error The error message in case the values differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void ClassTest::checkValue( const Type& value, const Type& expected, const std::string& error ) const
+{
+   if( !( value == expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << value << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the data exchange formats.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the data exchange class test.
+*/
+#define RUN_EXCHANGE_CLASS_TEST \
+   blazetest::mathtest::exchange::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace exchange
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,209 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/expressiongraph/OperationTest.h
+//  \brief Header file for the expression graph operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_EXPRESSIONGRAPH_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_EXPRESSIONGRAPH_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/ExpressionGraph.h>
+#include <blaze/system/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace expressiongraph {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the ExpressionGraph class.
+//
+// This class represents a test suite for the deferred evaluation of dense vector statements by
+// means of the ExpressionGraph class. It tests the fusion of statements into passes, the
+// detection of the dependencies between statements, and the results of the block-wise serial
+// and parallel evaluation. All vectors and matrices are initialized with small integral values
+// such that all results can be compared exactly.
+*/
+class OperationTest
+{
+ public:
+   //**Type definitions****************************************************************************
+   using VT = blaze::DynamicVector<double,blaze::columnVector>;  //!< Type of the dense vectors.
+   using MT = blaze::DynamicMatrix<double,blaze::rowMajor>;      //!< Type of the dense matrices.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFusion     ( size_t n );
+   void testConflict   ();
+   void testSelfAlias  ();
+   void testSizeChange ();
+   void testResize     ();
+   void testLargeSystem();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void initialize( VT& v, size_t n, size_t seed );
+   static void initialize( MT& A, size_t m, size_t n );
+
+   void checkPasses      ( const blaze::ExpressionGraph& graph, size_t expected ) const;
+   void checkPass        ( const blaze::ExpressionGraph& graph, size_t node, size_t expected, bool fused ) const;
+   void checkDependencies( const blaze::ExpressionGraph& graph, size_t node,
+                           const std::vector<size_t>& expected ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an evaluated statement.
+//
+// \param result The result of the expression graph.
+// \param expected The result of the according regular evaluation.
+// \param label The label of the checked statement.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1, typename T2 >
+void OperationTest::checkResult( const T1& result, const T2& expected, const std::string& label ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of deferred evaluation\n"
+          << " Details:\n"
+          << "   Statement: " << label << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the ExpressionGraph class.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the expression graph operation test.
+*/
+#define RUN_EXPRESSIONGRAPH_OPERATION_TEST \
+   blazetest::mathtest::expressiongraph::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace expressiongraph
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,320 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/householder/DenseTest.h
+//  \brief Header file for the dense matrix Householder test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_HOUSEHOLDER_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_HOUSEHOLDER_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace householder {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense matrix Householder tests.
+//
+// This class represents a test suite for the native Householder QR and LQ decompositions and
+// the native least squares solvers. It tests small matrices (decomposed by the unblocked
+// algorithm) and large matrices (decomposed by the blocked algorithm) of all storage orders.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testQR( size_t m, size_t n );
+
+   template< typename Type >
+   void testLQ( size_t m, size_t n );
+
+   template< typename Type >
+   void testSolve( size_t m, size_t n );
+
+   void testStatic();
+   void testBatch();
+   void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition with a randomly initialized matrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native QR decomposition for a randomly initialized \a m-by-\a n
+// matrix of the given type. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void DenseTest::testQR( size_t m, size_t n )
+{
+   test_ = "Householder QR decomposition";
+
+   typedef blaze::RemoveAdaptor_<Type>  MT;
+   typedef blaze::ElementType_<Type>    ET;
+
+   Type A( m, n );
+   randomize( A );
+
+   MT Q, R;
+   blaze::hqr( A, Q, R );
+
+   const MT QR( Q*R );
+   const MT QQ( ctrans( Q ) * Q );
+
+   bool upper( true );
+   for( size_t i=0UL; i<R.rows(); ++i ) {
+      for( size_t j=0UL; j<i && j<R.columns(); ++j ) {
+         if( R(i,j) != ET() ) upper = false;
+      }
+   }
+
+   if( QR != A || QQ != blaze::IdentityMatrix<ET>( Q.columns() ) || !upper ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: QR decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix size: " << m << "x" << n << "\n"
+          << "   Orthonormal columns: " << ( QQ == blaze::IdentityMatrix<ET>( Q.columns() ) ) << "\n"
+          << "   Upper trapezoidal R: " << upper << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native LQ decomposition with a randomly initialized matrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LQ decomposition for a randomly initialized \a m-by-\a n
+// matrix of the given type. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void DenseTest::testLQ( size_t m, size_t n )
+{
+   test_ = "Householder LQ decomposition";
+
+   typedef blaze::RemoveAdaptor_<Type>  MT;
+   typedef blaze::ElementType_<Type>    ET;
+
+   Type A( m, n );
+   randomize( A );
+
+   MT L, Q;
+   blaze::hlq( A, L, Q );
+
+   const MT LQ( L*Q );
+   const MT QQ( Q * ctrans( Q ) );
+
+   if( LQ != A || QQ != blaze::IdentityMatrix<ET>( Q.rows() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: LQ decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix size: " << m << "x" << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native least squares solver with a randomly initialized system.
+//
+// \param m The number of rows of the random system matrix.
+// \param n The number of columns of the random system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native least squares solver for a randomly initialized \a m-by-\a n
+// system. For overdetermined systems the residual has to be orthogonal to the columns of the
+// system matrix, for underdetermined systems the system has to be solved exactly. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testSolve( size_t m, size_t n )
+{
+   test_ = "Householder least squares solver";
+
+   typedef blaze::ElementType_<Type>  ET;
+
+   Type A( m, n );
+   randomize( A );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( m );
+   randomize( b );
+
+   const blaze::DynamicVector<ET,blaze::columnVector> x( blaze::solve_ls( A, b ) );
+
+   const blaze::DynamicVector<ET,blaze::columnVector> r( A*x - b );
+   const blaze::DynamicVector<ET,blaze::columnVector> z( m >= n ? ctrans( A ) * r : r );
+
+   if( x.size() != n || z != blaze::DynamicVector<ET,blaze::columnVector>( z.size(), ET() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Least squares solution failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix size: " << m << "x" << n << "\n"
+          << "   Solution:\n" << x << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native Householder decompositions and least squares solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix Householder test.
+*/
+#define RUN_DENSE_HOUSEHOLDER_TEST \
+   blazetest::mathtest::householder::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace householder
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
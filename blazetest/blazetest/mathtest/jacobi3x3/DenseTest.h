@@ -0,0 +1,594 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/jacobi3x3/DenseTest.h
+//  \brief Header file for the dense 3x3 Jacobi decomposition test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_JACOBI3X3_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_JACOBI3X3_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace jacobi3x3 {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all dense 3x3 Jacobi decomposition tests.
+//
+// This class represents a test suite for the branch-free singular value, polar and symmetric
+// eigenvalue decompositions of 3x3 matrices. It tests the single matrix functions for random
+// and for degenerate matrices as well as the batched functions.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, bool SO >
+   void testRandom();
+
+   template< typename Type >
+   void testBatch( size_t N );
+
+   void testDegenerate();
+
+   template< typename Type, bool SO >
+   void checkSvd( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A );
+
+   template< typename Type, bool SO >
+   void checkPolar( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A );
+
+   template< typename Type, bool SO >
+   void checkEigh( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A );
+
+   template< typename Type, bool SO1, bool SO2, bool TF, bool SO3 >
+   void checkSvd( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                  const blaze::StaticMatrix<Type,3UL,3UL,SO2>& U,
+                  const blaze::StaticVector<Type,3UL,TF>& s,
+                  const blaze::StaticMatrix<Type,3UL,3UL,SO3>& V );
+
+   template< typename Type, bool SO1, bool SO2, bool SO3 >
+   void checkPolar( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                    const blaze::StaticMatrix<Type,3UL,3UL,SO2>& R,
+                    const blaze::StaticMatrix<Type,3UL,3UL,SO3>& S );
+
+   template< typename Type, bool SO1, bool TF, bool SO2 >
+   void checkEigh( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                   const blaze::StaticVector<Type,3UL,TF>& w,
+                   const blaze::StaticMatrix<Type,3UL,3UL,SO2>& V );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   static bool isClose( const MT1& A, const MT2& B, blaze::ElementType_<MT1> scale );
+
+   template< typename MT >
+   static blaze::ElementType_<MT> determinant( const MT& A );
+
+   template< typename Type >
+   static Type tolerance();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the 3x3 decompositions with randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the 3x3 singular value, polar and symmetric eigenvalue decompositions
+// for a number of randomly initialized matrices of the given element type and storage order.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO >
+void DenseTest::testRandom()
+{
+   test_ = "3x3 decompositions with random matrices";
+
+   for( size_t rep=0UL; rep<100UL; ++rep )
+   {
+      blaze::StaticMatrix<Type,3UL,3UL,SO> A;
+      randomize( A, Type(-1), Type(1) );
+
+      checkSvd( A );
+      checkPolar( A );
+      checkEigh( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched 3x3 decompositions.
+//
+// \param N The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched 3x3 singular value, polar and symmetric eigenvalue
+// decompositions for a batch of \a N random (symmetric) matrices. Each result is checked individually and
+// the singular values and eigenvalues are compared to the results of the single matrix
+// functions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testBatch( size_t N )
+{
+   test_ = "Batched 3x3 decompositions";
+
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   typedef blaze::StaticMatrix<Type,3UL,3UL,rowMajor>     RMT;
+   typedef blaze::StaticMatrix<Type,3UL,3UL,columnMajor>  CMT;
+   typedef blaze::StaticVector<Type,3UL,columnVector>     VT;
+
+   std::vector< RMT, blaze::AlignedAllocator<RMT> > A( N ), B( N );
+   for( size_t i=0UL; i<N; ++i ) {
+      randomize( A[i], Type(-1), Type(1) );
+      B[i] = A[i] + trans( A[i] );
+   }
+
+   std::vector< CMT, blaze::AlignedAllocator<CMT> > U, V, R, S, Q;
+   std::vector< VT , blaze::AlignedAllocator<VT>  > s, w;
+
+   svd3x3  ( A, U, s, V );
+   polar3x3( A, R, S );
+   eigh3x3 ( B, w, Q );
+
+   if( U.size() != N || s.size() != N || V.size() != N || R.size() != N || S.size() != N ||
+       w.size() != N || Q.size() != N ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of results\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of matrices: " << N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      checkSvd  ( A[i], U[i], s[i], V[i] );
+      checkPolar( A[i], R[i], S[i] );
+      checkEigh ( B[i], w[i], Q[i] );
+
+      RMT U1, V1, Q1;
+      VT s1, w1;
+      svd3x3 ( A[i], U1, s1, V1 );
+      eigh3x3( B[i], w1, Q1 );
+
+      if( !isClose( s[i], s1, Type(1) ) || !isClose( w[i], w1, Type(1) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batched and single decomposition differ\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix index: " << i << " of " << N << "\n"
+             << "   Batched singular values:\n" << s[i] << "\n"
+             << "   Single singular values:\n" << s1 << "\n"
+             << "   Batched eigenvalues:\n" << w[i] << "\n"
+             << "   Single eigenvalues:\n" << w1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the 3x3 singular value decomposition of the given matrix.
+//
+// \param A The given 3x3 matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the singular value decomposition of the given matrix both with
+// row-major and column-major result matrices and checks the results. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO >
+void DenseTest::checkSvd( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A )
+{
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> U1, V1;
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::columnMajor> U2, V2;
+   blaze::StaticVector<Type,3UL,blaze::columnVector> s1;
+   blaze::StaticVector<Type,3UL,blaze::rowVector> s2;
+
+   svd3x3( A, U1, s1, V1 );
+   checkSvd( A, U1, s1, V1 );
+
+   svd3x3( A, U2, s2, V2 );
+   checkSvd( A, U2, s2, V2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the 3x3 polar decomposition of the given matrix.
+//
+// \param A The given 3x3 matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the polar decomposition of the given matrix both with row-major and
+// column-major result matrices and checks the results. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO >
+void DenseTest::checkPolar( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A )
+{
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> R1, S1;
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::columnMajor> R2, S2;
+
+   polar3x3( A, R1, S1 );
+   checkPolar( A, R1, S1 );
+
+   polar3x3( A, R2, S2 );
+   checkPolar( A, R2, S2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the 3x3 symmetric eigenvalue decomposition of the given matrix.
+//
+// \param A The given 3x3 matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the eigenvalue decomposition of the symmetric matrix \f$ A + A^T \f$.
+// Since only the lower part of the matrix is referenced, the upper part of the input matrix
+// is additionally overwritten with arbitrary values. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO >
+void DenseTest::checkEigh( const blaze::StaticMatrix<Type,3UL,3UL,SO>& A )
+{
+   const blaze::StaticMatrix<Type,3UL,3UL,SO> B( A + trans( A ) );
+
+   blaze::StaticMatrix<Type,3UL,3UL,SO> L( B );
+   L(0,1) = L(0,2) = L(1,2) = Type(7);
+
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> V1;
+   blaze::StaticMatrix<Type,3UL,3UL,blaze::columnMajor> V2;
+   blaze::StaticVector<Type,3UL,blaze::columnVector> w1;
+   blaze::StaticVector<Type,3UL,blaze::rowVector> w2;
+
+   eigh3x3( L, w1, V1 );
+   checkEigh( B, w1, V1 );
+
+   eigh3x3( L, w2, V2 );
+   checkEigh( B, w2, V2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a 3x3 singular value decomposition.
+//
+// \param A The decomposed 3x3 matrix.
+// \param U The computed left singular vectors.
+// \param s The computed singular values.
+// \param V The computed right singular vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that \f$ A = U \cdot diag(s) \cdot V \f$ holds, that \a U and \a V are
+// proper rotations and that the singular values are sorted in descending order of their
+// magnitude with only the last singular value being possibly negative. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO1, bool SO2, bool TF, bool SO3 >
+void DenseTest::checkSvd( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                          const blaze::StaticMatrix<Type,3UL,3UL,SO2>& U,
+                          const blaze::StaticVector<Type,3UL,TF>& s,
+                          const blaze::StaticMatrix<Type,3UL,3UL,SO3>& V )
+{
+   const Type scale( max( abs( A ) ) );
+   const Type tol( tolerance<Type>() * scale );
+
+   blaze::StaticMatrix<Type,3UL,3UL,SO2> UD( U );
+   for( size_t j=0UL; j<3UL; ++j ) {
+      column( UD, j ) *= s[j];
+   }
+
+   const blaze::IdentityMatrix<Type> I( 3UL );
+
+   const bool ordered( s[0] >= s[1] - tol && s[1] >= std::abs( s[2] ) - tol && s[1] >= Type(0) );
+
+   if( !isClose( UD * V, A, scale ) || !isClose( trans( U ) * U, I, Type(1) ) ||
+       !isClose( V * trans( V ), I, Type(1) ) || !ordered ||
+       std::abs( determinant( U ) - Type(1) ) > tolerance<Type>() ||
+       std::abs( determinant( V ) - Type(1) ) > tolerance<Type>() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Singular value decomposition failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Sorted singular values: " << ordered << "\n"
+          << "   Input matrix:\n" << A << "\n"
+          << "   Result U:\n" << U << "\n"
+          << "   Result s:\n" << s << "\n"
+          << "   Result V:\n" << V << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a 3x3 polar decomposition.
+//
+// \param A The decomposed 3x3 matrix.
+// \param R The computed rotation.
+// \param S The computed symmetric matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that \f$ A = R \cdot S \f$ holds, that \a R is a proper rotation and
+// that \a S is symmetric. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type, bool SO1, bool SO2, bool SO3 >
+void DenseTest::checkPolar( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                            const blaze::StaticMatrix<Type,3UL,3UL,SO2>& R,
+                            const blaze::StaticMatrix<Type,3UL,3UL,SO3>& S )
+{
+   const Type scale( max( abs( A ) ) );
+
+   if( !isClose( R * S, A, scale ) || !isClose( trans( R ) * R, blaze::IdentityMatrix<Type>( 3UL ), Type(1) ) ||
+       !isClose( S, trans( S ), scale ) || std::abs( determinant( R ) - Type(1) ) > tolerance<Type>() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Polar decomposition failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Input matrix:\n" << A << "\n"
+          << "   Result R:\n" << R << "\n"
+          << "   Result S:\n" << S << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a 3x3 symmetric eigenvalue decomposition.
+//
+// \param A The decomposed symmetric 3x3 matrix.
+// \param w The computed eigenvalues.
+// \param V The computed eigenvectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that \f$ A \cdot V = V \cdot diag(w) \f$ holds, that \a V is a proper
+// rotation and that the eigenvalues are sorted in ascending order. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO1, bool TF, bool SO2 >
+void DenseTest::checkEigh( const blaze::StaticMatrix<Type,3UL,3UL,SO1>& A,
+                           const blaze::StaticVector<Type,3UL,TF>& w,
+                           const blaze::StaticMatrix<Type,3UL,3UL,SO2>& V )
+{
+   const Type scale( max( abs( A ) ) );
+   const Type tol( tolerance<Type>() * scale );
+
+   blaze::StaticMatrix<Type,3UL,3UL,SO2> VW( V );
+   for( size_t j=0UL; j<3UL; ++j ) {
+      column( VW, j ) *= w[j];
+   }
+
+   const bool sorted( w[0] <= w[1] + tol && w[1] <= w[2] + tol );
+
+   if( !isClose( A * V, VW, scale ) || !isClose( trans( V ) * V, blaze::IdentityMatrix<Type>( 3UL ), Type(1) ) ||
+       !sorted || std::abs( determinant( V ) - Type(1) ) > tolerance<Type>() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Eigenvalue decomposition failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Sorted eigenvalues: " << sorted << "\n"
+          << "   Input matrix:\n" << A << "\n"
+          << "   Result w:\n" << w << "\n"
+          << "   Result V:\n" << V << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Elementwise comparison of two matrices or vectors relative to the given scale.
+//
+// \param A The first matrix or vector.
+// \param B The second matrix or vector.
+// \param scale The magnitude of the elements of the compared matrices or vectors.
+// \return \a true if all elements agree up to the tolerance, \a false if not.
+*/
+template< typename MT1, typename MT2 >
+bool DenseTest::isClose( const MT1& A, const MT2& B, blaze::ElementType_<MT1> scale )
+{
+   typedef blaze::ElementType_<MT1>  ET;
+
+   return max( abs( A - B ) ) <= tolerance<ET>() * scale;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the determinant of the given 3x3 matrix.
+//
+// \param A The given 3x3 matrix.
+// \return The determinant of the matrix.
+*/
+template< typename MT >
+blaze::ElementType_<MT> DenseTest::determinant( const MT& A )
+{
+   return A(0,0) * ( A(1,1)*A(2,2) - A(1,2)*A(2,1) ) -
+          A(0,1) * ( A(1,0)*A(2,2) - A(1,2)*A(2,0) ) +
+          A(0,2) * ( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative tolerance of the decomposition tests for the given element type.
+//
+// \return The relative tolerance.
+*/
+template< typename Type >
+Type DenseTest::tolerance()
+{
+   return Type(64) * std::numeric_limits<Type>::epsilon();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the branch-free 3x3 Jacobi decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense 3x3 Jacobi decomposition test.
+*/
+#define RUN_DENSE_JACOBI3X3_TEST \
+   blazetest::mathtest::jacobi3x3::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace jacobi3x3
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
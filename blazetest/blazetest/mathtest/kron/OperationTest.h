@@ -0,0 +1,409 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kron/OperationTest.h
+//  \brief Header file for the Kronecker product operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_KRON_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_KRON_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kron {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Kronecker product.
+//
+// This class represents a test suite for the Kronecker product expressions. It tests the
+// assignment of Kronecker products of dense and sparse, row-major and column-major operands
+// to dense and sparse target matrices as well as the multiplication of Kronecker products with
+// dense vectors. All results are verified against an explicitly formed Kronecker product.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT1, typename MT2 > void testAssign();
+   template< typename MT1, typename MT2 > void testVectorMult();
+                                          void testLargeProduct();
+                                          void testNonFinite();
+                                          void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > static void initialize( MT& A, size_t m, size_t n, size_t seed );
+
+   template< typename MT1, typename MT2 >
+   static blaze::DynamicMatrix<double,blaze::rowMajor> reference( const MT1& A, const MT2& B );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const std::string& op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Kronecker product assignment operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, subtraction assignment
+// and Schur product assignment of the Kronecker product of two matrices of the given types to
+// dense and sparse target matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+void OperationTest::testAssign()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Kronecker product assignment";
+
+   MT1 A;
+   MT2 B;
+   initialize( A, 3UL, 4UL, 1UL );
+   initialize( B, 5UL, 2UL, 2UL );
+
+   const blaze::DynamicMatrix<double,rowMajor> ref( reference( A, B ) );
+
+   {
+      const blaze::DynamicMatrix<double,rowMajor> C( blaze::kron( A, B ) );
+      checkResult( C, ref, "Row-major dense assignment" );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,columnMajor> C( blaze::kron( A, B ) );
+      checkResult( C, ref, "Column-major dense assignment" );
+   }
+
+   {
+      const blaze::CompressedMatrix<double,rowMajor> C( blaze::kron( A, B ) );
+      checkResult( C, ref, "Row-major sparse assignment" );
+   }
+
+   {
+      const blaze::CompressedMatrix<double,columnMajor> C( blaze::kron( A, B ) );
+      checkResult( C, ref, "Column-major sparse assignment" );
+   }
+
+   {
+      blaze::DynamicMatrix<double,rowMajor> C( ref );
+      C += blaze::kron( A, B );
+      checkResult( C, 2.0*ref, "Addition assignment" );
+
+      C -= blaze::kron( A, B );
+      checkResult( C, ref, "Subtraction assignment" );
+
+      C %= blaze::kron( A, B );
+      checkResult( C, ref % ref, "Schur product assignment" );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,rowMajor> C( blaze::kron( trans( A ), 2.0*B ) );
+      checkResult( C, reference( trans( A ), 2.0*B ), "Assignment of transpose operands" );
+   }
+
+   {
+      const auto K( blaze::kron( A, B ) );
+      blaze::DynamicMatrix<double,rowMajor> C( ref.rows(), ref.columns() );
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         for( size_t j=0UL; j<ref.columns(); ++j ) {
+            C(i,j) = K(i,j);
+         }
+      }
+      checkResult( C, ref, "Element access" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Kronecker product/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of the Kronecker product of two matrices
+// of the given types with a dense column vector and a dense row vector. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+void OperationTest::testVectorMult()
+{
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   test_ = "Kronecker product/dense vector multiplication";
+
+   MT1 A;
+   MT2 B;
+   initialize( A, 4UL, 3UL, 3UL );
+   initialize( B, 2UL, 6UL, 4UL );
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> ref( reference( A, B ) );
+
+   blaze::DynamicVector<double,columnVector> x( ref.columns() );
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = 0.5 * double( 1 + i%7UL );
+   }
+
+   blaze::DynamicVector<double,rowVector> z( ref.rows() );
+   for( size_t i=0UL; i<z.size(); ++i ) {
+      z[i] = 0.25 * double( 1 + i%5UL );
+   }
+
+   {
+      const blaze::DynamicVector<double,columnVector> y( blaze::kron( A, B ) * x );
+      checkResult( y, ref * x, "Multiplication with a dense vector" );
+   }
+
+   {
+      blaze::DynamicVector<double,columnVector> y( ref * x );
+      y += blaze::kron( A, B ) * ( 2.0 * x );
+      checkResult( y, 3.0 * ref * x, "Addition assignment of a scaled multiplication" );
+   }
+
+   {
+      const blaze::CompressedVector<double,columnVector> y( blaze::kron( A, B ) * x );
+      checkResult( y, ref * x, "Multiplication assigned to a sparse vector" );
+   }
+
+   {
+      const blaze::DynamicVector<double,rowVector> y( z * blaze::kron( A, B ) );
+      checkResult( y, z * ref, "Multiplication with a transpose dense vector" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a deterministic pattern.
+//
+// \param A The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param seed The seed of the pattern.
+// \return void
+//
+// This function resizes the given matrix to \f$ m \times n \f$ and initializes it with a
+// deterministic pattern of non-zero elements. Every third element is left zero in order to
+// test the handling of default elements.
+*/
+template< typename MT >  // Type of the matrix
+void OperationTest::initialize( MT& A, size_t m, size_t n, size_t seed )
+{
+   A.resize( m, n, false );
+   reset( A );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t k( i*n + j + seed );
+         if( k % 3UL != 0UL ) {
+            A(i,j) = double( k % 7UL ) - 2.5;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Explicit computation of the Kronecker product of the two given matrices.
+//
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \return The explicitly formed Kronecker product.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+blaze::DynamicMatrix<double,blaze::rowMajor>
+   OperationTest::reference( const MT1& A, const MT2& B )
+{
+   const size_t P( B.rows()    );
+   const size_t Q( B.columns() );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> C( A.rows()*P, A.columns()*Q );
+
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( size_t j=0UL; j<C.columns(); ++j ) {
+         C(i,j) = A(i/P,j/Q) * B(i%P,j%Q);
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a Kronecker product operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param op The label of the performed operation.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void OperationTest::checkResult( const T1& result, const T2& expected, const std::string& op ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << op << " failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Kronecker product.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Kronecker product operation test.
+*/
+#define RUN_KRON_OPERATION_TEST \
+   blazetest::mathtest::kron::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kron
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mapped/ClassTest.h
+//  \brief Header file for the memory-mapped container class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_MAPPED_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPED_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/MappedVector.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mapped {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the memory-mapped containers.
+//
+// This class represents a test suite for the MappedVector and MappedMatrix class templates and
+// for the memory-mapped storage of compressed matrices. It performs a series of runtime tests
+// on the creation, mapping, resizing, and persistence of file-backed vectors and matrices.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+                        void testVector();
+   template< bool SO > void testMatrix();
+   template< bool SO > void testCompressed();
+                        void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void checkValue( const Type& value, const Type& expected, const std::string& error ) const;
+
+   void writeHeader( size_t rows, size_t columns, size_t spacing ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Path of the temporary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the creation, the mapping, and the resizing of a file-backed matrix with
+// the given storage order. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO >
+void ClassTest::testMatrix()
+{
+   test_ = "MappedMatrix";
+
+   blaze::DynamicMatrix<double,SO> R( 7UL, 5UL );
+   blaze::randomize( R );
+
+   {
+      blaze::MappedMatrix<double,SO> A( file_, 7UL, 5UL );
+      A = R;
+      A.sync();
+
+      checkValue( A.isAligned(), true, "Unaligned mapped matrix" );
+      checkValue( A.spacing() >= ( SO ? 7UL : 5UL ), true, "Invalid spacing" );
+   }
+
+   {
+      const blaze::MappedMatrix<const double,SO> A( file_ );
+      A.advise( blaze::sequentialAccess );
+      A.prefetch();
+
+      checkValue( A.rows(), 7UL, "Invalid number of rows" );
+      checkValue( A.columns(), 5UL, "Invalid number of columns" );
+      checkValue( A == R, true, "Invalid persistent matrix" );
+
+      const blaze::DynamicMatrix<double,SO> B( A * trans( A ) );
+      const blaze::DynamicMatrix<double,SO> C( R * trans( R ) );
+      checkValue( B == C, true, "Invalid matrix multiplication" );
+   }
+
+   {
+      blaze::MappedMatrix<double,SO> A( file_ );
+
+      A.resize( 9UL, 6UL );
+      bool equal( true );
+      for( size_t i=0UL; i<9UL; ++i )
+         for( size_t j=0UL; j<6UL; ++j )
+            equal = equal && A(i,j) == ( ( i < 7UL && j < 5UL )?( R(i,j) ):( 0.0 ) );
+      checkValue( equal, true, "Invalid growing resize" );
+
+      A.resize( 4UL, 3UL );
+      equal = true;
+      for( size_t i=0UL; i<4UL; ++i )
+         for( size_t j=0UL; j<3UL; ++j )
+            equal = equal && A(i,j) == R(i,j);
+      checkValue( equal, true, "Invalid shrinking resize" );
+
+      A.resize( 10UL, 11UL );
+      equal = true;
+      for( size_t i=0UL; i<10UL; ++i )
+         for( size_t j=0UL; j<11UL; ++j )
+            equal = equal && A(i,j) == ( ( i < 4UL && j < 3UL )?( R(i,j) ):( 0.0 ) );
+      checkValue( equal, true, "Invalid resize after shrinking" );
+   }
+
+   {
+      blaze::MappedMatrix<double,SO> A( file_, blaze::copyOnWrite );
+      A = 2.0;
+   }
+
+   {
+      const blaze::MappedMatrix<const double,SO> A( file_ );
+      checkValue( A(0,0), R(0,0), "Copy-on-write mapping modified the file" );
+      checkValue( A(9,10), 0.0, "Copy-on-write mapping modified the file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the memory-mapped storage of compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function stores and loads a compressed matrix with the given storage order via the
+// saveMapped() and loadMapped() functions. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testCompressed()
+{
+   test_ = "Mapped compressed matrix";
+
+   blaze::CompressedMatrix<double,SO> A( 9UL, 13UL );
+   blaze::randomize( A, 30UL );
+
+   blaze::saveMapped( file_, A );
+
+   blaze::CompressedMatrix<double,SO> B( 2UL, 2UL );
+   blaze::loadMapped( file_, B );
+
+   checkValue( B.rows(), 9UL, "Invalid number of rows" );
+   checkValue( B.columns(), 13UL, "Invalid number of columns" );
+   checkValue( B.nonZeros(), A.nonZeros(), "Invalid number of non-zero elements" );
+   checkValue( B == A, true, "Invalid loaded matrix" );
+
+   blaze::saveMapped( file_, blaze::CompressedMatrix<double,SO>( 3UL, 4UL ) );
+   blaze::loadMapped( file_, B );
+
+   checkValue( B.rows(), 3UL, "Invalid number of rows" );
+   checkValue( B.nonZeros(), 0UL, "Invalid number of non-zero elements" );
+
+   // Loading a file with an overflowing number of non-zero elements
+   try {
+      {
+         blaze::MappedFile file( file_, blaze::readWrite );
+
+         blaze::MappedHeader header;
+         std::memcpy( &header, file.data(), sizeof( header ) );
+
+         const uint64_t nonzeros( 1UL << 62 );
+         header.nonZeros = nonzeros;
+
+         std::memcpy( file.data(), &header, sizeof( header ) );
+         std::memcpy( file.data() + sizeof( header ) + ( SO ? 4UL : 3UL )*sizeof( uint64_t ),
+                      &nonzeros, sizeof( nonzeros ) );
+      }
+
+      blaze::loadMapped( file_, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a file with an overflowing number of non-zero elements succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkValue( B.rows(), 3UL, "Invalid number of rows" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given value.
+//
+// \param value The value to be checked.
+// \param expected The expected value.
+// \param error The error message in case the values differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void ClassTest::checkValue( const Type& value, const Type& expected, const std::string& error ) const
+{
+   if( !( value == expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << value << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the memory-mapped containers.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the memory-mapped container class test.
+*/
+#define RUN_MAPPED_CLASS_TEST \
+   blazetest::mathtest::mapped::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mapped
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
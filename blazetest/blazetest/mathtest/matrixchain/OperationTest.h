@@ -0,0 +1,428 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixchain/OperationTest.h
+//  \brief Header file for the matrix chain reordering operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXCHAIN_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXCHAIN_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/expressions/MatrixChain.h>
+#include <blaze/system/Optimizations.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixchain {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime reordering of matrix product chains.
+//
+// This class represents a test suite for the runtime reordering of chained matrix/matrix
+// multiplications. It tests the order of evaluation chosen by the MatrixChainPlan class and
+// compares the results of the assignment, addition assignment, and subtraction assignment of
+// reordered chains (both serial and SMP) to the left-to-right evaluation of the chain.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using DMat  = blaze::DynamicMatrix<double,blaze::rowMajor>;        //!< Row-major dense matrix type.
+   using TDMat = blaze::DynamicMatrix<double,blaze::columnMajor>;     //!< Column-major dense matrix type.
+   using SMat  = blaze::CompressedMatrix<double,blaze::rowMajor>;     //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<double,blaze::columnMajor>;  //!< Column-major sparse matrix type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPlan();
+   void testDenseChains();
+   void testSparseChains();
+   void testRankOne();
+   void testLarge();
+   void testAliasing();
+
+   template< typename... MTs >
+   void testChain( bool reordered, const MTs&... mats );
+
+   void checkPlan( const blaze::MatrixChainPlan& plan, size_t i, size_t j, size_t split ) const;
+   void checkCost( const blaze::MatrixChainPlan& plan, double flops ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static blaze::MatrixChainNode node( size_t m, size_t n );
+   static blaze::MatrixChainNode node( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT > static MT create( size_t m, size_t n, size_t seed );
+
+   template< typename MT, bool SO >
+   static void initialize( blaze::DenseMatrix<MT,SO>& mat, size_t seed );
+
+   template< typename MT, bool SO >
+   static void initialize( blaze::SparseMatrix<MT,SO>& mat, size_t seed );
+
+   template< typename MT >
+   static MT chain( const MT& mat );
+
+   template< typename MT1, typename MT2, typename... MTs >
+   static decltype(auto) chain( const MT1& lhs, const MT2& rhs, const MTs&... mats );
+
+   template< typename MT >
+   static DMat evaluate( const MT& mat );
+
+   template< typename MT1, typename MT2, typename... MTs >
+   static DMat evaluate( const MT1& lhs, const MT2& rhs, const MTs&... mats );
+
+   static double value( size_t i, size_t j, size_t seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of the given matrix product chain.
+//
+// \param reordered \a true in case the chain is expected to be reordered, \a false if not.
+// \param mats The factors of the chain.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given chain is reordered as expected and compares the
+// results of the serial and SMP assignment, addition assignment, and subtraction assignment
+// of the chain to a row-major and a column-major dense matrix to the left-to-right evaluation
+// of the chain. In case the runtime reordering of matrix product chains is disabled, no chain
+// is expected to be reordered. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename... MTs >
+void OperationTest::testChain( bool reordered, const MTs&... mats )
+{
+   reordered = reordered && blaze::useChainReordering;
+
+   if( blaze::evaluateMatrixChain<true>( chain( mats... ), []( const auto& ) {} ) != reordered ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected order of evaluation\n"
+          << " Details:\n"
+          << "   Number of factors: " << sizeof...( MTs ) << "\n"
+          << "   Expected reordering: " << ( reordered ? "yes" : "no" ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const DMat ref( evaluate( mats... ) );
+   const DMat init( create<DMat>( ref.rows(), ref.columns(), 7UL ) );
+
+   DMat  res1, res3, res5( init ), res7( init ), res9 ( init ), res11( init );
+   TDMat res2, res4, res6( init ), res8( init ), res10( init ), res12( init );
+
+   res1  = chain( mats... );
+   res2  = chain( mats... );
+   res3  = serial( chain( mats... ) );
+   res4  = serial( chain( mats... ) );
+   res5 += chain( mats... );
+   res6 += chain( mats... );
+   res7 += serial( chain( mats... ) );
+   res8 += serial( chain( mats... ) );
+   res9  -= chain( mats... );
+   res10 -= chain( mats... );
+   res11 -= serial( chain( mats... ) );
+   res12 -= serial( chain( mats... ) );
+
+   const DMat add( init + ref );
+   const DMat sub( init - ref );
+
+   if( res1 != ref || res2 != ref || res3 != ref || res4 != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of the matrix chain failed\n"
+          << " Details:\n"
+          << "   Row-major result:\n" << res1 << "\n"
+          << "   Column-major result:\n" << res2 << "\n"
+          << "   Serial row-major result:\n" << res3 << "\n"
+          << "   Serial column-major result:\n" << res4 << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( res5 != add || res6 != add || res7 != add || res8 != add ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition assignment of the matrix chain failed\n"
+          << " Details:\n"
+          << "   Row-major result:\n" << res5 << "\n"
+          << "   Column-major result:\n" << res6 << "\n"
+          << "   Serial row-major result:\n" << res7 << "\n"
+          << "   Serial column-major result:\n" << res8 << "\n"
+          << "   Expected result:\n" << add << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( res9 != sub || res10 != sub || res11 != sub || res12 != sub ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subtraction assignment of the matrix chain failed\n"
+          << " Details:\n"
+          << "   Row-major result:\n" << res9 << "\n"
+          << "   Column-major result:\n" << res10 << "\n"
+          << "   Serial row-major result:\n" << res11 << "\n"
+          << "   Serial column-major result:\n" << res12 << "\n"
+          << "   Expected result:\n" << sub << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates and initializes a matrix of the given size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param seed The seed of the matrix values.
+// \return The initialized matrix.
+*/
+template< typename MT >
+MT OperationTest::create( size_t m, size_t n, size_t seed )
+{
+   MT mat( m, n );
+   initialize( mat, seed );
+   return mat;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes all elements of the given dense matrix.
+//
+// \param mat The dense matrix to be initialized.
+// \param seed The seed of the matrix values.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::initialize( blaze::DenseMatrix<MT,SO>& mat, size_t seed )
+{
+   for( size_t i=0UL; i<(~mat).rows(); ++i ) {
+      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+         (~mat)(i,j) = value( i, j, seed );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes approximately a third of the elements of the given sparse matrix.
+//
+// \param mat The sparse matrix to be initialized.
+// \param seed The seed of the matrix values and the sparsity pattern.
+// \return void
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void OperationTest::initialize( blaze::SparseMatrix<MT,SO>& mat, size_t seed )
+{
+   for( size_t i=0UL; i<(~mat).rows(); ++i ) {
+      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+         if( ( i + 2UL*j + seed ) % 3UL == 0UL )
+            (~mat)(i,j) = value( i, j, seed );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given factor as the trivial matrix product chain.
+//
+// \param mat The single factor.
+// \return Copy of the given factor.
+*/
+template< typename MT >
+MT OperationTest::chain( const MT& mat )
+{
+   return mat;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the product expression of the given factors.
+//
+// \param lhs The first factor.
+// \param rhs The second factor.
+// \param mats The remaining factors.
+// \return The expression \f$ ((lhs*rhs)*mats_0)*... \f$.
+*/
+template< typename MT1, typename MT2, typename... MTs >
+decltype(auto) OperationTest::chain( const MT1& lhs, const MT2& rhs, const MTs&... mats )
+{
+   return chain( lhs * rhs, mats... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the given factor into a dense matrix.
+//
+// \param mat The single factor.
+// \return The evaluated factor.
+*/
+template< typename MT >
+OperationTest::DMat OperationTest::evaluate( const MT& mat )
+{
+   return DMat( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the product of the given factors from left to right.
+//
+// \param lhs The first factor.
+// \param rhs The second factor.
+// \param mats The remaining factors.
+// \return The product of all factors.
+//
+// All products are evaluated into temporaries, i.e. no chain of matrix products is created.
+*/
+template< typename MT1, typename MT2, typename... MTs >
+OperationTest::DMat OperationTest::evaluate( const MT1& lhs, const MT2& rhs, const MTs&... mats )
+{
+   return evaluate( DMat( lhs * rhs ), mats... );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime reordering of matrix product chains.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the matrix chain reordering operation test.
+*/
+#define RUN_MATRIXCHAIN_OPERATION_TEST \
+   blazetest::mathtest::matrixchain::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixchain
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -47,6 +47,7 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/serialization/SparseEncoding.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/Submatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -94,6 +95,7 @@ class ClassTest
    //@{
    void testEmptyMatrices ();
    void testRandomMatrices();
+   void testDeltaEncoding ();
    void testFailures      ();
 
    template< size_t M, size_t N, typename MT >
@@ -131,7 +133,8 @@ class ClassTest
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   std::string test_;  //!< Label of the currently performed test.
+   std::string test_;                //!< Label of the currently performed test.
+   blaze::SparseEncoding encoding_;  //!< The encoding of serialized sparse matrices.
    //@}
    //**********************************************************************************************
 };
@@ -421,7 +424,10 @@ void ClassTest::testSerialization( Archive& archive, const MT& src )
    using blaze::IsDenseMatrix;
 
    try {
-      archive << src;
+      if( encoding_ == blaze::plainEncoding )
+         archive << src;
+      else
+         serialize( archive, src, encoding_ );
    }
    catch( std::runtime_error& ex ) {
       std::ostringstream oss;
@@ -0,0 +1,660 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mixedprecision/OperationTest.h
+//  \brief Header file for the mixed precision operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MIXEDPRECISION_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_MIXEDPRECISION_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/dense/IntegerMMM.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mixedprecision {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the mixed precision compute kernels.
+//
+// This class represents a test suite for the compute kernels that combine operands of different
+// floating point precision (single and double precision as well as the 16-bit bfloat16 and
+// float16 storage types) or of low precision integral types. This includes dense vector inner
+// products, dense matrix/dense vector and dense matrix/dense matrix multiplications, quantized
+// dense matrix multiplications, and the conversion between dense vectors and matrices of
+// different precision.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T1, typename T2 > void testDot();
+   template< typename T1, typename T2 > void testDMatDVecMult();
+   template< typename T1, typename T2 > void testTDMatDVecMult();
+   template< typename T1, typename T2 > void testDMatDMatMult();
+   template< typename T1, typename T2 > void testQuantizedDMatDMatMult();
+   template< typename T1, typename T2 > void testConversion();
+   template< typename T1, typename T2 > void testMatrixConversion();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type > static Type value( size_t i, size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense vector inner product.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inner product of two dense vectors with different
+// floating point element types for a range of vector sizes. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testDot()
+{
+   test_ = "Mixed precision dense vector inner product";
+
+   for( size_t n=0UL; n<100UL; n+=7UL )
+   {
+      blaze::DynamicVector<T1,blaze::columnVector> x( n );
+      blaze::DynamicVector<T2,blaze::columnVector> y( n );
+
+      double ref( 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         x[i] = value<T1>( i, 1UL );
+         y[i] = value<T2>( i, 2UL );
+         ref += static_cast<double>( x[i] ) * static_cast<double>( y[i] );
+      }
+
+      const double result( trans( x ) * y );
+
+      if( !blaze::equal( result, ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inner product failed\n"
+             << " Details:\n"
+             << "   Left-hand side element type:\n"
+             << "     " << typeid( T1 ).name() << "\n"
+             << "   Right-hand side element type:\n"
+             << "     " << typeid( T2 ).name() << "\n"
+             << "   Size: " << n << "\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision row-major dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a row-major dense matrix with a dense
+// vector of a different floating point element type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testDMatDVecMult()
+{
+   test_ = "Mixed precision row-major dense matrix/dense vector multiplication";
+
+   const size_t M( 37UL );
+   const size_t N( 53UL );
+
+   using RT = blaze::MultTrait_<T1,T2>;
+
+   blaze::DynamicMatrix<T1,blaze::rowMajor> A( M, N );
+   blaze::DynamicVector<T2,blaze::columnVector> x( N );
+   blaze::DynamicVector<RT,blaze::columnVector> ref( M, RT(0) );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = value<T2>( j, 5UL );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = value<T1>( i, j );
+         ref[i] += static_cast<RT>( A(i,j) ) * static_cast<RT>( x[j] );
+      }
+   }
+
+   const blaze::DynamicVector<RT,blaze::columnVector> result( A * x );
+
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Matrix element type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Vector element type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision column-major dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, and subtraction
+// assignment of the (scaled) multiplication of a column-major dense matrix with a dense
+// vector of a different floating point element type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testTDMatDVecMult()
+{
+   test_ = "Mixed precision column-major dense matrix/dense vector multiplication";
+
+   const size_t M( 37UL );
+   const size_t N( 53UL );
+
+   using RT = blaze::MultTrait_<T1,T2>;
+
+   blaze::DynamicMatrix<T1,blaze::columnMajor> A( M, N );
+   blaze::DynamicVector<T2,blaze::columnVector> x( N );
+   blaze::DynamicVector<RT,blaze::columnVector> ref( M, RT(0) );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = value<T2>( j, 5UL );
+   }
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         A(i,j) = value<T1>( i, j );
+         ref[i] += static_cast<RT>( A(i,j) ) * static_cast<RT>( x[j] );
+      }
+   }
+
+   blaze::DynamicVector<RT,blaze::columnVector> result1( A * x );
+
+   blaze::DynamicVector<RT,blaze::columnVector> result2( ref );
+   result2 += A * x;
+   result2 -= A * x;
+
+   blaze::DynamicVector<RT,blaze::columnVector> result3( RT(2) * ( A * x ) );
+   result3 -= ( A * x ) * RT(3);
+   result3 += ( A * x ) * RT(2);
+
+   if( result1 != ref || result2 != ref || result3 != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Matrix element type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Vector element type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Result (assignment):\n" << result1 << "\n"
+          << "   Result (addition/subtraction assignment):\n" << result2 << "\n"
+          << "   Result (scaled assignment):\n" << result3 << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, and subtraction
+// assignment of the (scaled) multiplication of two dense matrices with different floating
+// point element types or with low precision integral element types for all combinations of
+// storage orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testDMatDMatMult()
+{
+   test_ = "Mixed precision dense matrix/dense matrix multiplication";
+
+   using RT = blaze::If_< blaze::IsIntegral<T1>, int32_t, blaze::MultTrait_<T1,T2> >;
+
+   const size_t M( 83UL );
+   const size_t N( 91UL );
+   const size_t K( 77UL );
+
+   blaze::DynamicMatrix<T1,blaze::rowMajor> A( M, K );
+   blaze::DynamicMatrix<T2,blaze::rowMajor> B( K, N );
+   blaze::DynamicMatrix<RT,blaze::rowMajor> ref( M, N, RT(0) );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         A(i,k) = value<T1>( i, k );
+      }
+   }
+
+   for( size_t k=0UL; k<K; ++k ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         B(k,j) = value<T2>( k+1UL, j );
+      }
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t k=0UL; k<K; ++k ) {
+            ref(i,j) += static_cast<RT>( A(i,k) ) * static_cast<RT>( B(k,j) );
+         }
+      }
+   }
+
+   const blaze::DynamicMatrix<T1,blaze::columnMajor> TA( A );
+   const blaze::DynamicMatrix<T2,blaze::columnMajor> TB( B );
+
+   blaze::DynamicMatrix<RT,blaze::rowMajor>    result1( A * B );
+   blaze::DynamicMatrix<RT,blaze::columnMajor> result2( A * TB );
+   blaze::DynamicMatrix<RT,blaze::rowMajor>    result3( TA * B );
+   blaze::DynamicMatrix<RT,blaze::columnMajor> result4( TA * TB );
+
+   blaze::DynamicMatrix<RT,blaze::rowMajor> result5( ref );
+   result5 += A * TB;
+   result5 -= TA * B;
+
+   blaze::DynamicMatrix<RT,blaze::columnMajor> result6( RT(2) * ( TA * TB ) );
+   result6 -= ( A * B ) * RT(3);
+   result6 += ( A * TB ) * RT(2);
+
+   if( result1 != ref || result2 != ref || result3 != ref ||
+       result4 != ref || result5 != ref || result6 != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Left-hand side element type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Right-hand side element type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Result (row-major/row-major):\n" << result1 << "\n"
+          << "   Result (row-major/column-major):\n" << result2 << "\n"
+          << "   Result (column-major/row-major):\n" << result3 << "\n"
+          << "   Result (column-major/column-major):\n" << result4 << "\n"
+          << "   Result (addition/subtraction assignment):\n" << result5 << "\n"
+          << "   Result (scaled assignment):\n" << result6 << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the quantized dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the quantized multiplication of two dense matrices with
+// low precision integral element types (with and without row and column scaling factors) for
+// all combinations of storage orders. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testQuantizedDMatDMatMult()
+{
+   test_ = "Quantized dense matrix/dense matrix multiplication";
+
+   const size_t M( 67UL );
+   const size_t N( 45UL );
+   const size_t K( 129UL );
+
+   blaze::DynamicMatrix<T1,blaze::rowMajor> A( M, K );
+   blaze::DynamicMatrix<T2,blaze::rowMajor> B( K, N );
+   blaze::DynamicVector<float,blaze::columnVector> rs( M );
+   blaze::DynamicVector<float,blaze::rowVector> cs( N );
+   blaze::DynamicMatrix<int32_t,blaze::rowMajor> ref( M, N, 0 );
+   blaze::DynamicMatrix<float,blaze::rowMajor> sref( M, N );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         A(i,k) = value<T1>( i, k );
+      }
+   }
+
+   for( size_t k=0UL; k<K; ++k ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         B(k,j) = value<T2>( k+1UL, j );
+      }
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      rs[i] = 0.5F * float( i % 5UL + 1UL );
+   }
+
+   for( size_t j=0UL; j<N; ++j ) {
+      cs[j] = 0.25F * float( j % 3UL + 1UL );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t k=0UL; k<K; ++k ) {
+            ref(i,j) += static_cast<int32_t>( A(i,k) ) * static_cast<int32_t>( B(k,j) );
+         }
+         sref(i,j) = rs[i] * cs[j] * ref(i,j);
+      }
+   }
+
+   const blaze::DynamicMatrix<T1,blaze::columnMajor> TA( A );
+   const blaze::DynamicMatrix<T2,blaze::columnMajor> TB( B );
+
+   blaze::DynamicMatrix<int32_t,blaze::rowMajor> result1;
+   blaze::DynamicMatrix<int32_t,blaze::columnMajor> result2;
+   blaze::DynamicMatrix<float,blaze::rowMajor> result3;
+   blaze::DynamicMatrix<float,blaze::columnMajor> result4;
+
+   blaze::qmmm( result1, A, TB );
+   blaze::qmmm( result2, TA, B );
+   blaze::qmmm( result3, A, B, rs, cs );
+   blaze::qmmm( result4, TA, TB, rs, cs );
+
+   if( result1 != ref || result2 != ref || result3 != sref || result4 != sref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Left-hand side element type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Right-hand side element type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Result (row-major/column-major):\n" << result1 << "\n"
+          << "   Result (column-major/row-major):\n" << result2 << "\n"
+          << "   Expected result:\n" << ref << "\n"
+          << "   Scaled result (row-major/row-major):\n" << result3 << "\n"
+          << "   Scaled result (column-major/column-major):\n" << result4 << "\n"
+          << "   Expected scaled result:\n" << sref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::qmmm( result3, A, B, cs, rs );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid scaling factors accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between dense vectors of different floating point precision.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment of a dense vector to a dense vector with
+// a different floating point element type for a range of vector sizes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testConversion()
+{
+   test_ = "Dense vector conversion";
+
+   for( size_t n=0UL; n<100UL; n+=7UL )
+   {
+      blaze::DynamicVector<T2,blaze::columnVector> x( n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         x[i] = value<T2>( i, 3UL ) / T2(4);
+      }
+
+      const blaze::DynamicVector<T1,blaze::columnVector> result( x );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         if( result[i] != static_cast<T1>( x[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Conversion failed\n"
+                << " Details:\n"
+                << "   Target element type:\n"
+                << "     " << typeid( T1 ).name() << "\n"
+                << "   Source element type:\n"
+                << "     " << typeid( T2 ).name() << "\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << result << "\n"
+                << "   Source vector:\n" << x << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between dense matrices of different floating point precision.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment of a row-major and a column-major dense
+// matrix to a dense matrix with a different floating point element type. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1, typename T2 >
+void OperationTest::testMatrixConversion()
+{
+   test_ = "Dense matrix conversion";
+
+   for( size_t n=0UL; n<40UL; n+=13UL )
+   {
+      blaze::DynamicMatrix<T2,blaze::rowMajor> A( n, n+3UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = value<T2>( i, j ) / T2(8);
+         }
+      }
+
+      const blaze::DynamicMatrix<T2,blaze::columnMajor> TA( A );
+
+      const blaze::DynamicMatrix<T1,blaze::rowMajor>    result1( A  );
+      const blaze::DynamicMatrix<T1,blaze::columnMajor> result2( TA );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j )
+         {
+            if( result1(i,j) != static_cast<T1>( A(i,j) ) ||
+                result2(i,j) != static_cast<T1>( A(i,j) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Conversion failed\n"
+                   << " Details:\n"
+                   << "   Target element type:\n"
+                   << "     " << typeid( T1 ).name() << "\n"
+                   << "   Source element type:\n"
+                   << "     " << typeid( T2 ).name() << "\n"
+                   << "   Result (row-major):\n" << result1 << "\n"
+                   << "   Result (column-major):\n" << result2 << "\n"
+                   << "   Source matrix:\n" << A << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a small integral test value for the given indices.
+//
+// \param i The first index.
+// \param j The second index.
+// \return The test value in the range \f$[-5..5]\f$.
+//
+// Due to the small integral values all computations are exact, independent of the precision
+// and the order of the floating point operations within the different kernels.
+*/
+template< typename Type >
+Type OperationTest::value( size_t i, size_t j )
+{
+   return Type( static_cast<int>( ( i*7UL + j*3UL ) % 11UL ) - 5 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the mixed precision compute kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the mixed precision operation test.
+*/
+#define RUN_MIXEDPRECISION_OPERATION_TEST \
+   blazetest::mathtest::mixedprecision::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mixedprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
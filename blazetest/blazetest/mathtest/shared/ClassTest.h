@@ -0,0 +1,402 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/shared/ClassTest.h
+//  \brief Header file for the shared-memory container class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_SHARED_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SHARED_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SharedMatrix.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/SharedMemory.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace shared {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the shared-memory containers.
+//
+// This class represents a test suite for the SharedMatrix and SharedCompressedMatrix class
+// templates. It performs a series of runtime tests on the creation of shared memory segments,
+// the attachment from the same and from a forked process, and the reference counting.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ClassTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO > void testMatrix();
+   template< bool SO > void testCompressed();
+                        void testAnonymous();
+                        void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void checkValue( const Type& value, const Type& expected, const std::string& error ) const;
+
+   template< typename Func >
+   void checkChild( Func func, const std::string& error ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string name_;  //!< Name of the temporary shared memory segment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SharedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the creation of a shared dense matrix with the given storage order, the
+// attachment from the same and from a forked process, and the reference counting. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testMatrix()
+{
+   test_ = "SharedMatrix";
+
+   blaze::DynamicMatrix<double,SO> R( 7UL, 5UL );
+   blaze::randomize( R );
+
+   {
+      blaze::SharedMatrix<double,SO> A( name_, 7UL, 5UL );
+
+      checkValue( A.rows(), 7UL, "Invalid number of rows" );
+      checkValue( A.columns(), 5UL, "Invalid number of columns" );
+      checkValue( A.isAligned(), true, "Unaligned shared matrix" );
+      checkValue( A.references(), size_t( 1UL ), "Invalid number of references" );
+      checkValue( A.name(), name_, "Invalid segment name" );
+
+      A = R;
+
+      {
+         const blaze::SharedMatrix<const double,SO> B( name_ );
+
+         checkValue( A.references(), size_t( 2UL ), "Invalid number of references" );
+         checkValue( B.mode(), blaze::readOnly, "Invalid mapping mode" );
+         checkValue( B == R, true, "Invalid attached matrix" );
+
+         A(2,3) = 42.0;
+         checkValue( B(2,3), 42.0, "Modification not visible in attached matrix" );
+         A(2,3) = R(2,3);
+
+         const blaze::DynamicMatrix<double,SO> C( B * trans( B ) );
+         const blaze::DynamicMatrix<double,SO> D( R * trans( R ) );
+         checkValue( C == D, true, "Invalid matrix multiplication" );
+      }
+
+      checkValue( A.references(), size_t( 1UL ), "Invalid number of references" );
+
+      const std::string name( name_ );
+
+      checkChild( [&R,&name]() {
+         blaze::SharedMatrix<double,SO> B( name );
+         const bool valid( B == R && B.references() == 2UL );
+         B(0,0) = -1.0;
+         return valid;
+      }, "Invalid attachment from child process" );
+
+      checkValue( A(0,0), -1.0, "Modification of child process not visible" );
+      checkValue( A.references(), size_t( 1UL ), "Invalid number of references" );
+   }
+
+   // Removal of the segment by the last instance
+   try {
+      const blaze::SharedMatrix<const double,SO> B( name_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attaching to a removed segment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SharedCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the placement of a compressed matrix with the given storage order in a
+// shared memory segment, the attachment from the same and from a forked process, and the use of
+// the shared matrix in expressions. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testCompressed()
+{
+   test_ = "SharedCompressedMatrix";
+
+   blaze::CompressedMatrix<double,SO> A( 9UL, 13UL );
+   blaze::randomize( A, 30UL );
+   A(4,7) = 3.0;
+   A.erase( 8UL, 2UL );
+
+   blaze::DynamicVector<double,blaze::columnVector> x( 13UL );
+   blaze::randomize( x );
+
+   {
+      const blaze::SharedCompressedMatrix<double,SO> S( name_, A );
+
+      checkValue( S.rows(), 9UL, "Invalid number of rows" );
+      checkValue( S.columns(), 13UL, "Invalid number of columns" );
+      checkValue( S.nonZeros(), A.nonZeros(), "Invalid number of non-zero elements" );
+      checkValue( S.nonZeros( 4UL ), A.nonZeros( 4UL ), "Invalid number of non-zero elements" );
+      checkValue( S == A, true, "Invalid shared matrix" );
+      checkValue( S(4,7), 3.0, "Invalid element access" );
+      checkValue( S(8,2), 0.0, "Invalid access to zero element" );
+      checkValue( S.find( 4UL, 7UL )->value(), 3.0, "Invalid find() result" );
+      checkValue( S.find( 8UL, 2UL ) == S.end( SO ? 2UL : 8UL ), true, "Invalid find() result" );
+      checkValue( S.references(), size_t( 1UL ), "Invalid number of references" );
+
+      {
+         const blaze::SharedCompressedMatrix<double,SO> T( name_ );
+
+         checkValue( S.references(), size_t( 2UL ), "Invalid number of references" );
+         checkValue( T == A, true, "Invalid attached matrix" );
+
+         const blaze::DynamicVector<double,blaze::columnVector> y1( T * x );
+         const blaze::DynamicVector<double,blaze::columnVector> y2( A * x );
+         checkValue( y1 == y2, true, "Invalid matrix/vector multiplication" );
+
+         const blaze::CompressedMatrix<double,SO> B( T + A );
+         checkValue( B == 2.0*A, true, "Invalid matrix addition" );
+
+         checkValue( blaze::submatrix( T, 2UL, 3UL, 5UL, 6UL ) == blaze::submatrix( A, 2UL, 3UL, 5UL, 6UL ),
+                     true, "Invalid submatrix" );
+         checkValue( blaze::row( T, 4UL ) == blaze::row( A, 4UL ), true, "Invalid row" );
+         checkValue( blaze::column( T, 7UL ) == blaze::column( A, 7UL ), true, "Invalid column" );
+      }
+
+      const std::string name( name_ );
+
+      checkChild( [&A,&x,&name]() {
+         const blaze::SharedCompressedMatrix<double,SO> T( name );
+         const blaze::DynamicVector<double,blaze::columnVector> y( T * x );
+         return T == A && T.references() == 2UL && y == A * x;
+      }, "Invalid attachment from child process" );
+
+      checkValue( S.references(), size_t( 1UL ), "Invalid number of references" );
+   }
+
+   {
+      const blaze::SharedCompressedMatrix<double,SO> S( name_, trans( 2.0 * A ) );
+      const blaze::CompressedMatrix<double,SO> B( trans( 2.0 * A ) );
+
+      checkValue( S.rows(), 13UL, "Invalid number of rows" );
+      checkValue( S == B, true, "Invalid shared matrix expression" );
+   }
+
+   {
+      const blaze::SharedCompressedMatrix<double,SO> S( name_, blaze::CompressedMatrix<double,SO>( 3UL, 4UL ) );
+
+      checkValue( S.rows(), 3UL, "Invalid number of rows" );
+      checkValue( S.nonZeros(), 0UL, "Invalid number of non-zero elements" );
+      checkValue( S(2,3), 0.0, "Invalid access to zero element" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given value.
+//
+// \param value The value to be checked.
+// \param expected The expected value.
+// \param error The error message in case the values differ.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void ClassTest::checkValue( const Type& value, const Type& expected, const std::string& error ) const
+{
+   if( !( value == expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Result:\n" << value << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Running the given check in a forked child process.
+//
+// \param func The check to be performed by the child process.
+// \param error The error message in case the check fails.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The given function is executed in a child process and has to return \a true on success. All
+// exceptions within the child process are treated as failure.
+*/
+template< typename Func >
+void ClassTest::checkChild( Func func, const std::string& error ) const
+{
+   const pid_t pid( ::fork() );
+
+   if( pid == 0 ) {
+      bool valid( false );
+      try {
+         valid = func();
+      }
+      catch( ... ) {}
+      ::_exit( valid ? 0 : 1 );
+   }
+
+   int status( 0 );
+
+   if( pid < 0 || ::waitpid( pid, &status, 0 ) != pid ||
+       !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the shared-memory containers.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the shared-memory container class test.
+*/
+#define RUN_SHARED_CLASS_TEST \
+   blazetest::mathtest::shared::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace shared
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -1387,6 +1388,18 @@ void OperationTest<T>::testPow( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(0), T(8) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = pow( a_[i], b_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, pow( loada( a_+i ), loada( b_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
@@ -1435,6 +1448,18 @@ void OperationTest<T>::testExp( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(-80), T(80) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = exp( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, exp( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
@@ -1579,6 +1604,18 @@ void OperationTest<T>::testLog( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(1E-3), T(1E6) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = log( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, log( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
@@ -1722,6 +1759,18 @@ void OperationTest<T>::testSin( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(-1000), T(1000) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = sin( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, sin( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
@@ -1913,6 +1962,18 @@ void OperationTest<T>::testCos( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(-1000), T(1000) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = cos( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, cos( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
@@ -2200,6 +2261,32 @@ void OperationTest<T>::testTanh( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T special[] = { T(0), -T(0), inf, -inf, T(20), T(-20) };
+
+   for( size_t i=0UL; i<N; ++i ) {
+      a_[i] = special[i%6UL];
+      c_[i] = tanh( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, tanh( loada( a_+i ) ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( d_[i] != c_[i] || std::signbit( d_[i] ) != std::signbit( c_[i] ) ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid result for special value\n"
+             << " Details:\n"
+             << "   argument = " << a_[i] << "\n"
+             << "   expected = " << c_[i] << "\n"
+             << "   actual   = " << d_[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -2296,6 +2383,18 @@ void OperationTest<T>::testErf( blaze::TrueType )
    }
 
    compare( c_, d_ );
+
+   initialize( T(-5), T(5) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = erf( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, erf( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_ );
 }
 //*************************************************************************************************
 
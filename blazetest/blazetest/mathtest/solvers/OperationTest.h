@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/OperationTest.h
+//  \brief Header file for the iterative solver operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SymmetricMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative solvers.
+//
+// This class represents a test suite for the iterative solver module. It tests the conjugate
+// gradient, BiCGSTAB, and GMRES solvers for dense, sparse, and adaptor system matrices, both
+// without preconditioner and in combination with the Jacobi and ILU(0) preconditioners. All
+// solutions are verified via the true residual of the linear system.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testCG();
+   template< typename MT > void testBiCGSTAB();
+   template< typename MT > void testGMRES();
+                           void testILU0();
+                           void testLargeSystem();
+                           void testInitialGuess();
+                           void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > static void laplace( MT& A, size_t N, bool symmetric );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkSolution( const MT& A, const VT1& x, const VT2& b,
+                       const blaze::SolverResult& result, const std::string& solver ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conjugate gradient solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conjugate gradient solver for a symmetric positive
+// definite system matrix of the given type, without preconditioner and in combination with
+// the Jacobi and ILU(0) preconditioners. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >
+void OperationTest::testCG()
+{
+   using ET = blaze::ElementType_<MT>;
+
+   test_ = "Conjugate gradient solver";
+
+   MT A;
+   laplace( A, 9UL, true );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( A.rows() );
+   for( size_t i=0UL; i<b.size(); ++i ) {
+      b[i] = ET( 1 + i%5UL );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::cg( A, x, b ) );
+      checkSolution( A, x, b, result, "CG" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::cg( A, x, b, blaze::JacobiPreconditioner<ET>( A ) ) );
+      checkSolution( A, x, b, result, "CG (Jacobi)" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::cg( A, x, b, blaze::ILU0Preconditioner<ET>( A ) ) );
+      checkSolution( A, x, b, result, "CG (ILU(0))" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the BiCGSTAB solver for a nonsymmetric system matrix of
+// the given type, without preconditioner and in combination with the Jacobi and ILU(0)
+// preconditioners. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void OperationTest::testBiCGSTAB()
+{
+   using ET = blaze::ElementType_<MT>;
+
+   test_ = "BiCGSTAB solver";
+
+   MT A;
+   laplace( A, 9UL, false );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( A.rows() );
+   for( size_t i=0UL; i<b.size(); ++i ) {
+      b[i] = ET( 1 + i%3UL );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b ) );
+      checkSolution( A, x, b, result, "BiCGSTAB" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, blaze::JacobiPreconditioner<ET>( A ) ) );
+      checkSolution( A, x, b, result, "BiCGSTAB (Jacobi)" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, blaze::ILU0Preconditioner<ET>( A ) ) );
+      checkSolution( A, x, b, result, "BiCGSTAB (ILU(0))" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted GMRES solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the GMRES solver for a nonsymmetric system matrix of the
+// given type, without preconditioner and in combination with the Jacobi and ILU(0)
+// preconditioners. In order to test the restart, the restart length is chosen smaller than
+// the number of required iterations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >
+void OperationTest::testGMRES()
+{
+   using ET = blaze::ElementType_<MT>;
+
+   test_ = "GMRES solver";
+
+   MT A;
+   laplace( A, 9UL, false );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( A.rows() );
+   for( size_t i=0UL; i<b.size(); ++i ) {
+      b[i] = ET( 1 + i%7UL );
+   }
+
+   blaze::SolverSettings settings;
+   settings.restart = 10UL;
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::gmres( A, x, b, settings ) );
+      checkSolution( A, x, b, result, "GMRES" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::gmres( A, x, b, blaze::JacobiPreconditioner<ET>( A ), settings ) );
+      checkSolution( A, x, b, result, "GMRES (Jacobi)" );
+   }
+
+   {
+      blaze::DynamicVector<ET,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::gmres( A, x, b, blaze::ILU0Preconditioner<ET>( A ), settings ) );
+      checkSolution( A, x, b, result, "GMRES (ILU(0))" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a 2D five-point stencil.
+//
+// \param A The matrix to be initialized.
+// \param N The number of grid points per dimension.
+// \param symmetric \a true for a symmetric stencil, \a false for a convection-diffusion stencil.
+// \return void
+//
+// This function resizes the given matrix to \f$ N^2 \times N^2 \f$ and initializes it with the
+// discretization of the 2D Laplace operator. In case \a symmetric is \a false, the left and
+// right neighbors are weighted differently, which results in a nonsymmetric, diagonally
+// dominant matrix.
+*/
+template< typename MT >
+void OperationTest::laplace( MT& A, size_t N, bool symmetric )
+{
+   using ET = blaze::ElementType_<MT>;
+
+   const size_t NN( N*N );
+   const ET left ( symmetric ? ET(-1) : ET(-1.5) );
+   const ET right( symmetric ? ET(-1) : ET(-0.5) );
+
+   blaze::CompressedMatrix<ET,blaze::rowMajor> tmp( NN, NN );
+   tmp.reserve( 5UL*NN );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         const size_t row( i*N+j );
+         if( i > 0UL   ) tmp.append( row, row-N  , ET(-1) );
+         if( j > 0UL   ) tmp.append( row, row-1UL, left );
+         tmp.append( row, row, ET(4) );
+         if( j < N-1UL ) tmp.append( row, row+1UL, ( symmetric ? left : right ) );
+         if( i < N-1UL ) tmp.append( row, row+N  , ET(-1) );
+         tmp.finalize( row );
+      }
+   }
+
+   A = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Verification of the result of an iterative solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param result The result returned by the solver.
+// \param solver The name of the solver.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence and that the relative true
+// residual of the computed solution satisfies the default tolerance of the solvers (with a
+// safety factor that accounts for the difference between the updated and the true residual).
+// Note that all tests are performed in double precision.
+*/
+template< typename MT, typename VT1, typename VT2 >
+void OperationTest::checkSolution( const MT& A, const VT1& x, const VT2& b,
+                                   const blaze::SolverResult& result, const std::string& solver ) const
+{
+   const blaze::DynamicVector<double,blaze::columnVector> r( b - A * x );
+   const double residual( std::sqrt( dot( r, r ) / dot( b, b ) ) );
+
+   if( !result.converged || residual > 1E-7 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Iterative solution failed\n"
+          << " Details:\n"
+          << "   Solver: " << solver << "\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Converged: " << result.converged << "\n"
+          << "   Iterations: " << result.iterations << "\n"
+          << "   Reported residual: " << result.residual << "\n"
+          << "   True residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solver operation test.
+*/
+#define RUN_SOLVERS_OPERATION_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
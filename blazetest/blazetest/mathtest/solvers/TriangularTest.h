@@ -0,0 +1,361 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/TriangularTest.h
+//  \brief Header file for the sparse triangular solve test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_TRIANGULARTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_TRIANGULARTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sparse triangular solve.
+//
+// This class represents a test suite for the level-scheduled forward and backward substitution
+// with sparse lower and upper triangular matrices. It tests the solution of systems with single
+// and multiple right-hand sides for row-major and column-major system matrices, the level
+// analysis, and the error handling. All solutions are verified via the residual of the linear
+// system.
+*/
+class TriangularTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TriangularTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testVector();
+   template< typename MT > void testMatrix();
+                           void testLevels();
+                           void testLargeSystem();
+                           void testExceptions();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > static void initialize( MT& A, size_t N );
+
+   template< typename MT, typename T1, typename T2 >
+   void checkSolution( const MT& A, const T1& x, const T2& b, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular solve with a single right-hand side.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the forward or backward substitution for a sparse triangular
+// system matrix of the given type and a single right-hand side, both with and without an explicit
+// level schedule. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >
+void TriangularTest::testVector()
+{
+   test_ = "Sparse triangular solve (single right-hand side)";
+
+   for( size_t N=0UL; N<=50UL; N+=7UL )
+   {
+      MT A;
+      initialize( A, N );
+
+      blaze::DynamicVector<double,blaze::columnVector> b( N );
+      for( size_t i=0UL; i<N; ++i ) {
+         b[i] = double( i%5UL ) - 2.0;
+      }
+
+      {
+         blaze::DynamicVector<double,blaze::columnVector> x;
+         blaze::solve( A, x, b );
+         checkSolution( A, x, b, "Default solve" );
+      }
+
+      {
+         const blaze::LevelSchedule schedule( A );
+         blaze::DynamicVector<double,blaze::columnVector> x;
+         blaze::solve( A, x, b, schedule );
+         checkSolution( A, x, b, "Solve with level schedule" );
+      }
+
+      {
+         const blaze::DynamicVector<double,blaze::columnVector> x( blaze::solve( A, b ) );
+         checkSolution( A, x, b, "Solve returning the solution" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular solve with multiple right-hand sides.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the forward or backward substitution for a sparse triangular
+// system matrix of the given type and multiple right-hand sides, stored in both row-major and
+// column-major matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT >
+void TriangularTest::testMatrix()
+{
+   test_ = "Sparse triangular solve (multiple right-hand sides)";
+
+   for( size_t N=0UL; N<=50UL; N+=7UL )
+   {
+      MT A;
+      initialize( A, N );
+
+      const blaze::LevelSchedule schedule( A );
+
+      for( size_t K=1UL; K<=9UL; K+=4UL )
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> B( N, K );
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<K; ++j ) {
+               B(i,j) = double( ( i+2UL*j )%7UL ) - 3.0;
+            }
+         }
+
+         {
+            blaze::DynamicMatrix<double,blaze::rowMajor> X;
+            blaze::solve( A, X, B );
+            checkSolution( A, X, B, "Row-major right-hand sides" );
+         }
+
+         {
+            blaze::DynamicMatrix<double,blaze::columnMajor> X;
+            blaze::solve( A, X, B, schedule );
+            checkSolution( A, X, B, "Column-major right-hand sides" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given sparse triangular matrix.
+//
+// \param A The matrix to be initialized.
+// \param N The number of rows and columns of the matrix.
+// \return void
+//
+// This function resizes the given lower or upper triangular matrix to \f$ N \times N \f$ and
+// initializes it with a deterministic sparsity pattern consisting of the first off-diagonal and
+// a scattered set of further off-diagonal elements. All diagonal elements are explicitly stored
+// and, in case of a non-unitriangular matrix, are chosen such that the matrix is diagonally
+// dominant.
+*/
+template< typename MT >
+void TriangularTest::initialize( MT& A, size_t N )
+{
+   constexpr bool lower( blaze::IsLower<MT>::value );
+   constexpr bool uni  ( blaze::IsUniTriangular<MT>::value );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> tmp( N, N );
+   tmp.reserve( 4UL*N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         const size_t dist( lower ? i-j : j-i );
+
+         if( i == j ) {
+            tmp.append( i, j, uni ? 1.0 : 3.0 + double( i%3UL ) );
+         }
+         else if( ( lower ? j < i : i < j ) && ( dist == 1UL || ( i*j+dist )%11UL == 0UL ) ) {
+            tmp.append( i, j, -0.1 * double( 1UL + ( i+j )%5UL ) );
+         }
+      }
+      tmp.finalize( i );
+   }
+
+   A = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Verification of the result of a sparse triangular solve.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side.
+// \param label The label of the performed solve.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the maximum absolute residual of the computed solution is in the
+// order of the machine accuracy. Note that all tests are performed in double precision.
+*/
+template< typename MT, typename T1, typename T2 >
+void TriangularTest::checkSolution( const MT& A, const T1& x, const T2& b,
+                                    const std::string& label ) const
+{
+   const double residual( ( A.rows() == 0UL )?( 0.0 ):( blaze::max( blaze::abs( A * x - b ) ) ) );
+
+   if( residual > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sparse triangular solve failed\n"
+          << " Details:\n"
+          << "   Solve: " << label << "\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Number of rows: " << A.rows() << "\n"
+          << "   Residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse triangular solve.
+//
+// \return void
+*/
+void runTest()
+{
+   TriangularTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse triangular solve test.
+*/
+#define RUN_SOLVERS_TRIANGULAR_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -108,6 +108,7 @@ class SubmatrixNumericTest
    template< typename ST > void testAddAssign  ();
    template< typename ST > void testSubAssign  ();
    template< typename ST > void testSchurAssign();
+   template< typename ST > void testAliasing   ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -124,6 +125,7 @@ class SubmatrixNumericTest
    /*!\name Utility functions */
    //@{
    template< typename ST > void init( ST& sym );
+   template< typename ST > void initAliasing( ST& sym );
    //@}
    //**********************************************************************************************
 
@@ -6453,6 +6455,143 @@ void SubmatrixNumericTest::testSchurAssign()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the assignment between mirrored submatrices of a SymmetricMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, and subtraction
+// assignment of an off-diagonal submatrix of a SymmetricMatrix to the submatrix at the mirrored
+// position. Although the regions of both submatrices do not intersect, they alias via the
+// symmetric counterparts of their elements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename ST >  // Type of the symmetric matrix
+void SubmatrixNumericTest::testAliasing()
+{
+   typedef blaze::SubmatrixExprTrait_<ST,blaze::unaligned>  SMT;
+
+
+   //=====================================================================================
+   // Assignment
+   //=====================================================================================
+
+   // (  1  2  3  4 )      (  1  2  3  6 )
+   // (  2  5  6  7 )  =>  (  2  5  4  7 )
+   // (  3  6  8  9 )      (  3  4  8  9 )
+   // (  4  7  9 10 )      (  6  7  9 10 )
+   {
+      test_ = "Aliased submatrix assignment";
+
+      ST sym;
+      initAliasing( sym );
+
+      SMT sm1 = submatrix( sym, 0UL, 2UL, 2UL, 2UL );
+      SMT sm2 = submatrix( sym, 2UL, 0UL, 2UL, 2UL );
+
+      sm1 = sm2;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> result{ { 1, 2, 3, 6 },
+                                                              { 2, 5, 4, 7 },
+                                                              { 3, 4, 8, 9 },
+                                                              { 6, 7, 9, 10 } };
+
+      checkRows   ( sym, 4UL );
+      checkColumns( sym, 4UL );
+
+      if( sym != result ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to overlapping submatrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sym << "\n"
+             << "   Expected result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Addition assignment
+   //=====================================================================================
+
+   // (  1  2  3  4 )      (  1  2  6 10 )
+   // (  2  5  6  7 )  =>  (  2  5 10 14 )
+   // (  3  6  8  9 )      (  6 10  8  9 )
+   // (  4  7  9 10 )      ( 10 14  9 10 )
+   {
+      test_ = "Aliased submatrix addition assignment";
+
+      ST sym;
+      initAliasing( sym );
+
+      SMT sm1 = submatrix( sym, 0UL, 2UL, 2UL, 2UL );
+      SMT sm2 = submatrix( sym, 2UL, 0UL, 2UL, 2UL );
+
+      sm1 += sm2;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> result{ { 1, 2, 6, 10 },
+                                                              { 2, 5, 10, 14 },
+                                                              { 6, 10, 8, 9 },
+                                                              { 10, 14, 9, 10 } };
+
+      checkRows   ( sym, 4UL );
+      checkColumns( sym, 4UL );
+
+      if( sym != result ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment to overlapping submatrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sym << "\n"
+             << "   Expected result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Subtraction assignment
+   //=====================================================================================
+
+   // (  1  2  3  4 )      (  1  2  0 -2 )
+   // (  2  5  6  7 )  =>  (  2  5  2  0 )
+   // (  3  6  8  9 )      (  0  2  8  9 )
+   // (  4  7  9 10 )      ( -2  0  9 10 )
+   {
+      test_ = "Aliased submatrix subtraction assignment";
+
+      ST sym;
+      initAliasing( sym );
+
+      SMT sm1 = submatrix( sym, 0UL, 2UL, 2UL, 2UL );
+      SMT sm2 = submatrix( sym, 2UL, 0UL, 2UL, 2UL );
+
+      sm1 -= sm2;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> result{ { 1, 2, 0, -2 },
+                                                              { 2, 5, 2, 0 },
+                                                              { 0, 2, 8, 9 },
+                                                              { -2, 0, 9, 10 } };
+
+      checkRows   ( sym, 4UL );
+      checkColumns( sym, 4UL );
+
+      if( sym != result ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment to overlapping submatrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sym << "\n"
+             << "   Expected result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checking the number of rows of the given matrix.
 //
@@ -6586,6 +6725,32 @@ void SubmatrixNumericTest::init( ST& sym )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initializing the given symmetric matrix for the aliasing tests.
+//
+// \return void
+//
+// This function initializes the given symmetric matrix as 4x4 matrix with the upper part
+// filled row-wise with the values 1 to 10.
+*/
+template< typename ST >
+void SubmatrixNumericTest::initAliasing( ST& sym )
+{
+   sym.resize( 4UL );
+   sym(0,0) =  1;
+   sym(0,1) =  2;
+   sym(0,2) =  3;
+   sym(0,3) =  4;
+   sym(1,1) =  5;
+   sym(1,2) =  6;
+   sym(1,3) =  7;
+   sym(2,2) =  8;
+   sym(2,3) =  9;
+   sym(3,3) = 10;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,304 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/async/OperationTest.cpp
+//  \brief Source file for the asynchronous assignment operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/async/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace async {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testCompletion();
+   testExceptions();
+   testAliasing();
+   testConcurrency();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the completion of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs several concurrent asynchronous vector and matrix assignments and
+// checks their results after the completion of the according futures. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testCompletion()
+{
+   test_ = "Completion of asynchronous assignments";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 120UL, 80UL ), B( 80UL, 100UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 80UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = double( ( i+2UL*j )%7UL ) - 3.0;
+      }
+   }
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         B(i,j) = double( ( 3UL*i+j )%5UL ) - 2.0;
+      }
+   }
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = double( i%3UL ) - 1.0;
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> y, z( 80UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor> C;
+   blaze::DynamicMatrix<double,blaze::columnMajor> D;
+
+   std::future<void> f1( blaze::asyncAssign( y, A * x ) );
+   std::future<void> f2( blaze::asyncAssign( C, A * B ) );
+   std::future<void> f3( blaze::asyncAssign( D, trans( A * B ) ) );
+   std::future<void> f4( blaze::asyncAssign( z, 2.0 * x ) );
+
+   f1.get();
+   f2.get();
+   f3.get();
+   f4.get();
+
+   checkResult( y, blaze::DynamicVector<double,blaze::columnVector>( A * x ), "y = A * x" );
+   checkResult( C, blaze::DynamicMatrix<double,blaze::rowMajor>( A * B ), "C = A * B" );
+   checkResult( D, blaze::DynamicMatrix<double,blaze::rowMajor>( trans( A * B ) ), "D = trans( A * B )" );
+   checkResult( z, blaze::DynamicVector<double,blaze::columnVector>( 2.0 * x ), "z = 2 * x" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions thrown during asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during an asynchronous assignment is rethrown
+// by the \c get() function of the returned future. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testExceptions()
+{
+   test_ = "Exceptions of asynchronous assignments";
+
+   // Invalid assignment to a static vector
+   {
+      blaze::StaticVector<double,3UL,blaze::columnVector> y;
+      const blaze::DynamicVector<double,blaze::columnVector> x( 4UL, 1.0 );
+
+      std::future<void> future( blaze::asyncAssign( y, x ) );
+
+      try {
+         future.get();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid asynchronous assignment succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rejection of aliased asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that asynchronous assignments that would require an intermediate
+// temporary due to aliasing are rejected by means of a \a std::invalid_argument exception.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAliasing()
+{
+   test_ = "Aliased asynchronous assignments";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 5UL, 1.0 ), B( 5UL, 5UL, 2.0 );
+   blaze::DynamicVector<double,blaze::columnVector> x( 5UL, 1.0 );
+
+   // Aliased vector assignment
+   try {
+      blaze::asyncAssign( x, A * x ).get();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Aliased asynchronous vector assignment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Aliased matrix assignment
+   try {
+      blaze::asyncAssign( A, A * B ).get();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Aliased asynchronous matrix assignment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent execution of asynchronous and thread parallel assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a thread parallel assignment is executed while an asynchronous
+// assignment is still pending. For that purpose the asynchronous assignment is blocked until
+// the parallel assignment has been completed. In case the parallel assignment waits for the
+// completion of the asynchronous assignment, the asynchronous assignment is released after
+// a timeout and a \a std::runtime_error exception is thrown. The test is only performed in
+// case the C++11 or Boost thread-based parallelization is active.
+*/
+void OperationTest::testConcurrency()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   test_ = "Concurrent asynchronous and parallel assignments";
+
+   const size_t N( blaze::SMP_DVECDVECADD_THRESHOLD + 1000UL );
+
+   std::atomic<bool> released( false );
+   std::atomic<bool> timeout ( false );
+
+   const auto block = [&released,&timeout]( double value )
+   {
+      const auto deadline( std::chrono::steady_clock::now() + std::chrono::seconds( 10 ) );
+
+      while( !released && !timeout ) {
+         if( std::chrono::steady_clock::now() > deadline ) {
+            timeout = true;
+            break;
+         }
+         std::this_thread::yield();
+      }
+
+      return value;
+   };
+
+   const blaze::DynamicVector<double,blaze::columnVector> a( N, 1.0 ), b( N, 2.0 ), x( 100UL, 3.0 );
+   blaze::DynamicVector<double,blaze::columnVector> y, z;
+
+   std::future<void> future( blaze::asyncAssign( y, map( x, block ) ) );
+
+   z = a + b;
+   released = true;
+
+   future.get();
+
+   if( timeout ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel assignment waited for pending asynchronous assignment\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkResult( y, x, "y = map( x, block )" );
+   checkResult( z, blaze::DynamicVector<double,blaze::columnVector>( N, 3.0 ), "z = a + b" );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace async
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment operation test..." << std::endl;
+
+   try
+   {
+      RUN_ASYNC_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
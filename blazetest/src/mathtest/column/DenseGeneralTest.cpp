@@ -85,6 +85,7 @@ DenseGeneralTest::DenseGeneralTest()
    testIsDefault();
    testIsSame();
    testSubvector();
+   testCanAlias();
 }
 //*************************************************************************************************
 
@@ -7192,6 +7193,38 @@ void DenseGeneralTest::testSubvector()
       }
    }
 
+   {
+      test_ = "Row-major subvector() assignment";
+
+      initialize();
+
+      CT   col1 = blaze::column( mat_, 1UL );
+      auto sv   = blaze::subvector( col1, 1UL, 2UL );
+
+      blaze::DynamicVector<int,blaze::columnVector> vec{ 11, 12 };
+
+      sv = vec;
+
+      if( col1[0] != 0 || col1[1] != 11 || col1[2] != 12 || col1[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subvector assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << col1 << "\n"
+             << "   Expected result:\n( 0 11 12 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat_(1,1) != 11 || mat_(2,1) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subvector assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -7225,6 +7258,109 @@ void DenseGeneralTest::testSubvector()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major subvector() assignment";
+
+      initialize();
+
+      OCT  col1 = blaze::column( tmat_, 1UL );
+      auto sv   = blaze::subvector( col1, 1UL, 2UL );
+
+      blaze::DynamicVector<int,blaze::columnVector> vec{ 11, 12 };
+
+      sv = vec;
+
+      if( col1[0] != 0 || col1[1] != 11 || col1[2] != 12 || col1[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subvector assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << col1 << "\n"
+             << "   Expected result:\n( 0 11 12 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( tmat_(1,1) != 11 || tmat_(2,1) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subvector assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tmat_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c canAlias() member function with the Column specialization.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c canAlias() member function with two dense columns.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseGeneralTest::testCanAlias()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major canAlias() function";
+
+      initialize();
+
+      CT col1 = blaze::column( mat_, 1UL );
+      CT col2 = blaze::column( mat_, 1UL );
+      CT col3 = blaze::column( mat_, 2UL );
+
+      if( !col1.canAlias( &col2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of identical columns not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( col1.canAlias( &col3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of different columns detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major canAlias() function";
+
+      initialize();
+
+      OCT col1 = blaze::column( tmat_, 1UL );
+      OCT col2 = blaze::column( tmat_, 1UL );
+      OCT col3 = blaze::column( tmat_, 2UL );
+
+      if( !col1.canAlias( &col2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of identical columns not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( col1.canAlias( &col3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of different columns detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
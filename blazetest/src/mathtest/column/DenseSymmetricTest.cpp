@@ -85,6 +85,7 @@ DenseSymmetricTest::DenseSymmetricTest()
    testIsDefault();
    testIsSame();
    testSubvector();
+   testCanAlias();
 }
 //*************************************************************************************************
 
@@ -7097,6 +7098,77 @@ void DenseSymmetricTest::testSubvector()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c canAlias() member function with the Column specialization.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c canAlias() member function with two dense columns.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseSymmetricTest::testCanAlias()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major canAlias() function";
+
+      initialize();
+
+      CT col1 = blaze::column( mat_, 1UL );
+      CT col2 = blaze::column( mat_, 1UL );
+      CT col3 = blaze::column( mat_, 2UL );
+
+      if( !col1.canAlias( &col2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of identical columns not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( col1.canAlias( &col3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of different columns detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major canAlias() function";
+
+      initialize();
+
+      OCT col1 = blaze::column( tmat_, 1UL );
+      OCT col2 = blaze::column( tmat_, 1UL );
+      OCT col3 = blaze::column( tmat_, 2UL );
+
+      if( !col1.canAlias( &col2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of identical columns not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( col1.canAlias( &col3 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of different columns detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
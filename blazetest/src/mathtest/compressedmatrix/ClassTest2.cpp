@@ -79,6 +79,7 @@ ClassTest::ClassTest()
    testSet();
    testInsert();
    testAppend();
+   testBuild();
    testErase();
    testFind();
    testLowerBound();
@@ -4181,6 +4182,197 @@ void ClassTest::testAppend()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the TripletBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bulk construction of a CompressedMatrix by means of the
+// TripletBuilder class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testBuild()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major TripletBuilder::build()";
+
+      // Building a matrix from unordered triplets with duplicates in two buffers
+      {
+         blaze::TripletBuilder<int,blaze::rowMajor> builder( 3UL, 4UL, 2UL );
+         builder.add( 0UL, 2UL, 3UL,  4 );
+         builder.add( 1UL, 0UL, 1UL,  2 );
+         builder.add( 0UL, 0UL, 1UL,  1 );
+         builder.add( 1UL, 2UL, 3UL, -1 );
+         builder.add( 0UL, 2UL, 0UL,  5 );
+         builder.add( 1UL, 0UL, 0UL,  7 );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 2UL );
+         builder.build( mat );
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 0UL );
+         checkNonZeros( mat, 2UL, 2UL );
+
+         if( mat(0,0) != 7 || mat(0,1) != 3 || mat(2,0) != 5 || mat(2,3) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Build operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 3 0 0 )\n( 0 0 0 0 )\n( 5 0 0 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Building a matrix with a custom combination of duplicates
+         builder.build( mat, []( int, int b ){ return b; } );
+
+         checkNonZeros( mat, 4UL );
+
+         if( mat(0,0) != 7 || mat(0,1) != 2 || mat(2,0) != 5 || mat(2,3) != -1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Build operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 2 0 0 )\n( 0 0 0 0 )\n( 5 0 0 -1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Building a matrix with many rows from few triplets
+      {
+         const size_t M( 1000000UL );
+         const size_t N( 2UL*blaze::SMP_DVECASSIGN_THRESHOLD );
+
+         blaze::TripletBuilder<int,blaze::rowMajor> builder( M, 3UL );
+         for( size_t k=0UL; k<N; ++k ) {
+            builder.add( ( k*7919UL ) % M, k % 3UL, 1 );
+         }
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat;
+         builder.build( mat );
+
+         checkRows    ( mat, M );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, N );
+
+         if( mat(7919UL,1UL) != 1 || mat(0UL,0UL) != 1 || mat(0UL,1UL) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Build operation failed\n"
+                << " Details:\n"
+                << "   Result: mat(7919,1) = " << mat(7919UL,1UL) << ", mat(0,0) = " << mat(0UL,0UL)
+                << ", mat(0,1) = " << mat(0UL,1UL) << "\n"
+                << "   Expected result: mat(7919,1) = 1, mat(0,0) = 1, mat(0,1) = 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Adding triplets with invalid row and column indices
+      {
+         blaze::TripletBuilder<int,blaze::rowMajor> builder( 3UL, 4UL );
+
+         try {
+            builder.add( 3UL, 0UL, 1 );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Adding a triplet with an invalid row index succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::out_of_range& ) {}
+
+         try {
+            builder.add( 0UL, 4UL, 1 );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Adding a triplet with an invalid column index succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::out_of_range& ) {}
+
+         if( builder.size() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of triplets\n"
+                << " Details:\n"
+                << "   Number of triplets: " << builder.size() << "\n"
+                << "   Expected number of triplets: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major TripletBuilder::build()";
+
+      // Building a matrix from unordered triplets with duplicates in two buffers
+      {
+         blaze::TripletBuilder<int,blaze::columnMajor> builder( 3UL, 4UL, 2UL );
+         builder.add( 0UL, 2UL, 3UL,  4 );
+         builder.add( 1UL, 0UL, 1UL,  2 );
+         builder.add( 0UL, 0UL, 1UL,  1 );
+         builder.add( 1UL, 2UL, 3UL, -1 );
+         builder.add( 0UL, 2UL, 0UL,  5 );
+         builder.add( 1UL, 0UL, 0UL,  7 );
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 2UL );
+         builder.build( mat );
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 1UL );
+         checkNonZeros( mat, 2UL, 0UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(0,0) != 7 || mat(0,1) != 3 || mat(2,0) != 5 || mat(2,3) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Build operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 3 0 0 )\n( 0 0 0 0 )\n( 5 0 0 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Building a matrix with a custom combination of duplicates
+         builder.build( mat, []( int, int b ){ return b; } );
+
+         checkNonZeros( mat, 4UL );
+
+         if( mat(0,0) != 7 || mat(0,1) != 2 || mat(2,0) != 5 || mat(2,3) != -1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Build operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 2 0 0 )\n( 0 0 0 0 )\n( 5 0 0 -1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c erase() member function of the CompressedMatrix class template.
 //
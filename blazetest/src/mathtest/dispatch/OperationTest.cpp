@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dispatch/OperationTest.cpp
+//  \brief Source file for the runtime dispatch operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#define BLAZE_USE_RUNTIME_DISPATCH 1
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dispatch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+   : initial_( blaze::getInstructionSet() )  // The initially selected instruction set
+{
+   testInstructionSet();
+
+
+   //=====================================================================================
+   // Single precision tests
+   //=====================================================================================
+
+   testDot < float >();
+   testAxpy< float >();
+   testSpMV< float >();
+   testMMM < float >();
+
+
+   //=====================================================================================
+   // Double precision tests
+   //=====================================================================================
+
+   testDot < double >();
+   testAxpy< double >();
+   testSpMV< double >();
+   testMMM < double >();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the OperationTest class test.
+//
+// The destructor restores the initially selected instruction set.
+*/
+OperationTest::~OperationTest()
+{
+   blaze::setInstructionSet( initial_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the detection and the explicit selection of the instruction set used by
+// the runtime dispatched compute kernels. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testInstructionSet()
+{
+   test_ = "Instruction set selection";
+
+   const blaze::InstructionSet detected( blaze::detectInstructionSet() );
+
+   if( blaze::getInstructionSet() > detected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unsupported instruction set selected\n"
+          << " Details:\n"
+          << "   Detected instruction set: " << blaze::getInstructionSetName( detected ) << "\n"
+          << "   Selected instruction set: " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( int isa=blaze::isaGeneric; isa<=detected; ++isa )
+   {
+      blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+      if( blaze::getInstructionSet() != isa ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting the instruction set failed\n"
+             << " Details:\n"
+             << "   Requested instruction set: " << blaze::getInstructionSetName( static_cast<blaze::InstructionSet>( isa ) ) << "\n"
+             << "   Selected instruction set : " << blaze::getInstructionSetName( blaze::getInstructionSet() ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( detected < blaze::isaAVX512 )
+   {
+      try {
+         blaze::setInstructionSet( static_cast<blaze::InstructionSet>( detected+1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selecting an unsupported instruction set succeeded\n"
+             << " Details:\n"
+             << "   Detected instruction set: " << blaze::getInstructionSetName( detected ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime dispatch operation test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime dispatch operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -174,6 +174,18 @@ void AliasingTest::testDMatDMatMult()
       checkResult( dB4x3_, result_ );
    }
 
+   // Assignment to operand of a reordered chain
+   {
+      test_ = "DMatDMatMult - Assignment to operand of a reordered chain";
+
+      initialize();
+
+      result_ = ( dA3x4_ * dB4x3_ ) * ( dA3x4_ * dB4x3_ );
+      dA3x4_  = dA3x4_ * dB4x3_ * dA3x4_ * dB4x3_;
+
+      checkResult( dA3x4_, result_ );
+   }
+
 
    //=====================================================================================
    // Multiplication with addition assignment
@@ -597,6 +609,18 @@ void AliasingTest::testDMatTDMatMult()
       checkResult( tdB4x3_, result_ );
    }
 
+   // Assignment to operand of a reordered chain
+   {
+      test_ = "DMatTDMatMult - Assignment to operand of a reordered chain";
+
+      initialize();
+
+      result_ = ( dA3x4_ * tdB4x3_ ) * ( dA3x4_ * tdB4x3_ );
+      dA3x4_  = dA3x4_ * tdB4x3_ * dA3x4_ * tdB4x3_;
+
+      checkResult( dA3x4_, result_ );
+   }
+
 
    //=====================================================================================
    // Multiplication with addition assignment
@@ -1020,6 +1044,18 @@ void AliasingTest::testTDMatDMatMult()
       checkResult( dB4x3_, result_ );
    }
 
+   // Assignment to operand of a reordered chain
+   {
+      test_ = "TDMatDMatMult - Assignment to operand of a reordered chain";
+
+      initialize();
+
+      result_ = ( tdA3x4_ * dB4x3_ ) * ( tdA3x4_ * dB4x3_ );
+      tdA3x4_ = tdA3x4_ * dB4x3_ * tdA3x4_ * dB4x3_;
+
+      checkResult( tdA3x4_, result_ );
+   }
+
 
    //=====================================================================================
    // Multiplication with addition assignment
@@ -1443,6 +1479,18 @@ void AliasingTest::testTDMatTDMatMult()
       checkResult( tdB4x3_, result_ );
    }
 
+   // Assignment to operand of a reordered chain
+   {
+      test_ = "TDMatTDMatMult - Assignment to operand of a reordered chain";
+
+      initialize();
+
+      result_ = ( tdA3x4_ * tdB4x3_ ) * ( tdA3x4_ * tdB4x3_ );
+      tdA3x4_ = tdA3x4_ * tdB4x3_ * tdA3x4_ * tdB4x3_;
+
+      checkResult( tdA3x4_, result_ );
+   }
+
 
    //=====================================================================================
    // Multiplication with addition assignment
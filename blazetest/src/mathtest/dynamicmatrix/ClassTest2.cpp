@@ -4516,6 +4516,35 @@ void ClassTest::testResize()
       checkRows    ( mat, 0UL );
       checkColumns ( mat, 0UL );
       checkNonZeros( mat, 0UL );
+
+      // Resizing to 300x200, then to 400x150 and preserving the elements
+      mat.resize( 300UL, 200UL );
+
+      for( size_t i=0UL; i<300UL; ++i ) {
+         for( size_t j=0UL; j<200UL; ++j ) {
+            mat(i,j) = static_cast<int>( i*200UL + j + 1UL );
+         }
+      }
+
+      mat.resize( 400UL, 150UL, true );
+
+      checkRows    ( mat, 400UL );
+      checkColumns ( mat, 150UL );
+      checkCapacity( mat, 60000UL );
+
+      for( size_t i=0UL; i<300UL; ++i ) {
+         for( size_t j=0UL; j<150UL; ++j ) {
+            if( mat(i,j) != static_cast<int>( i*200UL + j + 1UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resizing the matrix failed\n"
+                   << " Details:\n"
+                   << "   Result at (" << i << "," << j << "): " << mat(i,j) << "\n"
+                   << "   Expected result: " << ( i*200UL + j + 1UL ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
    }
 
 
@@ -4608,6 +4637,35 @@ void ClassTest::testResize()
       checkRows    ( mat, 0UL );
       checkColumns ( mat, 0UL );
       checkNonZeros( mat, 0UL );
+
+      // Resizing to 300x200, then to 400x150 and preserving the elements
+      mat.resize( 300UL, 200UL );
+
+      for( size_t i=0UL; i<300UL; ++i ) {
+         for( size_t j=0UL; j<200UL; ++j ) {
+            mat(i,j) = static_cast<int>( i*200UL + j + 1UL );
+         }
+      }
+
+      mat.resize( 400UL, 150UL, true );
+
+      checkRows    ( mat, 400UL );
+      checkColumns ( mat, 150UL );
+      checkCapacity( mat, 60000UL );
+
+      for( size_t i=0UL; i<300UL; ++i ) {
+         for( size_t j=0UL; j<150UL; ++j ) {
+            if( mat(i,j) != static_cast<int>( i*200UL + j + 1UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resizing the matrix failed\n"
+                   << " Details:\n"
+                   << "   Result at (" << i << "," << j << "): " << mat(i,j) << "\n"
+                   << "   Expected result: " << ( i*200UL + j + 1UL ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -5282,6 +5340,96 @@ void ClassTest::testTranspose()
    }
 
 
+   {
+      test_ = "Row-major rectangular self-transpose (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major in-place self-transpose of a 64x8 matrix";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1( 64UL, 8UL, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat2( mat1 );
+
+      const double* const ptr( mat1.data() );
+
+      mat1 = trans( mat1 );
+
+      checkRows    ( mat1, 8UL );
+      checkColumns ( mat1, 64UL );
+
+      if( mat1.data() != ptr || mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major self-transpose of a 1001x32 matrix without spare capacity";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1( 1001UL, 32UL, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat2( mat1 );
+
+      mat1 = trans( mat1 );
+
+      checkRows    ( mat1, 32UL );
+      checkColumns ( mat1, 1001UL );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double* const ptr( mat1.data() );
+
+      transpose( mat1 );
+      transpose( mat1 );
+
+      checkRows    ( mat1, 32UL );
+      checkColumns ( mat1, 1001UL );
+
+      if( mat1.data() != ptr || mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Repeated in-place transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
    //=====================================================================================
    // Column-major matrix tests
    //=====================================================================================
@@ -5443,6 +5591,95 @@ void ClassTest::testTranspose()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major rectangular self-transpose (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major in-place self-transpose of a 8x64 matrix";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat1( 8UL, 64UL, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat2( mat1 );
+
+      const double* const ptr( mat1.data() );
+
+      mat1 = trans( mat1 );
+
+      checkRows    ( mat1, 64UL );
+      checkColumns ( mat1, 8UL );
+
+      if( mat1.data() != ptr || mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major self-transpose of a 32x1001 matrix without spare capacity";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat1( 32UL, 1001UL, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat2( mat1 );
+
+      mat1 = trans( mat1 );
+
+      checkRows    ( mat1, 1001UL );
+      checkColumns ( mat1, 32UL );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double* const ptr( mat1.data() );
+
+      transpose( mat1 );
+      transpose( mat1 );
+
+      checkRows    ( mat1, 1001UL );
+      checkColumns ( mat1, 32UL );
+
+      if( mat1.data() != ptr || mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Repeated in-place transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -2609,6 +2609,30 @@ void ClassTest::testResize()
 
    checkSize    ( vec, 0UL );
    checkNonZeros( vec, 0UL );
+
+   // Resizing to 50000, then to 120000 and preserving the elements
+   vec.resize( 50000UL );
+
+   for( size_t i=0UL; i<50000UL; ++i ) {
+      vec[i] = static_cast<int>( i + 1UL );
+   }
+
+   vec.resize( 120000UL, true );
+
+   checkSize    ( vec, 120000UL );
+   checkCapacity( vec, 120000UL );
+
+   for( size_t i=0UL; i<50000UL; ++i ) {
+      if( vec[i] != static_cast<int>( i + 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the vector failed\n"
+             << " Details:\n"
+             << "   Result at index " << i << ": " << vec[i] << "\n"
+             << "   Expected result: " << ( i + 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,244 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/eigh/DenseTest.cpp
+//  \brief Source file for the dense matrix symmetric eigensolver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/eigh/DenseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace eigh {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest test.
+//
+// \exception std::runtime_error Error during eigenvalue computation detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[][2] = { { 1UL, 1UL }, { 2UL, 1UL }, { 5UL, 5UL }, { 17UL, 3UL },
+                               { 70UL, 70UL }, { 70UL, 7UL }, { 150UL, 150UL }, { 150UL, 15UL } };
+
+   for( const auto& s : sizes )
+   {
+      testRandom< blaze::DynamicMatrix<double,rowMajor   > >( s[0], s[1] );
+      testRandom< blaze::DynamicMatrix<double,columnMajor> >( s[0], s[1] );
+      testRandom< blaze::DynamicMatrix<cdouble,rowMajor   > >( s[0], s[1] );
+      testRandom< blaze::DynamicMatrix<cdouble,columnMajor> >( s[0], s[1] );
+   }
+
+   testTridiagonal();
+   testClustered();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native eigensolver with a matrix with known spectrum.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native eigensolver with the tridiagonal (-1,2,-1) matrix, whose
+// eigenvalues are given by \f$ 2-2\cos(j\pi/(n+1)) \f$. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testTridiagonal()
+{
+   test_ = "Symmetric eigensolver with tridiagonal matrix";
+
+   const size_t n( 150UL );
+   const double pi( 3.14159265358979323846 );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n, 0.0 );
+   blaze::DynamicVector<double,blaze::columnVector> w( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) = 2.0;
+      if( i > 0UL ) A(i,i-1UL) = A(i-1UL,i) = -1.0;
+      w[i] = 2.0 - 2.0*std::cos( ( i+1UL )*pi / ( n+1UL ) );
+   }
+
+   testEigenpairs( A, n, w );
+   testEigenpairs( A, 10UL, blaze::DynamicVector<double,blaze::columnVector>( subvector( w, 0UL, 10UL ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native eigensolver with a matrix with strongly clustered spectrum.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native eigensolver with a block diagonal matrix consisting of five
+// identical random blocks, i.e. every eigenvalue has multiplicity five. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testClustered()
+{
+   test_ = "Symmetric eigensolver with clustered spectrum";
+
+   const size_t b( 30UL );
+   const size_t m( 5UL );
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( b, b );
+   randomize( B );
+   B += trans( B );
+
+   blaze::DynamicVector<double,blaze::columnVector> v;
+   blaze::eigh( B, v );
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( m*b, m*b, 0.0 );
+   blaze::DynamicVector<double,blaze::columnVector> w( m*b );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      submatrix( A, i*b, i*b, b, b ) = B;
+      for( size_t j=0UL; j<b; ++j ) {
+         w[j*m+i] = v[j];
+      }
+   }
+
+   testEigenpairs( A, m*b, w );
+   testEigenpairs( A, 2UL*m, blaze::DynamicVector<double,blaze::columnVector>( subvector( w, 0UL, 2UL*m ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the native eigensolver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that non-square matrices and invalid numbers of requested eigenpairs
+// are rejected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testExceptions()
+{
+   test_ = "Symmetric eigensolver with invalid arguments";
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 3UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::eigh( A, w );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Eigenvalue computation of non-square matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << w << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 4UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::eigh( A, w, V, 5UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Computing more eigenpairs than rows succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << w << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace eigh
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix symmetric eigensolver test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_EIGH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix symmetric eigensolver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,517 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/exchange/ClassTest.cpp
+//  \brief Source file for the data exchange class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/exchange/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace exchange {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the data exchange class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                                  // Label of the currently performed test
+   , file_( "blazetest_exchange_file.bin" )  // Path of the temporary file
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testNpyVector();
+   testNpyMatrix<rowMajor>();
+   testNpyMatrix<columnMajor>();
+   testNpz();
+   testMatrixMarket<rowMajor>();
+   testMatrixMarket<columnMajor>();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the data exchange class test.
+//
+// The destructor removes the temporary file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the .npy import and export of dense vectors and of the NpyVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a dense vector to a .npy file and reads it back into vectors of the same
+// and of different element types. Additionally, it tests the zero-copy mapping of the file via
+// NpyVector. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNpyVector()
+{
+   test_ = "NpyVector";
+
+   blaze::DynamicVector<int,blaze::columnVector> ref( 11UL );
+   for( size_t i=0UL; i<ref.size(); ++i ) {
+      ref[i] = int( i*i ) - 20;
+   }
+
+   blaze::writeNpy( file_, ref );
+
+   {
+      blaze::DynamicVector<int,blaze::rowVector> x;
+      blaze::readNpy( file_, x );
+      checkValue( x == trans( ref ), true, "Invalid vector" );
+
+      blaze::DynamicVector<double,blaze::columnVector> y;
+      blaze::readNpy( file_, y );
+      checkValue( y == blaze::DynamicVector<double,blaze::columnVector>( ref ), true, "Invalid converted vector" );
+
+      blaze::DynamicVector<blaze::complex<float>,blaze::columnVector> z;
+      blaze::readNpy( file_, z );
+      checkValue( z[3], blaze::complex<float>( -11.0F, 0.0F ), "Invalid complex vector" );
+   }
+
+   {
+      const blaze::NpyVector<const int,blaze::columnVector> x( file_ );
+      checkValue( x.isMapped(), true, "Invalid conversion of a compatible array" );
+      checkValue( x == ref, true, "Invalid mapped vector" );
+
+      const blaze::NpyVector<const long double,blaze::columnVector> y( file_ );
+      checkValue( y.isMapped(), false, "Invalid mapping of an incompatible array" );
+      checkValue( y[10], 80.0L, "Invalid converted vector" );
+   }
+
+   {
+      blaze::NpyVector<int,blaze::columnVector> x( file_, blaze::readWrite );
+      x *= 2;
+   }
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> x;
+      blaze::readNpy( file_, x );
+      checkValue( x == 2*ref, true, "Invalid persistent modification" );
+   }
+
+   blaze::writeNpy( file_, blaze::DynamicVector<float,blaze::columnVector>() );
+
+   {
+      const blaze::NpyVector<const float,blaze::columnVector> x( file_ );
+      checkValue( x.size(), 0UL, "Invalid size of empty vector" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the .npz import and export of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several arrays into a .npz archive and reads them back by name, both
+// by copying and by mapping the arrays in place. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNpz()
+{
+   test_ = "NpzArchive";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 9UL );
+   blaze::DynamicMatrix<float,blaze::columnMajor> B( 3UL, 4UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 7UL );
+
+   blaze::randomize( A );
+   blaze::randomize( B );
+   blaze::randomize( x );
+
+   {
+      blaze::NpzWriter writer( file_ );
+      writer.write( "A", A );
+      writer.write( "B", B );
+      writer.write( "x", x );
+   }
+
+   const blaze::NpzArchive archive( file_ );
+
+   checkValue( archive.size(), 3UL, "Invalid number of arrays" );
+   checkValue( archive.contains( "B" ), true, "Missing array" );
+   checkValue( archive.contains( "y" ), false, "Invalid array" );
+   checkValue( archive.names()[2] == "x", true, "Invalid array name" );
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> C;
+      archive.read( "A", C );
+      checkValue( C == A, true, "Invalid matrix" );
+
+      blaze::DynamicMatrix<float,blaze::columnMajor> D;
+      archive.read( "B", D );
+      checkValue( D == B, true, "Invalid matrix" );
+
+      blaze::DynamicVector<double,blaze::columnVector> y;
+      archive.read( "x", y );
+      checkValue( y == x, true, "Invalid vector" );
+   }
+
+   {
+      const blaze::NpyMatrix<const double,blaze::rowMajor> C( archive, "A" );
+      checkValue( C.isMapped(), true, "Invalid conversion of a compatible array" );
+      checkValue( C == A, true, "Invalid mapped matrix" );
+
+      const blaze::NpyMatrix<const float,blaze::columnMajor> D( archive, "B" );
+      checkValue( D.isMapped(), true, "Invalid conversion of a compatible array" );
+      checkValue( D == B, true, "Invalid mapped matrix" );
+
+      const blaze::NpyVector<const double,blaze::columnVector> y( archive, "x" );
+      checkValue( y.isMapped(), true, "Invalid conversion of a compatible array" );
+      checkValue( y == x, true, "Invalid mapped vector" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the data exchange formats.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid and incompatible files are detected. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExceptions()
+{
+   test_ = "Error handling";
+
+   blaze::writeNpy( file_, blaze::DynamicVector<double,blaze::columnVector>( 4UL, 1.0 ) );
+
+   // Reading a one-dimensional array into a matrix
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readNpy( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a one-dimensional array into a matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Writable mapping of an incompatible array
+   try {
+      blaze::NpyVector<float,blaze::columnVector> x( file_, blaze::readWrite );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Writable mapping of an incompatible array succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::writeNpy( file_, blaze::DynamicVector<blaze::complex<double>,blaze::columnVector>( 4UL ) );
+
+   // Reading a complex array into a real vector
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      blaze::readNpy( file_, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a complex array into a real vector succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading an array-format Matrix Market file
+   try {
+      writeFile( "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n" );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an array-format Matrix Market file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading a Matrix Market file with an out-of-bounds entry
+   try {
+      writeFile( "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n3 1 1.0\n" );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an out-of-bounds entry succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading a Matrix Market file with a missing entry
+   try {
+      writeFile( "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1.0\n2 2 1.0\n" );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a file with a missing entry succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading a Matrix Market file with an overflowing index
+   try {
+      writeFile( "%%MatrixMarket matrix coordinate real general\n2 2 1\n18446744073709551617 1 1.0\n" );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an overflowing index succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading .npy files with malformed or overflowing shapes
+   const std::string shapes[] = { "(2305843009213693952, 1)", "(4611686018427387904, 4)"
+                                , "(99999999999999999999999, 3)", "(-1, 3)" };
+
+   for( const std::string& shape : shapes )
+   {
+      try {
+         writeNpyFile( shape );
+
+         blaze::DynamicMatrix<double,blaze::rowMajor> A;
+         blaze::readNpy( file_, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a .npy file with an invalid shape succeeded\n"
+             << " Details:\n"
+             << "   Shape: " << shape << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Reading an array from a .npz archive with an overflowing zip64 local header offset
+   try {
+      writeNpzFile( 0xFFFFFFFFFFFFFFF0UL, 8UL );
+
+      const blaze::NpzArchive archive( file_ );
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      archive.read( "a", x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an array at an overflowing offset succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Opening a .npz archive with an extra field exceeding the extra field length
+   try {
+      writeNpzFile( 0UL, 100UL );
+
+      const blaze::NpzArchive archive( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Opening an archive with an invalid extra field succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the temporary file.
+//
+// \param content The content of the file.
+// \return void
+*/
+void ClassTest::writeFile( const std::string& content ) const
+{
+   std::ofstream out( file_.c_str(), std::ofstream::trunc );
+   out << content;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a .npy file with the given shape and three double precision elements.
+//
+// \param shape The shape of the array as given in the header (e.g. "(3, 1)").
+// \return void
+*/
+void ClassTest::writeNpyFile( const std::string& shape ) const
+{
+   std::string dict( "{'descr': '<f8', 'fortran_order': False, 'shape': " + shape + ", }" );
+   dict.resize( ( ( dict.size() + 11UL ) / 64UL + 1UL ) * 64UL - 11UL, ' ' );
+   dict += '\n';
+
+   std::string content( "\x93NUMPY\x01\x00", 8UL );
+   content += static_cast<char>( dict.size() & 0xFF );
+   content += static_cast<char>( dict.size() >> 8 );
+   content += dict;
+   content += std::string( 3UL*sizeof(double), '\0' );
+
+   std::ofstream out( file_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+   out << content;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a .npz archive consisting of the central directory of a single array.
+//
+// \param offset The zip64 offset of the local header of the array.
+// \param length The length stored in the zip64 extra field (which holds 8 bytes).
+// \return void
+*/
+void ClassTest::writeNpzFile( size_t offset, size_t length ) const
+{
+   const auto append = []( std::string& buffer, size_t value, size_t bytes ) {
+      for( size_t i=0UL; i<bytes; ++i ) {
+         buffer += static_cast<char>( ( value >> ( 8UL*i ) ) & 0xFFUL );
+      }
+   };
+
+   std::string content;
+   append( content, 0x02014B50UL, 4UL );  // Central file header signature
+   append( content, 20UL, 2UL );          // Version made by
+   append( content, 20UL, 2UL );          // Version needed to extract
+   append( content, 0UL, 8UL );           // Flags, compression method, time, and date
+   append( content, 0UL, 4UL );           // CRC-32
+   append( content, 64UL, 4UL );          // Compressed size
+   append( content, 64UL, 4UL );          // Uncompressed size
+   append( content, 5UL, 2UL );           // File name length
+   append( content, 12UL, 2UL );          // Extra field length
+   append( content, 0UL, 10UL );          // Comment length, disk number, and attributes
+   append( content, 0xFFFFFFFFUL, 4UL );  // Offset of the local header (see zip64 field)
+   content += "a.npy";
+   append( content, 0x0001UL, 2UL );      // Zip64 extended information
+   append( content, length, 2UL );
+   append( content, offset, 8UL );
+
+   const size_t directory( content.size() );
+
+   append( content, 0x06054B50UL, 4UL );  // End of central directory signature
+   append( content, 0UL, 6UL );           // Disk numbers and entries on this disk
+   append( content, 1UL, 2UL );           // Total number of entries
+   append( content, directory, 4UL );     // Size of the central directory
+   append( content, 0UL, 4UL );           // Offset of the central directory
+   append( content, 0UL, 2UL );           // Comment length
+
+   std::ofstream out( file_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+   out << content;
+}
+//*************************************************************************************************
+
+} // namespace exchange
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running data exchange class test..." << std::endl;
+
+   try
+   {
+      RUN_EXCHANGE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during data exchange class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,498 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/expressiongraph/OperationTest.cpp
+//  \brief Source file for the expression graph operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/expressiongraph/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace expressiongraph {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testFusion( 1000UL );
+   testConflict();
+   testSelfAlias();
+   testSizeChange();
+   testResize();
+   testLargeSystem();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the fusion of a producer, a consumer, and a scalar product.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the statements \f$ y = A x \f$, \f$ z = y + b \f$, and
+// \f$ s = z \cdot w \f$ are fused into a single pass and that the evaluation of this pass
+// yields the same results as the regular evaluation of the statements. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testFusion( size_t n )
+{
+   test_ = "Fused producer/consumer/dot pass";
+
+   MT A;
+   VT x, b, w, y, z;
+   double s( 0.0 );
+
+   initialize( A, n, 16UL );
+   initialize( x, 16UL, 1UL );
+   initialize( b, n, 2UL );
+   initialize( w, n, 3UL );
+
+   blaze::ExpressionGraph graph;
+   graph.assign( y, A * x );
+   graph.assign( z, y + b );
+   graph.dot( s, z, w );
+
+   checkPasses( graph, 1UL );
+   checkPass( graph, 0UL, 0UL, true );
+   checkPass( graph, 1UL, 0UL, true );
+   checkPass( graph, 2UL, 0UL, true );
+   checkDependencies( graph, 0UL, {} );
+   checkDependencies( graph, 1UL, { 0UL } );
+   checkDependencies( graph, 2UL, { 1UL } );
+
+   graph.evaluate();
+
+   if( graph.size() != 0UL || graph.passes() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty graph after evaluation\n"
+          << " Details:\n"
+          << "   Number of statements: " << graph.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const VT yref( A * x );
+   const VT zref( yref + b );
+   const double sref( dot( zref, w ) );
+
+   checkResult( y, yref, "y = A * x" );
+   checkResult( z, zref, "z = y + b" );
+   checkResult( s, sref, "s = dot( z, w )" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the split of a pass due to a non-element-wise read of a later target.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the statement \f$ y = b \f$ is not fused with the preceding
+// statement \f$ z = A y \f$, since the preceding statement reads all elements of \a y for
+// every block of \a z. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testConflict()
+{
+   test_ = "Split due to a non-element-wise read";
+
+   const size_t n( 200UL );
+
+   MT A;
+   VT y, b, z;
+
+   initialize( A, n, n );
+   initialize( y, n, 1UL );
+   initialize( b, n, 2UL );
+
+   const VT y0( y );
+
+   blaze::ExpressionGraph graph;
+   graph.assign( z, A * y );
+   graph.assign( y, b );
+
+   checkPasses( graph, 2UL );
+   checkPass( graph, 0UL, 0UL, true );
+   checkPass( graph, 1UL, 1UL, true );
+   checkDependencies( graph, 1UL, { 0UL } );
+
+   graph.evaluate();
+
+   checkResult( z, VT( A * y0 ), "z = A * y" );
+   checkResult( y, b, "y = b" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the unfused evaluation of a self-aliased statement.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the statement \f$ x = A x \f$ forms an unfused pass on its own,
+// which is evaluated via a regular assignment, and that the following statement starts a new
+// fused pass. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSelfAlias()
+{
+   test_ = "Unfused self-aliased statement";
+
+   const size_t n( 150UL );
+
+   MT A;
+   VT x, b, y, z;
+
+   initialize( A, n, n );
+   initialize( x, n, 1UL );
+   initialize( b, n, 2UL );
+
+   const VT x0( x );
+
+   blaze::ExpressionGraph graph;
+   graph.assign( y, x + b );
+   graph.assign( x, A * x );
+   graph.assign( z, x + y );
+
+   checkPasses( graph, 3UL );
+   checkPass( graph, 0UL, 0UL, true );
+   checkPass( graph, 1UL, 1UL, false );
+   checkPass( graph, 2UL, 2UL, true );
+   checkDependencies( graph, 1UL, { 0UL } );
+   checkDependencies( graph, 2UL, { 0UL, 1UL } );
+
+   graph.evaluate();
+
+   const VT yref( x0 + b );
+   const VT xref( A * x0 );
+
+   checkResult( y, yref, "y = x + b" );
+   checkResult( x, xref, "x = A * x" );
+   checkResult( z, VT( xref + yref ), "z = x + y" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the start of a new pass due to a change of the size.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that two independent statements of different size are evaluated in
+// separate passes and that the output operator reports the according number of passes. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSizeChange()
+{
+   test_ = "New pass due to a size change";
+
+   VT x, b, u, v, y;
+
+   initialize( x, 300UL, 1UL );
+   initialize( b, 300UL, 2UL );
+   initialize( u, 100UL, 3UL );
+
+   blaze::ExpressionGraph graph;
+   graph.assign( y, x + b );
+   graph.assign( v, 2.0 * u );
+
+   checkPasses( graph, 2UL );
+   checkPass( graph, 0UL, 0UL, true );
+   checkPass( graph, 1UL, 1UL, true );
+   checkDependencies( graph, 1UL, {} );
+
+   std::ostringstream os;
+   os << graph;
+
+   if( os.str().find( "(2 statements, 2 passes)" ) == std::string::npos ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid output of the expression graph\n"
+          << " Details:\n"
+          << "   Output:\n" << os.str() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   graph.evaluate();
+
+   checkResult( y, VT( x + b ), "y = x + b" );
+   checkResult( v, VT( 2.0 * u ), "v = 2 * u" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize of a target that is accessed by a recorded statement.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a target that is read by a previously recorded statement cannot
+// be resized by a later statement, since the resize would take effect before the evaluation
+// of the previously recorded statement. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testResize()
+{
+   test_ = "Resize of a target accessed by a recorded statement";
+
+   VT y, b, u, z;
+
+   initialize( y, 100UL, 1UL );
+   initialize( b, 100UL, 2UL );
+   initialize( u, 300UL, 3UL );
+
+   blaze::ExpressionGraph graph;
+   graph.assign( z, y + b );
+
+   try {
+      graph.assign( y, 2.0 * u );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing a target read by a recorded statement succeeded\n"
+          << " Details:\n"
+          << "   Graph:\n" << graph << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkPasses( graph, 1UL );
+
+   graph.evaluate();
+
+   checkResult( z, VT( y + b ), "z = y + b" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of fused passes above the SMP threshold.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused evaluation for vectors that exceed the SMP threshold for dense
+// vector assignments. In case shared memory parallelization is active, the pass is distributed
+// among all available threads. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testLargeSystem()
+{
+   testFusion( blaze::SMP_DVECASSIGN_THRESHOLD + 1000UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \param n The size of the vector.
+// \param seed The seed of the initialization.
+// \return void
+*/
+void OperationTest::initialize( VT& v, size_t n, size_t seed )
+{
+   v.resize( n, false );
+   for( size_t i=0UL; i<n; ++i ) {
+      v[i] = double( ( i*seed + 1UL )%7UL ) - 3.0;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+*/
+void OperationTest::initialize( MT& A, size_t m, size_t n )
+{
+   A.resize( m, n, false );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = double( ( i + 2UL*j )%5UL ) - 2.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of passes of the given expression graph.
+//
+// \param graph The expression graph to be checked.
+// \param expected The expected number of passes.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkPasses( const blaze::ExpressionGraph& graph, size_t expected ) const
+{
+   if( graph.passes() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of passes\n"
+          << " Details:\n"
+          << "   Number of passes: " << graph.passes() << "\n"
+          << "   Expected number of passes: " << expected << "\n"
+          << "   Graph:\n" << graph << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the pass of a statement of the given expression graph.
+//
+// \param graph The expression graph to be checked.
+// \param node The index of the statement.
+// \param expected The expected index of the pass.
+// \param fused The expected fusion flag of the statement.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkPass( const blaze::ExpressionGraph& graph, size_t node,
+                               size_t expected, bool fused ) const
+{
+   if( graph.pass( node ) != expected || graph.isFused( node ) != fused ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid pass of statement " << node << "\n"
+          << " Details:\n"
+          << "   Pass: " << graph.pass( node ) << ( graph.isFused( node ) ? " (fused)" : " (single)" ) << "\n"
+          << "   Expected pass: " << expected << ( fused ? " (fused)" : " (single)" ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the dependencies of a statement of the given expression graph.
+//
+// \param graph The expression graph to be checked.
+// \param node The index of the statement.
+// \param expected The expected dependencies of the statement.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkDependencies( const blaze::ExpressionGraph& graph, size_t node,
+                                       const std::vector<size_t>& expected ) const
+{
+   if( graph.dependencies( node ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dependencies of statement " << node << "\n"
+          << " Details:\n"
+          << "   Graph:\n" << graph << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace expressiongraph
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ExpressionGraph operation test..." << std::endl;
+
+   try
+   {
+      RUN_EXPRESSIONGRAPH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ExpressionGraph operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
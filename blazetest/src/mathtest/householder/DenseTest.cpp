@@ -0,0 +1,299 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/householder/DenseTest.cpp
+//  \brief Source file for the dense matrix Householder test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/householder/DenseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace householder {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest test.
+//
+// \exception std::runtime_error Error during Householder decomposition detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[][2] = { { 1UL, 1UL }, { 7UL, 4UL }, { 4UL, 7UL }, { 9UL, 9UL },
+                               { 150UL, 70UL }, { 70UL, 150UL }, { 97UL, 97UL } };
+
+   for( const auto& s : sizes )
+   {
+      testQR< blaze::DynamicMatrix<double,rowMajor   > >( s[0], s[1] );
+      testQR< blaze::DynamicMatrix<double,columnMajor> >( s[0], s[1] );
+      testQR< blaze::DynamicMatrix<cdouble,rowMajor   > >( s[0], s[1] );
+      testQR< blaze::DynamicMatrix<cdouble,columnMajor> >( s[0], s[1] );
+
+      testLQ< blaze::DynamicMatrix<double,rowMajor   > >( s[0], s[1] );
+      testLQ< blaze::DynamicMatrix<cdouble,columnMajor> >( s[0], s[1] );
+
+      testSolve< blaze::DynamicMatrix<double,rowMajor   > >( s[0], s[1] );
+      testSolve< blaze::DynamicMatrix<double,columnMajor> >( s[0], s[1] );
+      testSolve< blaze::DynamicMatrix<cdouble,rowMajor   > >( s[0], s[1] );
+   }
+
+   testStatic();
+   testBatch();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native least squares solver for fixed size systems.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native least squares solver for overdetermined and underdetermined
+// systems with StaticMatrix system matrices and StaticVector right-hand sides. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testStatic()
+{
+   test_ = "Householder least squares solver for fixed size systems";
+
+   {
+      blaze::StaticMatrix<double,6UL,3UL,blaze::rowMajor> A;
+      blaze::StaticVector<double,6UL,blaze::columnVector> b;
+      blaze::StaticVector<double,3UL,blaze::columnVector> x;
+
+      randomize( A );
+      randomize( b );
+
+      blaze::solve_ls( A, x, b );
+
+      const blaze::StaticVector<double,3UL,blaze::columnVector> z( trans( A ) * ( A*x - b ) );
+
+      if( z != blaze::StaticVector<double,3UL,blaze::columnVector>( 0.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Least squares solution of overdetermined system failed\n"
+             << " Details:\n"
+             << "   Solution:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::StaticMatrix<double,3UL,6UL,blaze::columnMajor> A;
+      blaze::StaticVector<double,3UL,blaze::columnVector> b;
+      blaze::StaticVector<double,6UL,blaze::columnVector> x;
+
+      randomize( A );
+      randomize( b );
+
+      blaze::solve_ls( A, x, b );
+
+      const blaze::StaticVector<double,3UL,blaze::columnVector> r( A*x - b );
+
+      if( r != blaze::StaticVector<double,3UL,blaze::columnVector>( 0.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Minimum norm solution of underdetermined system failed\n"
+             << " Details:\n"
+             << "   Solution:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched native least squares solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the least squares solution of a batch of small fixed size systems. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testBatch()
+{
+   test_ = "Batched Householder least squares solver";
+
+   using MT  = blaze::StaticMatrix<double,8UL,3UL,blaze::rowMajor>;
+   using VT1 = blaze::StaticVector<double,3UL,blaze::columnVector>;
+   using VT2 = blaze::StaticVector<double,8UL,blaze::columnVector>;
+
+   const size_t N( 257UL );
+
+   std::vector< MT , blaze::AlignedAllocator<MT>  > A( N );
+   std::vector< VT1, blaze::AlignedAllocator<VT1> > x;
+   std::vector< VT2, blaze::AlignedAllocator<VT2> > b( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      randomize( A[i] );
+      randomize( b[i] );
+   }
+
+   blaze::solve_ls( A, x, b );
+
+   if( x.size() != N ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of solution vectors\n"
+          << " Details:\n"
+          << "   Number of solutions: " << x.size() << "\n"
+          << "   Expected number    : " << N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      VT1 y;
+      blaze::solve_ls( A[i], y, b[i] );
+
+      if( x[i] != y ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batched least squares solution failed\n"
+             << " Details:\n"
+             << "   System index: " << i << "\n"
+             << "   Result:\n" << x[i] << "\n"
+             << "   Expected result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the native least squares solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid and rank-deficient systems are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testExceptions()
+{
+   test_ = "Householder least squares solver with invalid system";
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 3UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> b( 4UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( blaze::solve_ls( A, b ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving system with invalid right-hand side succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << x << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 3UL, 0.0 );
+      blaze::DynamicVector<double,blaze::columnVector> b( 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( blaze::solve_ls( A, b ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving rank-deficient system succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << x << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Rank-deficient" ) == std::string::npos ) throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace householder
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix Householder test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_HOUSEHOLDER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix Householder test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,160 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/jacobi3x3/DenseTest.cpp
+//  \brief Source file for the dense 3x3 Jacobi decomposition test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/jacobi3x3/DenseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace jacobi3x3 {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest test.
+//
+// \exception std::runtime_error Error during decomposition detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testRandom<double,rowMajor   >();
+   testRandom<double,columnMajor>();
+   testRandom<float ,rowMajor   >();
+   testRandom<float ,columnMajor>();
+
+   for( size_t N : { 0UL, 1UL, 7UL, 100UL, blaze::JACOBI3X3_SMP_THRESHOLD + 3UL } ) {
+      testBatch<double>( N );
+      testBatch<float >( N );
+   }
+
+   testDegenerate();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the 3x3 decompositions with degenerate matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the 3x3 decompositions with the zero matrix, the identity, a reflection,
+// rank-deficient matrices, and random matrices with very large and very small elements. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testDegenerate()
+{
+   test_ = "3x3 decompositions with degenerate matrices";
+
+   typedef blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>  MT;
+
+   std::vector< MT, blaze::AlignedAllocator<MT> > matrices;
+
+   matrices.push_back( MT( 0.0 ) );
+   matrices.push_back( MT{ { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0,  1.0 } } );
+   matrices.push_back( MT{ { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, -1.0 } } );
+   matrices.push_back( MT{ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0,  2.0 } } );
+   matrices.push_back( MT{ { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 3.0, 6.0,  9.0 } } );
+   matrices.push_back( MT{ { 1.0, 2.0, 2.0 }, { 3.0, 4.0, 4.0 }, { 5.0, 6.0,  6.0 } } );
+
+   MT A;
+   randomize( A, -1.0, 1.0 );
+   matrices.push_back( A * 1E150 );
+   matrices.push_back( A * 1E-150 );
+
+   for( const MT& M : matrices ) {
+      checkSvd( M );
+      checkPolar( M );
+      checkEigh( M );
+   }
+}
+//*************************************************************************************************
+
+} // namespace jacobi3x3
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense 3x3 Jacobi decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_DENSE_JACOBI3X3_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense 3x3 Jacobi decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/kron/OperationTest.cpp
+//  \brief Source file for the Kronecker product operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blazetest/mathtest/kron/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kron {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using DRM = blaze::DynamicMatrix<double,rowMajor>;
+   using DCM = blaze::DynamicMatrix<double,columnMajor>;
+   using SRM = blaze::CompressedMatrix<double,rowMajor>;
+   using SCM = blaze::CompressedMatrix<double,columnMajor>;
+
+
+   //=====================================================================================
+   // Assignment tests
+   //=====================================================================================
+
+   testAssign<DRM,DRM>();
+   testAssign<DRM,DCM>();
+   testAssign<DCM,SRM>();
+   testAssign<DRM,SCM>();
+   testAssign<SRM,DRM>();
+   testAssign<SCM,DCM>();
+   testAssign<SRM,SRM>();
+   testAssign<SRM,SCM>();
+   testAssign<SCM,SCM>();
+
+
+   //=====================================================================================
+   // Multiplication tests
+   //=====================================================================================
+
+   testVectorMult<DRM,DRM>();
+   testVectorMult<DCM,DCM>();
+   testVectorMult<DRM,SRM>();
+   testVectorMult<SCM,DRM>();
+   testVectorMult<SRM,SCM>();
+
+
+   //=====================================================================================
+   // Miscellaneous tests
+   //=====================================================================================
+
+   testLargeProduct();
+   testNonFinite();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a large Kronecker product.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of a Kronecker product that is large enough to be evaluated
+// in parallel (in case parallelization is enabled) and of its multiplication with a dense
+// vector for operand shapes that favor either of the two evaluation orders. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLargeProduct()
+{
+   test_ = "Large Kronecker product";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A, B;
+   initialize( A, 40UL, 30UL, 5UL );
+   initialize( B, 30UL, 40UL, 6UL );
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> ref( reference( A, B ) );
+
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C( blaze::kron( A, B ) );
+      checkResult( C, ref, "Dense assignment" );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> C( ref );
+      C -= blaze::kron( A, B );
+      checkResult( C, blaze::DynamicMatrix<double,blaze::rowMajor>( ref.rows(), ref.columns(), 0.0 ),
+                   "Subtraction assignment" );
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x( ref.columns() );
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         x[i] = double( i%3UL ) - 1.0;
+      }
+
+      const blaze::DynamicVector<double,blaze::columnVector> y1( blaze::kron( A, B ) * x );
+      checkResult( y1, ref * x, "Multiplication with a dense vector" );
+
+      const blaze::DynamicVector<double,blaze::columnVector> y2( blaze::kron( B, A ) * x );
+      checkResult( y2, reference( B, A ) * x, "Multiplication with a dense vector" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of non-finite values through the Kronecker product.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that non-finite elements of the right-hand side dense operand propagate
+// through the blocks of default elements of the left-hand side dense operand to both dense
+// and sparse target matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testNonFinite()
+{
+   test_ = "Kronecker product with non-finite elements";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 2UL, 2UL, 0.0 ), B( 2UL, 2UL, 1.0 );
+   A(0,0) = 2.0;
+   B(1,0) = std::numeric_limits<double>::quiet_NaN();
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> C1( blaze::kron( A, B ) );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> C2( blaze::kron( A, B ) );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B2( B );
+   const blaze::DynamicMatrix<double,blaze::rowMajor> C3( blaze::kron( A, B2 ) );
+
+   for( size_t i=0UL; i<2UL; ++i ) {
+      for( size_t j=0UL; j<2UL; ++j ) {
+         if( !std::isnan( C1(i*2UL+1UL,j*2UL) ) || !std::isnan( C2(i*2UL+1UL,j*2UL) ) ||
+             !std::isnan( C3(i*2UL+1UL,j*2UL) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-finite element not propagated\n"
+                << " Details:\n"
+                << "   Block: (" << i << "," << j << ")\n"
+                << "   Dense result:\n" << C1 << "\n"
+                << "   Sparse result:\n" << C2 << "\n"
+                << "   Dense result with sparse operand:\n" << C3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( C2.nonZeros() != 7UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << C2.nonZeros() << "\n"
+          << "   Expected number    : 7\n"
+          << "   Result:\n" << C2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the Kronecker product/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the multiplication of a Kronecker product with a vector of
+// mismatching size is rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testExceptions()
+{
+   test_ = "Kronecker product/dense vector multiplication with invalid vector";
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 2UL, 3UL, 1.0 ), B( 3UL, 2UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> y( blaze::kron( A, B ) * x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with invalid vector succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace kron
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Kronecker product operation test..." << std::endl;
+
+   try
+   {
+      RUN_KRON_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Kronecker product operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,348 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mapped/ClassTest.cpp
+//  \brief Source file for the memory-mapped container class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <blazetest/mathtest/mapped/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mapped {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the memory-mapped container class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                                // Label of the currently performed test
+   , file_( "blazetest_mapped_file.bin" )  // Path of the temporary file
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testVector();
+   testMatrix<rowMajor>();
+   testMatrix<columnMajor>();
+   testCompressed<rowMajor>();
+   testCompressed<columnMajor>();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the memory-mapped container class test.
+//
+// The destructor removes the temporary file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the creation, the mapping in all access modes, and the resizing of a
+// file-backed vector. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVector()
+{
+   test_ = "MappedVector";
+
+   const blaze::DynamicVector<double,blaze::columnVector> zero( 11UL, 0.0 );
+
+   {
+      blaze::MappedVector<double,blaze::columnVector> x( file_, 11UL );
+
+      checkValue( x.size(), 11UL, "Invalid size" );
+      checkValue( x.isAligned(), true, "Unaligned mapped vector" );
+      checkValue( x.mode(), blaze::readWrite, "Invalid mapping mode" );
+      checkValue( x == zero, true, "Non-zero initialization" );
+
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         x[i] = double( i );
+      }
+      x *= 2.0;
+      x.sync();
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> ref( 11UL );
+   for( size_t i=0UL; i<ref.size(); ++i ) {
+      ref[i] = 2.0 * double( i );
+   }
+
+   {
+      const blaze::MappedVector<const double,blaze::columnVector> x( file_ );
+      x.advise( blaze::sequentialAccess );
+      x.prefetch();
+
+      checkValue( x.mode(), blaze::readOnly, "Invalid mapping mode" );
+      checkValue( x == ref, true, "Invalid persistent vector" );
+
+      const blaze::DynamicVector<double,blaze::columnVector> y( x + x );
+      checkValue( y == 2.0*ref, true, "Invalid vector addition" );
+   }
+
+   {
+      blaze::MappedVector<double,blaze::columnVector> x( file_, blaze::copyOnWrite );
+      x = 0.0;
+      x.advise( blaze::dontNeed );
+      checkValue( x == zero, true, "Invalid assignment to copy-on-write vector" );
+   }
+
+   {
+      blaze::MappedVector<double,blaze::columnVector> x( file_ );
+      checkValue( x == ref, true, "Copy-on-write mapping modified the file" );
+
+      x.resize( 13UL );
+      checkValue( x.size(), 13UL, "Invalid size after resize" );
+      checkValue( blaze::subvector( x, 0UL, 11UL ) == ref, true, "Invalid growing resize" );
+      checkValue( x[12], 0.0, "Invalid growing resize" );
+
+      x.resize( 3UL );
+      x.resize( 9UL );
+      checkValue( blaze::subvector( x, 0UL, 3UL ) == blaze::subvector( ref, 0UL, 3UL ), true, "Invalid shrinking resize" );
+      checkValue( blaze::subvector( x, 3UL, 6UL ) == blaze::subvector( zero, 0UL, 6UL ), true, "Invalid resize after shrinking" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the memory-mapped containers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid mappings and invalid operations on mapped containers are
+// detected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExceptions()
+{
+   test_ = "Error handling";
+
+   {
+      blaze::MappedVector<double,blaze::columnVector> x( file_, 5UL );
+   }
+
+   // Read-only mapping of non-constant elements
+   try {
+      blaze::MappedVector<double,blaze::columnVector> x( file_, blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Read-only mapping of non-constant elements succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mapping with a different element type
+   try {
+      blaze::MappedVector<float,blaze::columnVector> x( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping with a different element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mapping a vector file as matrix
+   try {
+      blaze::MappedMatrix<double,blaze::rowMajor> A( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a vector file as matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Resizing a copy-on-write mapping
+   try {
+      blaze::MappedVector<double,blaze::columnVector> x( file_, blaze::copyOnWrite );
+      x.resize( 10UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing a copy-on-write mapping succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::logic_error& ) {}
+
+   // Mapping a vector file with an overflowing file size
+   try {
+      {
+         blaze::MappedVector<double,blaze::columnVector> x( file_, 5UL );
+      }
+      writeHeader( 5UL, 1UL, 1UL << 61 );
+
+      blaze::MappedVector<double,blaze::columnVector> x( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a vector file with an overflowing file size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mapping a matrix file with an overflowing file size
+   try {
+      {
+         blaze::MappedMatrix<double,blaze::rowMajor> A( file_, 2UL, 4UL );
+      }
+      writeHeader( 1UL << 62, 4UL, 8UL );
+
+      blaze::MappedMatrix<double,blaze::rowMajor> A( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a matrix file with an overflowing file size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mapping a non-existing file
+   try {
+      std::remove( file_.c_str() );
+      blaze::MappedVector<const double,blaze::columnVector> x( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Overwriting the size information in the header of the temporary file.
+//
+// \param rows The new number of rows.
+// \param columns The new number of columns.
+// \param spacing The new spacing between two rows/columns.
+// \return void
+//
+// This function is used to simulate corrupted or malicious files, whose header does not match
+// the size of the file.
+*/
+void ClassTest::writeHeader( size_t rows, size_t columns, size_t spacing ) const
+{
+   blaze::MappedFile file( file_, blaze::readWrite );
+
+   blaze::MappedHeader header;
+   std::memcpy( &header, file.data(), sizeof( header ) );
+
+   header.rows    = rows;
+   header.columns = columns;
+   header.spacing = spacing;
+
+   std::memcpy( file.data(), &header, sizeof( header ) );
+}
+//*************************************************************************************************
+
+} // namespace mapped
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedVector/MappedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPED_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedVector/MappedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,601 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixchain/OperationTest.cpp
+//  \brief Source file for the matrix chain reordering operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/matrixchain/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixchain {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testPlan();
+   testDenseChains();
+   testSparseChains();
+   testRankOne();
+   testLarge();
+   testAliasing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the order of evaluation chosen by the MatrixChainPlan class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the optimal splits and the estimated costs computed by the matrix-chain
+// dynamic program for several dense, sparse, and rank-1 chains. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPlan()
+{
+   using blaze::MatrixChainNode;
+   using blaze::MatrixChainPlan;
+
+   {
+      test_ = "Plan of a three factor chain evaluated from left to right";
+
+      const MatrixChainNode factors[] = { node( 10UL, 100UL ), node( 100UL, 5UL ), node( 5UL, 50UL ) };
+      const MatrixChainPlan plan( factors, 3UL );
+
+      checkPlan( plan, 0UL, 2UL, 1UL );
+      checkCost( plan, 7500.0 );
+   }
+
+   {
+      test_ = "Plan of a three factor chain evaluated from right to left";
+
+      const MatrixChainNode factors[] = { node( 50UL, 5UL ), node( 5UL, 100UL ), node( 100UL, 10UL ) };
+      const MatrixChainPlan plan( factors, 3UL );
+
+      checkPlan( plan, 0UL, 2UL, 0UL );
+      checkCost( plan, 7500.0 );
+
+      const MatrixChainNode given( multiply( multiply( factors[0], factors[1] ), factors[2] ) );
+
+      if( !isCheaper( plan.optimum(), given ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Optimal order of evaluation is not cheaper than the given order\n"
+             << " Details:\n"
+             << "   Optimal number of operations: " << plan.optimum().flops << "\n"
+             << "   Given number of operations  : " << given.flops << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Plan of a six factor chain";
+
+      const MatrixChainNode factors[] = { node( 30UL, 35UL ), node( 35UL, 15UL ), node( 15UL, 5UL )
+                                        , node( 5UL, 10UL ), node( 10UL, 20UL ), node( 20UL, 25UL ) };
+      const MatrixChainPlan plan( factors, 6UL );
+
+      checkPlan( plan, 0UL, 5UL, 2UL );
+      checkPlan( plan, 0UL, 2UL, 0UL );
+      checkPlan( plan, 1UL, 2UL, 1UL );
+      checkPlan( plan, 3UL, 5UL, 4UL );
+      checkPlan( plan, 3UL, 4UL, 3UL );
+      checkCost( plan, 15125.0 );
+   }
+
+   {
+      test_ = "Plan of a sparse matrix/dense matrix/dense vector chain";
+
+      const MatrixChainNode factors[] = { node( 1000UL, 1000UL, 1000UL ), node( 1000UL, 1000UL ), node( 1000UL, 1UL ) };
+      const MatrixChainPlan plan( factors, 3UL );
+
+      checkPlan( plan, 0UL, 2UL, 0UL );
+      checkCost( plan, 1001000.0 );
+   }
+
+   {
+      test_ = "Plan of a chain with a rank-1 inner dimension";
+
+      const MatrixChainNode factors[] = { node( 100UL, 1UL ), node( 1UL, 100UL ), node( 100UL, 100UL ) };
+      const MatrixChainPlan plan( factors, 3UL );
+
+      checkPlan( plan, 0UL, 2UL, 0UL );
+      checkCost( plan, 20000.0 );
+   }
+
+   {
+      test_ = "Plan of a chain of square matrices";
+
+      const MatrixChainNode factors[] = { node( 10UL, 10UL ), node( 10UL, 10UL ), node( 10UL, 10UL ) };
+      const MatrixChainPlan plan( factors, 3UL );
+
+      checkCost( plan, 2000.0 );
+
+      const MatrixChainNode given( multiply( multiply( factors[0], factors[1] ), factors[2] ) );
+
+      if( isCheaper( plan.optimum(), given ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Order of evaluation of equal cost considered cheaper\n"
+             << " Details:\n"
+             << "   Optimal number of operations: " << plan.optimum().flops << "\n"
+             << "   Given number of operations  : " << given.flops << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reordering of dense matrix product chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reordering of chains of three to six dense matrices of all storage
+// orders. Additionally, it tests chains that are not reordered since the given order is already
+// optimal or the number of factors exceeds the limit. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDenseChains()
+{
+   {
+      test_ = "DMat*DMat*DMat chain";
+      testChain( true, create<DMat>( 50UL, 5UL, 1UL ), create<DMat>( 5UL, 100UL, 2UL ), create<DMat>( 100UL, 10UL, 3UL ) );
+   }
+
+   {
+      test_ = "DMat*DMat*TDMat chain";
+      testChain( true, create<DMat>( 50UL, 5UL, 1UL ), create<DMat>( 5UL, 100UL, 2UL ), create<TDMat>( 100UL, 10UL, 3UL ) );
+   }
+
+   {
+      test_ = "TDMat*TDMat*DMat chain";
+      testChain( true, create<TDMat>( 50UL, 5UL, 1UL ), create<TDMat>( 5UL, 100UL, 2UL ), create<DMat>( 100UL, 10UL, 3UL ) );
+   }
+
+   {
+      test_ = "TDMat*TDMat*TDMat chain";
+      testChain( true, create<TDMat>( 50UL, 5UL, 1UL ), create<TDMat>( 5UL, 100UL, 2UL ), create<TDMat>( 100UL, 10UL, 3UL ) );
+   }
+
+   {
+      test_ = "Three factor chain in optimal order";
+      testChain( false, create<DMat>( 10UL, 100UL, 1UL ), create<TDMat>( 100UL, 5UL, 2UL ), create<DMat>( 5UL, 50UL, 3UL ) );
+   }
+
+   {
+      test_ = "Three factor chain of square matrices";
+      testChain( false, create<DMat>( 20UL, 20UL, 1UL ), create<DMat>( 20UL, 20UL, 2UL ), create<TDMat>( 20UL, 20UL, 3UL ) );
+   }
+
+   {
+      test_ = "Four factor chain";
+      testChain( true, create<DMat>( 10UL, 2UL, 1UL ), create<TDMat>( 2UL, 40UL, 2UL )
+                     , create<DMat>( 40UL, 3UL, 3UL ), create<TDMat>( 3UL, 25UL, 4UL ) );
+   }
+
+   {
+      test_ = "Five factor chain";
+      testChain( true, create<TDMat>( 7UL, 50UL, 1UL ), create<DMat>( 50UL, 2UL, 2UL ), create<TDMat>( 2UL, 60UL, 3UL )
+                     , create<DMat>( 60UL, 3UL, 4UL ), create<TDMat>( 3UL, 40UL, 5UL ) );
+   }
+
+   {
+      test_ = "Six factor chain";
+      testChain( true, create<DMat>( 30UL, 35UL, 1UL ), create<TDMat>( 35UL, 15UL, 2UL ), create<DMat>( 15UL, 5UL, 3UL )
+                     , create<TDMat>( 5UL, 10UL, 4UL ), create<DMat>( 10UL, 20UL, 5UL ), create<TDMat>( 20UL, 25UL, 6UL ) );
+   }
+
+   {
+      test_ = "Seven factor chain";
+      testChain( false, create<DMat>( 5UL, 6UL, 1UL ), create<DMat>( 6UL, 7UL, 2UL ), create<DMat>( 7UL, 8UL, 3UL )
+                      , create<DMat>( 8UL, 9UL, 4UL ), create<DMat>( 9UL, 10UL, 5UL ), create<DMat>( 10UL, 2UL, 6UL )
+                      , create<DMat>( 2UL, 12UL, 7UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reordering of mixed sparse and dense matrix product chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reordering of chains of sparse and dense matrices, including all
+// combinations of a sparse or dense outermost multiplication with both storage orders. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSparseChains()
+{
+   {
+      test_ = "DMat*SMat*DMat chain";
+      testChain( true, create<DMat>( 40UL, 4UL, 1UL ), create<SMat>( 4UL, 40UL, 2UL ), create<DMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "TDMat*TSMat*TDMat chain";
+      testChain( true, create<TDMat>( 40UL, 4UL, 1UL ), create<TSMat>( 4UL, 40UL, 2UL ), create<TDMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "DMat*DMat*SMat chain";
+      testChain( true, create<DMat>( 40UL, 4UL, 1UL ), create<DMat>( 4UL, 40UL, 2UL ), create<SMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "DMat*DMat*TSMat chain";
+      testChain( true, create<DMat>( 40UL, 4UL, 1UL ), create<DMat>( 4UL, 40UL, 2UL ), create<TSMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "TDMat*TDMat*SMat chain";
+      testChain( true, create<TDMat>( 40UL, 4UL, 1UL ), create<TDMat>( 4UL, 40UL, 2UL ), create<SMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "TDMat*TDMat*TSMat chain";
+      testChain( true, create<TDMat>( 40UL, 4UL, 1UL ), create<TDMat>( 4UL, 40UL, 2UL ), create<TSMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "SMat*SMat*DMat chain";
+      testChain( true, create<SMat>( 40UL, 4UL, 1UL ), create<SMat>( 4UL, 40UL, 2UL ), create<DMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "SMat*SMat*TDMat chain";
+      testChain( true, create<SMat>( 40UL, 4UL, 1UL ), create<SMat>( 4UL, 40UL, 2UL ), create<TDMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "TSMat*TSMat*DMat chain";
+      testChain( true, create<TSMat>( 40UL, 4UL, 1UL ), create<TSMat>( 4UL, 40UL, 2UL ), create<DMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "TSMat*TSMat*TDMat chain";
+      testChain( true, create<TSMat>( 40UL, 4UL, 1UL ), create<TSMat>( 4UL, 40UL, 2UL ), create<TDMat>( 40UL, 30UL, 3UL ) );
+   }
+
+   {
+      test_ = "DMat*SMat*TDMat*TSMat chain";
+      testChain( true, create<DMat>( 30UL, 3UL, 1UL ), create<SMat>( 3UL, 40UL, 2UL )
+                     , create<TDMat>( 40UL, 5UL, 3UL ), create<TSMat>( 5UL, 20UL, 4UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reordering of matrix product chains with a rank-1 inner dimension.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests chains containing an outer product of a column and a row matrix. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testRankOne()
+{
+   {
+      test_ = "Rank-1 chain evaluated from right to left";
+      testChain( true, create<DMat>( 40UL, 1UL, 1UL ), create<TDMat>( 1UL, 40UL, 2UL ), create<DMat>( 40UL, 40UL, 3UL ) );
+   }
+
+   {
+      test_ = "Rank-1 chain evaluated from left to right";
+      testChain( false, create<DMat>( 40UL, 40UL, 1UL ), create<TDMat>( 40UL, 1UL, 2UL ), create<DMat>( 1UL, 40UL, 3UL ) );
+   }
+
+   {
+      test_ = "Rank-1 chain with a sparse factor";
+      testChain( true, create<TDMat>( 40UL, 1UL, 1UL ), create<DMat>( 1UL, 40UL, 2UL ), create<SMat>( 40UL, 40UL, 3UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reordering of large matrix product chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reordering of chains whose intermediate and final results are large
+// enough to be evaluated in parallel in case SMP is enabled. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLarge()
+{
+   {
+      test_ = "Large DMat*DMat*DMat chain";
+      testChain( true, create<DMat>( 200UL, 8UL, 1UL ), create<DMat>( 8UL, 200UL, 2UL ), create<DMat>( 200UL, 150UL, 3UL ) );
+   }
+
+   {
+      test_ = "Large TDMat*DMat*TDMat chain";
+      testChain( true, create<TDMat>( 200UL, 8UL, 1UL ), create<DMat>( 8UL, 200UL, 2UL ), create<TDMat>( 200UL, 150UL, 3UL ) );
+   }
+
+   {
+      test_ = "Large DMat*SMat*TDMat chain";
+      testChain( true, create<DMat>( 200UL, 8UL, 1UL ), create<SMat>( 8UL, 200UL, 2UL ), create<TDMat>( 200UL, 150UL, 3UL ) );
+   }
+
+   {
+      test_ = "Large four factor chain";
+      testChain( true, create<DMat>( 150UL, 120UL, 1UL ), create<TDMat>( 120UL, 100UL, 2UL )
+                     , create<DMat>( 100UL, 6UL, 3UL ), create<TDMat>( 6UL, 100UL, 4UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of reordered chains to one of their factors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of a
+// reordered matrix product chain to one of its own factors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAliasing()
+{
+   const DMat A( create<DMat>( 20UL, 4UL, 1UL ) );
+   const DMat B( create<DMat>( 4UL, 20UL, 2UL ) );
+   const DMat C( create<DMat>( 20UL, 4UL, 3UL ) );
+   const DMat ABC( evaluate( A, B, C ) );
+
+   {
+      test_ = "Assignment of a reordered chain to its first factor";
+
+      DMat lhs( A );
+      lhs = lhs * B * C;
+
+      if( lhs != ABC ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of the matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << lhs << "\n"
+             << "   Expected result:\n" << ABC << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Addition assignment of a reordered chain to its last factor";
+
+      DMat lhs( C );
+      lhs += A * B * lhs;
+
+      if( lhs != C + ABC ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of the matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << lhs << "\n"
+             << "   Expected result:\n" << ( C + ABC ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Subtraction assignment of a reordered chain to its first factor";
+
+      DMat lhs( A );
+      lhs -= lhs * B * C;
+
+      if( lhs != A - ABC ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of the matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << lhs << "\n"
+             << "   Expected result:\n" << ( A - ABC ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the optimal split of a subchain.
+//
+// \param plan The order of evaluation to be checked.
+// \param i The index of the first factor of the subchain.
+// \param j The index of the last factor of the subchain.
+// \param split The expected optimal split of the subchain.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkPlan( const blaze::MatrixChainPlan& plan, size_t i, size_t j, size_t split ) const
+{
+   if( plan.split( i, j ) != split ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid split of the subchain [" << i << ".." << j << "]\n"
+          << " Details:\n"
+          << "   Result: " << plan.split( i, j ) << "\n"
+          << "   Expected result: " << split << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the estimated number of operations of the optimal order of evaluation.
+//
+// \param plan The order of evaluation to be checked.
+// \param flops The expected number of multiply-add operations.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkCost( const blaze::MatrixChainPlan& plan, double flops ) const
+{
+   if( plan.optimum().flops != flops ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of operations\n"
+          << " Details:\n"
+          << "   Result: " << plan.optimum().flops << "\n"
+          << "   Expected result: " << flops << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the cost estimate of a dense factor.
+//
+// \param m The number of rows of the factor.
+// \param n The number of columns of the factor.
+// \return The cost estimate of the factor.
+*/
+blaze::MatrixChainNode OperationTest::node( size_t m, size_t n )
+{
+   return { m, n, double( m ) * double( n ), false, 0.0, 0.0 };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cost estimate of a sparse factor.
+//
+// \param m The number of rows of the factor.
+// \param n The number of columns of the factor.
+// \param nonzeros The number of non-zero elements of the factor.
+// \return The cost estimate of the factor.
+*/
+blaze::MatrixChainNode OperationTest::node( size_t m, size_t n, size_t nonzeros )
+{
+   return { m, n, double( nonzeros ), true, 0.0, 0.0 };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a small integral test value for the given indices.
+//
+// \param i The row index.
+// \param j The column index.
+// \param seed The seed of the test value.
+// \return The test value in the range \f$[-5..5]\f$.
+//
+// Due to the small integral values all computations are exact, independent of the order of
+// evaluation of the matrix product chain.
+*/
+double OperationTest::value( size_t i, size_t j, size_t seed )
+{
+   return double( static_cast<int>( ( i*7UL + j*3UL + seed*5UL ) % 11UL ) - 5 );
+}
+//*************************************************************************************************
+
+} // namespace matrixchain
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running matrix chain reordering operation test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXCHAIN_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during matrix chain reordering operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/SparseEncoding.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 #include <blaze/math/StaticVector.h>
@@ -65,9 +66,11 @@ namespace matrixserializer {
 // \exception std::runtime_error Operation error detected.
 */
 ClassTest::ClassTest()
+   : encoding_( blaze::plainEncoding )
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testDeltaEncoding();
    testFailures();
 }
 //*************************************************************************************************
@@ -317,6 +320,187 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serialization test with delta encoded sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs serialization tests with sparse matrices in the delta encoding,
+// including matrices with unit, binary, and few distinct values and matrices that consist
+// of several encoded blocks. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testDeltaEncoding()
+{
+   test_ = "Delta encoded matrices";
+
+   encoding_ = blaze::deltaEncoding;
+
+
+   //=====================================================================================
+   // Empty matrices
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src;
+
+      runDynamicMatrixTests   ( src );
+      runCompressedMatrixTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 5UL, 0UL );
+
+      runDynamicMatrixTests   ( src );
+      runCompressedMatrixTests( src );
+   }
+
+
+   //=====================================================================================
+   // Randomly initialized matrices
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runAllTests<7UL,13UL>( src );
+   }
+
+   {
+      blaze::CompressedMatrix<unsigned int,blaze::columnMajor> src( 7UL, 13UL );
+      randomize( src );
+      runAllTests<7UL,13UL>( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> src( 13UL, 7UL );
+      randomize( src );
+      runAllTests<13UL,7UL>( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::StaticVector<double,3UL>,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      runAllTests<13UL,7UL>( src );
+   }
+
+
+   //=====================================================================================
+   // Matrices with unit, binary, and few distinct values
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 13UL, 7UL );
+      for( size_t i=0UL; i<13UL; ++i ) {
+         for( size_t j=i%3UL; j<7UL; j+=3UL ) {
+            src(i,j) = 1.0;
+         }
+      }
+      runAllTests<13UL,7UL>( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 13UL, 7UL );
+      for( size_t j=0UL; j<7UL; ++j ) {
+         for( size_t i=j%2UL; i<13UL; i+=2UL ) {
+            src(i,j) = ( i+j ) % 3UL == 0UL ? 0 : 1;
+         }
+      }
+      runAllTests<13UL,7UL>( src );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::rowMajor> src( 13UL, 7UL );
+      for( size_t i=0UL; i<13UL; ++i ) {
+         for( size_t j=0UL; j<7UL; ++j ) {
+            src(i,j) = ( i*7UL+j ) % 5UL == 0UL ? -0.0F : 0.25F * ( ( i+j ) % 4UL );
+         }
+      }
+      runAllTests<13UL,7UL>( src );
+   }
+
+
+   //=====================================================================================
+   // Large matrices
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 3000UL, 1500UL, 500UL*3000UL );
+      for( size_t i=0UL; i<3000UL; ++i ) {
+         for( size_t j=i%7UL; j<1500UL; j+=( i%13UL )*( i%13UL )+3UL ) {
+            src.append( i, j, ( j%5UL == 0UL )?( 2.0 ):( blaze::rand<double>() ) );
+         }
+         src.finalize( i );
+      }
+
+      {
+         blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+         runTest( src, dst );
+      }
+
+      {
+         blaze::CompressedMatrix<double,blaze::columnMajor> dst;
+         runTest( src, dst );
+      }
+
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> dst;
+         runTest( src, dst );
+      }
+
+      {
+         const blaze::CompressedMatrix<double,blaze::columnMajor> tmp( src );
+         blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+         runTest( tmp, dst );
+      }
+   }
+
+
+   //=====================================================================================
+   // Size of the encoding
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<float,blaze::rowMajor> src( 500UL, 500UL, 500UL*500UL );
+      for( size_t i=0UL; i<500UL; ++i ) {
+         for( size_t j=0UL; j<500UL; j+=( i+j )%3UL+1UL ) {
+            src.append( i, j, 1.0F );
+         }
+         src.finalize( i );
+      }
+
+      std::stringstream plain, delta;
+
+      {
+         blaze::Archive<std::stringstream> archive( plain );
+         serialize( archive, src, blaze::plainEncoding );
+      }
+
+      {
+         blaze::Archive<std::stringstream> archive( delta );
+         serialize( archive, src, blaze::deltaEncoding );
+      }
+
+      const size_t plainSize( plain.str().size() );
+      const size_t deltaSize( delta.str().size() );
+
+      if( 10UL*deltaSize > plainSize ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient compression of delta encoded matrix\n"
+             << " Details:\n"
+             << "   Size of plain encoding: " << plainSize << "\n"
+             << "   Size of delta encoding: " << deltaSize << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   encoding_ = blaze::plainEncoding;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -422,6 +606,34 @@ void ClassTest::testFailures()
    }
    catch( std::runtime_error& )
    {}
+
+   try {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 5UL, 4UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> dst;
+
+      randomize( src, 12UL );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      serialize( archive, src, blaze::deltaEncoding );
+
+      std::string data( stream.str() );
+      data.resize( data.size() - 5UL );
+
+      std::stringstream truncated( data );
+      blaze::Archive<std::stringstream> archive2( truncated );
+      archive2 >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization of a truncated delta encoded matrix succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
 }
 //*************************************************************************************************
 
@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mixedprecision/OperationTest.cpp
+//  \brief Source file for the mixed precision operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/mixedprecision/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mixedprecision {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   //=====================================================================================
+   // Inner product tests
+   //=====================================================================================
+
+   testDot<float,double>();
+   testDot<double,float>();
+   testDot<blaze::bfloat16,float>();
+   testDot<float,blaze::float16>();
+   testDot<blaze::bfloat16,blaze::bfloat16>();
+   testDot<blaze::float16,blaze::bfloat16>();
+
+
+   //=====================================================================================
+   // Dense matrix/dense vector multiplication tests
+   //=====================================================================================
+
+   testDMatDVecMult <float,double>();
+   testDMatDVecMult <double,float>();
+   testTDMatDVecMult<float,double>();
+   testTDMatDVecMult<double,float>();
+   testTDMatDVecMult<float,float>();
+   testDMatDVecMult <blaze::bfloat16,float>();
+   testDMatDVecMult <blaze::float16,blaze::float16>();
+   testTDMatDVecMult<blaze::bfloat16,float>();
+   testTDMatDVecMult<blaze::float16,blaze::bfloat16>();
+   testTDMatDVecMult<blaze::bfloat16,blaze::bfloat16>();
+
+
+   //=====================================================================================
+   // Dense matrix/dense matrix multiplication tests
+   //=====================================================================================
+
+   testDMatDMatMult<blaze::bfloat16,blaze::bfloat16>();
+   testDMatDMatMult<blaze::float16,blaze::float16>();
+   testDMatDMatMult<blaze::bfloat16,float>();
+   testDMatDMatMult<float,blaze::float16>();
+   testDMatDMatMult<int8_t,int8_t>();
+   testDMatDMatMult<uint8_t,int8_t>();
+   testDMatDMatMult<int16_t,int16_t>();
+   testQuantizedDMatDMatMult<int8_t,int8_t>();
+   testQuantizedDMatDMatMult<int8_t,uint8_t>();
+   testQuantizedDMatDMatMult<int16_t,int8_t>();
+
+
+   //=====================================================================================
+   // Conversion tests
+   //=====================================================================================
+
+   testConversion<double,float>();
+   testConversion<float,double>();
+   testConversion<float,blaze::bfloat16>();
+   testConversion<blaze::bfloat16,float>();
+   testConversion<float,blaze::float16>();
+   testConversion<blaze::float16,float>();
+   testMatrixConversion<double,float>();
+   testMatrixConversion<float,blaze::bfloat16>();
+   testMatrixConversion<blaze::bfloat16,float>();
+   testMatrixConversion<blaze::float16,float>();
+}
+//*************************************************************************************************
+
+} // namespace mixedprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running mixed precision operation test..." << std::endl;
+
+   try
+   {
+      RUN_MIXEDPRECISION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during mixed precision operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
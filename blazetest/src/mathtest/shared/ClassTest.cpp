@@ -0,0 +1,339 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/shared/ClassTest.cpp
+//  \brief Source file for the shared-memory container class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <blazetest/mathtest/shared/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace shared {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the shared-memory container class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                                                          // Label of the currently performed test
+   , name_( "/blazetest_shared_" + std::to_string( ::getpid() ) )  // Name of the temporary segment
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testMatrix<rowMajor>();
+   testMatrix<columnMajor>();
+   testCompressed<rowMajor>();
+   testCompressed<columnMajor>();
+   testAnonymous();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the shared-memory container class test.
+//
+// The destructor removes the temporary shared memory segment in case it still exists.
+*/
+ClassTest::~ClassTest()
+{
+   blaze::SharedMemory::remove( name_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of anonymous shared memory segments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the creation of anonymous segments and the attachment via the inherited
+// file descriptor of the segment. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAnonymous()
+{
+   test_ = "Anonymous segments";
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> R( 6UL, 17UL );
+   blaze::randomize( R );
+
+   blaze::CompressedMatrix<float,blaze::columnMajor> C( 11UL, 4UL );
+   blaze::randomize( C, 12UL );
+
+   blaze::SharedMatrix<float,blaze::rowMajor> A( "", 6UL, 17UL, blaze::hugePages );
+   A = R;
+
+   const blaze::SharedCompressedMatrix<float,blaze::columnMajor> S( "", C );
+
+   checkValue( A.name().empty(), true, "Invalid segment name" );
+   checkValue( A.fd() >= 0, true, "Invalid file descriptor" );
+
+   {
+      const blaze::SharedMatrix<const float,blaze::rowMajor> B( A.fd() );
+      const blaze::SharedCompressedMatrix<float,blaze::columnMajor> T( S.fd() );
+
+      checkValue( B == R, true, "Invalid attached matrix" );
+      checkValue( T == C, true, "Invalid attached compressed matrix" );
+      checkValue( A.references(), size_t( 2UL ), "Invalid number of references" );
+      checkValue( S.references(), size_t( 2UL ), "Invalid number of references" );
+   }
+
+   const int fd1( A.fd() );
+   const int fd2( S.fd() );
+
+   checkChild( [&R,&C,fd1,fd2]() {
+      const blaze::SharedMatrix<const float,blaze::rowMajor> B( fd1 );
+      const blaze::SharedCompressedMatrix<float,blaze::columnMajor> T( fd2 );
+      return B == R && T == C && B.references() == 2UL;
+   }, "Invalid attachment from child process" );
+
+   checkValue( A.references(), size_t( 1UL ), "Invalid number of references" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the shared-memory containers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid and incompatible attachments are detected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExceptions()
+{
+   test_ = "Error handling";
+
+   blaze::SharedMatrix<double,blaze::rowMajor> A( name_, 4UL, 3UL );
+
+   // Creating an already existing segment
+   try {
+      blaze::SharedMatrix<double,blaze::rowMajor> B( name_, 4UL, 3UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Creating an already existing segment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+
+   // Read-only attachment of non-constant elements
+   try {
+      blaze::SharedMatrix<double,blaze::rowMajor> B( name_, blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Read-only attachment of non-constant elements succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attachment with a different element type
+   try {
+      blaze::SharedMatrix<float,blaze::rowMajor> B( name_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attachment with a different element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attachment with a different storage order
+   try {
+      blaze::SharedMatrix<double,blaze::columnMajor> B( name_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attachment with a different storage order succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attaching a dense segment as compressed matrix
+   try {
+      const blaze::SharedCompressedMatrix<double,blaze::rowMajor> S( name_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attaching a dense segment as compressed matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Checked access to a shared compressed matrix
+   try {
+      const blaze::SharedCompressedMatrix<double,blaze::rowMajor> S( "", blaze::CompressedMatrix<double>( 2UL, 2UL ) );
+      S.at( 2UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   // Attachment with an overflowing segment size
+   try {
+      {
+         blaze::SharedMemory segment( name_, blaze::readWrite );
+
+         blaze::MappedHeader header;
+         std::memcpy( &header, segment.data(), sizeof( header ) );
+         header.rows    = 1UL << 62;
+         header.spacing = 8UL;
+         std::memcpy( segment.data(), &header, sizeof( header ) );
+      }
+
+      blaze::SharedMatrix<double,blaze::rowMajor> B( name_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attachment with an overflowing segment size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Attachment with invalid indices of the non-zero elements
+   {
+      using Element = blaze::ValueIndexPair<double>;
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> C( 2UL, 3UL );
+      C(0,0) = 1.0;
+      C(0,2) = 2.0;
+      C(1,1) = 3.0;
+
+      const std::string name( name_ + "_compressed" );
+      const blaze::SharedCompressedMatrix<double,blaze::rowMajor> S( name, C );
+
+      const size_t offset( blaze::nextMultiple<size_t>( sizeof( blaze::MappedHeader ) + 3UL*sizeof( uint64_t ), 64UL )
+                         + sizeof( Element ) );
+
+      for( size_t index : { 3UL, 0UL } )
+      {
+         {
+            blaze::SharedMemory segment( name, blaze::readWrite );
+            const Element element( 2.0, index );
+            std::memcpy( segment.data() + offset, &element, sizeof( element ) );
+         }
+
+         try {
+            const blaze::SharedCompressedMatrix<double,blaze::rowMajor> T( name );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Attachment with invalid index " << index << " succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+   // Attaching to a non-existing segment
+   try {
+      const blaze::SharedMatrix<const double,blaze::rowMajor> B( name_ + "_missing" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Attaching to a non-existing segment succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace shared
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SharedMatrix/SharedCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SHARED_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SharedMatrix/SharedCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,430 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/OperationTest.cpp
+//  \brief Source file for the iterative solver operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Conjugate gradient tests
+   //=====================================================================================
+
+   testCG< blaze::CompressedMatrix<double,rowMajor> >();
+   testCG< blaze::CompressedMatrix<double,columnMajor> >();
+   testCG< blaze::DynamicMatrix<double,rowMajor> >();
+   testCG< blaze::SymmetricMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testCG< blaze::SymmetricMatrix< blaze::DynamicMatrix<double,columnMajor> > >();
+
+
+   //=====================================================================================
+   // BiCGSTAB tests
+   //=====================================================================================
+
+   testBiCGSTAB< blaze::CompressedMatrix<double,rowMajor> >();
+   testBiCGSTAB< blaze::CompressedMatrix<double,columnMajor> >();
+   testBiCGSTAB< blaze::DynamicMatrix<double,rowMajor> >();
+   testBiCGSTAB< blaze::DynamicMatrix<double,columnMajor> >();
+
+
+   //=====================================================================================
+   // GMRES tests
+   //=====================================================================================
+
+   testGMRES< blaze::CompressedMatrix<double,rowMajor> >();
+   testGMRES< blaze::CompressedMatrix<double,columnMajor> >();
+   testGMRES< blaze::DynamicMatrix<double,rowMajor> >();
+   testGMRES< blaze::DynamicMatrix<double,columnMajor> >();
+
+
+   //=====================================================================================
+   // Miscellaneous tests
+   //=====================================================================================
+
+   testILU0();
+   testLargeSystem();
+   testInitialGuess();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ILU(0) preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ILU(0) decomposition of a tridiagonal matrix. Since the
+// LU decomposition of a tridiagonal matrix doesn't cause any fill-in, the ILU(0) decomposition
+// is exact and the preconditioned solvers have to converge within a single iteration. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testILU0()
+{
+   test_ = "ILU(0) preconditioner";
+
+   const size_t N( 50UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( N, N );
+   blaze::DynamicVector<double,blaze::columnVector> b( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( i > 0UL ) A(i,i-1UL) = -1.0;
+      A(i,i) = 3.0;
+      if( i < N-1UL ) A(i,i+1UL) = -1.5;
+      b[i] = double( i%4UL ) - 1.0;
+   }
+
+   const blaze::ILU0Preconditioner<double> M( A );
+
+   // Checking the factors
+   {
+      const blaze::CompressedMatrix<double,blaze::rowMajor>& LU( M.factors() );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> L( N, N, 0.0 ), U( N, N, 0.0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         for( auto element=LU.begin(i); element!=LU.end(i); ++element ) {
+            if( element->index() < i ) L(i,element->index()) = element->value();
+            else                       U(i,element->index()) = element->value();
+         }
+         L(i,i) = 1.0;
+      }
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> LxU( L * U );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            if( std::abs( LxU(i,j) - A(i,j) ) > 1E-12 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid ILU(0) factors\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << ") of L*U = " << LxU(i,j) << "\n"
+                   << "   Expected value = " << A(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   // Solving with the exact preconditioner
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, M ) );
+      checkSolution( A, x, b, result, "BiCGSTAB (ILU(0))" );
+
+      if( result.iterations != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of iterations\n"
+             << " Details:\n"
+             << "   Iterations: " << result.iterations << "\n"
+             << "   Expected iterations: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::gmres( A, x, b, M ) );
+      checkSolution( A, x, b, result, "GMRES (ILU(0))" );
+
+      if( result.iterations != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of iterations\n"
+             << " Details:\n"
+             << "   Iterations: " << result.iterations << "\n"
+             << "   Expected iterations: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the iterative solvers for a large linear system.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solvers for a linear system that exceeds the thresholds
+// for the shared memory parallelization of the fused kernels. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLargeSystem()
+{
+   test_ = "Large linear system";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   laplace( A, 200UL, true );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( A.rows() );
+   for( size_t i=0UL; i<b.size(); ++i ) {
+      b[i] = double( i%11UL ) - 5.0;
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::cg( A, x, b ) );
+      checkSolution( A, x, b, result, "CG" );
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, blaze::ILU0Preconditioner<double>( A ) ) );
+      checkSolution( A, x, b, result, "BiCGSTAB (ILU(0))" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of the initial guess and the termination criteria.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solvers don't perform any iteration in case the initial guess
+// already solves the system or the right-hand side is zero, and that the maximum number of
+// iterations is respected. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testInitialGuess()
+{
+   test_ = "Initial guess and termination criteria";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   laplace( A, 9UL, true );
+
+   blaze::DynamicVector<double,blaze::columnVector> x( A.rows() ), b;
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = double( i%3UL );
+   }
+   b = A * x;
+
+   // Exact initial guess
+   {
+      const blaze::SolverResult result( blaze::cg( A, x, b ) );
+
+      if( result.iterations != 0UL || !result.converged ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration with exact initial guess\n"
+             << " Details:\n"
+             << "   Iterations: " << result.iterations << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Zero right-hand side
+   {
+      blaze::DynamicVector<double,blaze::columnVector> y( A.rows(), 1.0 ), zero( A.rows(), 0.0 );
+      const blaze::SolverResult result( blaze::gmres( A, y, zero ) );
+
+      if( result.iterations != 0UL || !result.converged || y != zero ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution for zero right-hand side\n"
+             << " Details:\n"
+             << "   Iterations: " << result.iterations << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Maximum number of iterations
+   {
+      blaze::SolverSettings settings;
+      settings.maxIterations = 3UL;
+      settings.tolerance     = 0.0;
+
+      blaze::DynamicVector<double,blaze::columnVector> y;
+      const blaze::SolverResult result( blaze::bicgstab( A, y, b, settings ) );
+
+      if( result.iterations != 3UL || result.converged || y.size() != A.rows() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Maximum number of iterations not respected\n"
+             << " Details:\n"
+             << "   Iterations: " << result.iterations << "\n"
+             << "   Expected iterations: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the iterative solvers and preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid system matrices and vector sizes are rejected by means of
+// a \a std::invalid_argument exception. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testExceptions()
+{
+   test_ = "Error handling";
+
+   // Non-square system matrix
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 3UL, 4UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 3UL, 1.0 );
+      blaze::cg( A, x, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with non-square matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Invalid right-hand side
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 3UL, 3UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 4UL, 1.0 );
+      blaze::gmres( A, x, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with invalid right-hand side succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Missing diagonal element
+   try {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,0) = 1.0;
+      A(1,2) = 1.0;
+      A(2,2) = 1.0;
+      const blaze::ILU0Preconditioner<double> M( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: ILU(0) decomposition with missing diagonal element succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Zero diagonal element
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 3UL, 3UL, 1.0 );
+      A(1,1) = 0.0;
+      const blaze::JacobiPreconditioner<double> M( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Jacobi preconditioner with zero diagonal element succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running iterative solver operation test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during iterative solver operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,463 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/TriangularTest.cpp
+//  \brief Source file for the sparse triangular solve test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/TriangularTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TriangularTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TriangularTest::TriangularTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Single right-hand side tests
+   //=====================================================================================
+
+   testVector< blaze::LowerMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testVector< blaze::LowerMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+   testVector< blaze::UpperMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testVector< blaze::UpperMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+   testVector< blaze::UniLowerMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testVector< blaze::UniLowerMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+   testVector< blaze::UniUpperMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testVector< blaze::UniUpperMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+
+
+   //=====================================================================================
+   // Multiple right-hand side tests
+   //=====================================================================================
+
+   testMatrix< blaze::LowerMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testMatrix< blaze::LowerMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+   testMatrix< blaze::UpperMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testMatrix< blaze::UpperMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+   testMatrix< blaze::UniLowerMatrix< blaze::CompressedMatrix<double,rowMajor> > >();
+   testMatrix< blaze::UniUpperMatrix< blaze::CompressedMatrix<double,columnMajor> > >();
+
+
+   //=====================================================================================
+   // Miscellaneous tests
+   //=====================================================================================
+
+   testLevels();
+   testLargeSystem();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the level analysis of sparse triangular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the number of levels computed for a diagonal, a bidiagonal, and a lower
+// triangular matrix whose rows only depend on the row two above, as well as the matching of a
+// level schedule with a system matrix (including matrices whose pattern differs in a single
+// element). In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void TriangularTest::testLevels()
+{
+   test_ = "Level analysis";
+
+   const size_t N( 10UL );
+
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > D( N ), L( N ), S( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      D(i,i) = 2.0;
+      L(i,i) = 2.0;
+      S(i,i) = 2.0;
+      if( i > 0UL ) L(i,i-1UL) = 1.0;
+      if( i > 1UL ) S(i,i-2UL) = 1.0;
+   }
+
+   // Diagonal matrix
+   {
+      const blaze::LevelSchedule schedule( D );
+
+      if( schedule.levels() != 1UL || schedule.levelSize( 0UL ) != N ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels of a diagonal matrix\n"
+             << " Details:\n"
+             << "   Number of levels: " << schedule.levels() << "\n"
+             << "   Expected number of levels: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Bidiagonal matrix
+   {
+      const blaze::LevelSchedule schedule( L );
+
+      if( schedule.levels() != N || schedule.size() != N || schedule.nonZeros() != 2UL*N-1UL ||
+          !schedule.isLower() || !schedule.isRowMajor() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels of a bidiagonal matrix\n"
+             << " Details:\n"
+             << "   Number of levels: " << schedule.levels() << "\n"
+             << "   Expected number of levels: " << N << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Matrix with two independent chains of rows
+   {
+      const blaze::LevelSchedule schedule( S );
+
+      if( schedule.levels() != N/2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid levels of a matrix with two independent chains\n"
+             << " Details:\n"
+             << "   Number of levels: " << schedule.levels() << "\n"
+             << "   Expected number of levels: " << N/2UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t l=0UL; l<schedule.levels(); ++l ) {
+         if( schedule.levelSize( l ) != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid level size\n"
+                << " Details:\n"
+                << "   Level: " << l << "\n"
+                << "   Level size: " << schedule.levelSize( l ) << "\n"
+                << "   Expected level size: 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Matching of the level schedule
+   {
+      const blaze::LevelSchedule schedule( L );
+      const blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > C( L );
+
+      if( !schedule.matches( L ) || schedule.matches( D ) || schedule.matches( C ) ||
+          !blaze::LevelSchedule( C ).matches( C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matching of a level schedule\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Matching of the level schedule with a matrix of the same size and number of non-zeros
+   // (the sparsity pattern is only compared in case user assertions are activated)
+#if BLAZE_USER_ASSERTION
+   {
+      const blaze::LevelSchedule schedule( L );
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > P( L ), Q( L );
+      P.erase( N-1UL, N-2UL );
+      P(N-1UL,0UL) = 1.0;
+      Q.erase( N-1UL, N-2UL );
+      Q(N-2UL,0UL) = 1.0;
+
+      if( schedule.matches( P ) || schedule.matches( Q ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level schedule matches a different sparsity pattern\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular solve for large linear systems.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse triangular solve for systems whose levels exceed
+// the threshold for the parallel substitution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void TriangularTest::testLargeSystem()
+{
+   test_ = "Large sparse triangular system";
+
+   // Lower triangular part of a 2D five-point stencil with multiple right-hand sides
+   {
+      const size_t N( 150UL );
+      const size_t NN( N*N );
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( NN );
+      A.reserve( 3UL*NN );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            const size_t row( i*N+j );
+            if( i > 0UL ) A.append( row, row-N  , -1.0 );
+            if( j > 0UL ) A.append( row, row-1UL, -1.0 );
+            A.append( row, row, 4.0 );
+            A.finalize( row );
+         }
+      }
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> B( NN, 32UL );
+      for( size_t i=0UL; i<NN; ++i ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            B(i,j) = double( ( i+j )%11UL ) - 5.0;
+         }
+      }
+
+      const blaze::LevelSchedule schedule( A );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X;
+      blaze::solve( A, X, B, schedule );
+      checkSolution( A, X, B, "Five-point stencil" );
+   }
+
+   // Upper triangular matrix with two wide levels and a single right-hand side
+   {
+      const size_t N( 20000UL );
+      const size_t M( 100UL );
+
+      blaze::UpperMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > A( N );
+      A.reserve( 3UL*N );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         if( j >= N-M && j > 0UL ) {
+            for( size_t i=j%M; i<j; i+=M ) {
+               A.append( i, j, -0.5 );
+            }
+         }
+         A.append( j, j, 2.0 );
+         A.finalize( j );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> b( N );
+      for( size_t i=0UL; i<N; ++i ) {
+         b[i] = double( i%7UL ) - 3.0;
+      }
+
+      const blaze::LevelSchedule schedule( A );
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      blaze::solve( A, x, b, schedule );
+      checkSolution( A, x, b, "Wide levels" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse triangular solve.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid right-hand sides and level schedules are rejected by means
+// of a \a std::invalid_argument exception and that singular system matrices are detected. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TriangularTest::testExceptions()
+{
+   test_ = "Error handling";
+
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( 3UL );
+   A(0,0) = 1.0;
+   A(1,1) = 2.0;
+   A(2,1) = 1.0;
+   A(2,2) = 3.0;
+
+   // Invalid right-hand side vector
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 4UL, 1.0 );
+      blaze::solve( A, x, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with invalid right-hand side vector succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Invalid right-hand side matrix
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> X, B( 4UL, 2UL, 1.0 );
+      blaze::solve( A, X, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with invalid right-hand side matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Level schedule of a different matrix
+   try {
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > D( 3UL );
+      D(0,0) = 1.0;
+      D(1,1) = 1.0;
+      D(2,2) = 1.0;
+
+      const blaze::LevelSchedule schedule( D );
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 3UL, 1.0 );
+      blaze::solve( A, x, b, schedule );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with non-matching level schedule succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Level schedule of a matrix with a different sparsity pattern
+   // (the sparsity pattern is only compared in case user assertions are activated)
+#if BLAZE_USER_ASSERTION
+   try {
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > P( 3UL ), Q( 3UL );
+      P(0,0) = 1.0;
+      P(1,0) = 1.0;
+      P(1,1) = 2.0;
+      P(2,2) = 3.0;
+      Q(0,0) = 1.0;
+      Q(2,0) = 1.0;
+      Q(1,1) = 2.0;
+      Q(2,2) = 3.0;
+
+      const blaze::LevelSchedule schedule( P );
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 3UL, 1.0 );
+      blaze::solve( Q, x, b, schedule );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving with level schedule of a different sparsity pattern succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+#endif
+
+   // Singular system matrix
+   {
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > S( A );
+      S(1,1) = 0.0;
+
+      blaze::DynamicVector<double,blaze::columnVector> x, b( 3UL, 1.0 );
+      bool detected( false );
+
+      try {
+         blaze::solve( S, x, b );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse triangular solve test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_TRIANGULAR_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse triangular solve test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -43,6 +43,7 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/NoAlias.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blazetest/mathtest/submatrix/DenseUnalignedTest.h>
@@ -590,6 +591,74 @@ void DenseUnalignedTest::testAssignment()
       }
    }
 
+   {
+      test_ = "Row-major Submatrix assignment (disjoint submatrices)";
+
+      initialize();
+
+      SMT sm = blaze::submatrix( mat_, 0UL, 0UL, 2UL, 2UL );
+      sm = blaze::submatrix( mat_, 3UL, 2UL, 2UL, 2UL ) * blaze::submatrix( mat_, 3UL, 0UL, 2UL, 2UL );
+
+      checkRows    ( sm  ,  2UL );
+      checkColumns ( sm  ,  2UL );
+      checkNonZeros( sm  ,  4UL );
+      checkRows    ( mat_,  5UL );
+      checkColumns ( mat_,  4UL );
+      checkNonZeros( mat_, 13UL );
+
+      if( mat_(0,0) != -42 || mat_(0,1) !=  68 || mat_(0,2) !=  0 || mat_(0,3) !=  0 ||
+          mat_(1,0) !=  70 || mat_(1,1) != -44 || mat_(1,2) !=  0 || mat_(1,3) !=  0 ||
+          mat_(2,0) !=  -2 || mat_(2,1) !=   0 || mat_(2,2) != -3 || mat_(2,3) !=  0 ||
+          mat_(3,0) !=   0 || mat_(3,1) !=   4 || mat_(3,2) !=  5 || mat_(3,3) != -6 ||
+          mat_(4,0) !=   7 || mat_(4,1) !=  -8 || mat_(4,2) !=  9 || mat_(4,3) != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat_ << "\n"
+             << "   Expected result:\n( -42  68   0   0 )\n"
+                                     "(  70 -44   0   0 )\n"
+                                     "(  -2   0  -3   0 )\n"
+                                     "(   0   4   5  -6 )\n"
+                                     "(   7  -8   9  10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major Submatrix assignment (noalias)";
+
+      initialize();
+
+      SMT sm = blaze::submatrix( mat_, 0UL, 0UL, 2UL, 2UL );
+      noalias( sm ) = blaze::submatrix( mat_, 3UL, 2UL, 2UL, 2UL ) * blaze::submatrix( mat_, 3UL, 0UL, 2UL, 2UL );
+
+      checkRows    ( sm  ,  2UL );
+      checkColumns ( sm  ,  2UL );
+      checkNonZeros( sm  ,  4UL );
+      checkRows    ( mat_,  5UL );
+      checkColumns ( mat_,  4UL );
+      checkNonZeros( mat_, 13UL );
+
+      if( mat_(0,0) != -42 || mat_(0,1) !=  68 || mat_(0,2) !=  0 || mat_(0,3) !=  0 ||
+          mat_(1,0) !=  70 || mat_(1,1) != -44 || mat_(1,2) !=  0 || mat_(1,3) !=  0 ||
+          mat_(2,0) !=  -2 || mat_(2,1) !=   0 || mat_(2,2) != -3 || mat_(2,3) !=  0 ||
+          mat_(3,0) !=   0 || mat_(3,1) !=   4 || mat_(3,2) !=  5 || mat_(3,3) != -6 ||
+          mat_(4,0) !=   7 || mat_(4,1) !=  -8 || mat_(4,2) !=  9 || mat_(4,3) != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat_ << "\n"
+             << "   Expected result:\n( -42  68   0   0 )\n"
+                                     "(  70 -44   0   0 )\n"
+                                     "(  -2   0  -3   0 )\n"
+                                     "(   0   4   5  -6 )\n"
+                                     "(   7  -8   9  10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Row-major dense matrix assignment
@@ -1308,6 +1377,70 @@ void DenseUnalignedTest::testAssignment()
       }
    }
 
+   {
+      test_ = "Column-major Submatrix assignment (disjoint submatrices)";
+
+      initialize();
+
+      OSMT sm = blaze::submatrix( tmat_, 0UL, 0UL, 2UL, 2UL );
+      sm = blaze::submatrix( tmat_, 2UL, 3UL, 2UL, 2UL ) * blaze::submatrix( tmat_, 0UL, 3UL, 2UL, 2UL );
+
+      checkRows    ( sm   ,  2UL );
+      checkColumns ( sm   ,  2UL );
+      checkNonZeros( sm   ,  4UL );
+      checkRows    ( tmat_,  4UL );
+      checkColumns ( tmat_,  5UL );
+      checkNonZeros( tmat_, 13UL );
+
+      if( tmat_(0,0) != 36 || tmat_(0,1) !=  -37 || tmat_(0,2) != -2 || tmat_(0,3) !=  0 || tmat_(0,4) !=  7 ||
+          tmat_(1,0) != 40 || tmat_(1,1) != -122 || tmat_(1,2) !=  0 || tmat_(1,3) !=  4 || tmat_(1,4) != -8 ||
+          tmat_(2,0) !=  0 || tmat_(2,1) !=    0 || tmat_(2,2) != -3 || tmat_(2,3) !=  5 || tmat_(2,4) !=  9 ||
+          tmat_(3,0) !=  0 || tmat_(3,1) !=    0 || tmat_(3,2) !=  0 || tmat_(3,3) != -6 || tmat_(3,4) != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tmat_ << "\n"
+             << "   Expected result:\n( 36   -37  -2   0   7 )\n"
+                                     "( 40  -122   0   4  -8 )\n"
+                                     "(  0     0  -3   5   9 )\n"
+                                     "(  0     0   0  -6  10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major Submatrix assignment (noalias)";
+
+      initialize();
+
+      OSMT sm = blaze::submatrix( tmat_, 0UL, 0UL, 2UL, 2UL );
+      noalias( sm ) = blaze::submatrix( tmat_, 2UL, 3UL, 2UL, 2UL ) * blaze::submatrix( tmat_, 0UL, 3UL, 2UL, 2UL );
+
+      checkRows    ( sm   ,  2UL );
+      checkColumns ( sm   ,  2UL );
+      checkNonZeros( sm   ,  4UL );
+      checkRows    ( tmat_,  4UL );
+      checkColumns ( tmat_,  5UL );
+      checkNonZeros( tmat_, 13UL );
+
+      if( tmat_(0,0) != 36 || tmat_(0,1) !=  -37 || tmat_(0,2) != -2 || tmat_(0,3) !=  0 || tmat_(0,4) !=  7 ||
+          tmat_(1,0) != 40 || tmat_(1,1) != -122 || tmat_(1,2) !=  0 || tmat_(1,3) !=  4 || tmat_(1,4) != -8 ||
+          tmat_(2,0) !=  0 || tmat_(2,1) !=    0 || tmat_(2,2) != -3 || tmat_(2,3) !=  5 || tmat_(2,4) !=  9 ||
+          tmat_(3,0) !=  0 || tmat_(3,1) !=    0 || tmat_(3,2) !=  0 || tmat_(3,3) != -6 || tmat_(3,4) != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tmat_ << "\n"
+             << "   Expected result:\n( 36   -37  -2   0   7 )\n"
+                                     "( 40  -122   0   4  -8 )\n"
+                                     "(  0     0  -3   5   9 )\n"
+                                     "(  0     0   0  -6  10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major dense matrix assignment
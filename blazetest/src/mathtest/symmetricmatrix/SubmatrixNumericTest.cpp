@@ -65,21 +65,25 @@ SubmatrixNumericTest::SubmatrixNumericTest()
    testAddAssign<DST>();
    testSubAssign<DST>();
    testSchurAssign<DST>();
+   testAliasing<DST>();
 
    testAssignment<DOST>();
    testAddAssign<DOST>();
    testSubAssign<DOST>();
    testSchurAssign<DOST>();
+   testAliasing<DOST>();
 
    testAssignment<SST>();
    testAddAssign<SST>();
    testSubAssign<SST>();
    testSchurAssign<SST>();
+   testAliasing<SST>();
 
    testAssignment<SOST>();
    testAddAssign<SOST>();
    testSubAssign<SOST>();
    testSchurAssign<SOST>();
+   testAliasing<SOST>();
 }
 //*************************************************************************************************
 